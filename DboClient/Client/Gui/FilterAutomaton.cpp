@@ -0,0 +1,255 @@
+#include "precomp_dboclient.h"
+#include "FilterAutomaton.h"
+
+#include <algorithm>
+
+
+CFilterAutomaton::CFilterAutomaton()
+{
+	Clear();
+}
+
+CFilterAutomaton::~CFilterAutomaton()
+{
+}
+
+void CFilterAutomaton::Clear()
+{
+	m_vecBuild.clear();
+
+	// root
+	m_vecBuild.push_back( SBuildNode() );
+	m_vecBuild.back().nLink		= -1;
+	m_vecBuild.back().wDepth	= 0;
+	m_vecBuild.back().bEndText	= false;
+
+	m_vecEdgeBegin.clear();
+	m_vecEdgeChar.clear();
+	m_vecEdgeNext.clear();
+	m_vecFail.clear();
+	m_vecOutput.clear();
+	m_vecDepth.clear();
+	m_vecLink.clear();
+
+	m_nNumWord = 0;
+}
+
+wchar_t CFilterAutomaton::FoldChar(wchar_t wch)
+{
+	//   (  ~  )  ݰ
+	if( wch >= 0xFF01 && wch <= 0xFF5E )
+		wch = (wchar_t)( wch - 0xFEE0 );
+	else if( wch == 0x3000 )
+		wch = L' ';
+
+	if( wch >= L'A' && wch <= L'Z' )
+		wch = (wchar_t)( wch + (L'a' - L'A') );
+
+	return wch;
+}
+
+void CFilterAutomaton::AddText(const wchar_t* pText, int nSize, int nLink)
+{
+	if( m_vecBuild.empty() )
+	{
+		DBO_FAIL("CFilterAutomaton: AddText after Build, call Clear first");
+		return;
+	}
+
+	UINT uiNode = 0;
+	int nPos;
+	for( nPos = 0; nPos < nSize && pText[nPos] != NULL; ++nPos )
+	{
+		wchar_t wch = FoldChar( pText[nPos] );
+
+		std::map<wchar_t, UINT>::iterator it = m_vecBuild[uiNode].mapNext.find( wch );
+		if( it != m_vecBuild[uiNode].mapNext.end() )
+		{
+			uiNode = it->second;
+			continue;
+		}
+
+		UINT uiNew = (UINT)m_vecBuild.size();
+		m_vecBuild[uiNode].mapNext[wch] = uiNew;
+
+		m_vecBuild.push_back( SBuildNode() );
+		m_vecBuild.back().nLink		= -1;
+		m_vecBuild.back().wDepth	= (USHORT)( nPos + 1 );
+		m_vecBuild.back().bEndText	= false;
+
+		uiNode = uiNew;
+	}
+
+	//  ܾ  ʴ´
+	if( uiNode == 0 )
+		return;
+
+	if( !m_vecBuild[uiNode].bEndText )
+		++m_nNumWord;
+
+	m_vecBuild[uiNode].bEndText	= true;
+	m_vecBuild[uiNode].nLink	= nLink;
+}
+
+void CFilterAutomaton::Build()
+{
+	if( m_vecBuild.empty() )
+		return;
+
+	UINT uiNumState = (UINT)m_vecBuild.size();
+
+	// 1. bfs  state ȣ ٽ ű edge  flat 迭 ű.
+	//    map   ̹Ƿ state  edge  ĵǾ ִ.
+	std::vector<UINT> vecOrder;			// state -> build node
+	std::vector<UINT> vecState;			// build node -> state
+	vecOrder.reserve( uiNumState );
+	vecState.resize( uiNumState );
+
+	vecOrder.push_back( 0 );
+	vecState[0] = 0;
+
+	for( UINT i = 0; i < vecOrder.size(); ++i )
+	{
+		SBuildNode& sNode = m_vecBuild[vecOrder[i]];
+		for( std::map<wchar_t, UINT>::iterator it = sNode.mapNext.begin(); it != sNode.mapNext.end(); ++it )
+		{
+			vecState[it->second] = (UINT)vecOrder.size();
+			vecOrder.push_back( it->second );
+		}
+	}
+
+	m_vecEdgeBegin.resize( uiNumState + 1 );
+	m_vecEdgeChar.resize( uiNumState - 1 );
+	m_vecEdgeNext.resize( uiNumState - 1 );
+	m_vecDepth.resize( uiNumState );
+	m_vecLink.resize( uiNumState );
+
+	UINT uiEdge = 0;
+	for( UINT uiState = 0; uiState < uiNumState; ++uiState )
+	{
+		SBuildNode& sNode = m_vecBuild[vecOrder[uiState]];
+
+		m_vecEdgeBegin[uiState]	= uiEdge;
+		m_vecDepth[uiState]		= sNode.wDepth;
+		m_vecLink[uiState]		= sNode.nLink;
+
+		for( std::map<wchar_t, UINT>::iterator it = sNode.mapNext.begin(); it != sNode.mapNext.end(); ++it )
+		{
+			m_vecEdgeChar[uiEdge] = it->first;
+			m_vecEdgeNext[uiEdge] = vecState[it->second];
+			++uiEdge;
+		}
+	}
+	m_vecEdgeBegin[uiNumState] = uiEdge;
+
+	// 2. fail link  output link. θ ڽĺ  óǰ,
+	//    fail     state ̹Ƿ ̹ Ǿ ִ.
+	m_vecFail.assign( uiNumState, 0 );
+	m_vecOutput.assign( uiNumState, INVALID_STATE );
+
+	for( UINT uiState = 0; uiState < uiNumState; ++uiState )
+	{
+		for( UINT e = m_vecEdgeBegin[uiState]; e < m_vecEdgeBegin[uiState + 1]; ++e )
+		{
+			UINT uiChild = m_vecEdgeNext[e];
+
+			m_vecFail[uiChild] = ( uiState == 0 ) ? 0 : Goto( m_vecFail[uiState], m_vecEdgeChar[e] );
+
+			if( m_vecBuild[vecOrder[uiChild]].bEndText )
+				m_vecOutput[uiChild] = uiChild;
+			else
+				m_vecOutput[uiChild] = m_vecOutput[m_vecFail[uiChild]];
+		}
+	}
+
+	// Ͽ trie  
+	std::vector<SBuildNode>().swap( m_vecBuild );
+}
+
+UINT CFilterAutomaton::FindEdge(UINT uiState, wchar_t wch) const
+{
+	const wchar_t* pBegin	= &m_vecEdgeChar[0] + m_vecEdgeBegin[uiState];
+	const wchar_t* pEnd		= &m_vecEdgeChar[0] + m_vecEdgeBegin[uiState + 1];
+
+	const wchar_t* pFind = std::lower_bound( pBegin, pEnd, wch );
+	if( pFind == pEnd || *pFind != wch )
+		return INVALID_STATE;
+
+	return m_vecEdgeNext[pFind - &m_vecEdgeChar[0]];
+}
+
+UINT CFilterAutomaton::Goto(UINT uiState, wchar_t wch) const
+{
+	for( ;; )
+	{
+		UINT uiNext = FindEdge( uiState, wch );
+		if( uiNext != INVALID_STATE )
+			return uiNext;
+
+		if( uiState == 0 )
+			return 0;
+
+		uiState = m_vecFail[uiState];
+	}
+}
+
+int CFilterAutomaton::FindText(const wchar_t* pText, int nSize, MATCHVEC& vecResult) const
+{
+	if( m_vecEdgeChar.empty() || nSize <= 0 )
+		return 0;
+
+	//  ġ   ܾ  state.  ġ θ Ƿ ߿ ã   .
+	std::vector<UINT> vecLongest( nSize, INVALID_STATE );
+	std::vector<int> vecEnd( nSize );
+
+	UINT uiState = 0;
+	for( int i = 0; i < nSize; ++i )
+	{
+		uiState = Goto( uiState, FoldChar( pText[i] ) );
+
+		for( UINT uiOut = m_vecOutput[uiState]; uiOut != INVALID_STATE; uiOut = m_vecOutput[m_vecFail[uiOut]] )
+		{
+			int nStart = i - m_vecDepth[uiOut] + 1;
+
+			vecLongest[nStart]	= uiOut;
+			vecEnd[nStart]		= i;
+		}
+	}
+
+	// տ ġ ʰ 
+	int nResult = 0;
+	for( int i = 0; i < nSize; ++i )
+	{
+		if( vecLongest[i] == INVALID_STATE )
+			continue;
+
+		SMatch sMatch;
+		sMatch.uPosStart	= i;
+		sMatch.uPosEnd		= vecEnd[i];
+		sMatch.nLink		= m_vecLink[vecLongest[i]];
+
+		vecResult.push_back( sMatch );
+		++nResult;
+
+		i = vecEnd[i];
+	}
+
+	return nResult;
+}
+
+bool CFilterAutomaton::IsMatch(const wchar_t* pText, int nSize) const
+{
+	if( m_vecEdgeChar.empty() )
+		return false;
+
+	UINT uiState = 0;
+	for( int i = 0; i < nSize; ++i )
+	{
+		uiState = Goto( uiState, FoldChar( pText[i] ) );
+
+		if( m_vecOutput[uiState] != INVALID_STATE )
+			return true;
+	}
+
+	return false;
+}
@@ -0,0 +1,96 @@
+/*****************************************************************************
+*
+* File			: FilterAutomaton.h
+* Copyright		: ()NTL
+* Date			: 2026. 10. 17
+* Abstract		: Aho-Corasick automaton for the say filter
+*****************************************************************************
+* Desc			:
+*
+* CFilterWord  trie  ڸ ó ٽ match ϹǷ (   x ܾ  )
+* ŭ map  ã´.  automaton  ܾ    Build  fail link  
+* state  edge     flat 迭 ٲپ,  ѹ ȴ´.
+*
+*  CFilterWord::FindText  . ( տ,   ܾ, ġ  )
+* ,  ҹڿ /ݰ ڴ  ڷ . ( FoldChar )
+*  ϳ  ϳ ٲٹǷ  ġ   ġ̴.
+*****************************************************************************/
+
+#ifndef _FILTER_AUTOMATON_H_
+#define _FILTER_AUTOMATON_H_
+
+#pragma once
+
+#include <vector>
+#include <map>
+
+
+class CFilterAutomaton
+{
+public:
+	struct SMatch
+	{
+		UINT	uPosStart;
+		UINT	uPosEnd;				///<   ġ (  )
+		int		nLink;
+	};
+
+	typedef std::vector<SMatch>		MATCHVEC;
+
+public:
+	CFilterAutomaton();
+	~CFilterAutomaton();
+
+	void			Clear();
+
+	/**
+	* ܾ Ѵ.  ܾ ٽ ϵǸ   link  .
+	*  ڿ Build  ҷ ˻ ݿȴ. Build  Ͽ trie  Ƿ
+	* ܾ ٽ Ϸ Clear  Ѵ.
+	*/
+	void			AddText(const wchar_t* pText, int nSize, int nLink);
+	void			Build();
+
+	int				GetNumFilter() const	{ return m_nNumWord; }
+
+	int				FindText(const wchar_t* pText, int nSize, MATCHVEC& vecResult) const;
+
+	/**
+	* ܾ ϳ ִ. ó ã  .
+	*/
+	bool			IsMatch(const wchar_t* pText, int nSize) const;
+
+	static wchar_t	FoldChar(wchar_t wch);
+
+protected:
+	enum { INVALID_STATE = 0xffffffff };
+
+	struct SBuildNode
+	{
+		std::map<wchar_t, UINT>	mapNext;
+		int						nLink;
+		USHORT					wDepth;
+		bool					bEndText;
+	};
+
+	UINT			Goto(UINT uiState, wchar_t wch) const;
+	UINT			FindEdge(UINT uiState, wchar_t wch) const;
+
+protected:
+	// Build   trie
+	std::vector<SBuildNode>	m_vecBuild;
+
+	// Build . state 0  root ̰ state  bfs ̴.
+	std::vector<UINT>		m_vecEdgeBegin;			///< state  ù edge, state  + 1 
+	std::vector<wchar_t>	m_vecEdgeChar;			///< state ȿ   
+	std::vector<UINT>		m_vecEdgeNext;
+
+	std::vector<UINT>		m_vecFail;
+	std::vector<UINT>		m_vecOutput;			///< ڱ⸦  fail   ó  ܾ  state
+	std::vector<USHORT>		m_vecDepth;
+	std::vector<int>		m_vecLink;
+
+	int						m_nNumWord;
+};
+
+#endif
@@ -3,6 +3,7 @@
 
 // core
 #include "NtlDebug.h"
+#include "NtlCoreUtil.h"
 #include "NtlClientService.h"
 
 // shared
@@ -29,14 +30,12 @@ CFilterManager::~CFilterManager()
 void CFilterManager::InitOnce() 
 {
 	m_defaultReplace = L"--";
-
-	m_pFilterWord = NTL_NEW CWFILTERWORD;
 }
 
 void CFilterManager::Destroy() 
 {
-	if( m_pFilterWord )
-		NTL_DELETE(m_pFilterWord);
+	m_FilterAutomaton.Clear();
+	m_bIsEmpty = TRUE;
 }
 
 void CFilterManager::Create(void) 
@@ -52,20 +51,24 @@ void CFilterManager::Create(void)
 
 	sCHAT_FILTER_TBLDAT* pFilter = NULL;
 
+	m_FilterAutomaton.Clear();
+
 	for(CChattingFilterTable::TABLEIT it = pFilterTable->Begin(); it != pFilterTable->End(); it++)
 	{
 		pFilter = (sCHAT_FILTER_TBLDAT*)it->second;
 		AddFilter( pFilter->tblidx, pFilter->wszSlangText, pFilter->filteringTextIndex );
 	}
 
+	m_FilterAutomaton.Build();
+
 	// ܾ 1 ̻ ϵǾ  ̺  ִ° ƴϴٶ ǴѴ.
-	if( m_pFilterWord->GetNumFilter() > 0 )
+	if( m_FilterAutomaton.GetNumFilter() > 0 )
 		m_bIsEmpty = FALSE;
 }
 
 void CFilterManager::AddFilter(int nIndex, wchar_t* pText, int nLink)
 {
-	m_pFilterWord->AddText( nIndex, pText, lstrlenW( pText ), nLink );
+	m_FilterAutomaton.AddText( pText, lstrlenW( pText ), nLink );
 }
 
 /**
@@ -89,8 +92,12 @@ std::wstring CFilterManager::Filtering(std::wstring& pText)
 	std::wstring		strText = pText;
 
 	// vecResult ü ͸ ܾ ġ  äִ´.
-	std::vector<CWFILTERWORD::SResult> vecResult;
-	m_pFilterWord->FindText(strText.c_str(), (int)strText.length(), vecResult);
+	CFilterAutomaton::MATCHVEC vecResult;
+	m_FilterAutomaton.FindText(strText.c_str(), (int)strText.length(), vecResult);
+
+	// ͵ ܾ  ġȯ ̺  ʿ䰡 .
+	if( vecResult.empty() )
+		return strText;
 
 	// ̺ ̸  ִ´.
 	CTextTable* pReplaceTable = API_GetTableContainer()->GetTextAllTable()->GetFilteringTable();
@@ -104,7 +111,7 @@ std::wstring CFilterManager::Filtering(std::wstring& pText)
 	// ̰ ڿ տ ġȯ  ڿ  ̰ ٲ 츦 Ѵ.
 	for (int i = (int)vecResult.size() - 1; i >= 0; --i)
 	{
-		CWFILTERWORD::SResult& resultRef = vecResult.at(i);
+		SResult& resultRef = vecResult.at(i);
 
 		// ͸ ܾ ġȯѴ. strText.erase( StartPos, Offset );
 		strText.erase(resultRef.uPosStart, resultRef.uPosEnd-resultRef.uPosStart+1);
@@ -178,13 +185,8 @@ RwBool CFilterManager::IsSlang(std::wstring& pText )
 		return FALSE;
 	}
 
-	std::wstring strText = pText;
-
-	std::vector<CWFILTERWORD::SResult> vecResult;
-	m_pFilterWord->FindText(strText.c_str(), (int)strText.length(), vecResult);
-
 	//  ܾ ϳ ˻Ǹ  ڿ 弳 ȴ.
-	if( vecResult.size() > 0 )
+	if( m_FilterAutomaton.IsMatch(pText.c_str(), (int)pText.length()) )
 		return TRUE;
 
 	return FALSE;
@@ -220,4 +222,121 @@ RwBool CFilterManager::IsAnyInvalidText( const WCHAR* pText )
 		return TRUE;
 
 	return FALSE;
-}
\ No newline at end of file
+}
+
+/**
+* \brief  ˻ ð 
+*
+* ̺ ܾ  trie( CFilterWord )   , ܾ  ä 
+*   nLoop  ˻ ð log  .
+* automaton  ҹڿ /ݰ  ڷ Ƿ ã  trie    ִ.
+*
+* \param nLoop  ü ˻ϴ Ƚ
+*/
+void CFilterManager::Benchmark( int nLoop )
+{
+	CChattingFilterTable* pFilterTable = API_GetTableContainer()->GetChattingFilterTable();
+	if( NULL == pFilterTable || m_bIsEmpty )
+	{
+		NtlLogFilePrint("filter benchmark : filter table is empty");
+		return;
+	}
+
+	CWFILTERWORD clFilterWord;
+	std::vector<std::wstring> vecWord;
+
+	for(CChattingFilterTable::TABLEIT it = pFilterTable->Begin(); it != pFilterTable->End(); it++)
+	{
+		sCHAT_FILTER_TBLDAT* pFilter = (sCHAT_FILTER_TBLDAT*)it->second;
+
+		int nIndex	= pFilter->tblidx;
+		int nLink	= pFilter->filteringTextIndex;
+		clFilterWord.AddText( nIndex, pFilter->wszSlangText, lstrlenW( pFilter->wszSlangText ), nLink );
+
+		if( pFilter->wszSlangText[0] != NULL )
+			vecWord.push_back( pFilter->wszSlangText );
+	}
+
+	if( vecWord.empty() )
+		return;
+
+	// ä  䳻 . Ź   ǵ rand()   seed  .
+	const int BENCHMARK_LINE_COUNT = 1000;
+	const wchar_t* pFiller = L"ȳϼ      մϴ Dragon Ball Online ";
+	int nFillerLen = lstrlenW( pFiller );
+
+	std::vector<std::wstring> vecLine;
+	vecLine.reserve( BENCHMARK_LINE_COUNT );
+
+	RwUInt32 uiSeed = 0x12345678;
+	RwUInt32 uiNumChar = 0;
+
+	for( int i = 0; i < BENCHMARK_LINE_COUNT; ++i )
+	{
+		std::wstring strLine;
+		int nPiece = 3 + i % 6;
+
+		for( int j = 0; j < nPiece; ++j )
+		{
+			uiSeed = uiSeed * 1103515245 + 12345;
+			RwUInt32 uiRand = uiSeed >> 16;
+
+			// 4  ϳ  ܾ
+			if( ( uiRand & 3 ) == 0 )
+			{
+				strLine += vecWord[uiRand % vecWord.size()];
+			}
+			else
+			{
+				int nStart	= uiRand % nFillerLen;
+				int nLen	= nFillerLen - nStart < 8 ? nFillerLen - nStart : 8;
+				strLine.append( pFiller + nStart, nLen );
+			}
+		}
+
+		uiNumChar += (RwUInt32)strLine.length();
+		vecLine.push_back( strLine );
+	}
+
+	LARGE_INTEGER liFreq, liBegin, liEnd;
+	QueryPerformanceFrequency( &liFreq );
+
+	//  trie
+	std::vector<CWFILTERWORD::SResult> vecTrieResult;
+	RwUInt32 uiTrieMatch = 0;
+
+	QueryPerformanceCounter( &liBegin );
+	for( int n = 0; n < nLoop; ++n )
+	{
+		for( size_t i = 0; i < vecLine.size(); ++i )
+		{
+			vecTrieResult.clear();
+			uiTrieMatch += clFilterWord.FindText( vecLine[i].c_str(), (int)vecLine[i].length(), vecTrieResult );
+		}
+	}
+	QueryPerformanceCounter( &liEnd );
+
+	double dTrieTime = (double)( liEnd.QuadPart - liBegin.QuadPart ) * 1000.0 / (double)liFreq.QuadPart;
+
+	// automaton
+	CFilterAutomaton::MATCHVEC vecResult;
+	RwUInt32 uiMatch = 0;
+
+	QueryPerformanceCounter( &liBegin );
+	for( int n = 0; n < nLoop; ++n )
+	{
+		for( size_t i = 0; i < vecLine.size(); ++i )
+		{
+			vecResult.clear();
+			uiMatch += m_FilterAutomaton.FindText( vecLine[i].c_str(), (int)vecLine[i].length(), vecResult );
+		}
+	}
+	QueryPerformanceCounter( &liEnd );
+
+	double dTime = (double)( liEnd.QuadPart - liBegin.QuadPart ) * 1000.0 / (double)liFreq.QuadPart;
+
+	NtlLogFilePrintArgs("filter benchmark : %u words, %d lines, %u chars, %d loops",
+						(RwUInt32)vecWord.size(), BENCHMARK_LINE_COUNT, uiNumChar, nLoop);
+	NtlLogFilePrintArgs("filter benchmark : trie %.3f ms ( %u matches ), automaton %.3f ms ( %u matches ), x%.2f",
+						dTrieTime, uiTrieMatch, dTime, uiMatch, dTime > 0.0 ? dTrieTime / dTime : 0.0);
+}
@@ -25,11 +25,13 @@
 #include <vector>
 #include <windows.h>
 #include "NtlDebug.h"
+#include "FilterAutomaton.h"
 
 
 /**
 * \ingroup Client
 * ͵ ܾ  ھ иϿ  Ű  
+* ˻ CFilterAutomaton  Ű,  Benchmark   θ .
 */
 template <typename T>
 class CFilterWord
@@ -219,6 +221,7 @@ class CFilterManager
 {
 public:
 	typedef CFilterWord<wchar_t> CWFILTERWORD;
+	typedef CFilterAutomaton::SMatch SResult;
 
 public:
 	// ʱȭ & 
@@ -242,6 +245,8 @@ public:
 	RwBool IsSlang( std::string& pText );							///< 弳 üũ(string)
 	RwBool IsSlang( const wchar_t* pText );
 
+	void Benchmark( int nLoop );									///< CFilterWord  automaton  ˻ ð log  
+
 	// ̱ νϽ
 	static CFilterManager* GetInstance(void)
 	{
@@ -251,7 +256,7 @@ public:
 	}
 
 protected:
-	CWFILTERWORD*			m_pFilterWord;
+	CFilterAutomaton		m_FilterAutomaton;
 	std::wstring			m_defaultReplace;
 	RwBool					m_bIsEmpty;
 
@@ -89,10 +89,10 @@ VOID CTeleportProposalManager::Destroy()
 */
 void CTeleportProposalManager::HandleEvents( RWS::CMsg& msg )
 {
-	MapFuncEventHandler::iterator it = m_mapEventFunc.find( msg.Id );
-	if( it != m_mapEventFunc.end() )
+	FuncEventHander pFunc = m_mapEventFunc.Find( msg.Id );
+	if( pFunc )
 	{
-		(this->*(*it).second)(msg);
+		(this->*pFunc)(msg);
 	}
 }
 
@@ -64,7 +64,7 @@ protected:
 	MapTeleportProposal	m_mapTeleportProposal;
 
 	typedef void (CTeleportProposalManager::*FuncEventHander)(RWS::CMsg &pMsg);
-	typedef std::map<const RWS::CRegisteredMsgs*, FuncEventHander> MapFuncEventHandler;
+	typedef RWS::CEventFuncTable<FuncEventHander> MapFuncEventHandler;
 	MapFuncEventHandler m_mapEventFunc;
 
 	RwReal				m_fElapsedTime;
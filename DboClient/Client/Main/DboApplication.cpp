@@ -14,6 +14,7 @@
 #include "NtlCoreApi.h"
 #include "NtlLoadingController.h"
 #include "NtlProfiler.h"
+#include "NtlTraceProfiler.h"
 #include "vlc.h"
 // shared
 #include "NtlClientNet.h"
@@ -76,6 +77,7 @@
 
 // dbo
 #include "PacketProc.h"
+#include "PacketCapture.h"
 #include "DisplayParser.h"
 #include "DisplayStringManager.h"
 #include "AlarmManager.h"
@@ -1067,6 +1069,9 @@ void CDboApplication::SetRenderEnable(RwBool bRender)
 
 RwBool CDboApplication::Update(RwReal fTime, RwReal fElapsedTime)
 {
+	NTL_TRACE_FRAME();
+	NTL_TRACE_SCOPE("CDboApplication::Update");
+
 	// network process
 	// picking ó   input ߿ д.
 	//  picking ó Ͽ rendering culling atomic pick atomic container  д.
@@ -1074,15 +1079,25 @@ RwBool CDboApplication::Update(RwReal fTime, RwReal fElapsedTime)
 
 	fElapsedTime = fElapsedTime * g_fElapsedWeightValue;
 
+	// replay ߿ ϵ frame  elapsed time    ִ.
+	fElapsedTime = CPacketReplayer::GetInstance()->BeginFrame(fElapsedTime);
+	CPacketCapture::GetInstance()->BeginFrame(fElapsedTime);
+
+	NTL_TRACE_BEGIN("Network");
+
 #ifdef NET_SERVER_SYNC
 	CPacketProc::GetInstance()->RecvPacketProc();
 #else
 	CDboVirtualServer::GetInstance()->Update(fElapsedTime);
 #endif
 
+	NTL_TRACE_END();
+
 //	EventQueueCurrentProcessFilterMsg(
 
+	NTL_TRACE_BEGIN("API_CoreUpdate");
 	API_CoreUpdate(fElapsedTime);
+	NTL_TRACE_END();
 
 	GetLobbyManager()->Update(fElapsedTime);
 
@@ -1094,11 +1109,15 @@ RwBool CDboApplication::Update(RwReal fTime, RwReal fElapsedTime)
 
 	NTL_SPROFILE("GAME LOGIC")
 
+	NTL_TRACE_BEGIN("Visual Update");
 	m_pVisualManager->UpdateBeforeCamera(fElapsedTime);
 	m_pVisualManager->Update(fElapsedTime);
+	NTL_TRACE_END();
 
 	if(GetRenderEnable())
 	{
+		NTL_TRACE_SCOPE("Render");
+
 		if (m_pCamera->CameraClear(&m_BackgroundColor, rwCAMERACLEARZ|rwCAMERACLEARIMAGE))
 		{
 			if( m_pCamera->PostCameraBeginUpdate(fElapsedTime) )
@@ -1297,6 +1316,8 @@ void CDboApplication::Destroy()
 
 	CPetitionManager::DestroyInstance();
 
+	CNtlTraceProfiler::Destroy();
+
 	// Close the event system
 	RWS::CEventHandler::UnRegisterStreamChunkHandlers();
 	RWS::CEventHandler::Close ();
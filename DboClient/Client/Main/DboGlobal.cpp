@@ -175,6 +175,8 @@ RwBool CDboGlobal::Create(HWND hWnd)
 		NTL_RETURN(FALSE);
 	}
 
+	m_pNetwork->SetTraceCallback(NetworkTraceCallback);
+
 	if(!LoadConfigOptions("ConfigOptions.xml"))
 	{
 		DBO_FAIL("Fail load ConfigOptions.xml");
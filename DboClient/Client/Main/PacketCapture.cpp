@@ -0,0 +1,344 @@
+#include "precomp_dboclient.h"
+#include "PacketCapture.h"
+
+// core
+#include "NtlDebug.h"
+#include "NtlCoreUtil.h"
+
+// dbo
+#include "DboApplication.h"
+
+
+#define PACKET_CAPTURE_FILE_BUFFER		(64 * 1024)
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+
+CPacketCapture::CPacketCapture()
+{
+	m_pFile			= NULL;
+	m_uiBeginTime	= 0;
+
+	m_uiFrameCount	= 0;
+	m_uiPacketCount	= 0;
+	m_uiPacketBytes	= 0;
+}
+
+CPacketCapture::~CPacketCapture()
+{
+	Stop();
+}
+
+CPacketCapture* CPacketCapture::GetInstance(void)
+{
+	static CPacketCapture Instance;
+	return &Instance;
+}
+
+RwBool CPacketCapture::Start(const RwChar *pFileName)
+{
+	Stop();
+
+	if(fopen_s(&m_pFile, pFileName, "wb") != 0 || m_pFile == NULL)
+	{
+		NtlLogFilePrintArgs("packet capture : can not open file (%s)", pFileName);
+		m_pFile = NULL;
+		return FALSE;
+	}
+
+	// packet  disk   ʵ buffer  ũ ´.
+	setvbuf(m_pFile, NULL, _IOFBF, PACKET_CAPTURE_FILE_BUFFER);
+
+	sPACKET_CAPTURE_FILE_HEADER sHeader;
+	sHeader.uiMagic		= PACKET_CAPTURE_MAGIC;
+	sHeader.wVersion	= PACKET_CAPTURE_VERSION;
+	sHeader.wHeaderSize	= sizeof(sPACKET_CAPTURE_FILE_HEADER);
+	_time64(&sHeader.tmBegin);
+
+	if(fwrite(&sHeader, sizeof(sHeader), 1, m_pFile) != 1)
+	{
+		NtlLogFilePrintArgs("packet capture : can not write file (%s)", pFileName);
+		fclose(m_pFile);
+		m_pFile = NULL;
+		return FALSE;
+	}
+
+	m_uiBeginTime	= timeGetTime();
+	m_uiFrameCount	= 0;
+	m_uiPacketCount	= 0;
+	m_uiPacketBytes	= 0;
+
+	NtlLogFilePrintArgs("packet capture : start (%s)", pFileName);
+
+	return TRUE;
+}
+
+void CPacketCapture::Stop(void)
+{
+	if(!IsRecording())
+		return;
+
+	fclose(m_pFile);
+	m_pFile = NULL;
+
+	NtlLogFilePrintArgs("packet capture : stop, %u frames, %u packets, %u bytes", m_uiFrameCount, m_uiPacketCount, m_uiPacketBytes);
+}
+
+void CPacketCapture::BeginFrame(RwReal fElapsedTime)
+{
+	if(!IsRecording())
+		return;
+
+	WriteRecord(PACKET_CAPTURE_RECORD_FRAME, INVALID_PACKET_CAPTURE_CHANNEL, &fElapsedTime, sizeof(RwReal));
+
+	m_uiFrameCount++;
+}
+
+void CPacketCapture::WritePacket(RwUInt8 byChannel, const void *pData, RwUInt16 wDataSize)
+{
+	if(!IsRecording())
+		return;
+
+	WriteRecord(PACKET_CAPTURE_RECORD_PACKET, byChannel, pData, wDataSize);
+
+	m_uiPacketCount++;
+	m_uiPacketBytes += wDataSize;
+}
+
+void CPacketCapture::WriteRecord(RwUInt8 byType, RwUInt8 byChannel, const void *pData, RwUInt16 wDataSize)
+{
+	sPACKET_CAPTURE_RECORD sRecord;
+	sRecord.byType		= byType;
+	sRecord.byChannel	= byChannel;
+	sRecord.wDataSize	= wDataSize;
+	sRecord.uiTime		= timeGetTime() - m_uiBeginTime;
+
+	if(fwrite(&sRecord, sizeof(sRecord), 1, m_pFile) != 1 ||
+	   (wDataSize > 0 && fwrite(pData, wDataSize, 1, m_pFile) != 1))
+	{
+		NtlLogFilePrint("packet capture : write failed");
+		Stop();
+	}
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+
+CPacketReplayer::CPacketReplayer()
+{
+	m_uiPos				= 0;
+	m_uiFrameEnd		= 0;
+
+	m_bPlaying			= FALSE;
+	m_eSpeed			= REPLAY_SPEED_RECORDED;
+	m_bRestoreRender	= FALSE;
+
+	m_uiBeginTime		= 0;
+	m_liBegin.QuadPart	= 0;
+
+	m_uiFrameCount		= 0;
+	m_uiPacketCount		= 0;
+}
+
+CPacketReplayer::~CPacketReplayer()
+{
+}
+
+CPacketReplayer* CPacketReplayer::GetInstance(void)
+{
+	static CPacketReplayer Instance;
+	return &Instance;
+}
+
+RwBool CPacketReplayer::Start(const RwChar *pFileName, eREPLAY_SPEED eSpeed, RwBool bRender /*= TRUE*/)
+{
+	Stop();
+
+	FILE *fp = NULL;
+	if(fopen_s(&fp, pFileName, "rb") != 0 || fp == NULL)
+	{
+		NtlLogFilePrintArgs("packet replay : can not open file (%s)", pFileName);
+		return FALSE;
+	}
+
+	fseek(fp, 0, SEEK_END);
+	long lSize = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	// replay ߿ file   ʵ  ÷ д.
+	if(lSize > 0)
+	{
+		m_vecData.resize(lSize);
+		if(fread(&m_vecData[0], lSize, 1, fp) != 1)
+			m_vecData.clear();
+	}
+
+	fclose(fp);
+
+	const sPACKET_CAPTURE_FILE_HEADER *pHeader = reinterpret_cast<const sPACKET_CAPTURE_FILE_HEADER*>( m_vecData.empty() ? NULL : &m_vecData[0] );
+	if( m_vecData.size() < sizeof(sPACKET_CAPTURE_FILE_HEADER) ||
+		pHeader->uiMagic != PACKET_CAPTURE_MAGIC ||
+		pHeader->wVersion != PACKET_CAPTURE_VERSION ||
+		pHeader->wHeaderSize < sizeof(sPACKET_CAPTURE_FILE_HEADER) ||
+		pHeader->wHeaderSize > m_vecData.size() )
+	{
+		NtlLogFilePrintArgs("packet replay : invalid capture file (%s)", pFileName);
+		VecData().swap(m_vecData);
+		return FALSE;
+	}
+
+	m_uiPos			= pHeader->wHeaderSize;
+	m_uiFrameEnd	= m_uiPos;
+	m_eSpeed		= eSpeed;
+	m_bPlaying		= TRUE;
+
+	m_uiFrameCount	= 0;
+	m_uiPacketCount	= 0;
+
+	m_bRestoreRender = FALSE;
+	if(!bRender && CDboApplication::GetInstance()->GetRenderEnable())
+	{
+		CDboApplication::GetInstance()->SetRenderEnable(FALSE);
+		m_bRestoreRender = TRUE;
+	}
+
+	m_uiBeginTime = timeGetTime();
+	QueryPerformanceCounter(&m_liBegin);
+
+	NtlLogFilePrintArgs("packet replay : start (%s), %s speed", pFileName, m_eSpeed == REPLAY_SPEED_MAX ? "max" : "recorded");
+
+	return TRUE;
+}
+
+void CPacketReplayer::Stop(void)
+{
+	if(!IsPlaying())
+		return;
+
+	LARGE_INTEGER liEnd, liFreq;
+	QueryPerformanceCounter(&liEnd);
+	QueryPerformanceFrequency(&liFreq);
+
+	RwReal fSec = (RwReal)( (double)(liEnd.QuadPart - m_liBegin.QuadPart) / (double)liFreq.QuadPart );
+	if(fSec <= 0.0f)
+		fSec = 0.001f;
+
+	NtlLogFilePrintArgs("packet replay : stop, %u frames, %u packets, %.3f sec ( %.1f frames/sec, %.1f packets/sec )",
+						m_uiFrameCount, m_uiPacketCount, fSec, m_uiFrameCount / fSec, m_uiPacketCount / fSec);
+
+	if(m_bRestoreRender)
+	{
+		CDboApplication::GetInstance()->SetRenderEnable(TRUE);
+		m_bRestoreRender = FALSE;
+	}
+
+	VecData().swap(m_vecData);
+
+	m_uiPos			= 0;
+	m_uiFrameEnd	= 0;
+	m_bPlaying		= FALSE;
+}
+
+RwReal CPacketReplayer::BeginFrame(RwReal fElapsedTime)
+{
+	if(!IsPlaying())
+		return fElapsedTime;
+
+	//  frame  packet    ִ.( loading  pop    )
+	if(m_uiPos < m_uiFrameEnd)
+		return fElapsedTime;
+
+	const sPACKET_CAPTURE_RECORD *pRecord;
+	if(!ReadRecord(m_uiPos, &pRecord))
+	{
+		Stop();
+		return fElapsedTime;
+	}
+
+	if(m_eSpeed == REPLAY_SPEED_MAX)
+	{
+		if(pRecord->byType == PACKET_CAPTURE_RECORD_FRAME)
+		{
+			fElapsedTime = *reinterpret_cast<const RwReal*>(pRecord + 1);
+			m_uiPos += sizeof(sPACKET_CAPTURE_RECORD) + pRecord->wDataSize;
+			m_uiFrameCount++;
+		}
+
+		m_uiFrameEnd = FindNextFrame(m_uiPos);
+	}
+	else
+	{
+		RwUInt32 uiNow = timeGetTime() - m_uiBeginTime;
+		RwUInt32 uiEnd = m_uiPos;
+
+		while(ReadRecord(uiEnd, &pRecord) && pRecord->uiTime <= uiNow)
+		{
+			if(pRecord->byType == PACKET_CAPTURE_RECORD_FRAME)
+				m_uiFrameCount++;
+
+			uiEnd += sizeof(sPACKET_CAPTURE_RECORD) + pRecord->wDataSize;
+		}
+
+		m_uiFrameEnd = uiEnd;
+	}
+
+	return fElapsedTime;
+}
+
+RwBool CPacketReplayer::PeekPacket(void **ppData, RwUInt8 *pbyChannel)
+{
+	const sPACKET_CAPTURE_RECORD *pRecord;
+
+	while(m_uiPos < m_uiFrameEnd && ReadRecord(m_uiPos, &pRecord))
+	{
+		if(pRecord->byType == PACKET_CAPTURE_RECORD_PACKET)
+		{
+			*ppData		= (void*)(pRecord + 1);
+			*pbyChannel	= pRecord->byChannel;
+			return TRUE;
+		}
+
+		m_uiPos += sizeof(sPACKET_CAPTURE_RECORD) + pRecord->wDataSize;
+	}
+
+	return FALSE;
+}
+
+void CPacketReplayer::PopPacket(void)
+{
+	const sPACKET_CAPTURE_RECORD *pRecord;
+	if(!ReadRecord(m_uiPos, &pRecord))
+		return;
+
+	m_uiPos += sizeof(sPACKET_CAPTURE_RECORD) + pRecord->wDataSize;
+	m_uiPacketCount++;
+}
+
+RwBool CPacketReplayer::ReadRecord(RwUInt32 uiPos, const sPACKET_CAPTURE_RECORD **ppRecord) const
+{
+	RwUInt32 uiSize = (RwUInt32)m_vecData.size();
+	if(uiPos + sizeof(sPACKET_CAPTURE_RECORD) > uiSize)
+		return FALSE;
+
+	const sPACKET_CAPTURE_RECORD *pRecord = reinterpret_cast<const sPACKET_CAPTURE_RECORD*>( &m_vecData[uiPos] );
+	if(uiPos + sizeof(sPACKET_CAPTURE_RECORD) + pRecord->wDataSize > uiSize)
+		return FALSE;
+
+	if(pRecord->byType == PACKET_CAPTURE_RECORD_FRAME && pRecord->wDataSize != sizeof(RwReal))
+		return FALSE;
+
+	*ppRecord = pRecord;
+	return TRUE;
+}
+
+RwUInt32 CPacketReplayer::FindNextFrame(RwUInt32 uiPos) const
+{
+	const sPACKET_CAPTURE_RECORD *pRecord;
+
+	while(ReadRecord(uiPos, &pRecord) && pRecord->byType != PACKET_CAPTURE_RECORD_FRAME)
+		uiPos += sizeof(sPACKET_CAPTURE_RECORD) + pRecord->wDataSize;
+
+	return uiPos;
+}
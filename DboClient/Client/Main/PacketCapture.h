@@ -0,0 +1,184 @@
+/*****************************************************************************
+ *
+ * File			: PacketCapture.h
+ * Copyright	: ()NTL
+ * Date			: 2026. 10. 17
+ * Abstract		: received packet capture / replay
+ *****************************************************************************
+ * Desc         :   packet  frame  binary file  ϰ,
+ *				  ϵ file  CPacketProc   ٽ  .
+ *
+ *				  file layout
+ *				  sPACKET_CAPTURE_FILE_HEADER
+ *				  sPACKET_CAPTURE_RECORD + data ( frame record  data  RwReal elapsed time,
+ *												  packet record  data  packet body )
+ *				  ...
+ *
+ *				  replay  capture  ߴ Ͱ  ( stage,  ) ؾ Ѵ.
+ *				  virtual server packet  client    Ƿ  ʴ´.
+ *****************************************************************************/
+
+#ifndef __PACKET_CAPTURE_H__
+#define __PACKET_CAPTURE_H__
+
+#include <vector>
+
+
+#define PACKET_CAPTURE_MAGIC		0x5043504E		// "NPCP"
+#define PACKET_CAPTURE_VERSION		1
+
+
+enum ePACKET_CAPTURE_RECORD
+{
+	PACKET_CAPTURE_RECORD_FRAME,			///< frame . data = RwReal elapsed time
+	PACKET_CAPTURE_RECORD_PACKET,			///<  packet. data = packet body
+
+	MAX_PACKET_CAPTURE_RECORD
+};
+
+enum ePACKET_CAPTURE_CHANNEL
+{
+	PACKET_CAPTURE_CHANNEL_AUTH,
+	PACKET_CAPTURE_CHANNEL_CHAR,
+	PACKET_CAPTURE_CHANNEL_CHAT,
+	PACKET_CAPTURE_CHANNEL_GAME,
+
+	MAX_PACKET_CAPTURE_CHANNEL,
+	INVALID_PACKET_CAPTURE_CHANNEL = 0xFF
+};
+
+#pragma pack(push, 1)
+
+struct sPACKET_CAPTURE_FILE_HEADER
+{
+	RwUInt32		uiMagic;
+	RwUInt16		wVersion;
+	RwUInt16		wHeaderSize;
+	__time64_t		tmBegin;				///< capture  ð
+};
+
+struct sPACKET_CAPTURE_RECORD
+{
+	RwUInt8			byType;					///< ePACKET_CAPTURE_RECORD
+	RwUInt8			byChannel;				///< ePACKET_CAPTURE_CHANNEL
+	RwUInt16		wDataSize;
+	RwUInt32		uiTime;					///< capture ۺ ð( ms )
+};
+
+#pragma pack(pop)
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+
+class CPacketCapture
+{
+public:
+
+	CPacketCapture();
+	~CPacketCapture();
+
+	static CPacketCapture* GetInstance(void);
+
+	RwBool	Start(const RwChar *pFileName);
+	void	Stop(void);
+
+	RwBool	IsRecording(void) const;
+
+	/**
+	* application frame  . Ŀ ϵǴ packet   frame  Ѵ.
+	*/
+	void	BeginFrame(RwReal fElapsedTime);
+
+	void	WritePacket(RwUInt8 byChannel, const void *pData, RwUInt16 wDataSize);
+
+private:
+
+	void	WriteRecord(RwUInt8 byType, RwUInt8 byChannel, const void *pData, RwUInt16 wDataSize);
+
+private:
+
+	FILE		*m_pFile;
+	RwUInt32	m_uiBeginTime;
+
+	RwUInt32	m_uiFrameCount;
+	RwUInt32	m_uiPacketCount;
+	RwUInt32	m_uiPacketBytes;
+};
+
+
+inline RwBool CPacketCapture::IsRecording(void) const
+{
+	return m_pFile != NULL;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+
+class CPacketReplayer
+{
+public:
+
+	enum eREPLAY_SPEED
+	{
+		REPLAY_SPEED_RECORDED,				///< ϵ ð ߾  .
+		REPLAY_SPEED_MAX,					///< application frame  ϵ frame ϳ, ϵ elapsed time  .
+	};
+
+public:
+
+	CPacketReplayer();
+	~CPacketReplayer();
+
+	static CPacketReplayer* GetInstance(void);
+
+	RwBool	Start(const RwChar *pFileName, eREPLAY_SPEED eSpeed, RwBool bRender = TRUE);
+	void	Stop(void);
+
+	RwBool	IsPlaying(void) const;
+
+	/**
+	* application frame  . ̹ frame    packet   ϰ
+	* simulation  ѱ elapsed time   ش.
+	*/
+	RwReal	BeginFrame(RwReal fElapsedTime);
+
+	/**
+	* ̹ frame    packet.  FALSE
+	*/
+	RwBool	PeekPacket(void **ppData, RwUInt8 *pbyChannel);
+	void	PopPacket(void);
+
+private:
+
+	RwBool	ReadRecord(RwUInt32 uiPos, const sPACKET_CAPTURE_RECORD **ppRecord) const;
+	RwUInt32 FindNextFrame(RwUInt32 uiPos) const;
+
+private:
+
+	typedef std::vector<RwUInt8> VecData;
+
+	VecData			m_vecData;
+	RwUInt32		m_uiPos;				///<   record
+	RwUInt32		m_uiFrameEnd;			///< ̹ frame     ִ record  
+
+	RwBool			m_bPlaying;
+	eREPLAY_SPEED	m_eSpeed;
+	RwBool			m_bRestoreRender;
+
+	RwUInt32		m_uiBeginTime;
+	LARGE_INTEGER	m_liBegin;
+
+	RwUInt32		m_uiFrameCount;
+	RwUInt32		m_uiPacketCount;
+};
+
+
+inline RwBool CPacketReplayer::IsPlaying(void) const
+{
+	return m_bPlaying;
+}
+
+
+#endif
@@ -4,8 +4,12 @@
 // shared
 #include "NtlClientNet.h"
 
+//Network
+#include "..\Server\NtlNetwork\NtlPacket.h"
+
 // core
 #include "NtlDebug.h"
+#include "NtlTraceProfiler.h"
 
 // simulation
 #include "NtlNetSender.h"
@@ -16,6 +20,7 @@
 #include "DboEvent.h"
 #include "DboEventGenerator.h"
 #include "DumpCommand.h"
+#include "PacketCapture.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +39,25 @@ void NetworkLogCallback(const char *pNetLog)
 
 }
 
+void NetworkTraceCallback(int nTraceEvent, const char *pName)
+{
+	switch(nTraceEvent)
+	{
+	case NETCLIENT_TRACE_THREAD_NAME:
+		CNtlTraceProfiler::SetThreadName(pName);
+		break;
+	case NETCLIENT_TRACE_BEGIN:
+		CNtlTraceProfiler::Begin(pName);
+		break;
+	case NETCLIENT_TRACE_END:
+		CNtlTraceProfiler::End();
+		break;
+	case NETCLIENT_TRACE_THREAD_EXIT:
+		CNtlTraceProfiler::ReleaseThread();
+		break;
+	}
+}
+
 void NetworkEventHander(HSERVER hServer, int nEvent)
 {
 	SConnectData *pConnectData = GetDboGlobal()->GetConnectData();
@@ -190,6 +214,22 @@ void NetworkEventHander(HSERVER hServer, int nEvent)
 	}
 }
 
+static RwUInt8 GetCaptureChannel(HSERVER hServer)
+{
+	SConnectData *pConnectData = GetDboGlobal()->GetConnectData();
+
+	if(hServer == pConnectData->sAuthCon.hSocket)
+		return PACKET_CAPTURE_CHANNEL_AUTH;
+	else if(hServer == pConnectData->sCharCon.hSocket)
+		return PACKET_CAPTURE_CHANNEL_CHAR;
+	else if(hServer == pConnectData->sChatCon.hSocket)
+		return PACKET_CAPTURE_CHANNEL_CHAT;
+	else if(hServer == pConnectData->sGameCon.hSocket)
+		return PACKET_CAPTURE_CHANNEL_GAME;
+
+	return INVALID_PACKET_CAPTURE_CHANNEL;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////
 ///
 CClientRecvPacketProc::CClientRecvPacketProc( const HSERVER hServer )
@@ -199,6 +239,14 @@ CClientRecvPacketProc::CClientRecvPacketProc( const HSERVER hServer )
 
 bool CClientRecvPacketProc::RecvPacketProcess( void* const pData )
 {
+	CPacketCapture *pCapture = CPacketCapture::GetInstance();
+	if(pCapture->IsRecording())
+	{
+		// pData  packet body ̰, ٷ տ packet header  پ ִ.
+		LPPACKETHEADER pHeader = (LPPACKETHEADER)((BYTE*)pData - PACKET_HEADSIZE);
+		pCapture->WritePacket(GetCaptureChannel(m_hServer), pData, (RwUInt16)pHeader->wPacketLen);
+	}
+
 	GetDumpCmdManager()->RecvPacket(pData); 
 	CNtlPacketHandler::DetectPacketHeader(pData);
 	return true;
@@ -274,11 +322,35 @@ void CPacketProc::PopVirutalPacket(void)
 	m_listPacket.clear();
 }
 
+void CPacketProc::PopReplayPacket(void)
+{
+	CPacketReplayer *pReplayer = CPacketReplayer::GetInstance();
+
+	void *pData;
+	RwUInt8 byChannel;
+	while(pReplayer->PeekPacket(&pData, &byChannel))
+	{
+		GetDumpCmdManager()->RecvPacket(pData); 
+		CNtlPacketHandler::DetectPacketHeader(pData);
+		pReplayer->PopPacket();
+
+		if(!IsActivePop())
+			break;
+	}
+}
+
 void CPacketProc::RecvPacketProc(void)
 {
 	if(!IsActivePop())
 		return;
 
+	// replay ߿ network  capture file  packet  óѴ.
+	if(CPacketReplayer::GetInstance()->IsPlaying())
+	{
+		PopReplayPacket();
+		return;
+	}
+
 	SConnectData *pConnectData = GetDboGlobal()->GetConnectData();
 	if(pConnectData->sAuthCon.hSocket != INVALID_SOCKET)
 		PopPacket(pConnectData->sAuthCon.hSocket);
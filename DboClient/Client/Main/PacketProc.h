@@ -17,6 +17,7 @@
 
 void NetworkLogCallback(const char *pNetLog);
 void NetworkEventHander(HSERVER hServer, int nEvent);
+void NetworkTraceCallback(int nTraceEvent, const char *pName);
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////
 //
@@ -50,6 +51,7 @@ private:
 
 	void PopPacket(HSERVER hSocketId);
 	void PopVirutalPacket(void);
+	void PopReplayPacket(void);
 	
 public:
 
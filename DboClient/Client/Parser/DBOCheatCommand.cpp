@@ -10,6 +10,7 @@
 
 // core
 #include "NtlDebug.h"
+#include "NtlCoreUtil.h"
 #include "DumpCommand.h"
 #include "NtlLuaState.h"
 
@@ -39,14 +40,20 @@
 #include "NtlSobAvatarAttr.h"
 #include "NtlSobCharPerfController.h"
 #include "NtlSobManager.h"
+#include "NtlPacketHandler.h"
+#include "DboTSCMain.h"
 
 // dbo
 #include "DboEventGenerator.h"
 #include "AlarmManager.h"
 #include "DboLogic.h"
+#include "SayFilter.h"
 #include "DialogManager.h"		/// woosungs_test
 #include "SideDialogManager.h"	/// woosungs_test
 #include "PacketTracer.h"
+#include "PacketCapture.h"
+#include "NtlTraceProfiler.h"
+#include "NtlClientNet.h"
 
 // NtlGui						/// woosungs_test
 #include "gui_component.h"		
@@ -144,6 +151,13 @@ void CDBOCheatCommand::Register()
 	m_mapCheatHandler["dialog"]				= &CDBOCheatCommand::OnDialog;			/// woosungs_test	
 	// _ENABLE_PACKET_TRACE_	/// Defalut Disable ///  ɼִ. ڵ尡   
 	m_mapCheatHandler["packettrace"]		= &CDBOCheatCommand::OnPacketTrace;		/// woosungs_test 20090804	
+	m_mapCheatHandler["packetcapture"]		= &CDBOCheatCommand::OnPacketCapture;
+	m_mapCheatHandler["packetreplay"]		= &CDBOCheatCommand::OnPacketReplay;
+	m_mapCheatHandler["traceprofile"]		= &CDBOCheatCommand::OnTraceProfile;
+	m_mapCheatHandler["packetprofile"]		= &CDBOCheatCommand::OnPacketProfile;
+	m_mapCheatHandler["filterbench"]		= &CDBOCheatCommand::OnFilterBench;
+	m_mapCheatHandler["cipherbench"]		= &CDBOCheatCommand::OnCipherBench;
+	m_mapCheatHandler["tscompile"]			= &CDBOCheatCommand::OnTSCompile;
 
 	// sound
 	m_mapCheatHandler["playmanysound"]		= &CDBOCheatCommand::OnPlayManySound;
@@ -1328,6 +1342,235 @@ RwBool CDBOCheatCommand::OnPacketTrace(CNtlTokenizer* pLexer)	/// woosungs_test
 	return TRUE;
 }
 
+RwBool CDBOCheatCommand::OnPacketCapture(CNtlTokenizer* pLexer)
+{
+	RwInt32 iLine;
+
+	std::string strCommand1 = pLexer->PeekNextToken(NULL, &iLine);
+	std::string strCommand2 = pLexer->PeekNextToken(&iLine, &iLine);
+
+	if(strCommand1 == "start")
+	{
+		if(CPacketReplayer::GetInstance()->IsPlaying())
+		{
+			GetAlarmManager()->AlarmMessage(L"packet replay is running");
+			return FALSE;
+		}
+
+		if(strCommand2.empty())
+		{
+			// file ̸    ð .
+			RwChar acFileName[64];
+			__time64_t tmNow;
+			struct tm tmLocal;
+			_time64(&tmNow);
+			_localtime64_s(&tmLocal, &tmNow);
+			strftime(acFileName, sizeof(acFileName), "PacketCapture_%Y%m%d_%H%M%S.npc", &tmLocal);
+			strCommand2 = acFileName;
+		}
+
+		if(!CPacketCapture::GetInstance()->Start(strCommand2.c_str()))
+		{
+			GetAlarmManager()->AlarmMessage(L"packet capture start failed");
+			return FALSE;
+		}
+
+		GetAlarmManager()->AlarmMessage(L"packet capture on");
+	}
+	else if(strCommand1 == "stop")
+	{
+		CPacketCapture::GetInstance()->Stop();
+		GetAlarmManager()->AlarmMessage(L"packet capture off");
+	}
+	else
+		return FALSE;
+
+	return TRUE;
+}
+
+RwBool CDBOCheatCommand::OnPacketReplay(CNtlTokenizer* pLexer)
+{
+	RwInt32 iLine;
+
+	std::string strCommand1 = pLexer->PeekNextToken(NULL, &iLine);
+	if(strCommand1.empty())
+		return FALSE;
+
+	if(strCommand1 == "stop")
+	{
+		CPacketReplayer::GetInstance()->Stop();
+		GetAlarmManager()->AlarmMessage(L"packet replay off");
+		return TRUE;
+	}
+
+	CPacketReplayer::eREPLAY_SPEED eSpeed = CPacketReplayer::REPLAY_SPEED_RECORDED;
+	RwBool bRender = TRUE;
+
+	std::string strOption = pLexer->PeekNextToken(&iLine, &iLine);
+	while(!strOption.empty())
+	{
+		if(strOption == "fast")
+			eSpeed = CPacketReplayer::REPLAY_SPEED_MAX;
+		else if(strOption == "norender")
+			bRender = FALSE;
+		else
+			return FALSE;
+
+		strOption = pLexer->PeekNextToken(&iLine, &iLine);
+	}
+
+	// replay  packet  ٽ  ʴ´.
+	CPacketCapture::GetInstance()->Stop();
+
+	if(!CPacketReplayer::GetInstance()->Start(strCommand1.c_str(), eSpeed, bRender))
+	{
+		GetAlarmManager()->AlarmMessage(L"packet replay start failed");
+		return FALSE;
+	}
+
+	GetAlarmManager()->AlarmMessage(L"packet replay on");
+
+	return TRUE;
+}
+
+RwBool CDBOCheatCommand::OnTraceProfile(CNtlTokenizer* pLexer)
+{
+	RwInt32 iLine;
+
+	std::string strCommand1 = pLexer->PeekNextToken(NULL, &iLine);
+	std::string strCommand2 = pLexer->PeekNextToken(&iLine, &iLine);
+
+	if(strCommand1 == "start")
+	{
+		CNtlTraceProfiler::Start();
+		GetAlarmManager()->AlarmMessage(L"trace profile on");
+	}
+	else if(strCommand1 == "stop")
+	{
+		CNtlTraceProfiler::Stop();
+		GetAlarmManager()->AlarmMessage(L"trace profile off");
+	}
+	else if(strCommand1 == "dump")
+	{
+		if(strCommand2.empty())
+		{
+			RwChar acFileName[64];
+			__time64_t tmNow;
+			struct tm tmLocal;
+			_time64(&tmNow);
+			_localtime64_s(&tmLocal, &tmNow);
+			strftime(acFileName, sizeof(acFileName), "Trace_%Y%m%d_%H%M%S.json", &tmLocal);
+			strCommand2 = acFileName;
+		}
+
+		if(!CNtlTraceProfiler::DumpChromeTrace(strCommand2.c_str()))
+		{
+			GetAlarmManager()->AlarmMessage(L"trace profile dump failed");
+			return FALSE;
+		}
+
+		GetAlarmManager()->AlarmMessage(L"trace profile dumped");
+	}
+	else
+		return FALSE;
+
+	return TRUE;
+}
+
+RwBool CDBOCheatCommand::OnPacketProfile(CNtlTokenizer* pLexer)
+{
+	RwInt32 iLine;
+
+	std::string strCommand1 = pLexer->PeekNextToken(NULL, &iLine);
+	std::string strCommand2 = pLexer->PeekNextToken(&iLine, &iLine);
+
+	if(strCommand1 == "start")
+	{
+		CNtlPacketHandler::ResetProfile();
+		CNtlPacketHandler::EnableProfile(TRUE);
+		GetAlarmManager()->AlarmMessage(L"packet profile on");
+	}
+	else if(strCommand1 == "stop")
+	{
+		CNtlPacketHandler::EnableProfile(FALSE);
+		GetAlarmManager()->AlarmMessage(L"packet profile off");
+	}
+	else if(strCommand1 == "dump")
+	{
+		RwInt32 iTopNum = strCommand2.empty() ? 20 : atoi(strCommand2.c_str());
+		if(iTopNum <= 0)
+			return FALSE;
+
+		CNtlPacketHandler::DumpProfile(iTopNum);
+		GetAlarmManager()->AlarmMessage(L"packet profile dumped, see log");
+	}
+	else
+		return FALSE;
+
+	return TRUE;
+}
+
+RwBool CDBOCheatCommand::OnFilterBench(CNtlTokenizer* pLexer)
+{
+	RwInt32 iLine;
+
+	std::string strLoop = pLexer->PeekNextToken(NULL, &iLine);
+
+	int nLoop = strLoop.empty() ? 100 : atoi(strLoop.c_str());
+	if(nLoop <= 0)
+		return FALSE;
+
+	GetChattingFilter()->Benchmark(nLoop);
+	GetAlarmManager()->AlarmMessage(L"filter benchmark done, see log");
+
+	return TRUE;
+}
+
+static void CipherBenchLog(const char * lpszLine)
+{
+	NtlLogFilePrintArgs("cipher benchmark : %s", lpszLine);
+}
+
+RwBool CDBOCheatCommand::OnCipherBench(CNtlTokenizer* pLexer)
+{
+	RwInt32 iLine;
+
+	std::string strSize = pLexer->PeekNextToken(NULL, &iLine);
+	std::string strLoop = pLexer->PeekNextToken(&iLine, &iLine);
+
+	int nPacketSize	= strSize.empty() ? 256 : atoi(strSize.c_str());
+	int nLoop		= strLoop.empty() ? 100000 : atoi(strLoop.c_str());
+	if(nPacketSize <= 0 || nLoop <= 0)
+		return FALSE;
+
+	if(!NtlClientNetCipherBenchmark(nPacketSize, nLoop, CipherBenchLog))
+	{
+		GetAlarmManager()->AlarmMessage(L"cipher benchmark failed, see log");
+		return FALSE;
+	}
+
+	GetAlarmManager()->AlarmMessage(L"cipher benchmark done, see log");
+
+	return TRUE;
+}
+
+RwBool CDBOCheatCommand::OnTSCompile(CNtlTokenizer* pLexer)
+{
+	CDboTSCMain* pTSCMain = GetTSCMain();
+	if(!pTSCMain || !pTSCMain->IsCreated())
+		return FALSE;
+
+	if(!pTSCMain->CompileScripts())
+	{
+		GetAlarmManager()->AlarmMessage(L"ts compile failed, see log");
+		return FALSE;
+	}
+
+	GetAlarmManager()->AlarmMessage(L"ts compiled");
+
+	return TRUE;
+}
+
 RwBool CDBOCheatCommand::OnPlayManySound(CNtlTokenizer* pLexer)
 {
 	if( false == m_listPlayList.empty() )
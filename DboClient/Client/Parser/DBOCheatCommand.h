@@ -105,6 +105,13 @@ protected:
 
 	RwBool      OnDialog(CNtlTokenizer* pLexer);				///< dialog  /dialog all open(close)
 	RwBool      OnPacketTrace(CNtlTokenizer* pLexer);			/// woosungs_test 20090804
+	RwBool      OnPacketCapture(CNtlTokenizer* pLexer);			///< /packetcapture start [file] | stop
+	RwBool      OnPacketReplay(CNtlTokenizer* pLexer);			///< /packetreplay file [fast] [norender] | stop
+	RwBool      OnTraceProfile(CNtlTokenizer* pLexer);			///< /traceprofile start | stop | dump [file]
+	RwBool      OnPacketProfile(CNtlTokenizer* pLexer);			///< /packetprofile start | stop | dump [num]
+	RwBool      OnFilterBench(CNtlTokenizer* pLexer);			///< /filterbench [loop]
+	RwBool      OnCipherBench(CNtlTokenizer* pLexer);			///< /cipherbench [packet size] [loop]
+	RwBool      OnTSCompile(CNtlTokenizer* pLexer);				///< /tscompile : ts\*.e  ts\*.tsb  compile
 
 	// sound
 	RwBool		OnPlayManySound(CNtlTokenizer* pLexer);
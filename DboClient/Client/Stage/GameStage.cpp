@@ -1086,28 +1086,19 @@ void CGameStage::CreateWorld(RwV3d& vAvatarPos)
 	str += "\\";
 	str += "#######.gwp";
 
-	FILE* pFile = NULL;
-	SPackResFileData sPackFileData;
-	RwBool bPack = GetNtlResourcePackManager()->LoadTerrain(str.c_str(), sPackFileData);
-
-	if(bPack)
-	{
-		pFile = fopen(sPackFileData.strPackFileName.c_str(), "rb");
-		if(pFile)
-			fseek(pFile, sPackFileData.uiOffset, SEEK_SET);
-	}
-	else
+	CNtlPLPackStream WorldStream;
+	if(!GetNtlResourcePackManager()->LoadTerrain(str.c_str(), WorldStream))
 	{
 		std::string strWorldFileName = ".";
 		strWorldFileName += str;
-		pFile = fopen(strWorldFileName.c_str(), "rb");
+		WorldStream.OpenFile(strWorldFileName.c_str());
 	}
 
 	// create a global world param
+	FILE* pFile = WorldStream.GetFile();
 	if(pFile)
 	{
 		LoadFileWorldState(dGET_WORLD_PARAM(), pFile);
-		fclose(pFile);
 	}
 
 	DBO_ASSERT(dNTL_WORLD_VERSION_COMPARE(dGET_WORLD_PARAM()->WorldVer, dNTL_WORLD_VERSION), "invalid world resource version. world(" << dGET_WORLD_PARAM()->WorldProjectFolderName << ") support_version(" << dNTL_WORLD_VERSION << ") resource_version(" << dGET_WORLD_PARAM()->WorldVer << ")");
@@ -3,6 +3,7 @@
 
 // core
 #include "NtlLoadingController.h"
+#include "NtlTraceProfiler.h"
 
 // simulation
 #include "NtlSLLogic.h"
@@ -59,12 +60,22 @@ CGameLoadingThread::~CGameLoadingThread( void )
 
 int CGameLoadingThread::ThreadCallBackFunc( void* pParam )
 {
+	// thread loading    pParam  NULL ̰ main thread  Ҹ
+	if ( pParam ) NTL_TRACE_THREAD( "GameLoading" );
+
 	SetLoadState( eGAME_LOAD_STATE_LOADING );
 
-	if ( m_pGameStage ) m_pGameStage->MutiThreadLoading();
+	if ( m_pGameStage )
+	{
+		NTL_TRACE_SCOPE( "CGameStage::MutiThreadLoading" );
+		m_pGameStage->MutiThreadLoading();
+	}
 
 	SetLoadState( eGAME_LOAD_STATE_LOADED );
 
+	// stage  ҷ   thread  Ƿ   trace  Ѵ
+	if ( pParam ) NTL_TRACE_THREAD_EXIT();
+
 	return RESULT_THREAD_SUCCESS;
 }
 
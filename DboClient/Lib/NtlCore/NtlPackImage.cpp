@@ -53,13 +53,28 @@ void RegisterOldCallBack()
 
 RwTexture *Ntl_D3D9DDSTextureRead(SNtlPackImage *pPackImage)
 {
-	RegisterNewCallBack();
+	// data in memory is read through a memory stream, it needs no file system hook.
+	RwBool bPackData = (pPackImage->pPackData != NULL);
+	if(!bPackData)
+		RegisterNewCallBack();
 
 	RwStream *stream = NULL;
 	RwRaster *pRaster = NULL;
 	RwTexture *pTexture = NULL;
+	RwMemory memory;
+
+	if(bPackData)
+	{
+		memory.start	= (RwUInt8 *)pPackImage->pPackData;
+		memory.length	= pPackImage->uiPackSize;
+
+		stream = RwStreamOpen(rwSTREAMMEMORY, rwSTREAMREAD, &memory);
+	}
+	else
+	{
+		stream = RwStreamOpen(rwSTREAMFILENAME, rwSTREAMREAD, pPackImage);
+	}
 
-	stream = RwStreamOpen(rwSTREAMFILENAME, rwSTREAMREAD, pPackImage);
 	if (!stream)
 		goto ImagePackTextureLoad_Exit;
 		
@@ -89,7 +104,8 @@ RwTexture *Ntl_D3D9DDSTextureRead(SNtlPackImage *pPackImage)
 	RwTextureSetName(pTexture, pPackImage->pName);
 
 ImagePackTextureLoad_Exit:	
-	RegisterOldCallBack();
+	if(!bPackData)
+		RegisterOldCallBack();
 
 	return pTexture;
 }
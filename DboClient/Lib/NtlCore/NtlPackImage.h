@@ -20,8 +20,9 @@ struct SNtlPackImage
 	std::string		strPackFileName;	//Pack ̸
 	RwUInt32		uiPackOffset;		//Offset
 	RwUInt32		uiPackSize;			//File Size
+	const RwUInt8	*pPackData;			//Pack data already in memory (dds only), read instead of the file
 	
-	SNtlPackImage() : pName(NULL), pMaskName(NULL), uiPackOffset(0), uiPackSize(0) {}
+	SNtlPackImage() : pName(NULL), pMaskName(NULL), uiPackOffset(0), uiPackSize(0), pPackData(NULL) {}
 };
 
 RwTexture	*Ntl_D3D9DDSTextureRead(SNtlPackImage *pPackImage);
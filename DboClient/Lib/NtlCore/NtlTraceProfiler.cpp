@@ -0,0 +1,429 @@
+#include "precomp_ntlcore.h"
+#include "NtlTraceProfiler.h"
+
+#include <intrin.h>
+#include <vector>
+#include <algorithm>
+
+// core
+#include "NtlDebug.h"
+#include "NtlCoreUtil.h"
+
+
+struct sNTL_TRACE_THREAD
+{
+	DWORD				dwThreadId;
+	RwChar				chName[64];
+
+	sNTL_TRACE_EVENT	*pEvents;				///<  ߿ ó   . ̸  thread  NULL
+	RwUInt32			uiMask;
+
+	volatile RwUInt32	uiWritePos;				///< ݱ  event . ڱ thread  .
+	RwUInt32			uiStartPos;				///< Start  uiWritePos
+
+	volatile LONG		lWriting;				///< event   ̸ 1. DumpChromeTrace  ⸦ ٸ.
+	RwBool				bExited;				///< thread  . dump   ֵ  ξٰ .
+};
+
+
+namespace
+{
+	typedef std::vector<sNTL_TRACE_THREAD*> VecThread;
+
+	VecThread				g_vecThread;
+
+	CRITICAL_SECTION		g_csThread;
+	LONG					g_lCSInit = 0;
+
+	__declspec(thread) sNTL_TRACE_THREAD *g_pThreadTrace = NULL;
+
+
+	void DeleteThread(sNTL_TRACE_THREAD *pThread)
+	{
+		NTL_ARRAY_DELETE(pThread->pEvents);
+		NTL_DELETE(pThread);
+	}
+
+	// g_csThread ȿ θ.
+	void DeleteExitedThread(void)
+	{
+		VecThread::iterator it = g_vecThread.begin();
+		while(it != g_vecThread.end())
+		{
+			if((*it)->bExited)
+			{
+				DeleteThread(*it);
+				it = g_vecThread.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	CRITICAL_SECTION* GetThreadCS(void)
+	{
+		// ó θ thread  ʱȭ Ҷ ٸ thread  ٸ.
+		if(InterlockedCompareExchange(&g_lCSInit, 1, 0) == 0)
+		{
+			InitializeCriticalSection(&g_csThread);
+			InterlockedExchange(&g_lCSInit, 2);
+		}
+
+		while(g_lCSInit != 2)
+			Sleep(0);
+
+		return &g_csThread;
+	}
+
+	void WriteJsonString(FILE *fp, const RwChar *pStr)
+	{
+		fputc('"', fp);
+
+		for(; *pStr; ++pStr)
+		{
+			if(*pStr == '"' || *pStr == '\\')
+				fputc('\\', fp);
+
+			if((RwUInt8)*pStr < 0x20)
+				continue;
+
+			fputc(*pStr, fp);
+		}
+
+		fputc('"', fp);
+	}
+}
+
+
+volatile RwBool		CNtlTraceProfiler::m_bEnabled		= FALSE;
+RwUInt32			CNtlTraceProfiler::m_uiEventCount	= NTL_TRACE_DEFAULT_EVENT_COUNT;
+
+unsigned __int64	CNtlTraceProfiler::m_ui64StartTsc	= 0;
+LARGE_INTEGER		CNtlTraceProfiler::m_liStartCounter;
+
+LARGE_INTEGER		CNtlTraceProfiler::m_liLastFrame;
+RwReal				CNtlTraceProfiler::m_afFrameTime[NTL_TRACE_FRAME_HISTORY];
+RwUInt32			CNtlTraceProfiler::m_uiFrameCount	= 0;
+
+
+void CNtlTraceProfiler::Start(RwUInt32 uiEventCount /*= NTL_TRACE_DEFAULT_EVENT_COUNT*/)
+{
+	RwUInt32 uiCount = 2;
+	while(uiCount < uiEventCount)
+		uiCount <<= 1;
+
+	m_uiEventCount = uiCount;
+
+	EnterCriticalSection(GetThreadCS());
+
+	DeleteExitedThread();
+
+	for(VecThread::iterator it = g_vecThread.begin(); it != g_vecThread.end(); ++it)
+		(*it)->uiStartPos = (*it)->uiWritePos;
+
+	LeaveCriticalSection(GetThreadCS());
+
+	m_uiFrameCount		= 0;
+	m_liLastFrame.QuadPart = 0;
+
+	QueryPerformanceCounter(&m_liStartCounter);
+	m_ui64StartTsc = __rdtsc();
+
+	m_bEnabled = TRUE;
+
+	NtlLogFilePrintArgs("trace profiler : start, %u events per thread", m_uiEventCount);
+}
+
+void CNtlTraceProfiler::Stop(void)
+{
+	if(!m_bEnabled)
+		return;
+
+	// Write  lWriting   ߳ ʵ interlocked  .
+	InterlockedExchange((volatile LONG*)&m_bEnabled, FALSE);
+
+	sNTL_TRACE_FRAME_STAT sStat;
+	GetFrameStat(sStat);
+
+	NtlLogFilePrintArgs("trace profiler : stop, last %u frames avg %.2f ms, min %.2f ms, max %.2f ms, 95%% %.2f ms",
+						sStat.uiFrameCount, sStat.fAvgTime, sStat.fMinTime, sStat.fMaxTime, sStat.f95Time);
+}
+
+void CNtlTraceProfiler::Destroy(void)
+{
+	m_bEnabled = FALSE;
+
+	if(g_lCSInit != 2)
+		return;
+
+	EnterCriticalSection(&g_csThread);
+
+	for(VecThread::iterator it = g_vecThread.begin(); it != g_vecThread.end(); ++it)
+		DeleteThread(*it);
+
+	g_vecThread.clear();
+
+	LeaveCriticalSection(&g_csThread);
+
+	g_pThreadTrace = NULL;
+}
+
+sNTL_TRACE_THREAD* CNtlTraceProfiler::GetThread(void)
+{
+	if(g_pThreadTrace)
+		return g_pThreadTrace;
+
+	sNTL_TRACE_THREAD *pThread = NTL_NEW sNTL_TRACE_THREAD;
+
+	pThread->dwThreadId	= GetCurrentThreadId();
+	pThread->pEvents	= NULL;
+	pThread->uiMask		= 0;
+	pThread->uiWritePos	= 0;
+	pThread->uiStartPos	= 0;
+	pThread->lWriting	= 0;
+	pThread->bExited	= FALSE;
+
+	sprintf_s(pThread->chName, sizeof(pThread->chName), "Thread %u", pThread->dwThreadId);
+
+	EnterCriticalSection(GetThreadCS());
+	g_vecThread.push_back(pThread);
+	LeaveCriticalSection(GetThreadCS());
+
+	g_pThreadTrace = pThread;
+
+	return pThread;
+}
+
+void CNtlTraceProfiler::SetThreadName(const RwChar *pName)
+{
+	sNTL_TRACE_THREAD *pThread = GetThread();
+
+	EnterCriticalSection(GetThreadCS());
+	strcpy_s(pThread->chName, sizeof(pThread->chName), pName);
+	LeaveCriticalSection(GetThreadCS());
+}
+
+void CNtlTraceProfiler::ReleaseThread(void)
+{
+	sNTL_TRACE_THREAD *pThread = g_pThreadTrace;
+	if(!pThread)
+		return;
+
+	g_pThreadTrace = NULL;
+
+	EnterCriticalSection(GetThreadCS());
+
+	if(m_bEnabled && pThread->pEvents)
+	{
+		//  ̸ dump   ֵ  ΰ,  Start  dump  .
+		pThread->bExited = TRUE;
+	}
+	else
+	{
+		g_vecThread.erase(std::find(g_vecThread.begin(), g_vecThread.end(), pThread));
+		DeleteThread(pThread);
+	}
+
+	LeaveCriticalSection(GetThreadCS());
+}
+
+void CNtlTraceProfiler::Write(RwUInt32 uiType, const RwChar *pName)
+{
+	sNTL_TRACE_THREAD *pThread = GetThread();
+
+	//  ̶  ˸ ڿ ٽ ȮѴ. Stop Ŀ DumpChromeTrace    0  Ǳ⸦ ٸ.
+	InterlockedExchange(&pThread->lWriting, 1);
+
+	if(m_bEnabled)
+	{
+		if(!pThread->pEvents)
+		{
+			// ring buffer  ڱ thread  , dump  lWriting  0   ڿ д´.
+			pThread->uiMask		= m_uiEventCount - 1;
+			pThread->pEvents	= NTL_NEW sNTL_TRACE_EVENT[m_uiEventCount];
+		}
+
+		RwUInt32 uiPos = pThread->uiWritePos;
+
+		sNTL_TRACE_EVENT &sEvent = pThread->pEvents[uiPos & pThread->uiMask];
+		sEvent.pName	= pName;
+		sEvent.ui64Tsc	= __rdtsc();
+		sEvent.uiType	= uiType;
+
+		pThread->uiWritePos = uiPos + 1;
+	}
+
+	InterlockedExchange(&pThread->lWriting, 0);
+}
+
+void CNtlTraceProfiler::Begin(const RwChar *pName)
+{
+	if(!m_bEnabled)
+		return;
+
+	Write(NTL_TRACE_EVENT_BEGIN, pName);
+}
+
+void CNtlTraceProfiler::End(void)
+{
+	if(!m_bEnabled)
+		return;
+
+	Write(NTL_TRACE_EVENT_END, NULL);
+}
+
+void CNtlTraceProfiler::FrameMark(void)
+{
+	if(!m_bEnabled)
+		return;
+
+	Write(NTL_TRACE_EVENT_FRAME, "Frame");
+
+	LARGE_INTEGER liNow, liFreq;
+	QueryPerformanceCounter(&liNow);
+	QueryPerformanceFrequency(&liFreq);
+
+	if(m_liLastFrame.QuadPart != 0)
+	{
+		RwReal fTime = (RwReal)( (double)(liNow.QuadPart - m_liLastFrame.QuadPart) * 1000.0 / (double)liFreq.QuadPart );
+		m_afFrameTime[m_uiFrameCount % NTL_TRACE_FRAME_HISTORY] = fTime;
+		m_uiFrameCount++;
+	}
+
+	m_liLastFrame = liNow;
+}
+
+void CNtlTraceProfiler::GetFrameStat(sNTL_TRACE_FRAME_STAT &sStat)
+{
+	memset(&sStat, 0, sizeof(sStat));
+
+	RwUInt32 uiCount = m_uiFrameCount < NTL_TRACE_FRAME_HISTORY ? m_uiFrameCount : NTL_TRACE_FRAME_HISTORY;
+	if(uiCount == 0)
+		return;
+
+	RwReal afSorted[NTL_TRACE_FRAME_HISTORY];
+	memcpy(afSorted, m_afFrameTime, sizeof(RwReal) * uiCount);
+	std::sort(afSorted, afSorted + uiCount);
+
+	RwReal fSum = 0.0f;
+	for(RwUInt32 i = 0; i < uiCount; ++i)
+		fSum += afSorted[i];
+
+	sStat.uiFrameCount	= uiCount;
+	sStat.fAvgTime		= fSum / (RwReal)uiCount;
+	sStat.fMinTime		= afSorted[0];
+	sStat.fMaxTime		= afSorted[uiCount - 1];
+	sStat.f95Time		= afSorted[(uiCount * 95) / 100];
+}
+
+RwBool CNtlTraceProfiler::DumpChromeTrace(const RwChar *pFileName)
+{
+	// ٸ thread    event   ʵ  .
+	Stop();
+
+	FILE *fp = NULL;
+	if(fopen_s(&fp, pFileName, "wt") != 0 || fp == NULL)
+	{
+		NtlLogFilePrintArgs("trace profiler : can not open file (%s)", pFileName);
+		return FALSE;
+	}
+
+	// TSC  us  ٲ۴.
+	LARGE_INTEGER liNow, liFreq;
+	QueryPerformanceCounter(&liNow);
+	QueryPerformanceFrequency(&liFreq);
+
+	unsigned __int64 ui64NowTsc = __rdtsc();
+
+	double dElapsedUs = (double)(liNow.QuadPart - m_liStartCounter.QuadPart) * 1000000.0 / (double)liFreq.QuadPart;
+	double dTscPerUs = dElapsedUs > 0.0 ? (double)(ui64NowTsc - m_ui64StartTsc) / dElapsedUs : 1.0;
+	if(dTscPerUs <= 0.0)
+		dTscPerUs = 1.0;
+
+	fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+	RwBool bFirst = TRUE;
+	RwUInt32 uiTotal = 0;
+
+	EnterCriticalSection(GetThreadCS());
+
+	// Stop    thread  ĥ  ٸ. Write  g_csThread   ʴ´.
+	for(VecThread::iterator it = g_vecThread.begin(); it != g_vecThread.end(); ++it)
+	{
+		while((*it)->lWriting)
+			SwitchToThread();
+	}
+
+	for(VecThread::iterator it = g_vecThread.begin(); it != g_vecThread.end(); ++it)
+	{
+		sNTL_TRACE_THREAD *pThread = *it;
+
+		fprintf(fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", bFirst ? "" : ",\n", pThread->dwThreadId);
+		WriteJsonString(fp, pThread->chName);
+		fprintf(fp, "}}");
+		bFirst = FALSE;
+
+		if(!pThread->pEvents)
+			continue;
+
+		RwUInt32 uiEnd		= pThread->uiWritePos;
+		RwUInt32 uiBegin	= pThread->uiStartPos;
+		if(uiEnd - uiBegin > pThread->uiMask + 1)
+			uiBegin = uiEnd - (pThread->uiMask + 1);
+
+		// ring buffer   begin   end  ,   begin   ݴ´.
+		RwInt32 iDepth = 0;
+		double dLastUs = 0.0;
+
+		for(RwUInt32 uiPos = uiBegin; uiPos != uiEnd; ++uiPos)
+		{
+			const sNTL_TRACE_EVENT &sEvent = pThread->pEvents[uiPos & pThread->uiMask];
+
+			if(sEvent.ui64Tsc < m_ui64StartTsc)
+				continue;
+
+			double dUs = (double)(sEvent.ui64Tsc - m_ui64StartTsc) / dTscPerUs;
+			dLastUs = dUs;
+
+			switch(sEvent.uiType)
+			{
+			case NTL_TRACE_EVENT_BEGIN:
+				fprintf(fp, ",\n{\"name\":");
+				WriteJsonString(fp, sEvent.pName ? sEvent.pName : "?");
+				fprintf(fp, ",\"ph\":\"B\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", pThread->dwThreadId, dUs);
+				iDepth++;
+				break;
+
+			case NTL_TRACE_EVENT_END:
+				if(iDepth == 0)
+					continue;
+
+				fprintf(fp, ",\n{\"ph\":\"E\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", pThread->dwThreadId, dUs);
+				iDepth--;
+				break;
+
+			case NTL_TRACE_EVENT_FRAME:
+				fprintf(fp, ",\n{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", pThread->dwThreadId, dUs);
+				break;
+			}
+
+			uiTotal++;
+		}
+
+		for(; iDepth > 0; --iDepth)
+			fprintf(fp, ",\n{\"ph\":\"E\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", pThread->dwThreadId, dLastUs);
+	}
+
+	DeleteExitedThread();
+
+	LeaveCriticalSection(GetThreadCS());
+
+	fprintf(fp, "\n]}\n");
+	fclose(fp);
+
+	NtlLogFilePrintArgs("trace profiler : dump (%s), %u events", pFileName, uiTotal);
+
+	return TRUE;
+}
@@ -0,0 +1,149 @@
+/*****************************************************************************
+ *
+ * File			: NtlTraceProfiler.h
+ * Copyright	: ()NTL
+ * Date			: 2026. 10. 17
+ * Abstract		: per-thread scoped trace profiler
+ *****************************************************************************
+ * Desc         : thread  begin / end event  TSC ð Բ ring buffer  Ѵ.
+ *				   ߿ lock   , ϵ  Chrome trace ( Perfetto )
+ *				  JSON   chrome://tracing ̳ ui.perfetto.dev    ִ.
+ *
+ *				  CProfileManager ( NtlProfiler.h )  main thread   tree ̰,
+ *				   profiler  loading / network thread   ð  ̴.
+ *
+ *				  ring buffer   ߿ ó event    , NTL_TRACE_THREAD_EXIT  Ѵ.
+ *				  scope ̸ pointer  ϹǷ ڿ   Ѵ.
+ *				  TSC  core  ȭǾ ִٰ Ѵ. ( invariant TSC )
+ *****************************************************************************/
+
+#ifndef __NTL_TRACE_PROFILER_H__
+#define __NTL_TRACE_PROFILER_H__
+
+// ּ óϸ NTL_TRACE_ macro   .
+#define _NTL_TRACE_PROFILE_ENABLE
+
+
+#define NTL_TRACE_DEFAULT_EVENT_COUNT		(64 * 1024)		///< thread  ring buffer event  ( 2  ¼ )
+#define NTL_TRACE_FRAME_HISTORY				256				///< frame 踦  ֱ frame 
+
+
+enum eNTL_TRACE_EVENT
+{
+	NTL_TRACE_EVENT_BEGIN,
+	NTL_TRACE_EVENT_END,
+	NTL_TRACE_EVENT_FRAME,
+
+	MAX_NTL_TRACE_EVENT
+};
+
+struct sNTL_TRACE_EVENT
+{
+	const RwChar		*pName;
+	unsigned __int64	ui64Tsc;
+	RwUInt32			uiType;					///< eNTL_TRACE_EVENT
+};
+
+struct sNTL_TRACE_FRAME_STAT
+{
+	RwUInt32			uiFrameCount;			///< 迡  frame 
+	RwReal				fAvgTime;				///< ms
+	RwReal				fMinTime;
+	RwReal				fMaxTime;
+	RwReal				f95Time;				///< 95 percentile
+};
+
+struct sNTL_TRACE_THREAD;
+
+
+class CNtlTraceProfiler
+{
+public:
+
+	/**
+	*  Ѵ.   dump 󿡼 .
+	* \param uiEventCount ó ϴ thread  ring buffer ũ, 2  ¼ øѴ.
+	*/
+	static void			Start(RwUInt32 uiEventCount = NTL_TRACE_DEFAULT_EVENT_COUNT);
+	static void			Stop(void);
+	static RwBool		IsEnabled(void)			{ return m_bEnabled; }
+
+	/**
+	* α׷  ring buffer   Ѵ. ϴ thread    ڿ ҷ Ѵ.
+	*/
+	static void			Destroy(void);
+
+	/**
+	*  thread  ̸. ̸   thread  "Thread <id>"  ´.
+	*/
+	static void			SetThreadName(const RwChar *pName);
+
+	/**
+	* thread    θ.  thread  ring buffer  Ѵ. (  ̸ dump ڿ  )
+	*/
+	static void			ReleaseThread(void);
+
+	static void			Begin(const RwChar *pName);
+	static void			End(void);
+
+	/**
+	* main loop  frame ۸ θ. trace  frame ǥø  frame 踦 Ѵ.
+	*/
+	static void			FrameMark(void);
+
+	static void			GetFrameStat(sNTL_TRACE_FRAME_STAT &sStat);
+
+	/**
+	*  ߰ Chrome trace JSON  Ѵ.
+	*/
+	static RwBool		DumpChromeTrace(const RwChar *pFileName);
+
+private:
+
+	static sNTL_TRACE_THREAD*	GetThread(void);
+	static void					Write(RwUInt32 uiType, const RwChar *pName);
+
+private:
+
+	static volatile RwBool		m_bEnabled;
+	static RwUInt32				m_uiEventCount;
+
+	static unsigned __int64		m_ui64StartTsc;
+	static LARGE_INTEGER		m_liStartCounter;
+
+	static LARGE_INTEGER		m_liLastFrame;
+	static RwReal				m_afFrameTime[NTL_TRACE_FRAME_HISTORY];
+	static RwUInt32				m_uiFrameCount;
+};
+
+
+class CNtlTraceScope
+{
+public:
+
+	CNtlTraceScope(const RwChar *pName)		{ CNtlTraceProfiler::Begin(pName); }
+	~CNtlTraceScope(void)					{ CNtlTraceProfiler::End(); }
+};
+
+
+#ifdef _NTL_TRACE_PROFILE_ENABLE
+
+#define NTL_TRACE_SCOPE(name)		CNtlTraceScope __ntlTraceScope(name)
+#define NTL_TRACE_BEGIN(name)		CNtlTraceProfiler::Begin(name)
+#define NTL_TRACE_END()				CNtlTraceProfiler::End()
+#define NTL_TRACE_THREAD(name)		CNtlTraceProfiler::SetThreadName(name)
+#define NTL_TRACE_THREAD_EXIT()		CNtlTraceProfiler::ReleaseThread()
+#define NTL_TRACE_FRAME()			CNtlTraceProfiler::FrameMark()
+
+#else
+
+#define NTL_TRACE_SCOPE(name)
+#define NTL_TRACE_BEGIN(name)
+#define NTL_TRACE_END()
+#define NTL_TRACE_THREAD(name)
+#define NTL_TRACE_THREAD_EXIT()
+#define NTL_TRACE_FRAME()
+
+#endif
+
+#endif
@@ -98,6 +98,18 @@ namespace RWS
    //
    static CRegisteredMsgs pRMsgs;
 
+   // Registered events hashed by ui_msgname, so RegisterMsg doesn't walk every event
+   //
+   //
+   static const RwUInt32 REGISTERED_MSG_HASH_SIZE = 256;
+
+   static CRegisteredMsgs *pRMsgHash[REGISTERED_MSG_HASH_SIZE];
+
+   // Next CRegisteredMsgs::ui_index, indices are never reused so a CEventFuncTable
+   // can't map an unregistered event onto a newer one.
+   //
+   static RwUInt32 uiNextRMsgIndex = 0;
+
 
    /**
    *
@@ -600,7 +612,8 @@ namespace RWS
 
       // Check if this message has already been registered
       //   
-      CRegisteredMsgs *pRMsg = pRMsgs.p_next;
+      CRegisteredMsgs **ppRMsgBucket = &pRMsgHash[ui_msgname & (REGISTERED_MSG_HASH_SIZE - 1)];
+      CRegisteredMsgs *pRMsg = *ppRMsgBucket;
       
       while (pRMsg)
       {
@@ -652,7 +665,7 @@ namespace RWS
                RWS_RETURNVOID();
             }
          }
-         pRMsg = pRMsg->p_next;
+         pRMsg = pRMsg->p_hashnext;
       }
 
       // Message Not Registered, create a new event/message handler and register this message,
@@ -681,6 +694,13 @@ namespace RWS
       //
       pRMsgs.p_next = pRMsg;
 
+      // Link to head of the hash bucket
+      //
+      pRMsg->p_hashnext = *ppRMsgBucket;
+      *ppRMsgBucket = pRMsg;
+
+      pRMsg->ui_index = uiNextRMsgIndex++;
+
       // operator new some memory to store a copy of this string, this is important
       // as the address of the string which has been passed maybe on the stack
       //
@@ -797,6 +817,17 @@ namespace RWS
             CEventVisualization::EventUnRegistered(*pRMsg);
 #endif
 
+            // Unlink from the hash bucket, ui_msgname is still valid here
+            //
+            CRegisteredMsgs **ppRMsgBucket = &pRMsgHash[pRMsg->ui_msgname & (REGISTERED_MSG_HASH_SIZE - 1)];
+
+            while (*ppRMsgBucket && *ppRMsgBucket != pRMsg)
+            {
+               ppRMsgBucket = &(*ppRMsgBucket)->p_hashnext;
+            }
+
+            if (*ppRMsgBucket) *ppRMsgBucket = pRMsg->p_hashnext;
+
             // Free the memory associated with the name string
             //
 			RWS_ARRAY_DELETE(pRMsg->p_msgname);
@@ -240,9 +240,12 @@
 // RenderWare Studio Includes
 //
 
+#include <vector>
+
 #include <rwcore.h>
 #include <rpworld.h>
 #include "ceventvisualisation.h"
+#include "debugmacros.h"
 
 struct RpAtomic;  // forward reference to the RpAtomic struct, for the RpCEventHandlerAtomicPlugin functions.
 
@@ -354,8 +357,10 @@ namespace RWS
       CRegisteredMsgs(void) : 
          p_msgname(0),
          p_format(0),
+         ui_index(0),
          p_next(0),
          p_prev(0),
+         p_hashnext(0),
          iCountRegistered(0),
          PendingUnlink(false),
          HandlingEvent(false)
@@ -371,8 +376,13 @@ namespace RWS
       RwUInt32 ui_msgname;                      /**< Unique Id, generated from p_msgname */
       RwUInt32 ui_format;                       /**< Unique Id, generated from p_format */
 
+      RwUInt32 ui_index;                        /**< Compact integer id, assigned in registration order
+                                                     and never reused, see \ref CEventFuncTable */
+
       CRegisteredMsgs *p_next;                  /**< Pointer to the next CRegisteredMsgs  */
       CRegisteredMsgs *p_prev;                  /**< Pointer to the previous CRegisteredMsgs */
+      CRegisteredMsgs *p_hashnext;              /**< Pointer to the next CRegisteredMsgs in the same
+                                                     ui_msgname hash bucket */
 
       RwInt32 iCountRegistered;                 /**< A reference count, the number of times this
                                                    event has been registered.   */
@@ -1172,6 +1182,91 @@ namespace RWS
    } ;
 
 
+   /**
+   *
+   *  \ingroup CEventHandler
+   *
+   *  Maps events to member functions of an event handler, replaces the
+   *  std::map<const CRegisteredMsgs*, FUNC> lookups done in HandleEvents.
+   *
+   *  The table is indexed directly by \ref CRegisteredMsgs::ui_index so finding the
+   *  function of an event costs two array reads instead of a tree search. Two bytes
+   *  per registered event are kept for the slot, the functions themselves are stored densely.
+   *
+   *  \verbatim
+
+      typedef void (CMyClass::*FuncEventHander)(RWS::CMsg &pMsg);
+      typedef RWS::CEventFuncTable<FuncEventHander> MapFuncEventHandler;
+
+      m_mapEventFunc[g_EventUpdateTick.Get_pEventId()] = &CMyClass::UpdateTickEventHandler;
+
+      void CMyClass::HandleEvents(RWS::CMsg &pMsg)
+      {
+         FuncEventHander pFunc = m_mapEventFunc.Find(pMsg.Id);
+         if(pFunc)
+            (this->*pFunc)(pMsg);
+      }
+
+      \endverbatim
+   *
+   */
+
+   template <class FUNC>
+   class CEventFuncTable
+   {
+   public:
+
+      /**
+      *
+      *  pRMsg must be a registered event id, Get_pEventId returns 0 before RegisterMsg.
+      *
+      */
+      FUNC &operator[](const CRegisteredMsgs *pRMsg)
+      {
+         RWS_ASSERT(pRMsg, "CEventFuncTable::operator[] pRMsg==0, event is not registered.");
+
+         if (pRMsg->ui_index >= m_vecSlot.size())
+         {
+            m_vecSlot.resize(pRMsg->ui_index + 1, 0);
+         }
+
+         RwUInt16 &wSlot = m_vecSlot[pRMsg->ui_index];
+         if (wSlot == 0)
+         {
+            m_vecFunc.push_back(0);
+            wSlot = static_cast<RwUInt16>(m_vecFunc.size());
+         }
+
+         return m_vecFunc[wSlot - 1];
+      }
+
+      FUNC Find(const CRegisteredMsgs *pRMsg) const
+      {
+         if (!pRMsg || pRMsg->ui_index >= m_vecSlot.size())
+         {
+            return 0;
+         }
+
+         RwUInt16 wSlot = m_vecSlot[pRMsg->ui_index];
+
+         return wSlot ? m_vecFunc[wSlot - 1] : 0;
+      }
+
+      void clear(void)
+      {
+         m_vecSlot.clear();
+         m_vecFunc.clear();
+      }
+
+      RwBool empty(void) const {return m_vecFunc.empty();}
+
+   private:
+
+      std::vector<RwUInt16> m_vecSlot;           /**< ui_index -> slot in m_vecFunc + 1, 0 if not mapped */
+      std::vector<FUNC> m_vecFunc;
+   };
+
+
    namespace RpAtomicToEventHandler
    {
       /**
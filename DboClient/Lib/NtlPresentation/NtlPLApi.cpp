@@ -117,22 +117,19 @@ RpClump * API_PL_LoadClump( const RwChar * filename )
 	RwStream    *stream = NULL;
 	RpClump     *clump = NULL;
 	RwChar	    *pathName;
-	void		*fp = NULL;
+	RwMemory	memory;
 
 	//   
 	pathName = API_PL_PathnameCreate(filename);
 
-	SPackResFileData sPackFileData;
-	BOOL bPack = GetNtlResourcePackManager()->LoadObject(filename, sPackFileData);
+	CNtlPLPackElementData ElementData;
+	BOOL bPack = GetNtlResourcePackManager()->LoadObject(filename, ElementData);
 
 	if(bPack)
 	{
-		fp = RwFopen(sPackFileData.strPackFileName.c_str(), "rb");
-		if(fp)
-		{
-			RwFseek(fp, sPackFileData.uiOffset, RTFILE_POS_BEGIN);
-			stream = RwStreamOpen(rwSTREAMFILE, rwSTREAMREAD, fp);
-		}
+		memory.start	= (RwUInt8*)ElementData.GetData();
+		memory.length	= ElementData.GetSize();
+		stream = RwStreamOpen(rwSTREAMMEMORY, rwSTREAMREAD, &memory);
 	}
 	else
 	{	
@@ -146,12 +143,6 @@ RpClump * API_PL_LoadClump( const RwChar * filename )
 		RwStreamClose(stream, NULL);
 	}
 
-	if(fp)
-	{
-		RwFclose(fp);
-		fp = NULL;
-	}
-
 	API_PL_PathnameDestroy(pathName);
 
 	return clump;
@@ -164,19 +155,16 @@ RtDict*	API_PL_LoadUVAnimDict(const RwChar* strFullName)
 
     RtDict* pDict = NULL;
 	RwStream* pStream = NULL;
-	void *fp = NULL;
+	RwMemory memory;
 
-	SPackResFileData sPackFileData;
-	RwBool bPack = GetNtlResourcePackManager()->LoadObject(strFullName, sPackFileData);
+	CNtlPLPackElementData ElementData;
+	RwBool bPack = GetNtlResourcePackManager()->LoadObject(strFullName, ElementData);
 	if(bPack)
 	{
-		fp = RwFopen(sPackFileData.strPackFileName.c_str(), "rb");
-		if(fp == NULL)
-			return NULL;
-
-		RwFseek(fp, sPackFileData.uiOffset, RTFILE_POS_BEGIN);
+		memory.start	= (RwUInt8*)ElementData.GetData();
+		memory.length	= ElementData.GetSize();
 
-		pStream = RwStreamOpen(rwSTREAMFILE, rwSTREAMREAD, fp);
+		pStream = RwStreamOpen(rwSTREAMMEMORY, rwSTREAMREAD, &memory);
 	}
 	else
 		pStream = RwStreamOpen(rwSTREAMFILENAME, rwSTREAMREAD, strFullName);
@@ -190,9 +178,6 @@ RtDict*	API_PL_LoadUVAnimDict(const RwChar* strFullName)
 		RwStreamClose(pStream, NULL);
 	}
 
-	if(fp)
-		RwFclose(fp);
-
 	return pDict;
 }
 
@@ -1012,20 +1012,11 @@ RwBool CNtlPLPropertyContainer::LoadCharacter(const RwChar *pFileName)
 // by agebreak
 RwBool CNtlPLPropertyContainer::LoadEffect(const RwChar *pFileName)
 {
-	FILE* pFile = NULL;
-
-	SPackResFileData sPackFileData;
-	RwBool bPack = GetNtlResourcePackManager()->LoadObject(pFileName, sPackFileData);
-	if(bPack)
-	{
-		pFile = fopen(sPackFileData.strPackFileName.c_str(), "rb");
-		if(pFile)
-			fseek(pFile, sPackFileData.uiOffset, SEEK_SET);
-	}
-
-	if(pFile == NULL)
-		pFile = fopen(pFileName, "rb");
+	CNtlPLPackStream EffectStream;
+	if(!GetNtlResourcePackManager()->LoadObject(pFileName, EffectStream))
+		EffectStream.OpenFile(pFileName);
 
+	FILE* pFile = EffectStream.GetFile();
 	if (pFile == NULL)
 	{
 		return FALSE;
@@ -1036,14 +1027,12 @@ RwBool CNtlPLPropertyContainer::LoadEffect(const RwChar *pFileName)
 	fread(strFileHeader,				strlen(EFFECT_FILE_HEADER),					1,			pFile);
 	if (_stricmp(strFileHeader, EFFECT_FILE_HEADER) != 0)
 	{
-		fclose(pFile);
 		return FALSE;
 	}
 
 	fread(&CNtlResourceEffect::m_nVersion,			sizeof(RwUInt32),							1,			pFile);
 	if (CNtlResourceEffect::m_nVersion < 0x00000002)
 	{
-		fclose(pFile);
 		return FALSE;
 	}
 
@@ -1115,7 +1104,6 @@ RwBool CNtlPLPropertyContainer::LoadEffect(const RwChar *pFileName)
 		}
 	}
 
-	fclose(pFile);
 	return TRUE;
 }
 
@@ -456,20 +456,17 @@ CNtlPLResource* CNtlPLResourceManager::LoadDefault(const char *pStrName, const c
 	if(pResource == NULL)
 	{
 		RwStream *pStream = NULL;
-		void *fp = NULL;
+		RwMemory memory;
 
 
-		SPackResFileData sPackFileData;
-		BOOL bPack = GetNtlResourcePackManager()->LoadObject(pStrName, sPackFileData);
+		CNtlPLPackElementData ElementData;
+		BOOL bPack = GetNtlResourcePackManager()->LoadObject(pStrName, ElementData);
 
 		if(bPack)
 		{
-			fp = RwFopen(sPackFileData.strPackFileName.c_str(), "rb");
-			if(fp == NULL)
-				return NULL;
-
-			RwFseek(fp, sPackFileData.uiOffset, RTFILE_POS_BEGIN);
-			pStream = RwStreamOpen(rwSTREAMFILE, rwSTREAMREAD, fp);
+			memory.start	= (RwUInt8*)ElementData.GetData();
+			memory.length	= ElementData.GetSize();
+			pStream = RwStreamOpen(rwSTREAMMEMORY, rwSTREAMREAD, &memory);
 		}
 		else
 		{
@@ -567,14 +564,8 @@ CNtlPLResource* CNtlPLResourceManager::LoadDefault(const char *pStrName, const c
 		}
 		else    // شǴ Clump Load ϸ NULL ȯѴ. (by agebreak 2006-11-29)
 		{
-			if(fp)
-				RwFclose(fp);
-
 			return NULL;
 		}
-
-		if(fp)
-			RwFclose(fp);
 	}
 	else
 	{
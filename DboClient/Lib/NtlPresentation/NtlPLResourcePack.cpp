@@ -9,86 +9,560 @@
 #include "NtlCoreUtil.h"
 #include "NtlPackImage.h"
 
+#include <algorithm>
+
+#include "zlib.h"
+
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-CNtlPLResourcePack::CNtlPLResourcePack()
+struct SFilePackEntryLess
 {
+	const RwChar *pNamePool;
+
+	SFilePackEntryLess(const RwChar *pPool) : pNamePool(pPool) {}
+
+	bool operator () (const SFilePackEntry& sLeft, const SFilePackEntry& sRight) const
+	{
+		return strcmp(pNamePool + sLeft.uiNameOffset, pNamePool + sRight.uiNameOffset) < 0;
+	}
+};
+
+CNtlPLPackIndex::CNtlPLPackIndex()
+{
+	m_bSorted = TRUE;
 }
 
-CNtlPLResourcePack::~CNtlPLResourcePack()
+CNtlPLPackIndex::~CNtlPLPackIndex()
 {
-	ClearHeader();
 }
 
-void CNtlPLResourcePack::ClearHeader(void)
+void CNtlPLPackIndex::Clear(void)
 {
-	HMapPackHeader::iterator it;
-	for(it = m_hmapPackHeader.begin(); it != m_hmapPackHeader.end(); it++)
+	m_vecEntry.clear();
+	m_vecNamePool.clear();
+	m_vecSlot.clear();
+	m_bSorted = TRUE;
+}
+
+void CNtlPLPackIndex::Reserve(RwUInt32 uiCount, RwUInt32 uiNamePoolSize)
+{
+	m_vecEntry.reserve(uiCount);
+	m_vecNamePool.reserve(uiNamePoolSize);
+
+	RwUInt32 uiSlotCount = 16;
+	while(uiSlotCount < uiCount * 2)
+		uiSlotCount <<= 1;
+
+	if(uiSlotCount > m_vecSlot.size())
+		Rehash(uiSlotCount);
+}
+
+const SFilePackEntry* CNtlPLPackIndex::Insert(RwUInt8 byUnit, const RwChar *pName, RwUInt32 uiSize, RwUInt32 uiOffset, RwUInt32 uiPackedSize, RwUInt8 byCompress)
+{
+	if(pName == NULL)
+		return NULL;
+
+	RwUInt32 uiLength;
+	RwUInt32 uiHash = Hash(pName, uiLength);
+	if(uiLength == 0 || uiLength > 0xffff)
+		return NULL;
+
+	// keep the load factor under 1/2.
+	if((m_vecEntry.size() + 1) * 2 > m_vecSlot.size())
+		Rehash(m_vecSlot.empty() ? 16 : (RwUInt32)m_vecSlot.size() * 2);
+
+	RwUInt32 uiSlot = FindSlot(pName, uiLength, uiHash);
+	if(m_vecSlot[uiSlot] == 0)
 	{
-		NTL_DELETE( (*it).second );
+		SFilePackEntry sEntry;
+		sEntry.uiNameOffset	= (RwUInt32)m_vecNamePool.size();
+		sEntry.wNameLength	= (RwUInt16)uiLength;
+
+		for(RwUInt32 i = 0; i < uiLength; i++)
+			m_vecNamePool.push_back(Normalize(pName[i]));
+		m_vecNamePool.push_back(0);
+
+		m_vecEntry.push_back(sEntry);
+		m_vecSlot[uiSlot] = (RwUInt32)m_vecEntry.size();
+
+		m_bSorted = FALSE;
 	}
 
-	m_hmapPackHeader.clear();
+	SFilePackEntry *pEntry = &m_vecEntry[m_vecSlot[uiSlot] - 1];
+	pEntry->byUnitKey	= byUnit;
+	pEntry->byCompress	= byCompress;
+	pEntry->uiSize		= uiSize;
+	pEntry->uiOffset	= uiOffset;
+	pEntry->uiPackedSize	= byCompress == NTL_PACK_COMPRESS_NONE ? uiSize : uiPackedSize;
+
+	return pEntry;
 }
 
-void CNtlPLResourcePack::RegistHeaderName(const RwChar *pFileName)
+const SFilePackEntry* CNtlPLPackIndex::Find(const RwChar *pName) const
 {
-	m_strHeaderName = pFileName;
+	if(pName == NULL || m_vecSlot.empty())
+		return NULL;
+
+	RwUInt32 uiLength;
+	RwUInt32 uiHash = Hash(pName, uiLength);
+
+	RwUInt32 uiEntry = m_vecSlot[FindSlot(pName, uiLength, uiHash)];
+	if(uiEntry == 0)
+		return NULL;
+
+	return &m_vecEntry[uiEntry - 1];
 }
 
-void CNtlPLResourcePack::RegistDataName(const RwChar *pFileName)
+RwBool CNtlPLPackIndex::FindRange(const RwChar *pPrefix, RwUInt32& uiBegin, RwUInt32& uiEnd) const
 {
-	m_strDataName = pFileName;
+	uiBegin	= 0;
+	uiEnd	= 0;
+
+	if(pPrefix == NULL)
+		return FALSE;
+
+	NTL_ASSERT(m_bSorted, "CNtlPLPackIndex::FindRange, the index is not sorted");
+
+	RwUInt32 uiLength = (RwUInt32)strlen(pPrefix);
+
+	// first entry that isn't less than the prefix.
+	RwUInt32 uiLow = 0, uiHigh = GetCount();
+	while(uiLow < uiHigh)
+	{
+		RwUInt32 uiMid = (uiLow + uiHigh) / 2;
+		if(ComparePrefix(m_vecEntry[uiMid], pPrefix, uiLength) < 0)
+			uiLow = uiMid + 1;
+		else
+			uiHigh = uiMid;
+	}
+
+	uiBegin = uiLow;
+
+	// first entry past the ones that start with the prefix.
+	uiHigh = GetCount();
+	while(uiLow < uiHigh)
+	{
+		RwUInt32 uiMid = (uiLow + uiHigh) / 2;
+		if(ComparePrefix(m_vecEntry[uiMid], pPrefix, uiLength) <= 0)
+			uiLow = uiMid + 1;
+		else
+			uiHigh = uiMid;
+	}
+
+	uiEnd = uiLow;
+
+	return uiBegin < uiEnd;
+}
+
+const SFilePackEntry* CNtlPLPackIndex::GetEntry(RwUInt32 uiIndex) const
+{
+	if(uiIndex >= GetCount())
+		return NULL;
+
+	return &m_vecEntry[uiIndex];
+}
+
+void CNtlPLPackIndex::Sort(void)
+{
+	if(m_bSorted)
+		return;
+
+	std::sort(m_vecEntry.begin(), m_vecEntry.end(), SFilePackEntryLess(&m_vecNamePool[0]));
+	Rehash((RwUInt32)m_vecSlot.size());
+
+	m_bSorted = TRUE;
+}
+
+void CNtlPLPackIndex::Rehash(RwUInt32 uiSlotCount)
+{
+	m_vecSlot.assign(uiSlotCount, 0);
+
+	for(RwUInt32 i = 0; i < GetCount(); i++)
+	{
+		const RwChar *pName = GetName(&m_vecEntry[i]);
+
+		RwUInt32 uiLength;
+		RwUInt32 uiHash = Hash(pName, uiLength);
+
+		m_vecSlot[FindSlot(pName, uiLength, uiHash)] = i + 1;
+	}
+}
+
+RwUInt32 CNtlPLPackIndex::FindSlot(const RwChar *pName, RwUInt32 uiLength, RwUInt32 uiHash) const
+{
+	RwUInt32 uiMask = (RwUInt32)m_vecSlot.size() - 1;
+	RwUInt32 uiSlot = uiHash & uiMask;
+
+	while(m_vecSlot[uiSlot] != 0)
+	{
+		const SFilePackEntry& sEntry = m_vecEntry[m_vecSlot[uiSlot] - 1];
+		if(sEntry.wNameLength == uiLength && ComparePrefix(sEntry, pName, uiLength) == 0)
+			break;
+
+		uiSlot = (uiSlot + 1) & uiMask;
+	}
+
+	return uiSlot;
+}
+
+RwInt32 CNtlPLPackIndex::ComparePrefix(const SFilePackEntry& sEntry, const RwChar *pPrefix, RwUInt32 uiLength) const
+{
+	const RwUInt8 *pName = (const RwUInt8*)GetName(&sEntry);
+
+	for(RwUInt32 i = 0; i < uiLength; i++)
+	{
+		if(i >= sEntry.wNameLength)
+			return -1;
+
+		RwUInt8 byChar = (RwUInt8)Normalize(pPrefix[i]);
+		if(pName[i] != byChar)
+			return pName[i] < byChar ? -1 : 1;
+	}
+
+	return 0;
+}
+
+RwUInt32 CNtlPLPackIndex::Hash(const RwChar *pName, RwUInt32& uiLength)
+{
+	// FNV-1a
+	RwUInt32 uiHash = 2166136261U;
+
+	for(uiLength = 0; pName[uiLength] != 0; uiLength++)
+	{
+		uiHash ^= (RwUInt8)Normalize(pName[uiLength]);
+		uiHash *= 16777619U;
+	}
+
+	return uiHash;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CNtlPLPackDataUnit::CNtlPLPackDataUnit()
+{
+	m_hFile		= INVALID_HANDLE_VALUE;
+	m_hMapping	= NULL;
+	m_pView		= NULL;
+	m_uiSize	= 0;
+
+	::InitializeCriticalSection(&m_csStream);
 }
 
+CNtlPLPackDataUnit::~CNtlPLPackDataUnit()
+{
+	Close();
+
+	::DeleteCriticalSection(&m_csStream);
+}
+
+RwBool CNtlPLPackDataUnit::Open(const RwChar *pFileName)
+{
+	Close();
+
+	// the full path is kept so that later _chdir calls don't matter.
+	RwChar chFullPath[NTL_MAX_DIR_PATH];
+	DWORD dwLen = ::GetFullPathName(pFileName, NTL_MAX_DIR_PATH, chFullPath, NULL);
+	if(dwLen == 0 || dwLen >= NTL_MAX_DIR_PATH)
+		return FALSE;
+
+	m_hFile = ::CreateFile(chFullPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+	if(m_hFile == INVALID_HANDLE_VALUE)
+		return FALSE;
+
+	m_uiSize = ::GetFileSize(m_hFile, NULL);
+	if(m_uiSize == INVALID_FILE_SIZE)
+	{
+		Close();
+		return FALSE;
+	}
+
+	m_strFullPath = chFullPath;
+
+	if(m_uiSize == 0)
+		return TRUE;
+
+	// a unit that can't be mapped (out of address space) is still read through the handle.
+	m_hMapping = ::CreateFileMapping(m_hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	if(m_hMapping)
+	{
+		m_pView = (const RwUInt8*)::MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+		if(m_pView == NULL)
+		{
+			::CloseHandle(m_hMapping);
+			m_hMapping = NULL;
+		}
+	}
+
+	return TRUE;
+}
+
+void CNtlPLPackDataUnit::Close(void)
+{
+	if(m_pView)
+	{
+		::UnmapViewOfFile(m_pView);
+		m_pView = NULL;
+	}
+
+	if(m_hMapping)
+	{
+		::CloseHandle(m_hMapping);
+		m_hMapping = NULL;
+	}
+
+	::EnterCriticalSection(&m_csStream);
+
+	for(RwUInt32 i = 0; i < m_vecStream.size(); ++i)
+		fclose(m_vecStream[i]);
+
+	m_vecStream.clear();
+
+	if(m_hFile != INVALID_HANDLE_VALUE)
+	{
+		::CloseHandle(m_hFile);
+		m_hFile = INVALID_HANDLE_VALUE;
+	}
+
+	::LeaveCriticalSection(&m_csStream);
+
+	m_uiSize = 0;
+	m_strFullPath.clear();
+}
+
+RwBool CNtlPLPackDataUnit::IsValidElement(const SFilePackEntry *pElement) const
+{
+	if(pElement == NULL || m_hFile == INVALID_HANDLE_VALUE)
+		return FALSE;
+
+	if(pElement->uiOffset > m_uiSize || pElement->uiPackedSize > m_uiSize - pElement->uiOffset)
+		return FALSE;
+
+	return TRUE;
+}
 
-SFilePackHeaderElement*	CNtlPLResourcePack::FindHeader(std::string str)
+const RwUInt8* CNtlPLPackDataUnit::GetData(const SFilePackEntry *pElement) const
 {
-	HMapPackHeader::iterator it = m_hmapPackHeader.find(str);
-	if(it == m_hmapPackHeader.end())
+	if(m_pView == NULL || !IsValidElement(pElement))
+		return NULL;
+
+	if(pElement->byCompress != NTL_PACK_COMPRESS_NONE)
 		return NULL;
 
-	return (*it).second;
+	return m_pView + pElement->uiOffset;
 }
 
-SFilePackHeaderElement* CNtlPLResourcePack::FindHeader(const RwChar *pFileName)
+RwBool CNtlPLPackDataUnit::ReadData(const SFilePackEntry *pElement, void *pBuffer) const
 {
-	HMapPackHeader::iterator it = m_hmapPackHeader.find(pFileName);
-	if(it == m_hmapPackHeader.end())
+	if(pBuffer == NULL || !IsValidElement(pElement))
+		return FALSE;
+
+	if(pElement->byCompress == NTL_PACK_COMPRESS_ZLIB)
+		return InflateData(pElement, pBuffer);
+
+	if(pElement->byCompress != NTL_PACK_COMPRESS_NONE)
+		return FALSE;
+
+	if(m_pView)
+	{
+		memcpy(pBuffer, m_pView + pElement->uiOffset, pElement->uiSize);
+		return TRUE;
+	}
+
+	// positional read, the callers don't share a file pointer.
+	OVERLAPPED overlapped;
+	memset(&overlapped, 0, sizeof(OVERLAPPED));
+	overlapped.Offset = pElement->uiOffset;
+
+	DWORD dwRead = 0;
+	if(!::ReadFile(m_hFile, pBuffer, pElement->uiSize, &dwRead, &overlapped))
+		return FALSE;
+
+	return dwRead == pElement->uiSize;
+}
+
+RwBool CNtlPLPackDataUnit::InflateData(const SFilePackEntry *pElement, void *pBuffer) const
+{
+	z_stream stream;
+	memset(&stream, 0, sizeof(z_stream));
+
+	if(inflateInit(&stream) != Z_OK)
+		return FALSE;
+
+	stream.next_out		= (Bytef*)pBuffer;
+	stream.avail_out	= pElement->uiSize;
+
+	// without a view the packed data is fed in chunks read at their position.
+	RwUInt8 byChunk[NTL_FILEPACK_INFLATE_CHUNK];
+	RwUInt32 uiRead = 0;
+	RwInt32 iResult = Z_OK;
+
+	while(iResult == Z_OK)
+	{
+		if(stream.avail_in == 0)
+		{
+			if(uiRead >= pElement->uiPackedSize)
+				break;
+
+			if(m_pView)
+			{
+				stream.next_in	= (Bytef*)(m_pView + pElement->uiOffset);
+				stream.avail_in	= pElement->uiPackedSize;
+				uiRead			= pElement->uiPackedSize;
+			}
+			else
+			{
+				DWORD dwChunk = pElement->uiPackedSize - uiRead;
+				if(dwChunk > NTL_FILEPACK_INFLATE_CHUNK)
+					dwChunk = NTL_FILEPACK_INFLATE_CHUNK;
+
+				OVERLAPPED overlapped;
+				memset(&overlapped, 0, sizeof(OVERLAPPED));
+				overlapped.Offset = pElement->uiOffset + uiRead;
+
+				DWORD dwRead = 0;
+				if(!::ReadFile(m_hFile, byChunk, dwChunk, &dwRead, &overlapped) || dwRead == 0)
+					break;
+
+				stream.next_in	= byChunk;
+				stream.avail_in	= dwRead;
+				uiRead			+= dwRead;
+			}
+		}
+
+		iResult = inflate(&stream, Z_NO_FLUSH);
+	}
+
+	inflateEnd(&stream);
+
+	return iResult == Z_STREAM_END && stream.total_out == pElement->uiSize;
+}
+
+FILE* CNtlPLPackDataUnit::AcquireStream(const SFilePackEntry *pElement)
+{
+	if(!IsValidElement(pElement))
 		return NULL;
 
-	return (*it).second;
+	if(pElement->byCompress != NTL_PACK_COMPRESS_NONE)
+		return NULL;
+
+	FILE *pFile = NULL;
+
+	::EnterCriticalSection(&m_csStream);
+
+	if(!m_vecStream.empty())
+	{
+		pFile = m_vecStream.back();
+		m_vecStream.pop_back();
+	}
+
+	::LeaveCriticalSection(&m_csStream);
+
+	if(pFile == NULL && fopen_s(&pFile, m_strFullPath.c_str(), "rb") != 0)
+		return NULL;
+
+	if(fseek(pFile, pElement->uiOffset, SEEK_SET) != 0)
+	{
+		ReleaseStream(pFile);
+		return NULL;
+	}
+
+	return pFile;
 }
 
-void CNtlPLResourcePack::AddHeader(RwUInt8 byUnit, const RwChar *pFileName, RwUInt32 uiSize, RwUInt32 uiOffset)
+void CNtlPLPackDataUnit::ReleaseStream(FILE *pFile)
 {
-	if(!FindHeader(pFileName))
+	if(pFile == NULL)
+		return;
+
+	::EnterCriticalSection(&m_csStream);
+
+	// a stream given back after Close() belongs to the old file.
+	if(m_hFile != INVALID_HANDLE_VALUE)
 	{
-		SFilePackHeaderElement *pHeader = NTL_NEW SFilePackHeaderElement;
-		memset(pHeader, 0, sizeof(SFilePackHeaderElement));
+		m_vecStream.push_back(pFile);
+		pFile = NULL;
+	}
 
-		pHeader->byUnitKey	= byUnit;
-		strcpy_s(pHeader->chName, NTL_FILEPACK_NAME_SIZE, pFileName);
-		pHeader->uiSize		= uiSize;
-		pHeader->uiOffset	= uiOffset;
+	::LeaveCriticalSection(&m_csStream);
 
-		for(RwInt32 i = 0; i < NTL_FILEPACK_NAME_SIZE; i++)
-			pHeader->chName[i] = tolower(pHeader->chName[i]);
+	if(pFile)
+		fclose(pFile);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CNtlPLResourcePack::CNtlPLResourcePack()
+{
+	memset(m_pDataUnit, 0, sizeof(m_pDataUnit));
+}
+
+CNtlPLResourcePack::~CNtlPLResourcePack()
+{
+	CloseDataUnits();
+	ClearHeader();
+}
+
+void CNtlPLResourcePack::ClearHeader(void)
+{
+	m_Index.Clear();
+}
+
+void CNtlPLResourcePack::RegistHeaderName(const RwChar *pFileName)
+{
+	m_strHeaderName = pFileName;
+}
+
+void CNtlPLResourcePack::RegistDataName(const RwChar *pFileName)
+{
+	m_strDataName = pFileName;
+}
+
+
+const SFilePackEntry* CNtlPLResourcePack::FindHeader(const RwChar *pFileName) const
+{
+	return m_Index.Find(pFileName);
+}
+
+RwBool CNtlPLResourcePack::FindHeaderRange(const RwChar *pPrefix, RwUInt32& uiBegin, RwUInt32& uiEnd) const
+{
+	return m_Index.FindRange(pPrefix, uiBegin, uiEnd);
+}
+
+void CNtlPLResourcePack::AddHeader(RwUInt8 byUnit, const RwChar *pFileName, RwUInt32 uiSize, RwUInt32 uiOffset, RwUInt32 uiPackedSize, RwUInt8 byCompress)
+{
+	// the name has to fit in the header file record.
+	if(strlen(pFileName) >= NTL_FILEPACK_NAME_SIZE)
+		return;
 
-		m_hmapPackHeader[pHeader->chName] = pHeader;	
+	if(!FindHeader(pFileName))
+	{
+		m_Index.Insert(byUnit, pFileName, uiSize, uiOffset, uiPackedSize, byCompress);
 	}
 }
 
-CNtlPLResourcePack::HMapPackHeader&	CNtlPLResourcePack::GetHeaders(void)
+CNtlPLPackIndex& CNtlPLResourcePack::GetHeaders(void)
 {
-	return m_hmapPackHeader;
+	return m_Index;
 }
 
 RwInt32	CNtlPLResourcePack::GetElementCount(void)
 {
-	return (RwInt32)m_hmapPackHeader.size();
+	return (RwInt32)m_Index.GetCount();
+}
+
+RwBool CNtlPLResourcePack::HasCompressedElement(void)
+{
+	for(RwUInt32 i = 0; i < m_Index.GetCount(); i++)
+	{
+		if(m_Index.GetEntry(i)->byCompress != NTL_PACK_COMPRESS_NONE)
+			return TRUE;
+	}
+
+	return FALSE;
 }
 
 
@@ -115,28 +589,58 @@ const char* CNtlPLResourcePack::encrypt(std::string data)
 
 RwInt32 CNtlPLResourcePack::LoadPack(const RwChar *pFileName)
 {
+	CloseDataUnits();
 	ClearHeader();
 	CNtlFileSerializer s;
 	bool bSuccess = s.LoadFile((char*)pFileName, true, NTL_PACK_CRYPT_KEY); //FFCF4403F048FFC683C30883FB1072E1SDFDF4D DANNY-BOI
 	if(!bSuccess)
 		return NTL_FILEPACK_ERROR;
 
-	SFilePackHeaderElement *pHeader;
-	while(!s.IsEmpty())
+	RwChar chName[NTL_FILEPACK_NAME_SIZE + 1];
+	chName[NTL_FILEPACK_NAME_SIZE] = 0;
+
+	// an old header file starts with a unit key and a ".\\" name, it never matches the magic.
+	const SFilePackHeaderInfo *pInfo = (const SFilePackHeaderInfo*)s.Peek(sizeof(SFilePackHeaderInfo));
+	if(pInfo && pInfo->uiMagic == NTL_FILEPACK_HEADER_MAGIC &&
+		(RwUInt32)s.GetDataSize() - sizeof(SFilePackHeaderInfo) == pInfo->uiCount * sizeof(SFilePackHeaderElement2))
 	{
-		pHeader = NTL_NEW SFilePackHeaderElement;
-        
-        if(s.CheckOutBuffer(sizeof(SFilePackHeaderElement)))
-        {
-		    s.Out(pHeader, sizeof(SFilePackHeaderElement));
-		    m_hmapPackHeader[pHeader->chName] = pHeader;
-        }
-        else
-        {
-			NTL_DELETE( pHeader );
-        }
+		RwUInt32 uiCount = pInfo->uiCount;
+		s.OutView(sizeof(SFilePackHeaderInfo));
+
+		const SFilePackHeaderElement2 *pHeader = (const SFilePackHeaderElement2*)s.OutView(uiCount * sizeof(SFilePackHeaderElement2));
+		if(pHeader == NULL)
+			return NTL_FILEPACK_SUCCESS;
+
+		m_Index.Reserve(uiCount, uiCount * 48);
+
+		for(RwUInt32 i = 0; i < uiCount; i++)
+		{
+			memcpy(chName, pHeader[i].chName, NTL_FILEPACK_NAME_SIZE);
+
+			m_Index.Insert(pHeader[i].byUnitKey, chName, pHeader[i].uiSize, pHeader[i].uiOffset, pHeader[i].uiPackedSize, pHeader[i].byCompress);
+		}
+
+		m_Index.Sort();
+
+		return NTL_FILEPACK_SUCCESS;
 	}
 
+	RwUInt32 uiCount = (RwUInt32)s.GetDataSize() / sizeof(SFilePackHeaderElement);
+	const SFilePackHeaderElement *pHeader = (const SFilePackHeaderElement*)s.OutView(uiCount * sizeof(SFilePackHeaderElement));
+	if(pHeader == NULL)
+		return NTL_FILEPACK_SUCCESS;
+
+	m_Index.Reserve(uiCount, uiCount * 48);
+
+	for(RwUInt32 i = 0; i < uiCount; i++)
+	{
+		memcpy(chName, pHeader[i].chName, NTL_FILEPACK_NAME_SIZE);
+
+		m_Index.Insert(pHeader[i].byUnitKey, chName, pHeader[i].uiSize, pHeader[i].uiOffset, pHeader[i].uiSize, NTL_PACK_COMPRESS_NONE);
+	}
+
+	m_Index.Sort();
+
 	return NTL_FILEPACK_SUCCESS;
 }
 
@@ -170,16 +674,254 @@ RwInt32 CNtlPLResourcePack::SavePack(const RwChar *pFileName)
 			return NTL_FILEPACK_FILEREADONLY;
 	}
 
-	CNtlFileSerializer s(1024*1024*5, 1024*1024*5);
-	HMapPackHeader::iterator it;
-	for(it = m_hmapPackHeader.begin(); it != m_hmapPackHeader.end(); it++)
+	// AddHeader() leaves the index unsorted, the header file is written in name order.
+	m_Index.Sort();
+
+	CNtlFileSerializer s(1024*1024*5, 1024*1024*5);
+
+	// packs without compressed entries keep the old records, so older clients can still read them.
+	if(HasCompressedElement())
+	{
+		s.Reserve(sizeof(SFilePackHeaderInfo) + m_Index.GetCount() * sizeof(SFilePackHeaderElement2));
+
+		SFilePackHeaderInfo sInfo;
+		sInfo.uiMagic	= NTL_FILEPACK_HEADER_MAGIC;
+		sInfo.uiCount	= m_Index.GetCount();
+		s.In(&sInfo, sizeof(SFilePackHeaderInfo));
+
+		SFilePackHeaderElement2 sHeader2;
+		for(RwUInt32 i = 0; i < m_Index.GetCount(); i++)
+		{
+			const SFilePackEntry *pEntry = m_Index.GetEntry(i);
+
+			memset(&sHeader2, 0, sizeof(SFilePackHeaderElement2));
+			sHeader2.byUnitKey		= pEntry->byUnitKey;
+			sHeader2.byCompress		= pEntry->byCompress;
+			strcpy_s(sHeader2.chName, NTL_FILEPACK_NAME_SIZE, m_Index.GetName(pEntry));
+			sHeader2.uiSize			= pEntry->uiSize;
+			sHeader2.uiOffset		= pEntry->uiOffset;
+			sHeader2.uiPackedSize	= pEntry->uiPackedSize;
+
+			s.In(&sHeader2, sizeof(SFilePackHeaderElement2));
+		}
+
+		s.SaveFile((char*)pFileName, true, NTL_PACK_CRYPT_KEY);
+
+		return NTL_FILEPACK_SUCCESS;
+	}
+
+	s.Reserve(m_Index.GetCount() * sizeof(SFilePackHeaderElement));
+
+	SFilePackHeaderElement sHeader;
+	for(RwUInt32 i = 0; i < m_Index.GetCount(); i++)
+	{
+		const SFilePackEntry *pEntry = m_Index.GetEntry(i);
+
+		memset(&sHeader, 0, sizeof(SFilePackHeaderElement));
+		sHeader.byUnitKey	= pEntry->byUnitKey;
+		strcpy_s(sHeader.chName, NTL_FILEPACK_NAME_SIZE, m_Index.GetName(pEntry));
+		sHeader.uiSize		= pEntry->uiSize;
+		sHeader.uiOffset	= pEntry->uiOffset;
+
+		s.In(&sHeader, sizeof(SFilePackHeaderElement));
+	}
+
+	s.SaveFile((char*)pFileName, true, NTL_PACK_CRYPT_KEY);
+
+	return NTL_FILEPACK_SUCCESS;
+}
+
+void CNtlPLResourcePack::OpenDataUnits(const RwChar *pPath)
+{
+	CloseDataUnits();
+
+	RwBool bTried[NTL_FILEPACK_MAX_UNIT];
+	memset(bTried, 0, sizeof(bTried));
+
+	std::string strPackFileName, strOpenPack;
+
+	for(RwUInt32 i = 0; i < m_Index.GetCount(); i++)
+	{
+		RwUInt8 byUnit = m_Index.GetEntry(i)->byUnitKey;
+		if(bTried[byUnit])
+			continue;
+
+		bTried[byUnit] = TRUE;
+
+		GetPackDataFileName(byUnit, strPackFileName);
+
+		strOpenPack = pPath;
+		strOpenPack += strPackFileName;
+
+		CNtlPLPackDataUnit *pDataUnit = NTL_NEW CNtlPLPackDataUnit;
+		if(!pDataUnit->Open(strOpenPack.c_str()))
+		{
+			DBO_TRACE(FALSE, "pack data open failed. (" << strOpenPack.c_str() << ")");
+			NTL_DELETE(pDataUnit);
+			continue;
+		}
+
+		m_pDataUnit[byUnit] = pDataUnit;
+	}
+}
+
+void CNtlPLResourcePack::CloseDataUnits(void)
+{
+	for(RwInt32 i = 0; i < NTL_FILEPACK_MAX_UNIT; i++)
+	{
+		NTL_DELETE( m_pDataUnit[i] );
+	}
+}
+
+const RwUInt8* CNtlPLResourcePack::GetElementData(const SFilePackEntry *pElement) const
+{
+	if(pElement == NULL || m_pDataUnit[pElement->byUnitKey] == NULL)
+		return NULL;
+
+	return m_pDataUnit[pElement->byUnitKey]->GetData(pElement);
+}
+
+RwBool CNtlPLResourcePack::ReadElementData(const SFilePackEntry *pElement, void *pBuffer) const
+{
+	if(pElement == NULL || m_pDataUnit[pElement->byUnitKey] == NULL)
+		return FALSE;
+
+	return m_pDataUnit[pElement->byUnitKey]->ReadData(pElement, pBuffer);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CNtlPLPackElementData::CNtlPLPackElementData()
+{
+	m_pData		= NULL;
+	m_pBuffer	= NULL;
+	m_uiSize	= 0;
+}
+
+CNtlPLPackElementData::~CNtlPLPackElementData()
+{
+	Release();
+}
+
+RwBool CNtlPLPackElementData::Load(CNtlPLResourcePack *pResPack, const SFilePackEntry *pElement)
+{
+	Release();
+
+	if(pResPack == NULL || pElement == NULL)
+		return FALSE;
+
+	m_pData = pResPack->GetElementData(pElement);
+	if(m_pData == NULL)
+	{
+		m_pBuffer = NTL_NEW RwUInt8 [pElement->uiSize];
+		if(!pResPack->ReadElementData(pElement, m_pBuffer))
+		{
+			Release();
+			return FALSE;
+		}
+
+		m_pData = m_pBuffer;
+	}
+
+	m_uiSize = pElement->uiSize;
+
+	return TRUE;
+}
+
+RwBool CNtlPLPackElementData::LoadFile(const RwChar *pFileName)
+{
+	Release();
+
+	FILE *pFile = NULL;
+	if(fopen_s(&pFile, pFileName, "rb") != 0)
+		return FALSE;
+
+	fseek(pFile, 0, SEEK_END);
+	long lSize = ftell(pFile);
+	fseek(pFile, 0, SEEK_SET);
+
+	RwBool bRead = (lSize >= 0);
+	if(bRead)
+	{
+		m_pBuffer = NTL_NEW RwUInt8 [lSize];
+		bRead = (lSize == 0 || fread(m_pBuffer, lSize, 1, pFile) == 1);
+	}
+
+	fclose(pFile);
+
+	if(!bRead)
+	{
+		Release();
+		return FALSE;
+	}
+
+	m_pData		= m_pBuffer;
+	m_uiSize	= (RwUInt32)lSize;
+
+	return TRUE;
+}
+
+void CNtlPLPackElementData::Release(void)
+{
+	NTL_ARRAY_DELETE(m_pBuffer);
+
+	m_pData		= NULL;
+	m_uiSize	= 0;
+}
+
+CNtlPLPackStream::CNtlPLPackStream()
+{
+	m_pDataUnit	= NULL;
+	m_pFile		= NULL;
+}
+
+CNtlPLPackStream::~CNtlPLPackStream()
+{
+	Close();
+}
+
+RwBool CNtlPLPackStream::Open(CNtlPLPackDataUnit *pDataUnit, const SFilePackEntry *pElement)
+{
+	Close();
+
+	if(pDataUnit == NULL)
+		return FALSE;
+
+	m_pFile = pDataUnit->AcquireStream(pElement);
+	if(m_pFile == NULL)
+		return FALSE;
+
+	m_pDataUnit = pDataUnit;
+
+	return TRUE;
+}
+
+RwBool CNtlPLPackStream::OpenFile(const RwChar *pFileName)
+{
+	Close();
+
+	if(fopen_s(&m_pFile, pFileName, "rb") != 0)
 	{
-		s.In((*it).second, sizeof(SFilePackHeaderElement));
+		m_pFile = NULL;
+		return FALSE;
 	}
 
-	s.SaveFile((char*)pFileName, true, NTL_PACK_CRYPT_KEY);
+	return TRUE;
+}
 
-	return NTL_FILEPACK_SUCCESS;
+void CNtlPLPackStream::Close(void)
+{
+	if(m_pFile == NULL)
+		return;
+
+	if(m_pDataUnit)
+		m_pDataUnit->ReleaseStream(m_pFile);
+	else
+		fclose(m_pFile);
+
+	m_pDataUnit	= NULL;
+	m_pFile		= NULL;
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -193,6 +935,8 @@ CNtlPLResoucePackManager::CNtlPLResoucePackManager()
 	m_iMemSize		= 0;
 	m_pMemBuffer	= NULL;
 
+	m_bCompressPack	= FALSE;
+
 	m_pCallMakePackNotify = NULL;
 }
 
@@ -344,15 +1088,20 @@ void CNtlPLResoucePackManager::GetAllFiles(std::string& strOffsetFolder, std::li
 	strOffsetFolder = strCurrOffsetFolder;
 }
 
-RwInt32 CNtlPLResoucePackManager::SavePackFile(CNtlPLResourcePack *pResPack, std::list<std::string>& listFiles, const RwChar *pPackDataFileName)
+RwInt32 CNtlPLResoucePackManager::SavePackFile(RwUInt8 byPackType, std::list<std::string>& listFiles, const RwChar *pPackDataFileName, RwBool bCompress)
 {
 	if(listFiles.size() == 0)
 		return NTL_FILEPACK_ERROR;
 
+	CNtlPLResourcePack *pResPack = m_pResPack[byPackType];
+
 	RwInt32 iPackDataSerial = 0;
 	RwUInt32 uiDataOffset = 0;
 	RwUInt32 uiFileSize = 0;
+	RwUInt32 uiPackedSize = 0;
+	RwUInt8 byCompress = NTL_PACK_COMPRESS_NONE;
 	RwChar *pMem = 0;
+	const RwUInt8 *pPacked = NULL;
 	RwUInt32 uiTotalFileNum = (RwUInt32)listFiles.size();
 	RwUInt32 uiProcFileNum = 0;
 
@@ -384,8 +1133,26 @@ RwInt32 CNtlPLResoucePackManager::SavePackFile(CNtlPLResourcePack *pResPack, std
 	{
 		pMem = DumpFile((*it).c_str(), uiFileSize);
 
+		uiPackedSize	= uiFileSize;
+		byCompress		= NTL_PACK_COMPRESS_NONE;
+		pPacked			= (const RwUInt8*)pMem;
+
+		if(bCompress && uiFileSize > 0 && IsCompressibleFile(byPackType, (*it).c_str()))
+		{
+			RwUInt32 uiCompressSize = 0;
+			const RwUInt8 *pCompress = CompressFile(pMem, uiFileSize, uiCompressSize);
+
+			// already compressed formats (png, mp3, ...) barely shrink, they stay stored.
+			if(pCompress && (RwUInt64)uiCompressSize * 100 < (RwUInt64)uiFileSize * NTL_FILEPACK_COMPRESS_RATIO)
+			{
+				uiPackedSize	= uiCompressSize;
+				byCompress		= NTL_PACK_COMPRESS_ZLIB;
+				pPacked			= pCompress;
+			}
+		}
+
 		// pack limit size  ˻.
-		if(uiDataOffset > 0 && uiDataOffset + uiFileSize > NTL_MAX_FILEPACK_SIZE)
+		if(uiDataOffset > 0 && uiDataOffset + uiPackedSize > NTL_MAX_FILEPACK_SIZE)
 		{
 			if(fp)
 			{
@@ -420,11 +1187,11 @@ RwInt32 CNtlPLResoucePackManager::SavePackFile(CNtlPLResourcePack *pResPack, std
 
 		if(uiFileSize > 0)
 		{
-			fwrite(pMem, uiFileSize, 1, fp);
+			fwrite(pPacked, uiPackedSize, 1, fp);
 
-			pResPack->AddHeader(iPackDataSerial, (*it).c_str(), uiFileSize, uiDataOffset);
+			pResPack->AddHeader(iPackDataSerial, (*it).c_str(), uiFileSize, uiDataOffset, uiPackedSize, byCompress);
 
-			uiDataOffset += uiFileSize;
+			uiDataOffset += uiPackedSize;
 
 			if(m_pCallMakePackNotify)
 			{
@@ -441,6 +1208,8 @@ RwInt32 CNtlPLResoucePackManager::SavePackFile(CNtlPLResourcePack *pResPack, std
 		fp = NULL;
 	}
 
+	pResPack->GetHeaders().Sort();
+
 	return NTL_FILEPACK_SUCCESS;
 }
 
@@ -469,11 +1238,58 @@ RwChar* CNtlPLResoucePackManager::DumpFile(const char *pFileName, RwUInt32& uiSi
 	return m_pMemBuffer;
 }
 
+const RwUInt8* CNtlPLResoucePackManager::CompressFile(const RwChar *pData, RwUInt32 uiSize, RwUInt32& uiPackedSize)
+{
+	uLongf ulDestSize = compressBound(uiSize);
+	if(m_vecCompressBuffer.size() < ulDestSize)
+		m_vecCompressBuffer.resize(ulDestSize);
+
+	if(compress2(&m_vecCompressBuffer[0], &ulDestSize, (const Bytef*)pData, uiSize, Z_BEST_COMPRESSION) != Z_OK)
+	{
+		uiPackedSize = 0;
+		return NULL;
+	}
+
+	uiPackedSize = (RwUInt32)ulDestSize;
+
+	return &m_vecCompressBuffer[0];
+}
+
+RwBool CNtlPLResoucePackManager::IsCompressibleFile(RwUInt8 byPackType, const RwChar *pFileName) const
+{
+	const RwChar *pName = pFileName;
+	for(const RwChar *pCh = pFileName; *pCh; ++pCh)
+	{
+		if(*pCh == '\\' || *pCh == '/')
+			pName = pCh + 1;
+	}
+
+	const RwChar *pExt = strrchr(pName, '.');
+
+	switch(byPackType)
+	{
+	case NTL_PACK_TYPE_TEXTURE:
+		// png and bmp are read through the file system hook at the raw offset.
+		return pExt && _stricmp(pExt, ".dds") == 0;
+	case NTL_PACK_TYPE_OBJECT:
+		// the effect property is parsed through a stream of the data file.
+		return !(pExt && _stricmp(pExt, ".eff") == 0);
+	case NTL_PACK_TYPE_TERRAIN:
+		// only the field property, the pvs and the indoor bsp are read out of the element data.
+		// the sector data (wfif), the block property (wfp) and the world param (gwp) are parsed through a stream.
+		return _strnicmp(pName, "wfpf", 4) == 0 || strcmp(pName, "-------") == 0 || (pExt && _stricmp(pExt, ".bsp") == 0);
+	}
+
+	return TRUE;
+}
+
 
 RwInt32 CNtlPLResoucePackManager::SavePack(RwUInt8 byPackType, std::list<std::string>& listFolder, const RwChar *pPackHeaderFileName, const RwChar *pPackDataFileName)
 {
 	CNtlPLResourcePack *pResPack = m_pResPack[byPackType];
 
+	// the data files are rewritten, release the mapped views first.
+	pResPack->CloseDataUnits();
 	pResPack->ClearHeader();
 
 	//----------------------------------------------------
@@ -512,7 +1328,7 @@ RwInt32 CNtlPLResoucePackManager::SavePack(RwUInt8 byPackType, std::list<std::st
 	//----------------------------------------------------
 	// save pack data
 
-	RwInt32 iSaveRes = SavePackFile(pResPack, listFiles, pPackDataFileName);
+	RwInt32 iSaveRes = SavePackFile(byPackType, listFiles, pPackDataFileName, m_bCompressPack);
 
 	if(iSaveRes != NTL_FILEPACK_SUCCESS)
 		return iSaveRes;
@@ -621,23 +1437,15 @@ RwInt32 CNtlPLResoucePackManager::SavePropertyPack( void )
     return SavePack(NTL_PACK_TYPE_PROPERTY, listFolder, NTL_PACKNAME_PROPERTY_HEADER, NTL_PACKNAME_PROPERTY_DATA);
 }
 
-RwChar*	CNtlPLResoucePackManager::UnPackLeadBuffer(RwChar* pBuffer, const RwChar *pPackFileName, SFilePackHeaderElement *pElement)
+RwChar*	CNtlPLResoucePackManager::UnPackLeadBuffer(RwChar* pBuffer, CNtlPLResourcePack *pResPack, const SFilePackEntry *pElement)
 {
-	FILE *fp = NULL;
-
-	if(fopen_s(&fp, pPackFileName, "rb") != 0)
+	if(!pResPack->ReadElementData(pElement, pBuffer))
 		return NULL;
 
-	fseek(fp, pElement->uiOffset, SEEK_SET);
-
-	fread(pBuffer, pElement->uiSize, 1, fp);
-
-	fclose(fp);
-
 	return pBuffer;
 }
 
-void CNtlPLResoucePackManager::UnPackSaveBuffer(const RwChar *pFileName, const RwChar *pBuffer, SFilePackHeaderElement *pElement)
+void CNtlPLResoucePackManager::UnPackSaveBuffer(const RwChar *pFileName, const RwChar *pBuffer, const SFilePackEntry *pElement)
 {
     // б 뵵  ֵ Ӽ ȯѴ.
     ::SetFileAttributes(pFileName, FILE_ATTRIBUTE_NORMAL);
@@ -652,7 +1460,7 @@ void CNtlPLResoucePackManager::UnPackSaveBuffer(const RwChar *pFileName, const R
 	fclose(fp);
 }
 
-void CNtlPLResoucePackManager::UnPack(const RwChar *pFileName, const RwChar *pPackFileName, SFilePackHeaderElement *pElement, RwUInt32 uiPercent)
+void CNtlPLResoucePackManager::UnPack(const RwChar *pFileName, CNtlPLResourcePack *pResPack, const SFilePackEntry *pElement, RwUInt32 uiPercent)
 {
 	HANDLE hFile;
 	WIN32_FIND_DATA finddata;
@@ -675,13 +1483,10 @@ void CNtlPLResoucePackManager::UnPack(const RwChar *pFileName, const RwChar *pPa
 		}
 	}
 
-	std::string strLeadPack = NTL_PACK_FILE_PATH;
-	strLeadPack += pPackFileName;
-
     RwChar* pBuffer = NTL_NEW RwChar[pElement->uiSize];
     ZeroMemory(pBuffer, sizeof(RwChar) * pElement->uiSize);
 	
-	if(UnPackLeadBuffer(pBuffer, strLeadPack.c_str(), pElement))
+	if(UnPackLeadBuffer(pBuffer, pResPack, pElement))
 	{
 		UnPackSaveBuffer(pFileName, pBuffer, pElement);
 
@@ -729,7 +1534,13 @@ RwInt32 CNtlPLResoucePackManager::LoadPack(RwUInt8 byPackType, const RwChar *pPa
 	str = NTL_PACK_FILE_PATH;
 	str += pPackHeaderFileName;
 
-	return pResPack->LoadPack(str.c_str());
+	RwInt32 iResult = pResPack->LoadPack(str.c_str());
+	if(iResult == NTL_FILEPACK_SUCCESS)
+	{
+		pResPack->OpenDataUnits(NTL_PACK_FILE_PATH);
+	}
+
+	return iResult;
 }
 
 
@@ -783,9 +1594,8 @@ RwInt32	CNtlPLResoucePackManager::UnPack(void)
 	RwInt32 iTotNum = 0;	
 
 	std::string str;
-	std::string strPackFile;
 
-	SFilePackHeaderElement *pElement;
+	const SFilePackEntry *pElement;
 
 	for(RwInt32 i = 0; i < MAX_NTL_PACK_TYPE; i++)
 	{
@@ -797,18 +1607,15 @@ RwInt32	CNtlPLResoucePackManager::UnPack(void)
 	{
 		if(m_pResPack[i])
 		{
-			CNtlPLResourcePack::HMapPackHeader::iterator it;
-			CNtlPLResourcePack::HMapPackHeader& mapPackHeader = m_pResPack[i]->GetHeaders();
+			CNtlPLPackIndex& PackIndex = m_pResPack[i]->GetHeaders();
 
-			for(it = mapPackHeader.begin(); it != mapPackHeader.end(); it++)
+			for(RwUInt32 j = 0; j < PackIndex.GetCount(); j++)
 			{
-				str = (*it).first;
-				pElement = (*it).second;
-
-				m_pResPack[i]->GetPackDataFileName(pElement->byUnitKey, strPackFile);
+				pElement = PackIndex.GetEntry(j);
+				str = PackIndex.GetName(pElement);
 
 				RwUInt32 uiPercent = (RwUInt32)(((RwReal)iCurrNum/(RwReal)iTotNum) * 100.0f);
-				UnPack(str.c_str(), strPackFile.c_str(), pElement, uiPercent);
+				UnPack(str.c_str(), m_pResPack[i], pElement, uiPercent);
 
 				iCurrNum++;
 			}
@@ -828,27 +1635,24 @@ RwInt32 CNtlPLResoucePackManager::UnPack( EFilePackType ePackType )
     RwInt32 iCurrNum = 0;
     RwInt32 iTotNum = 0;	
 
-    std::string str, strPackFile;    
+    std::string str;
 
-    SFilePackHeaderElement *pElement;
+    const SFilePackEntry *pElement;
 
     if(m_pResPack[ePackType])
         iTotNum += m_pResPack[ePackType]->GetElementCount();
     
     if(m_pResPack[ePackType])
     {
-        CNtlPLResourcePack::HMapPackHeader::iterator it;
-        CNtlPLResourcePack::HMapPackHeader& mapPackHeader = m_pResPack[ePackType]->GetHeaders();
+        CNtlPLPackIndex& PackIndex = m_pResPack[ePackType]->GetHeaders();
 
-        for(it = mapPackHeader.begin(); it != mapPackHeader.end(); it++)
+        for(RwUInt32 j = 0; j < PackIndex.GetCount(); j++)
         {
-            str = (*it).first;
-            pElement = (*it).second;
-
-            m_pResPack[ePackType]->GetPackDataFileName(pElement->byUnitKey, strPackFile);
+            pElement = PackIndex.GetEntry(j);
+            str = PackIndex.GetName(pElement);
 
             RwUInt32 uiPercent = (RwUInt32)(((RwReal)iCurrNum/(RwReal)iTotNum) * 100.0f);
-            UnPack(str.c_str(), strPackFile.c_str(), pElement, uiPercent);
+            UnPack(str.c_str(), m_pResPack[ePackType], pElement, uiPercent);
 
             iCurrNum++;
         }
@@ -862,7 +1666,7 @@ CNtlPLResourcePack* CNtlPLResoucePackManager::FindResourcePack(RwUInt8 byPackTyp
 	return m_pResPack[byPackType];
 }
 
-SFilePackHeaderElement* CNtlPLResoucePackManager::FindHeaderElement(RwUInt8 byPackType, const RwChar *pFileName)
+const SFilePackEntry* CNtlPLResoucePackManager::FindHeaderElement(RwUInt8 byPackType, const RwChar *pFileName)
 {
 	if(m_pResPack[byPackType])
 		return m_pResPack[byPackType]->FindHeader(pFileName);
@@ -870,7 +1674,36 @@ SFilePackHeaderElement* CNtlPLResoucePackManager::FindHeaderElement(RwUInt8 byPa
 	return NULL;
 }
 
-void CNtlPLResoucePackManager::FilterPathBuffer(const RwChar *pPath, const RwChar *pFileName)
+const RwUInt8* CNtlPLResoucePackManager::GetPackData(RwUInt8 byPackType, const SFilePackEntry *pElement)
+{
+	if(m_pResPack[byPackType])
+		return m_pResPack[byPackType]->GetElementData(pElement);
+
+	return NULL;
+}
+
+RwBool CNtlPLResoucePackManager::ReadPackData(RwUInt8 byPackType, const SFilePackEntry *pElement, void *pBuffer)
+{
+	if(m_pResPack[byPackType])
+		return m_pResPack[byPackType]->ReadElementData(pElement, pBuffer);
+
+	return FALSE;
+}
+
+void CNtlPLResoucePackManager::ReadElement(CNtlPLResourcePack *pResPack, const SFilePackEntry *pElement, void **pData, RwInt32 *iSize)
+{
+	BYTE *pBuffer = NTL_NEW BYTE[pElement->uiSize];
+	if(!pResPack->ReadElementData(pElement, pBuffer))
+	{
+		NTL_ARRAY_DELETE(pBuffer);
+		return;
+	}
+
+	*pData = pBuffer;
+	*iSize = (RwInt32)pElement->uiSize;
+}
+
+void CNtlPLResoucePackManager::FilterFileName(RwChar *pBuffer, const RwChar *pFileName)
 {
 	RwInt32 iOffset = 0;
 	RwInt32 iLen = 0;
@@ -879,21 +1712,29 @@ void CNtlPLResoucePackManager::FilterPathBuffer(const RwChar *pPath, const RwCha
 	iLen = (RwInt32)strlen(pFileName);
 	for(RwInt32 i = 0; i < iLen; i++)
 	{
-		m_chFileBuffer[iOffset] = tolower(pFileName[i]);
+		pBuffer[iOffset] = tolower(pFileName[i]);
 
-		if(m_chFileBuffer[iOffset] == '/')
-			m_chFileBuffer[iOffset] = '\\';
+		if(pBuffer[iOffset] == '/')
+			pBuffer[iOffset] = '\\';
 
-		if(m_chFileBuffer[iOffset] == '\\' && iOffset > 0)
+		if(pBuffer[iOffset] == '\\' && iOffset > 0)
 		{
-			if(m_chFileBuffer[iOffset-1] != '\\')
+			if(pBuffer[iOffset-1] != '\\')
 				iOffset++;
 		}
 		else
 			iOffset++;
 	}
 
-	m_chFileBuffer[iOffset] = 0;
+	pBuffer[iOffset] = 0;
+}
+
+void CNtlPLResoucePackManager::FilterPathBuffer(const RwChar *pPath, const RwChar *pFileName)
+{
+	RwInt32 iOffset = 0;
+	RwInt32 iLen = 0;
+
+	FilterFileName(m_chFileBuffer, pFileName);
 
 	if(pPath == NULL)
 		return;
@@ -961,7 +1802,7 @@ RwTexture* CNtlPLResoucePackManager::LoadTexture(const RwChar *pPath, const RwCh
 
 	static RwChar chExt[3][5] = {".png", ".bmp", ".dds" };
 
-	SFilePackHeaderElement *pElement = NULL;
+	const SFilePackEntry *pElement = NULL;
 	CNtlPLResourcePack *pResPack = m_pResPack[NTL_PACK_TYPE_TEXTURE];
 	RwUInt8 byExtType = 0;
 
@@ -1003,21 +1844,32 @@ RwTexture* CNtlPLResoucePackManager::LoadTexture(const RwChar *pPath, const RwCh
 		}
 		else
 		{
-			RwInt32 iTempOffset = m_iBufferSize;
+			// every "name.*" of the directory is one range of the index, pick the extension by priority.
+			m_chFullBuffer[m_iBufferSize] = '.';
+			m_chFullBuffer[m_iBufferSize + 1] = 0;
 
-			for(RwInt32 i = 0; i < 3; i++)
+			RwUInt32 uiBegin, uiEnd;
+			if(pResPack->FindHeaderRange(m_chFullBuffer, uiBegin, uiEnd))
 			{
-				m_iBufferSize = iTempOffset;
-				strcpy_s(&m_chFullBuffer[m_iBufferSize], NTL_FILEPACK_BUFFER_SIZE - m_iBufferSize, chExt[i]);
-				m_iBufferSize += strlen(chExt[i]);
-				m_chFullBuffer[m_iBufferSize] = 0;
+				CNtlPLPackIndex& PackIndex = pResPack->GetHeaders();
 
-				pElement = pResPack->FindHeader(m_chFullBuffer);
-				if(pElement)
+				for(RwUInt32 k = uiBegin; k < uiEnd; k++)
 				{
-					byExtType = i;
-					goto ResourcPackTextureLoad_Exit;
+					const SFilePackEntry *pEntry = PackIndex.GetEntry(k);
+					const RwChar *pExt = PackIndex.GetName(pEntry) + m_iBufferSize;
+
+					for(RwInt32 i = 0; i < 3; i++)
+					{
+						if(_stricmp(pExt, chExt[i]) == 0 && (pElement == NULL || i < byExtType))
+						{
+							pElement	= pEntry;
+							byExtType	= i;
+						}
+					}
 				}
+
+				if(pElement)
+					goto ResourcPackTextureLoad_Exit;
 			}
 		}
 	}
@@ -1027,31 +1879,45 @@ ResourcPackTextureLoad_Exit:
 	if(pElement == NULL)
 		return NULL;
 
-	std::string strPackFileName;
-	m_pResPack[NTL_PACK_TYPE_TEXTURE]->GetPackDataFileName(pElement->byUnitKey, strPackFileName);
-
-	m_iBufferSize = 0;
-	strcpy_s(&m_chFullBuffer[m_iBufferSize], NTL_FILEPACK_BUFFER_SIZE, NTL_PACK_FILE_PATH);
-	m_iBufferSize += strlen(NTL_PACK_FILE_PATH);
-	
-	strcpy_s(&m_chFullBuffer[m_iBufferSize], NTL_FILEPACK_BUFFER_SIZE-m_iBufferSize, strPackFileName.c_str());
-	m_iBufferSize += strPackFileName.size();
-	
-	m_chFullBuffer[m_iBufferSize] = 0;
-
 	RwTexture *pTexture = NULL;
 
 	SNtlPackImage sPackImage;
 	sPackImage.pName				= pFileName;
 	sPackImage.pMaskName			= pMaskName;
-	sPackImage.strPackFileName		= m_chFullBuffer;
 	sPackImage.uiPackOffset			= pElement->uiOffset;
 	sPackImage.uiPackSize			= pElement->uiSize;
 
-
 	if(byExtType == PACK_TEXUTRE_EXT_DDS)
-		pTexture = Ntl_D3D9DDSTextureRead(&sPackImage);
-	else if(byExtType == PACK_TEXUTRE_EXT_PNG)
+	{
+		// dds is read out of the element data, a compressed entry is inflated first.
+		CNtlPLPackElementData ElementData;
+		if(!ElementData.Load(pResPack, pElement))
+			return NULL;
+
+		sPackImage.pPackData = ElementData.GetData();
+
+		return Ntl_D3D9DDSTextureRead(&sPackImage);
+	}
+
+	// the png and bmp readers only take a file name, they open the data file at the raw offset.
+	if(pElement->byCompress != NTL_PACK_COMPRESS_NONE)
+		return NULL;
+
+	CNtlPLPackDataUnit *pDataUnit = pResPack->GetDataUnit(pElement->byUnitKey);
+	if(pDataUnit)
+	{
+		sPackImage.strPackFileName = pDataUnit->GetFullPath();
+	}
+	else
+	{
+		std::string strPackFileName;
+		pResPack->GetPackDataFileName(pElement->byUnitKey, strPackFileName);
+
+		sPackImage.strPackFileName = NTL_PACK_FILE_PATH;
+		sPackImage.strPackFileName += strPackFileName.c_str();
+	}
+
+	if(byExtType == PACK_TEXUTRE_EXT_PNG)
 		pTexture = Ntl_PNGTextureRead(&sPackImage);
 	else if(byExtType == PACK_TEXUTRE_EXT_BMP)
 		pTexture = Ntl_BMPTextureRead(&sPackImage);
@@ -1059,14 +1925,14 @@ ResourcPackTextureLoad_Exit:
 	return pTexture;
 }
 
-RwBool CNtlPLResoucePackManager::LoadObject(const RwChar *pFileName, SPackResFileData& sPackFileData)
+const SFilePackEntry* CNtlPLResoucePackManager::FindObjectElement(const RwChar *pFileName)
 {
 	if(m_uiFlags == 0)
-		return FALSE;
+		return NULL;
 
 	FilterPathBuffer(NULL, pFileName);
 
-	SFilePackHeaderElement *pElement = NULL;
+	const SFilePackEntry *pElement = NULL;
 	RwChar *pPathRoot = NULL;
 
 	static char szPath[4096];
@@ -1107,72 +1973,73 @@ RwBool CNtlPLResoucePackManager::LoadObject(const RwChar *pFileName, SPackResFil
 
 	RwChar *extender  = rwstrrchr(m_chFileBuffer, '.');
 	if( extender == NULL )
-		return FALSE;
+		return NULL;
 
-	CNtlPLResourcePack *pResPack = m_pResPack[NTL_PACK_TYPE_OBJECT];
-	pElement = pResPack->FindHeader(m_chFullBuffer);
+	return m_pResPack[NTL_PACK_TYPE_OBJECT]->FindHeader(m_chFullBuffer);
+}
+
+RwBool CNtlPLResoucePackManager::LoadObject(const RwChar *pFileName, CNtlPLPackElementData& ElementData)
+{
+	const SFilePackEntry *pElement = FindObjectElement(pFileName);
 	if(pElement == NULL)
 		return FALSE;
 
-	std::string strPackFileName;
-	pResPack->GetPackDataFileName(pElement->byUnitKey, strPackFileName);
+	return ElementData.Load(m_pResPack[NTL_PACK_TYPE_OBJECT], pElement);
+}
 
-	sPackFileData.strPackFileName = NTL_PACK_FILE_PATH;
-	sPackFileData.strPackFileName += strPackFileName.c_str();
+RwBool CNtlPLResoucePackManager::LoadObject(const RwChar *pFileName, CNtlPLPackStream& PackStream)
+{
+	const SFilePackEntry *pElement = FindObjectElement(pFileName);
+	if(pElement == NULL)
+		return FALSE;
 
-	sPackFileData.uiOffset = pElement->uiOffset;
-	sPackFileData.uiSize = pElement->uiSize;
+	CNtlPLResourcePack *pResPack = m_pResPack[NTL_PACK_TYPE_OBJECT];
 
-	return TRUE;
+	return PackStream.Open(pResPack->GetDataUnit(pElement->byUnitKey), pElement);
 }
 
-RwBool CNtlPLResoucePackManager::LoadTerrain(const RwChar *pFileName, SPackResFileData& sPackFileData)
+const SFilePackEntry* CNtlPLResoucePackManager::FindTerrainElement(const RwChar *pFileName)
 {
-	if(m_uiFlags == 0)
-		return FALSE;
+	RwChar chFileBuffer[NTL_FILEPACK_BUFFER_SIZE];
+	RwChar chFullBuffer[NTL_FILEPACK_BUFFER_SIZE];
 
-	FilterPathBuffer(NULL, pFileName);
+	FilterFileName(chFileBuffer, pFileName);
 
-	SFilePackHeaderElement *pElement = NULL;
-	RwChar *pPathRoot = NULL;
-	
-	m_iBufferSize	= 0;
+	RwChar *pPathRoot = rwstrstr(chFileBuffer, "world");
+	if(pPathRoot == NULL)
+		return NULL;
 
-	pPathRoot = rwstrstr(m_chFileBuffer, "world");
+	chFullBuffer[0] = '.';
+	chFullBuffer[1] = '\\';
+	strcpy_s(&chFullBuffer[2], NTL_FILEPACK_BUFFER_SIZE - 2, pPathRoot);
 	
-	m_chFullBuffer[m_iBufferSize++] = '.';
-	m_chFullBuffer[m_iBufferSize++] = '\\';
+	return m_pResPack[NTL_PACK_TYPE_TERRAIN]->FindHeader(chFullBuffer);
+}
 
-	strcpy_s(&m_chFullBuffer[m_iBufferSize], NTL_FILEPACK_BUFFER_SIZE - m_iBufferSize, pPathRoot);
-	m_iBufferSize += strlen(pPathRoot);
-	m_chFullBuffer[m_iBufferSize] = 0;
-	
-	CNtlPLResourcePack *pResPack = m_pResPack[NTL_PACK_TYPE_TERRAIN];
-	pElement = pResPack->FindHeader(m_chFullBuffer);
-	if(pElement == NULL)
+RwBool CNtlPLResoucePackManager::LoadTerrain(const RwChar *pFileName, CNtlPLPackElementData& ElementData)
+{
+	if(m_uiFlags == 0)
 		return FALSE;
 
-	std::string strPackFileName;
-	pResPack->GetPackDataFileName(pElement->byUnitKey, strPackFileName);
-
-	sPackFileData.strPackFileName = NTL_PACK_FILE_PATH;
-	sPackFileData.strPackFileName += strPackFileName.c_str();
-
-	sPackFileData.uiOffset = pElement->uiOffset;
-	sPackFileData.uiSize = pElement->uiSize;
+	const SFilePackEntry *pElement = FindTerrainElement(pFileName);
+	if(pElement == NULL)
+		return FALSE;
 
-	return TRUE;
+	return ElementData.Load(m_pResPack[NTL_PACK_TYPE_TERRAIN], pElement);
 }
 
-std::string CNtlPLResoucePackManager::LoadTerrain(const RwChar *pFileName, RwUInt32& uiOffset, RwUInt32& uiSize)
+RwBool CNtlPLResoucePackManager::LoadTerrain(const RwChar *pFileName, CNtlPLPackStream& PackStream)
 {
-	SPackResFileData sFileData;
-	RwBool bSuccess = LoadTerrain(pFileName, sFileData);
+	if(m_uiFlags == 0)
+		return FALSE;
+
+	const SFilePackEntry *pElement = FindTerrainElement(pFileName);
+	if(pElement == NULL)
+		return FALSE;
 
-	uiOffset	= sFileData.uiOffset;
-	uiSize		= sFileData.uiSize;
+	CNtlPLResourcePack *pResPack = m_pResPack[NTL_PACK_TYPE_TERRAIN];
 
-	return sFileData.strPackFileName;
+	return PackStream.Open(pResPack->GetDataUnit(pElement->byUnitKey), pElement);
 }
 
 void CNtlPLResoucePackManager::LoadGui(const RwChar *pFileName, void **pData, RwUInt32 *uiSize)
@@ -1185,7 +2052,7 @@ void CNtlPLResoucePackManager::LoadGui(const RwChar *pFileName, void **pData, Rw
 
 	FilterPathBuffer(NULL, pFileName);
 
-	SFilePackHeaderElement *pElement = NULL;
+	const SFilePackEntry *pElement = NULL;
 	RwChar *pPathRoot = NULL;
 	
 	m_iBufferSize	= 0;
@@ -1204,22 +2071,9 @@ void CNtlPLResoucePackManager::LoadGui(const RwChar *pFileName, void **pData, Rw
 	if(pElement == NULL)
 		return;
 
-	std::string strPackFileName;
-	pResPack->GetPackDataFileName(pElement->byUnitKey, strPackFileName);
-
-	std::string strOpenPack;
-	strOpenPack = NTL_PACK_FILE_PATH;
-	strOpenPack += strPackFileName.c_str();
-
-	FILE *fp = NULL;
-	if(fopen_s(&fp, strOpenPack.c_str(), "rb") != 0)
-		return;
-
-	fseek(fp, pElement->uiOffset, SEEK_SET);
-	*uiSize = pElement->uiSize;
-	*pData = NTL_NEW char[pElement->uiSize];
-	fread(*pData, pElement->uiSize, 1, fp);
-	fclose(fp);
+	RwInt32 iSize = 0;
+	ReadElement(pResPack, pElement, pData, &iSize);
+	*uiSize = (RwUInt32)iSize;
 
 	return;
 }
@@ -1234,7 +2088,7 @@ void CNtlPLResoucePackManager::LoadFlash(const RwChar *pFileName, void **pData,
 
 	FilterPathBuffer(NULL, pFileName);
 
-	SFilePackHeaderElement *pElement = NULL;
+	const SFilePackEntry *pElement = NULL;
 	RwChar *pPathRoot = NULL;
 
 	m_iBufferSize	= 0;
@@ -1257,22 +2111,7 @@ void CNtlPLResoucePackManager::LoadFlash(const RwChar *pFileName, void **pData,
 	if(pElement->uiSize >= 0x80000000 )
 		return;
 
-	std::string strPackFileName;
-	pResPack->GetPackDataFileName(pElement->byUnitKey, strPackFileName);
-
-	std::string strOpenPack;
-	strOpenPack = NTL_PACK_FILE_PATH;
-	strOpenPack += strPackFileName.c_str();
-
-	FILE *fp = NULL;
-	if(fopen_s(&fp, strOpenPack.c_str(), "rb") != 0)
-		return;
-
-	fseek(fp, pElement->uiOffset, SEEK_SET);
-	*iSize = (RwInt32)pElement->uiSize;
-	*pData = NTL_NEW BYTE[pElement->uiSize];
-	fread(*pData, pElement->uiSize, 1, fp);
-	fclose(fp);
+	ReadElement(pResPack, pElement, pData, iSize);
 
 	return;
 }
@@ -1287,7 +2126,7 @@ void CNtlPLResoucePackManager::LoadSound(const RwChar *pFileName, void **pData,
 
 	FilterPathBuffer(NULL, pFileName);
 
-	SFilePackHeaderElement *pElement = NULL;
+	const SFilePackEntry *pElement = NULL;
 	RwChar *pPathRoot = NULL;
 
 	m_iBufferSize	= 0;
@@ -1306,24 +2145,7 @@ void CNtlPLResoucePackManager::LoadSound(const RwChar *pFileName, void **pData,
 	if(pElement == NULL)
 		return;
 
-	std::string strPackFileName;
-	pResPack->GetPackDataFileName(pElement->byUnitKey, strPackFileName);
-
-	std::string strOpenPack;
-	strOpenPack = NTL_PACK_FILE_PATH;
-	strOpenPack += strPackFileName.c_str();
-
-	FILE *fp = NULL;
-	if(fopen_s(&fp, strOpenPack.c_str(), "rb") != 0)
-		return;
-
-	fseek(fp, pElement->uiOffset, SEEK_SET);
-	*iSize = (RwInt32)pElement->uiSize;
-
-    NTL_ARRAY_DELETE(*pData);
-	*pData = NTL_NEW BYTE[pElement->uiSize];
-	fread(*pData, pElement->uiSize, 1, fp);
-	fclose(fp);
+	ReadElement(pResPack, pElement, pData, iSize);
 
 	return;
 }
@@ -1339,7 +2161,7 @@ void CNtlPLResoucePackManager::LoadLanguage( const RwChar* pFileName, void** pDa
 
     FilterPathBuffer(NULL, pFileName);
 
-    SFilePackHeaderElement *pElement = NULL;
+    const SFilePackEntry *pElement = NULL;
     RwChar *pPathRoot = NULL;
 
     m_iBufferSize	= 0;
@@ -1358,22 +2180,7 @@ void CNtlPLResoucePackManager::LoadLanguage( const RwChar* pFileName, void** pDa
     if(pElement == NULL)
         return;
 
-    std::string strPackFileName;
-    pResPack->GetPackDataFileName(pElement->byUnitKey, strPackFileName);
-
-    std::string strOpenPack;
-    strOpenPack = NTL_PACK_FILE_PATH;
-    strOpenPack += strPackFileName.c_str();
-
-    FILE *fp = NULL;
-    if(fopen_s(&fp, strOpenPack.c_str(), "rb") != 0)
-        return;
-
-    fseek(fp, pElement->uiOffset, SEEK_SET);
-    *iSize = (RwInt32)pElement->uiSize;
-    *pData = NTL_NEW BYTE[pElement->uiSize];
-    fread(*pData, pElement->uiSize, 1, fp);
-    fclose(fp);
+    ReadElement(pResPack, pElement, pData, iSize);
 
     return;
 }
@@ -1388,7 +2195,7 @@ void CNtlPLResoucePackManager::LoadTs( const RwChar* pFileName, void** pData, Rw
 
     FilterPathBuffer(NULL, pFileName);
 
-    SFilePackHeaderElement *pElement = NULL;
+    const SFilePackEntry *pElement = NULL;
     RwChar *pPathRoot = NULL;
 
     m_iBufferSize	= 0;
@@ -1407,22 +2214,7 @@ void CNtlPLResoucePackManager::LoadTs( const RwChar* pFileName, void** pData, Rw
     if(pElement == NULL)
         return;
 
-    std::string strPackFileName;
-    pResPack->GetPackDataFileName(pElement->byUnitKey, strPackFileName);
-
-    std::string strOpenPack;
-    strOpenPack = NTL_PACK_FILE_PATH;
-    strOpenPack += strPackFileName.c_str();
-
-    FILE *fp = NULL;
-    if(fopen_s(&fp, strOpenPack.c_str(), "rb") != 0)
-        return;
-
-    fseek(fp, pElement->uiOffset, SEEK_SET);
-    *iSize = (RwInt32)pElement->uiSize;
-    *pData = NTL_NEW BYTE[pElement->uiSize];
-    fread(*pData, pElement->uiSize, 1, fp);
-    fclose(fp);
+    ReadElement(pResPack, pElement, pData, iSize);
 
     return;
 }
@@ -1437,7 +2229,7 @@ void CNtlPLResoucePackManager::LoadScript( const RwChar* pFileName, void** pData
 
     FilterPathBuffer(NULL, pFileName);
 
-    SFilePackHeaderElement *pElement = NULL;
+    const SFilePackEntry *pElement = NULL;
     RwChar *pPathRoot = NULL;
 
     m_iBufferSize	= 0;
@@ -1456,22 +2248,7 @@ void CNtlPLResoucePackManager::LoadScript( const RwChar* pFileName, void** pData
     if(pElement == NULL)
         return;
 
-    std::string strPackFileName;
-    pResPack->GetPackDataFileName(pElement->byUnitKey, strPackFileName);
-
-    std::string strOpenPack;
-    strOpenPack = NTL_PACK_FILE_PATH;
-    strOpenPack += strPackFileName.c_str();
-
-    FILE *fp = NULL;
-    if(fopen_s(&fp, strOpenPack.c_str(), "rb") != 0)
-        return;
-
-    fseek(fp, pElement->uiOffset, SEEK_SET);
-    *iSize = (RwInt32)pElement->uiSize;
-    *pData = NTL_NEW BYTE[pElement->uiSize];
-    fread(*pData, pElement->uiSize, 1, fp);
-    fclose(fp);
+    ReadElement(pResPack, pElement, pData, iSize);
 
     return;
 }
@@ -1486,7 +2263,7 @@ void CNtlPLResoucePackManager::LoadProperty( const RwChar* pFileName, void** pDa
 
     FilterPathBuffer(NULL, pFileName);
 
-    SFilePackHeaderElement *pElement = NULL;
+    const SFilePackEntry *pElement = NULL;
     RwChar *pPathRoot = NULL;
 
     m_iBufferSize	= 0;
@@ -1505,35 +2282,13 @@ void CNtlPLResoucePackManager::LoadProperty( const RwChar* pFileName, void** pDa
     if(pElement == NULL)
         return;
 
-    std::string strPackFileName;
-    pResPack->GetPackDataFileName(pElement->byUnitKey, strPackFileName);
-
-    std::string strOpenPack;
-    strOpenPack = NTL_PACK_FILE_PATH;
-    strOpenPack += strPackFileName.c_str();
-
-    FILE *fp = NULL;
-    if(fopen_s(&fp, strOpenPack.c_str(), "rb") != 0)
-        return;
-
-    fseek(fp, pElement->uiOffset, SEEK_SET);
-    *iSize = (RwInt32)pElement->uiSize;
-    *pData = NTL_NEW BYTE[pElement->uiSize];
-    fread(*pData, pElement->uiSize, 1, fp);
-    fclose(fp);
+    ReadElement(pResPack, pElement, pData, iSize);
 }
 
-void CNtlPLResoucePackManager::LoadTable( const RwChar* pFileName, void** pData, RwInt32* iSize ) 
+const SFilePackEntry* CNtlPLResoucePackManager::FindTableElement(const RwChar *pFileName)
 {
-	*pData	= NULL;
-	*iSize = 0;
-
-	if(m_uiFlags == 0)
-		return;
-
 	FilterPathBuffer(NULL, pFileName);
 
-	SFilePackHeaderElement *pElement = NULL;
 	RwChar *pPathRoot = NULL;
 
 	m_iBufferSize	= 0;
@@ -1547,27 +2302,44 @@ void CNtlPLResoucePackManager::LoadTable( const RwChar* pFileName, void** pData,
 	m_iBufferSize += strlen(pPathRoot);
 	m_chFullBuffer[m_iBufferSize] = 0;
 
-	CNtlPLResourcePack *pResPack = m_pResPack[NTL_PACK_TYPE_TABLE];
-	pElement = pResPack->FindHeader(m_chFullBuffer);
+	return m_pResPack[NTL_PACK_TYPE_TABLE]->FindHeader(m_chFullBuffer);
+}
+
+void CNtlPLResoucePackManager::LoadTable( const RwChar* pFileName, void** pData, RwInt32* iSize ) 
+{
+	*pData	= NULL;
+	*iSize = 0;
+
+	if(m_uiFlags == 0)
+		return;
+
+	const SFilePackEntry *pElement = FindTableElement(pFileName);
 	if(pElement == NULL)
 		return;
 
-	std::string strPackFileName;
-	pResPack->GetPackDataFileName(pElement->byUnitKey, strPackFileName);
+	ReadElement(m_pResPack[NTL_PACK_TYPE_TABLE], pElement, pData, iSize);
+}
 
-	std::string strOpenPack;
-	strOpenPack = NTL_PACK_FILE_PATH;
-	strOpenPack += strPackFileName.c_str();
+RwBool CNtlPLResoucePackManager::GetTableData( const RwChar* pFileName, const void** ppData, RwInt32* iSize )
+{
+	*ppData	= NULL;
+	*iSize = 0;
 
-	FILE *fp = NULL;
-	if(fopen_s(&fp, strOpenPack.c_str(), "rb") != 0)
-		return;
+	if(m_uiFlags == 0)
+		return FALSE;
 
-	fseek(fp, pElement->uiOffset, SEEK_SET);
-	*iSize = (RwInt32)pElement->uiSize;
-	*pData = NTL_NEW BYTE[pElement->uiSize];
-	fread(*pData, pElement->uiSize, 1, fp);
-	fclose(fp);
+	const SFilePackEntry *pElement = FindTableElement(pFileName);
+	if(pElement == NULL)
+		return FALSE;
+
+	const RwUInt8 *pData = m_pResPack[NTL_PACK_TYPE_TABLE]->GetElementData(pElement);
+	if(pData == NULL)
+		return FALSE;
+
+	*ppData	= pData;
+	*iSize	= (RwInt32)pElement->uiSize;
+
+	return TRUE;
 }
 
 bool CNtlPLResoucePackManager::IsExistSoundFile(const RwChar *pFileName)
@@ -1577,7 +2349,7 @@ bool CNtlPLResoucePackManager::IsExistSoundFile(const RwChar *pFileName)
 
 	FilterPathBuffer(NULL, pFileName);
 
-	SFilePackHeaderElement *pElement = NULL;
+	const SFilePackEntry *pElement = NULL;
 	RwChar *pPathRoot = NULL;
 
 	m_iBufferSize	= 0;
@@ -1596,19 +2368,7 @@ bool CNtlPLResoucePackManager::IsExistSoundFile(const RwChar *pFileName)
 	if(pElement == NULL)
 		return false;
 
-	std::string strPackFileName;
-	pResPack->GetPackDataFileName(pElement->byUnitKey, strPackFileName);
-
-	std::string strOpenPack;
-	strOpenPack = NTL_PACK_FILE_PATH;
-	strOpenPack += strPackFileName.c_str();
-
-	FILE *fp = NULL;
-	if(fopen_s(&fp, strOpenPack.c_str(), "rb") != 0)
-		return false;
-
-	fclose(fp);
-	return true;
+	return pResPack->GetDataUnit(pElement->byUnitKey) != NULL;
 }
 
 
@@ -1660,6 +2420,27 @@ CTablePackLoad::~CTablePackLoad( void )
 
 bool CTablePackLoad::Call( const char* pfilename, CNtlFileSerializer* pSeralize, const char* pszCryptPassword ) 
 {
+	// Mapped pack data is decrypted or copied straight out of the view.
+	const void* pData = NULL;
+	RwInt32 iDataSize = 0;
+
+	if ( GetNtlResourcePackManager()->GetTableData( pfilename, &pData, &iDataSize ) )
+	{
+		if ( 0 == iDataSize )
+		{
+			return false;
+		}
+
+		if ( pszCryptPassword )
+		{
+			return pSeralize->LoadFile( (char*)pData, iDataSize, TRUE, (char*)pszCryptPassword );
+		}
+
+		pSeralize->In( pData, iDataSize );
+
+		return true;
+	}
+
 	if ( pszCryptPassword )
 	{
 		char* pBuffer = NULL;
@@ -14,7 +14,7 @@
 #ifndef __NTL_PLRESOURCE_PACK_H__
 #define __NTL_PLRESOURCE_PACK_H__
 
-#include <hash_map>
+#include <vector>
 #include "NtlCallbackWidget.h"
 #include "NtlDebug.h"
 
@@ -127,6 +127,22 @@ enum EFilePackTypeFlag
 
 #define NTL_MAX_FILEPACK_SIZE		20000000
 
+#define NTL_FILEPACK_MAX_UNIT		256
+
+//------------------------------------------------------------------------------
+// pack compression
+
+enum EFilePackCompress
+{
+	NTL_PACK_COMPRESS_NONE,						// stored as is.
+	NTL_PACK_COMPRESS_ZLIB,						// zlib stream.
+};
+
+#define NTL_FILEPACK_COMPRESS_RATIO	90			// an entry stays compressed only under this percent of its size.
+#define NTL_FILEPACK_INFLATE_CHUNK	16384
+
+#define NTL_FILEPACK_HEADER_MAGIC	0x324b504e	// "NPK2"
+
 
 typedef struct _SFilePackHeaderElement
 {
@@ -136,29 +152,188 @@ typedef struct _SFilePackHeaderElement
 	RwUInt32	uiOffset;	
 }SFilePackHeaderElement;
 
-//------------------------------------------------------------------------------
+// header file revision with compressed entries. the file starts with SFilePackHeaderInfo,
+// a pack without compressed entries is still saved as SFilePackHeaderElement records.
+typedef struct _SFilePackHeaderInfo
+{
+	RwUInt32	uiMagic;
+	RwUInt32	uiCount;
+}SFilePackHeaderInfo;
 
-typedef struct _SPackResFileData
+typedef struct _SFilePackHeaderElement2
 {
-	std::string strPackFileName;
+	RwUInt8		byUnitKey;
+	RwUInt8		byCompress;
+	RwChar		chName[NTL_FILEPACK_NAME_SIZE];
+	RwUInt32	uiSize;							// unpacked size.
 	RwUInt32	uiOffset;
+	RwUInt32	uiPackedSize;					// size in the data file.
+}SFilePackHeaderElement2;
+
+// SFilePackHeaderElement is the record in the header file. In memory a pack keeps this
+// smaller entry instead, its name lives in the name pool of CNtlPLPackIndex.
+typedef struct _SFilePackEntry
+{
 	RwUInt32	uiSize;
-}SPackResFileData;
+	RwUInt32	uiOffset;
+	RwUInt32	uiPackedSize;
+	RwUInt32	uiNameOffset;
+	RwUInt16	wNameLength;
+	RwUInt8		byUnitKey;
+	RwUInt8		byCompress;
+}SFilePackEntry;
+
+//------------------------------------------------------------------------------
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-class CNtlPLResourcePack
+/**
+ * \brief File name index of a pack.
+ * Names are lower-cased with '/' turned into '\\' and stored back to back in one pool.
+ * Find() hashes the name as it goes (open addressing), so lookups are case-insensitive and don't allocate.
+ * Sort() orders the entries by name once all of them are inserted, every directory is then a contiguous range of them.
+ * Lookups never reorder the entries, so they are const and entry pointers stay valid until the next Insert() or Sort().
+ */
+class CNtlPLPackIndex
 {
+protected:
+
+	std::vector<SFilePackEntry>	m_vecEntry;
+	std::vector<RwChar>			m_vecNamePool;
+	std::vector<RwUInt32>		m_vecSlot;			// entry index + 1, 0 is an empty slot.
+	RwBool						m_bSorted;
+
 public:
-	
-	typedef stdext::hash_map<std::string, SFilePackHeaderElement*> HMapPackHeader;
 
+	CNtlPLPackIndex();
+	~CNtlPLPackIndex();
+
+	void					Clear(void);
+	void					Reserve(RwUInt32 uiCount, RwUInt32 uiNamePoolSize);
+
+	// an entry with the same name is overwritten.
+	const SFilePackEntry*	Insert(RwUInt8 byUnit, const RwChar *pName, RwUInt32 uiSize, RwUInt32 uiOffset, RwUInt32 uiPackedSize, RwUInt8 byCompress);
+
+	const SFilePackEntry*	Find(const RwChar *pName) const;
+
+	// call after the last Insert(). FindRange() and the GetEntry() order need it.
+	void					Sort(void);
+
+	// the entries [uiBegin, uiEnd) start with pPrefix.
+	RwBool					FindRange(const RwChar *pPrefix, RwUInt32& uiBegin, RwUInt32& uiEnd) const;
+
+	RwUInt32				GetCount(void) const;
+	const SFilePackEntry*	GetEntry(RwUInt32 uiIndex) const;
+	const RwChar*			GetName(const SFilePackEntry *pEntry) const;
+
+protected:
+
+	void					Rehash(RwUInt32 uiSlotCount);
+	RwUInt32				FindSlot(const RwChar *pName, RwUInt32 uiLength, RwUInt32 uiHash) const;
+	RwInt32					ComparePrefix(const SFilePackEntry& sEntry, const RwChar *pPrefix, RwUInt32 uiLength) const;
+
+	static RwChar			Normalize(RwChar ch);
+	static RwUInt32			Hash(const RwChar *pName, RwUInt32& uiLength);
+};
+
+inline RwUInt32 CNtlPLPackIndex::GetCount(void) const
+{
+	return (RwUInt32)m_vecEntry.size();
+}
+
+inline const RwChar* CNtlPLPackIndex::GetName(const SFilePackEntry *pEntry) const
+{
+	return &m_vecNamePool[pEntry->uiNameOffset];
+}
+
+inline RwChar CNtlPLPackIndex::Normalize(RwChar ch)
+{
+	if(ch >= 'A' && ch <= 'Z')
+		return ch - 'A' + 'a';
+
+	if(ch == '/')
+		return '\\';
+
+	return ch;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * \brief One pack data file (tex0.pak, terrain3.pak, ...).
+ * The file is opened and mapped once and every element is served out of the mapped view.
+ * If the view can't be mapped, the elements are copied out of the open handle instead.
+ * Compressed elements are inflated straight into the caller's buffer, they have no span or stream.
+ * The FILE* based loaders borrow a stream of the unit, released streams stay open for the next one.
+ */
+class CNtlPLPackDataUnit
+{
+protected:
+
+	HANDLE			m_hFile;
+	HANDLE			m_hMapping;
+	const RwUInt8	*m_pView;
+	RwUInt32		m_uiSize;
+
+	std::string		m_strFullPath;
+
+	CRITICAL_SECTION	m_csStream;
+	std::vector<FILE*>	m_vecStream;		// released streams of the data file.
+
+public:
+
+	CNtlPLPackDataUnit();
+	~CNtlPLPackDataUnit();
+
+	RwBool			Open(const RwChar *pFileName);
+	void			Close(void);
+
+	RwBool			IsMapped(void) const;
+
+	// pointer into the mapped view, NULL if the unit isn't mapped or the element is compressed.
+	const RwUInt8*	GetData(const SFilePackEntry *pElement) const;
+
+	// copies or inflates the element into pBuffer (uiSize bytes). safe to call from any thread.
+	RwBool			ReadData(const SFilePackEntry *pElement, void *pBuffer) const;
+
+	// stream of the data file positioned at the element, NULL for a compressed element.
+	// give it back with ReleaseStream() instead of fclose(). safe to call from any thread.
+	FILE*			AcquireStream(const SFilePackEntry *pElement);
+	void			ReleaseStream(FILE *pFile);
+
+	// absolute path of the data file, taken when the unit was opened.
+	const std::string&	GetFullPath(void) const;
+
+protected:
+
+	RwBool			IsValidElement(const SFilePackEntry *pElement) const;
+	RwBool			InflateData(const SFilePackEntry *pElement, void *pBuffer) const;
+};
+
+inline RwBool CNtlPLPackDataUnit::IsMapped(void) const
+{
+	return m_pView != NULL;
+}
+
+inline const std::string& CNtlPLPackDataUnit::GetFullPath(void) const
+{
+	return m_strFullPath;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class CNtlPLResourcePack
+{
 protected:
 
 	std::string		m_strHeaderName;
 	std::string		m_strDataName;
-	HMapPackHeader	m_hmapPackHeader;
+	CNtlPLPackIndex	m_Index;
+
+	CNtlPLPackDataUnit	*m_pDataUnit[NTL_FILEPACK_MAX_UNIT];
 
 public:
 
@@ -171,20 +346,114 @@ public:
 	void		RegistDataName(const RwChar *pFileName);
 
 	const char*		encrypt(std::string data);
-	SFilePackHeaderElement*	FindHeader(std::string str); 
-	SFilePackHeaderElement* FindHeader(const RwChar *pFileName); 
+	const SFilePackEntry*	FindHeader(const RwChar *pFileName) const; 
+	RwBool					FindHeaderRange(const RwChar *pPrefix, RwUInt32& uiBegin, RwUInt32& uiEnd) const;
 
-	void					AddHeader(RwUInt8 byUnit, const RwChar *pFileName, RwUInt32 uiSize, RwUInt32 uiOffset);
-	HMapPackHeader&			GetHeaders(void);
+	void					AddHeader(RwUInt8 byUnit, const RwChar *pFileName, RwUInt32 uiSize, RwUInt32 uiOffset, RwUInt32 uiPackedSize, RwUInt8 byCompress);
+	CNtlPLPackIndex&		GetHeaders(void);
 
 	RwInt32					GetElementCount(void);
+	RwBool					HasCompressedElement(void);
 
 	void					GetPackDataFileName(RwUInt8 byUnit, std::string& strPackDataFileName);
 
 	RwInt32		LoadPack(const RwChar *pFileName);
 	RwInt32		SavePack(const RwChar *pFileName);
+
+	// opens every data unit the header refers to. pPath is prepended to the data file names.
+	void					OpenDataUnits(const RwChar *pPath);
+	void					CloseDataUnits(void);
+
+	CNtlPLPackDataUnit*		GetDataUnit(RwUInt8 byUnit) const;
+
+	const RwUInt8*			GetElementData(const SFilePackEntry *pElement) const;
+	RwBool					ReadElementData(const SFilePackEntry *pElement, void *pBuffer) const;
 };
 
+inline CNtlPLPackDataUnit* CNtlPLResourcePack::GetDataUnit(RwUInt8 byUnit) const
+{
+	return m_pDataUnit[byUnit];
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * \brief Data of one pack element.
+ * Points into the mapped view of its unit when it can. A compressed element, or one of a unit that
+ * isn't mapped, is read into a buffer of its own. The data stays valid until Release().
+ * LoadFile() reads a loose file the same way, so a loader parses the pack and the folder data alike.
+ */
+class CNtlPLPackElementData
+{
+protected:
+
+	const RwUInt8	*m_pData;
+	RwUInt8			*m_pBuffer;
+	RwUInt32		m_uiSize;
+
+public:
+
+	CNtlPLPackElementData();
+	~CNtlPLPackElementData();
+
+	RwBool			Load(CNtlPLResourcePack *pResPack, const SFilePackEntry *pElement);
+	RwBool			LoadFile(const RwChar *pFileName);
+	void			Release(void);
+
+	const RwUInt8*	GetData(void) const;
+	RwUInt32		GetSize(void) const;
+
+private:
+
+	CNtlPLPackElementData(const CNtlPLPackElementData&);
+	CNtlPLPackElementData& operator = (const CNtlPLPackElementData&);
+};
+
+inline const RwUInt8* CNtlPLPackElementData::GetData(void) const
+{
+	return m_pData;
+}
+
+inline RwUInt32 CNtlPLPackElementData::GetSize(void) const
+{
+	return m_uiSize;
+}
+
+/**
+ * \brief FILE* for the loaders that read a pack element or a loose file through stdio.
+ * A pack element borrows a stream of its data unit, positioned at the element, a loose file is opened as is.
+ * ftell() offsets of a pack element are offsets in the data file, seek the same stream back to them.
+ */
+class CNtlPLPackStream
+{
+protected:
+
+	CNtlPLPackDataUnit	*m_pDataUnit;
+	FILE				*m_pFile;
+
+public:
+
+	CNtlPLPackStream();
+	~CNtlPLPackStream();
+
+	RwBool			Open(CNtlPLPackDataUnit *pDataUnit, const SFilePackEntry *pElement);
+	RwBool			OpenFile(const RwChar *pFileName);
+	void			Close(void);
+
+	FILE*			GetFile(void) const;
+
+private:
+
+	CNtlPLPackStream(const CNtlPLPackStream&);
+	CNtlPLPackStream& operator = (const CNtlPLPackStream&);
+};
+
+inline FILE* CNtlPLPackStream::GetFile(void) const
+{
+	return m_pFile;
+}
+
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -214,6 +483,10 @@ private:
 	RwInt32		m_iMemSize;
 	RwChar		*m_pMemBuffer;
 
+	// pack builder compression.
+	RwBool					m_bCompressPack;
+	std::vector<RwUInt8>	m_vecCompressBuffer;
+
 	CNtlPLResourcePack *m_pResPack[MAX_NTL_PACK_TYPE];
 
 	CNtlCallbackParam2 *m_pCallMakePackNotify;
@@ -224,10 +497,15 @@ private:
 	void	DeleteAllPack(void);
 
 	void	GetAllFiles(std::string& strOffsetFolder, std::list<std::string>& listFiles);
-	RwInt32	SavePackFile(CNtlPLResourcePack *pResPack, std::list<std::string>& listFiles, const RwChar *pPackDataFileName); 
+	RwInt32	SavePackFile(RwUInt8 byPackType, std::list<std::string>& listFiles, const RwChar *pPackDataFileName, RwBool bCompress); 
 	RwChar*	DumpFile(const char *pFileName, RwUInt32& uiSize);
+	const RwUInt8* CompressFile(const RwChar *pData, RwUInt32 uiSize, RwUInt32& uiPackedSize);
+
+	// files whose loader reads the element data can be compressed, the ones read through a stream or at the raw offset stay stored.
+	RwBool	IsCompressibleFile(RwUInt8 byPackType, const RwChar *pFileName) const;
 
 	void	FilterPathBuffer(const RwChar *pPath, const RwChar *pFileName);
+	static void	FilterFileName(RwChar *pBuffer, const RwChar *pFileName);
 	void	CheckMemoryBuffer(RwInt32 iSize);
 
 	RwInt32 LoadPack(RwUInt8 byPackType, const RwChar *pPackHeaderFileName);
@@ -245,9 +523,17 @@ private:
     RwInt32 SaveTablePack(void);
     RwInt32 SavePropertyPack(void);
 
-	RwChar*	UnPackLeadBuffer(RwChar* pBuffer, const RwChar *pPackFileName, SFilePackHeaderElement *pElement);
-	void	UnPackSaveBuffer(const RwChar *pFileName, const RwChar *pBuffer, SFilePackHeaderElement *pElement);
-	void	UnPack(const RwChar *pFileName, const RwChar *pPackFileName, SFilePackHeaderElement *pElement, RwUInt32 uiPercent);
+	RwChar*	UnPackLeadBuffer(RwChar* pBuffer, CNtlPLResourcePack *pResPack, const SFilePackEntry *pElement);
+	void	UnPackSaveBuffer(const RwChar *pFileName, const RwChar *pBuffer, const SFilePackEntry *pElement);
+	void	UnPack(const RwChar *pFileName, CNtlPLResourcePack *pResPack, const SFilePackEntry *pElement, RwUInt32 uiPercent);
+
+	void	ReadElement(CNtlPLResourcePack *pResPack, const SFilePackEntry *pElement, void **pData, RwInt32 *iSize);
+
+	const SFilePackEntry*	FindObjectElement(const RwChar *pFileName);
+
+	// uses no member buffer, the terrain is looked up from the field loading threads as well.
+	const SFilePackEntry*	FindTerrainElement(const RwChar *pFileName);
+	const SFilePackEntry*	FindTableElement(const RwChar *pFileName);
 
 public:
 
@@ -259,13 +545,25 @@ public:
 	void					SetActiveTypeFlags(RwUInt32 uiFlags);
 	RwUInt32				GetActiveFlags(void) const;
 
+	// zlib compresses the entries of the packs built from now on, entry by entry.
+	void					SetCompressPack(RwBool bCompress);
+	RwBool					IsCompressPack(void) const;
+
 	CNtlPLResourcePack*		FindResourcePack(RwUInt8 byPackType);
-	SFilePackHeaderElement* FindHeaderElement(RwUInt8 byPackType, const RwChar *pFileName);
+	const SFilePackEntry*	FindHeaderElement(RwUInt8 byPackType, const RwChar *pFileName);
+
+	// span of the element in the mapped pack data, NULL if the unit isn't mapped.
+	const RwUInt8*			GetPackData(RwUInt8 byPackType, const SFilePackEntry *pElement);
+	RwBool					ReadPackData(RwUInt8 byPackType, const SFilePackEntry *pElement, void *pBuffer);
 
 	RwTexture*				LoadTexture(const RwChar *pPath, const RwChar *pFileName, const RwChar *pMaskName);
-	RwBool					LoadObject(const RwChar *pFileName, SPackResFileData& sPackFileData);
-	RwBool					LoadTerrain(const RwChar *pFileName, SPackResFileData& sPackFileData);
-	std::string				LoadTerrain(const RwChar *pFileName, RwUInt32& uiOffset, RwUInt32& uiSize);
+
+	// the element data is read out of the mapped pack, the stream is for the loaders that take a FILE*.
+	RwBool					LoadObject(const RwChar *pFileName, CNtlPLPackElementData& ElementData);
+	RwBool					LoadObject(const RwChar *pFileName, CNtlPLPackStream& PackStream);
+	RwBool					LoadTerrain(const RwChar *pFileName, CNtlPLPackElementData& ElementData);
+	RwBool					LoadTerrain(const RwChar *pFileName, CNtlPLPackStream& PackStream);
+
 	void					LoadGui(const RwChar *pFileName, void **pData, RwUInt32 *uiSize);
 	void					LoadFlash(const RwChar *pFileName, void **pData, RwInt32 *iSize );
 	void					LoadSound(const RwChar *pFileName, void **pData, RwInt32 *iSize );
@@ -273,6 +571,7 @@ public:
     void                    LoadTs(const RwChar* pFileName, void** pData, RwInt32* iSize);
     void                    LoadScript(const RwChar* pFileName, void** pData, RwInt32* iSize);
 	void                    LoadTable(const RwChar* pFileName, void** pData, RwInt32* iSize);
+	RwBool					GetTableData(const RwChar* pFileName, const void** ppData, RwInt32* iSize);
     void                    LoadProperty(const RwChar* pFileName, void** pData, RwInt32* iSize);
 
 	RwInt32					LoadPackHeader(void);
@@ -311,6 +610,16 @@ inline RwUInt32	CNtlPLResoucePackManager::GetActiveFlags(void) const
 	return m_uiFlags;
 }
 
+inline void CNtlPLResoucePackManager::SetCompressPack(RwBool bCompress)
+{
+	m_bCompressPack = bCompress;
+}
+
+inline RwBool CNtlPLResoucePackManager::IsCompressPack(void) const
+{
+	return m_bCompressPack;
+}
+
 
 RwTexture*	ResourcPackTextureLoad(const RwChar *pPath, const RwChar *pFileName, const RwChar *pMaskName);
 void		GuiPackLoad(const RwChar *pFileName, void **pData, unsigned int *uiSize);
@@ -366,37 +366,23 @@ RwBool CNtlWorldBlockMananger::SetABlockProp(RwV3d& Pos, sNTL_BLOCK_PROP& NtlBlo
 
 RwBool CNtlWorldBlockMananger::LoadProperty()
 {
-	_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
+	RwChar chPropPath[NTL_MAX_DIR_PATH];
+	GetWorldFilePath(chPropPath, NTL_MAX_DIR_PATH, "wfp");
 
-	FILE* pFile = NULL;
+	CNtlPLPackStream PropStream;
 	if(GetNtlResourcePackManager()->GetActiveFlags() & NTL_PACK_TYPE_FLAG_TERRAIN)
 	{
-		static RwChar chPackPatch[NTL_MAX_DIR_PATH];
-		strcpy_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldProjectFolderName);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "wfp");
-
-		SPackResFileData sPackFileData;
-		RwBool bPack = GetNtlResourcePackManager()->LoadTerrain(chPackPatch, sPackFileData);
-		if(bPack)
-		{
-			_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-			::fopen_s(&pFile, sPackFileData.strPackFileName.c_str(), "rb");
-			if(pFile)
-			{
-				fseek(pFile, sPackFileData.uiOffset, SEEK_SET);
-			}
-		}
+		GetNtlResourcePackManager()->LoadTerrain(chPropPath, PropStream);
 	}
 	else
 	{
-		::fopen_s(&pFile, "wfp", "rb");
+		PropStream.OpenFile(chPropPath);
 	}
 
+	FILE* pFile = PropStream.GetFile();
 	if (pFile == NULL)
 	{
-		DBO_TRACE(FALSE, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
-		_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		DBO_TRACE(FALSE, "file open failed. (" << chPropPath << ")");
 		return FALSE;
 	}
 
@@ -465,10 +451,6 @@ RwBool CNtlWorldBlockMananger::LoadProperty()
 		fread(&pBlockProp->_GameProp, sizeof(RwUInt32), 1, pFile);
 	}
 
-	::fclose(pFile);
-
-	_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-
 	return TRUE;
 }
 
@@ -85,78 +85,40 @@ RwBool CNtlWorldField::CreateFieldFromFile(RwInt32 FieldIdx)
 {
 	NTL_FUNCTION("CNtlWorldField::CreateFieldFromFile");
 
-	_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-	_chdir("fields");
-
-	sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", FieldIdx);
-	_chdir(dGET_WORLD_PARAM()->WorldChar64Buf);
-
-	FILE *pFile = NULL;
+	RwChar chFieldPath[NTL_MAX_DIR_PATH];
+	GetWorldFieldFilePath(chFieldPath, NTL_MAX_DIR_PATH, FieldIdx, "wfpf");
 
+	// read out of the mapped pack data, or out of the loose file loaded at once.
+	CNtlPLPackElementData PropData;
 	if(GetNtlResourcePackManager()->GetActiveFlags() & NTL_PACK_TYPE_FLAG_TERRAIN)
 	{
-		static RwChar chPackPatch[NTL_MAX_DIR_PATH];
-		strcpy_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldProjectFolderName);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "fields");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-
-		sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfpf%d", FieldIdx);
-
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-		
-		SPackResFileData sPackFileData;
-		RwBool bPack = GetNtlResourcePackManager()->LoadTerrain(chPackPatch, sPackFileData);
-		if(bPack)
-		{
-			_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-			::fopen_s(&pFile, sPackFileData.strPackFileName.c_str(), "rb");
-			if(pFile)
-			{
-				fseek(pFile, sPackFileData.uiOffset, SEEK_SET);
-			}
-		}
+		GetNtlResourcePackManager()->LoadTerrain(chFieldPath, PropData);
 	}
 	else
 	{
-		sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfpf%d", FieldIdx);
-
-		::fopen_s(&pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb");
+		PropData.LoadFile(chFieldPath);
 	}
 
-	if(pFile == NULL)
+	RwInt32 iTileNumInField = ((&g_sNtlWorldParam)->WorldSectorTileNum * (&g_sNtlWorldParam)->WorldFieldSectorNum) * ((&g_sNtlWorldParam)->WorldSectorTileNum * (&g_sNtlWorldParam)->WorldFieldSectorNum);
+
+	BYTE *pFileMem = (BYTE*)PropData.GetData();
+	if(pFileMem == NULL)
 	{
-		DBO_TRACE(FALSE, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
-		_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		DBO_TRACE(FALSE, "file open failed. (" << chFieldPath << ")");
+		NTL_RETURN(FALSE);
+	}
+	else if(GetNtlWorldFieldInfo()->FieldPropSkipToFileMem(pFileMem, iTileNumInField) > pFileMem + PropData.GetSize())
+	{
+		DBO_TRACE(FALSE, "file is too short. (" << chFieldPath << ")");
 		NTL_RETURN(FALSE);
 	}
 	else
 	{		
 		m_pProp = NTL_NEW sNTL_FIELD_PROP;
 
-		RwInt32 iTileNumInField = ((&g_sNtlWorldParam)->WorldSectorTileNum * (&g_sNtlWorldParam)->WorldFieldSectorNum) * ((&g_sNtlWorldParam)->WorldSectorTileNum * (&g_sNtlWorldParam)->WorldFieldSectorNum);
-
-		GetNtlWorldFieldInfo()->FieldNameLoadFromFile(pFile, m_pProp);
-		GetNtlWorldFieldInfo()->FieldBitPropLoadFromFile(pFile, m_pProp, iTileNumInField);
-		GetNtlWorldFieldInfo()->FieldFogLoadFromFile(pFile, m_pProp);
-		GetNtlWorldFieldInfo()->FieldSkyLoadFromFile(pFile, m_pProp);
-		GetNtlWorldFieldInfo()->FieldRealLightLoadFromFile(pFile, m_pProp);
-		GetNtlWorldFieldInfo()->FieldBGMLoadFromFile(pFile, m_pProp);
-		GetNtlWorldFieldInfo()->FieldBloomLoadFromFile(pFile, m_pProp);
-		GetNtlWorldFieldInfo()->FieldPlanetLoadFromFile(pFile, m_pProp);
-		GetNtlWorldFieldInfo()->FieldSpecularLoadFromFile(pFile, m_pProp);
-		GetNtlWorldFieldInfo()->FieldWorldMaterialLoadFromFile(pFile, m_pProp, iTileNumInField);
-		GetNtlWorldFieldInfo()->FieldColorLoadFromFile(pFile, m_pProp);
-		GetNtlWorldFieldInfo()->FieldWeatherLoadFromFile(pFile, m_pProp);
-		GetNtlWorldFieldInfo()->FieldHeatHazeLoadFromFile(pFile, m_pProp);
-						  
-		fclose(pFile);
+		GetNtlWorldFieldInfo()->FieldPropLoadFromFileMem(pFileMem, m_pProp, iTileNumInField);
 	}
 
-	_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-
 	NTL_RETURN(TRUE);
 }
 
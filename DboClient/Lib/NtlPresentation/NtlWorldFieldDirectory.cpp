@@ -0,0 +1,262 @@
+#include "precomp_ntlpresentation.h"
+#include "NtlWorldFieldDirectory.h"
+#include "ntlworldsectorinfo.h"
+#include "NtlDebug.h"
+
+#include <io.h>
+
+//////////////////////////////////////////////////////////////////////////
+// dNTL_WORLD_FILE : DEFINE
+//////////////////////////////////////////////////////////////////////////
+#ifdef dNTL_WORLD_FILE
+
+CNtlWorldFieldDirectory::MAP_DIRECTORY CNtlWorldFieldDirectory::s_mapDirectory;
+CNtlWorldFieldDirectory::sLOCK CNtlWorldFieldDirectory::s_Lock;
+
+CNtlWorldFieldDirectory::CNtlWorldFieldDirectory(void)
+{
+	m_DirOffset	= 0;
+	m_FileSize	= -1;
+}
+
+CNtlWorldFieldDirectory::~CNtlWorldFieldDirectory(void)
+{
+}
+
+RwBool CNtlWorldFieldDirectory::VerifyTail(sNTL_FIELD_DIRECTORY_TAIL& Tail, RwInt32 FileSize)
+{
+	RwInt32 SectorNum = dGET_WORLD_PARAM()->WorldFieldSectorNum * dGET_WORLD_PARAM()->WorldFieldSectorNum;
+
+	if(Tail.Magic != dNTL_FIELD_DIRECTORY_MAGIC || Tail.SectorNum != SectorNum || Tail.ChunkNum != eNFC_NUM || Tail.DirOffset < 0)
+	{
+		return FALSE;
+	}
+
+	// anything appended or cut off after the directory was written shows here
+	return (Tail.DirOffset + static_cast<RwInt32>(SectorNum * eNFC_NUM * sizeof(RwInt32) + sizeof(sNTL_FIELD_DIRECTORY_TAIL)) == FileSize);
+}
+
+RwBool CNtlWorldFieldDirectory::VerifyOffset()
+{
+	if(m_vecOffset.empty() || m_vecOffset[0] != 0)
+	{
+		return FALSE;
+	}
+
+	for(RwUInt32 i = 1; i < m_vecOffset.size(); ++i)
+	{
+		if(m_vecOffset[i] < m_vecOffset[i - 1] || m_vecOffset[i] > m_DirOffset)
+		{
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+RwBool CNtlWorldFieldDirectory::LoadFromFile(FILE* pFile)
+{
+	m_vecOffset.clear();
+
+	RwInt32 PosHead		= ftell(pFile);
+	RwInt32 FileSize	= _filelength(_fileno(pFile)) - PosHead;
+	m_FileSize			= FileSize;
+
+	sNTL_FIELD_DIRECTORY_TAIL Tail;
+	if(FileSize >= static_cast<RwInt32>(sizeof(sNTL_FIELD_DIRECTORY_TAIL)))
+	{
+		fseek(pFile, PosHead + FileSize - sizeof(sNTL_FIELD_DIRECTORY_TAIL), SEEK_SET);
+		if(fread(&Tail, sizeof(sNTL_FIELD_DIRECTORY_TAIL), 1, pFile) == 1 && VerifyTail(Tail, FileSize))
+		{
+			m_DirOffset = Tail.DirOffset;
+			m_vecOffset.resize(Tail.SectorNum * Tail.ChunkNum);
+
+			fseek(pFile, PosHead + Tail.DirOffset, SEEK_SET);
+			if(fread(&m_vecOffset[0], sizeof(RwInt32) * m_vecOffset.size(), 1, pFile) != 1 || !VerifyOffset())
+			{
+				m_vecOffset.clear();
+			}
+		}
+	}
+
+	fseek(pFile, PosHead, SEEK_SET);
+
+	return IsLoaded();
+}
+
+RwBool CNtlWorldFieldDirectory::LoadFromFileMem(BYTE* pFileMem, RwInt32 FileSize)
+{
+	m_vecOffset.clear();
+	m_FileSize = FileSize;
+
+	sNTL_FIELD_DIRECTORY_TAIL Tail;
+	if(FileSize >= static_cast<RwInt32>(sizeof(sNTL_FIELD_DIRECTORY_TAIL)))
+	{
+		CopyMemory(&Tail, pFileMem + FileSize - sizeof(sNTL_FIELD_DIRECTORY_TAIL), sizeof(sNTL_FIELD_DIRECTORY_TAIL));
+		if(VerifyTail(Tail, FileSize))
+		{
+			m_DirOffset = Tail.DirOffset;
+			m_vecOffset.resize(Tail.SectorNum * Tail.ChunkNum);
+
+			CopyMemory(&m_vecOffset[0], pFileMem + Tail.DirOffset, sizeof(RwInt32) * m_vecOffset.size());
+			if(!VerifyOffset())
+			{
+				m_vecOffset.clear();
+			}
+		}
+	}
+
+	return IsLoaded();
+}
+
+RwInt32 CNtlWorldFieldDirectory::GetOffset(RwInt32 IdxSectorInField, eNTL_FIELD_CHUNKID eChunkID)
+{
+	RwInt32 Idx = IdxSectorInField * eNFC_NUM + eChunkID;
+	if(IdxSectorInField < 0 || Idx >= static_cast<RwInt32>(m_vecOffset.size()))
+	{
+		return -1;
+	}
+
+	return m_vecOffset[Idx];
+}
+
+RwBool CNtlWorldFieldDirectory::FindOffset(RwInt32 IdxField, RwInt32 FileSize, RwInt32 IdxSectorInField, RwInt32& Offset)
+{
+	RwBool bFound = FALSE;
+
+	::EnterCriticalSection(&s_Lock.CS);
+
+	MAP_DIRECTORY_ITER The = s_mapDirectory.find(IdxField);
+	if(The != s_mapDirectory.end() && The->second.m_FileSize == FileSize)
+	{
+		Offset = The->second.IsLoaded() ? The->second.GetOffset(IdxSectorInField, eNFC_MESH) : -1;
+		bFound = TRUE;
+	}
+
+	::LeaveCriticalSection(&s_Lock.CS);
+
+	return bFound;
+}
+
+void CNtlWorldFieldDirectory::Insert(RwInt32 IdxField, CNtlWorldFieldDirectory& FieldDirectory)
+{
+	::EnterCriticalSection(&s_Lock.CS);
+
+	CNtlWorldFieldDirectory& Dest = s_mapDirectory[IdxField];
+	Dest.m_DirOffset	= FieldDirectory.m_DirOffset;
+	Dest.m_FileSize		= FieldDirectory.m_FileSize;
+	Dest.m_vecOffset.swap(FieldDirectory.m_vecOffset);
+
+	::LeaveCriticalSection(&s_Lock.CS);
+}
+
+void CNtlWorldFieldDirectory::Invalidate(RwInt32 IdxField)
+{
+	::EnterCriticalSection(&s_Lock.CS);
+	s_mapDirectory.erase(IdxField);
+	::LeaveCriticalSection(&s_Lock.CS);
+}
+
+void CNtlWorldFieldDirectory::InvalidateAll()
+{
+	::EnterCriticalSection(&s_Lock.CS);
+	s_mapDirectory.clear();
+	::LeaveCriticalSection(&s_Lock.CS);
+}
+
+RwBool CNtlWorldFieldDirectory::SaveIntoFile(FILE* pFile, RwInt32 IdxField, std::vector<RwInt32>& vecOffset)
+{
+	Invalidate(IdxField);
+
+	sNTL_FIELD_DIRECTORY_TAIL Tail;
+	Tail.Magic		= dNTL_FIELD_DIRECTORY_MAGIC;
+	Tail.SectorNum	= dGET_WORLD_PARAM()->WorldFieldSectorNum * dGET_WORLD_PARAM()->WorldFieldSectorNum;
+	Tail.ChunkNum	= eNFC_NUM;
+	Tail.DirOffset	= ftell(pFile);
+
+	if(static_cast<RwInt32>(vecOffset.size()) != Tail.SectorNum * eNFC_NUM)
+	{
+		DBO_TRACE(FALSE, "CNtlWorldFieldDirectory::SaveIntoFile, chunk offset count mismatched. (" << vecOffset.size() << ", " << Tail.SectorNum * eNFC_NUM << ")");
+		return FALSE;
+	}
+
+	fwrite(&vecOffset[0], sizeof(RwInt32) * vecOffset.size(), 1, pFile);
+	fwrite(&Tail, sizeof(sNTL_FIELD_DIRECTORY_TAIL), 1, pFile);
+
+	// what has just been written is what the next skip would read back
+	CNtlWorldFieldDirectory FieldDirectory;
+	FieldDirectory.m_DirOffset	= Tail.DirOffset;
+	FieldDirectory.m_FileSize	= ftell(pFile);
+	FieldDirectory.m_vecOffset.swap(vecOffset);
+
+	if(!FieldDirectory.VerifyOffset())
+	{
+		DBO_TRACE(FALSE, "CNtlWorldFieldDirectory::SaveIntoFile, invalid chunk offsets. (" << IdxField << ")");
+		return TRUE;
+	}
+
+	Insert(IdxField, FieldDirectory);
+
+	return TRUE;
+}
+
+RwBool CNtlWorldFieldDirectory::SkipToSector(FILE* pFile, RwInt32 IdxField, RwInt32 IdxSectorInField)
+{
+	RwInt32 PosHead		= ftell(pFile);
+	RwInt32 FileSize	= _filelength(_fileno(pFile)) - PosHead;
+
+	RwInt32 Offset = -1;
+	if(!FindOffset(IdxField, FileSize, IdxSectorInField, Offset))
+	{
+		// a field file without the directory is cached as well, so it isn't probed again on every skip
+		CNtlWorldFieldDirectory FieldDirectory;
+		if(FieldDirectory.LoadFromFile(pFile))
+		{
+			Offset = FieldDirectory.GetOffset(IdxSectorInField, eNFC_MESH);
+		}
+
+		Insert(IdxField, FieldDirectory);
+	}
+
+	if(Offset != -1)
+	{
+		fseek(pFile, PosHead + Offset, SEEK_SET);
+		return TRUE;
+	}
+
+	for(RwInt32 i = 0; i < IdxSectorInField; ++i)
+	{
+		GetNtlWorldSectorInfo()->OutdoorSectorSkipToFile(pFile);
+	}
+
+	return TRUE;
+}
+
+BYTE* CNtlWorldFieldDirectory::SkipToSectorMem(BYTE* pFileMem, RwInt32 FileSize, RwInt32 IdxField, RwInt32 IdxSectorInField)
+{
+	RwInt32 Offset = -1;
+	if(!FindOffset(IdxField, FileSize, IdxSectorInField, Offset))
+	{
+		CNtlWorldFieldDirectory FieldDirectory;
+		if(FieldDirectory.LoadFromFileMem(pFileMem, FileSize))
+		{
+			Offset = FieldDirectory.GetOffset(IdxSectorInField, eNFC_MESH);
+		}
+
+		Insert(IdxField, FieldDirectory);
+	}
+
+	if(Offset != -1)
+	{
+		return pFileMem + Offset;
+	}
+
+	for(RwInt32 i = 0; i < IdxSectorInField; ++i)
+	{
+		pFileMem = GetNtlWorldSectorInfo()->OutdoorSectorSkipToFileMem(pFileMem);
+	}
+
+	return pFileMem;
+}
+
+#endif
@@ -0,0 +1,105 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  ntlworldfielddirectory.h
+//
+//  copyright (c) 2005 ntl Ltd.
+//
+//  purpose : offset directory of the sectors in a field file(wfif)
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+
+#include "ntlworldcommon.h"
+
+#include <vector>
+#include <map>
+
+//////////////////////////////////////////////////////////////////////////
+// dNTL_WORLD_FILE : DEFINE
+//////////////////////////////////////////////////////////////////////////
+#ifdef dNTL_WORLD_FILE
+
+#define dNTL_FIELD_DIRECTORY_MAGIC	(0x52444657) // "WFDR"
+
+// written at the very end of the field file, right after the offset table
+struct sNTL_FIELD_DIRECTORY_TAIL
+{
+	RwUInt32	Magic;
+	RwInt32		SectorNum;
+	RwInt32		ChunkNum;
+	RwInt32		DirOffset;	// where the offset table starts, which is also where the sector data ends
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// definition : CNtlWorldFieldDirectory
+//
+// the field file is a plain run of outdoor sectors, so finding a sector used to mean parsing every sector ahead of it.
+// the directory keeps the offset of each chunk of each sector (SectorNum * eNFC_NUM RwInt32s, sector-major) behind the
+// sector data, with sNTL_FIELD_DIRECTORY_TAIL as the last bytes of the file. code reading the sectors sequentially
+// never gets to it, and a field file written without it, or rewritten by a tool which doesn't know of it, is simply
+// walked the old way.
+//
+// the offsets are relative to the head of the field file. the directory of each field file is read once and kept by field
+// index, keyed also on the file size so a field file changed behind our back is read again.
+// fields are streamed in from the loading threads as well, so the map is only touched under s_Lock. a directory is read
+// outside of it and put in afterwards, and a skip copies the offset it needs out rather than keeping a pointer.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class CNtlWorldFieldDirectory
+{
+public:
+	CNtlWorldFieldDirectory(void);
+	~CNtlWorldFieldDirectory(void);
+
+protected:
+	typedef std::map<RwInt32, CNtlWorldFieldDirectory>	MAP_DIRECTORY;
+	typedef MAP_DIRECTORY::iterator						MAP_DIRECTORY_ITER;
+
+	struct sLOCK
+	{
+		CRITICAL_SECTION	CS;
+
+		sLOCK()		{ ::InitializeCriticalSection(&CS); }
+		~sLOCK()	{ ::DeleteCriticalSection(&CS); }
+	};
+
+	static MAP_DIRECTORY	s_mapDirectory;
+	static sLOCK			s_Lock;
+
+	std::vector<RwInt32>	m_vecOffset;
+	RwInt32					m_DirOffset;
+	RwInt32					m_FileSize;
+
+public:
+	// pFile is a loose field file("rb") at its head, and is left there
+	RwBool	LoadFromFile(FILE* pFile);
+	RwBool	LoadFromFileMem(BYTE* pFileMem, RwInt32 FileSize);
+
+	RwBool	IsLoaded() { return !m_vecOffset.empty(); }
+	RwInt32	GetOffset(RwInt32 IdxSectorInField, eNTL_FIELD_CHUNKID eChunkID);
+
+	// pFile has been opened with "wb+" and all the sectors of the field have just been written from its head.
+	// vecOffset holds the chunk offsets recorded while writing them, SectorNum * eNFC_NUM, sector-major
+	static RwBool	SaveIntoFile(FILE* pFile, RwInt32 IdxField, std::vector<RwInt32>& vecOffset);
+
+	// move to the sector, IdxSectorInField counted in the order the sectors are written.
+	// these use the directory when the field file has one and skip the preceding sectors otherwise.
+	static RwBool	SkipToSector(FILE* pFile, RwInt32 IdxField, RwInt32 IdxSectorInField);
+	static BYTE*	SkipToSectorMem(BYTE* pFileMem, RwInt32 FileSize, RwInt32 IdxField, RwInt32 IdxSectorInField);
+
+	// forget the directories read so far, for a world being unloaded or a field file rewritten by hand
+	static void		Invalidate(RwInt32 IdxField);
+	static void		InvalidateAll();
+
+protected:
+	RwBool	VerifyTail(sNTL_FIELD_DIRECTORY_TAIL& Tail, RwInt32 FileSize);
+	RwBool	VerifyOffset();
+
+	// both take s_Lock. FindOffset returns FALSE when the field file has to be read first
+	static RwBool	FindOffset(RwInt32 IdxField, RwInt32 FileSize, RwInt32 IdxSectorInField, RwInt32& Offset);
+	static void		Insert(RwInt32 IdxField, CNtlWorldFieldDirectory& FieldDirectory);
+};
+
+#endif
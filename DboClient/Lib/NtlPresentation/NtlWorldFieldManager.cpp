@@ -21,6 +21,7 @@
 #include "NtlWorldFieldInfo.h"
 #include "NtlWorldField.h"
 #include "NtlWorldFieldManager.h"
+#include "NtlWorldFieldDirectory.h"
 #include "NtlWorldShadowManager.h"
 #include "NtlWorldBGMManager.h"
 #include "NtlWorldMergeManager.h"
@@ -388,52 +389,47 @@ VOID CNtlWorldFieldManager::LoadPVS()
 	BYTE	PVSFlag	= FALSE;
 	BYTE	NeighborVisibility[dPVS_TOT_CELL_CNT *  dPVS_LAYER_CNT];
 
-	_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
+	RwChar chPVSPath[NTL_MAX_DIR_PATH];
+	GetWorldFilePath(chPVSPath, NTL_MAX_DIR_PATH, "-------");
 
-	FILE *pFile = NULL;	
+	// read out of the mapped pack data, or out of the loose file loaded at once.
+	CNtlPLPackElementData PVSData;
 	if(GetNtlResourcePackManager()->GetActiveFlags() & NTL_PACK_TYPE_FLAG_TERRAIN)
 	{
-		static RwChar chPackPatch[NTL_MAX_DIR_PATH];
-		strcpy_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldProjectFolderName);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "-------");
-
-		SPackResFileData sPackFileData;
-		RwBool bPack = GetNtlResourcePackManager()->LoadTerrain(chPackPatch, sPackFileData);
-		if(bPack)
-		{
-			_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-			::fopen_s(&pFile, sPackFileData.strPackFileName.c_str(), "rb");
-			if(pFile)
-			{
-				fseek(pFile, sPackFileData.uiOffset, SEEK_SET);
-			}
-		}
+		GetNtlResourcePackManager()->LoadTerrain(chPVSPath, PVSData);
 	}
 	else
 	{
-		pFile = fopen("-------", "rb");
+		PVSData.LoadFile(chPVSPath);
 	}
 
-	DBO_ASSERT(pFile, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
+	DBO_ASSERT(PVSData.GetData(), "file open failed. (" << chPVSPath << ")");
 
-	if (pFile)
+	if (PVSData.GetData())
 	{
-		int iError = 1;
+		const BYTE *pFileMem = PVSData.GetData();
+		const BYTE *pFileEnd = pFileMem + PVSData.GetSize();
+
 		for(RwInt32 i = 0; i < dGET_WORLD_PARAM()->WorldSectorNum * dGET_WORLD_PARAM()->WorldSectorNum; ++i)
 		{
-			iError = fread(&PVSFlag, sizeof(BYTE), 1, pFile);
+			if(pFileMem + sizeof(BYTE) > pFileEnd)
+				break;
+
+			PVSFlag = *pFileMem;
+			pFileMem += sizeof(BYTE);
+
 			if(PVSFlag)
 			{
-				iError = fread(NeighborVisibility, sizeof(BYTE) * dPVS_TOT_CELL_CNT * dPVS_LAYER_CNT, 1, pFile);
+				if(pFileMem + sizeof(NeighborVisibility) > pFileEnd)
+					break;
+
+				memcpy(NeighborVisibility, pFileMem, sizeof(NeighborVisibility));
+				pFileMem += sizeof(NeighborVisibility);
+
 				m_pSectors[i].m_pNtlWorldSectorPVS->SetVisibilityNeighbor(NeighborVisibility);
 			}
 		}
-
-		fclose(pFile);
 	}
-
-	_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
 }
 
 void CNtlWorldFieldManager::CreateRpWorld()
@@ -501,6 +497,9 @@ void CNtlWorldFieldManager::Init(RpWorld *pNtlWorld, RwV3d& SpawnPos)
 
 	CreateRpWorld();
 
+	// the world folders are set by now, the field files are opened through absolute paths from here on
+	UpdateWorldFilePathRoot();
+
 	CNtlWorldFieldInfo::CreateInstance();
 
 	InitSingleInstance();
@@ -586,6 +585,9 @@ void CNtlWorldFieldManager::Free(void)
 	// ε
 	CNtlWorldSectorManager::Free();
 
+	// field indices belong to the world being freed
+	CNtlWorldFieldDirectory::InvalidateAll();
+
 	DestroySky();
 	DestroyDragoneSky();
 	DestroyFog();
@@ -1983,9 +1985,98 @@ RwBool CNtlWorldFieldManager::GetHeight(RwV3d& _Pos)
 	return TRUE;
 }
 
+RwBool CNtlWorldFieldManager::SkipToSectorInFieldFile(FILE* pFile, RwInt32 IdxField, RwInt32 IdxSector, RwV3d& SectorSPos)
+{
+	RwV3d	SPos				= m_pFields[IdxField].GetSPos();
+	RwInt32	IdxSectorInField	= 0;
+
+	for(RwInt32 l = (int)SPos.z; l < (int)SPos.z + dGET_WORLD_PARAM()->WorldFieldSize; l += dGET_WORLD_PARAM()->WorldSectorSize)
+	{
+		for(RwInt32 m = (int)SPos.x; m < (int)SPos.x + dGET_WORLD_PARAM()->WorldFieldSize; m += dGET_WORLD_PARAM()->WorldSectorSize)
+		{
+			SectorSPos.x = (RwReal)m;
+			SectorSPos.z = (RwReal)l;
+
+			if(GetSectorIdx(SectorSPos) == IdxSector)
+			{
+				return CNtlWorldFieldDirectory::SkipToSector(pFile, IdxField, IdxSectorInField);
+			}
+
+			++IdxSectorInField;
+		}
+	}
+
+	return FALSE;
+}
+
+BYTE* CNtlWorldFieldManager::SkipToSectorInFieldFileMem(BYTE* pFileMem, RwInt32 FileSize, RwInt32 IdxField, RwInt32 IdxSector, RwV3d& SectorSPos)
+{
+	RwV3d	SPos				= m_pFields[IdxField].GetSPos();
+	RwInt32	IdxSectorInField	= 0;
+
+	for(RwInt32 l = (int)SPos.z; l < (int)SPos.z + dGET_WORLD_PARAM()->WorldFieldSize; l += dGET_WORLD_PARAM()->WorldSectorSize)
+	{
+		for(RwInt32 m = (int)SPos.x; m < (int)SPos.x + dGET_WORLD_PARAM()->WorldFieldSize; m += dGET_WORLD_PARAM()->WorldSectorSize)
+		{
+			SectorSPos.x = (RwReal)m;
+			SectorSPos.z = (RwReal)l;
+
+			if(GetSectorIdx(SectorSPos) == IdxSector)
+			{
+				return CNtlWorldFieldDirectory::SkipToSectorMem(pFileMem, FileSize, IdxField, IdxSectorInField);
+			}
+
+			++IdxSectorInField;
+		}
+	}
+
+	return NULL;
+}
+
+RwBool CNtlWorldFieldManager::GetVertFromPack(const RwChar* pFieldPath, RwInt32 IdxField, RwInt32 IdxSector, RwV3d& DatumPt, RwV3d& Result)
+{
+	CNtlPLPackElementData FieldData;
+	if(!GetNtlResourcePackManager()->LoadTerrain(pFieldPath, FieldData))
+	{
+		DBO_TRACE(FALSE, "file open failed. (" << pFieldPath << ")");
+		return FALSE;
+	}
+
+	RwReal	TileSize;
+	RwReal	SPosX;	
+	RwReal	SPosZ;		
+	RwReal	CPosX;		
+	RwReal	CPosZ;		
+	RwInt32 XCnt;		
+	RwInt32 ZCnt;		
+	RwInt32	CntVert;
+
+	RwV3d	SectorSPos;
+	BYTE*	pFileMem = SkipToSectorInFieldFileMem((BYTE*)FieldData.GetData(), FieldData.GetSize(), IdxField, IdxSector, SectorSPos);
+	if(pFileMem)
+	{
+		TileSize	= (RwReal)dGET_WORLD_PARAM()->WorldSectorTileSize;
+		SPosX		= SectorSPos.x + dGET_WORLD_PARAM()->WorldSizeHalf;
+		SPosZ		= SectorSPos.z + dGET_WORLD_PARAM()->WorldSizeHalf;
+		CPosX		= DatumPt.x + dGET_WORLD_PARAM()->WorldSizeHalf;
+		CPosZ		= DatumPt.z + dGET_WORLD_PARAM()->WorldSizeHalf;
+		XCnt		= (RwInt32)(dGET_WORLD_PARAM()->WorldSectorTileNum - (RwInt32)((CPosX - SPosX) / TileSize));
+		ZCnt		= (RwInt32)((CPosZ - SPosZ) / (RwReal)TileSize);
+		CntVert		= XCnt + ZCnt * dGET_WORLD_PARAM()->WorldSectorVertNum;
+
+		pFileMem = GetNtlWorldSectorInfo()->SectorMaterialSkipToFileMem(pFileMem);
+		GetNtlWorldSectorInfo()->SectorHeightfieldSkipToFileMemGetVertex(pFileMem, CntVert, 1, &Result);
+
+		return TRUE;
+	}
+
+	DBO_TRACE(FALSE, "CNtlWorldFieldManager::GetVertFromPack, nothing matched.");
+
+	return FALSE;
+}
+
 RwBool CNtlWorldFieldManager::GetHeightFromFile(RwV3d& _PosSectorDatum, RwV3d& _PosTile)
 {
-	RwInt32 l, m;
 	RwInt32 IdxSector	= GetSectorIdx(_PosSectorDatum);
 	RwInt32 IdxField	= GetFieldIdx(_PosSectorDatum);
 
@@ -1994,17 +2085,25 @@ RwBool CNtlWorldFieldManager::GetHeightFromFile(RwV3d& _PosSectorDatum, RwV3d& _
 		return FALSE;
 	}
 
-	::_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-	::_chdir("fields");
+	RwChar chFieldPath[NTL_MAX_DIR_PATH];
+	GetWorldFieldFilePath(chFieldPath, NTL_MAX_DIR_PATH, IdxField, "wfif");
 
-	::sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", IdxField);
-	::_chdir(dGET_WORLD_PARAM()->WorldChar64Buf);
+	RwV3d	Result;
+	if(GetNtlResourcePackManager()->GetActiveFlags() & NTL_PACK_TYPE_FLAG_TERRAIN)
+	{
+		if(!GetVertFromPack(chFieldPath, IdxField, IdxSector, _PosTile, Result))
+		{
+			return FALSE;
+		}
+
+		_PosTile.y = Result.y;
+		return TRUE;
+	}
 
 	FILE* pFile;
-	if(::fopen_s(&pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb"))
+	if(::fopen_s(&pFile, chFieldPath, "rb"))
 	{
-		DBO_TRACE(FALSE, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
-		::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		DBO_TRACE(FALSE, "file open failed. (" << chFieldPath << ")");
 		return FALSE;
 	}
 
@@ -2016,54 +2115,36 @@ RwBool CNtlWorldFieldManager::GetHeightFromFile(RwV3d& _PosSectorDatum, RwV3d& _
 	RwInt32 XCnt;		
 	RwInt32 ZCnt;		
 	RwInt32	CntVert;
-	RwV3d	Result;
 
-	RwV3d	SPos = m_pFields[IdxField].GetSPos();
 	RwV3d	SectorSPos;
-	for(l = (int)SPos.z; l < (int)SPos.z + dGET_WORLD_PARAM()->WorldFieldSize; l += dGET_WORLD_PARAM()->WorldSectorSize)
+	if(SkipToSectorInFieldFile(pFile, IdxField, IdxSector, SectorSPos))
 	{
-		for(m = (int)SPos.x; m < (int)SPos.x + dGET_WORLD_PARAM()->WorldFieldSize; m += dGET_WORLD_PARAM()->WorldSectorSize)
-		{
-			SectorSPos.x = (RwReal)m;
-			SectorSPos.z = (RwReal)l;
-
-			if(GetSectorIdx(SectorSPos) == IdxSector)
-			{
-				TileSize	= (RwReal)dGET_WORLD_PARAM()->WorldSectorTileSize;
-				SPosX		= SectorSPos.x + dGET_WORLD_PARAM()->WorldSizeHalf;
-				SPosZ		= SectorSPos.z + dGET_WORLD_PARAM()->WorldSizeHalf;
-				CPosX		= _PosTile.x + dGET_WORLD_PARAM()->WorldSizeHalf;
-				CPosZ		= _PosTile.z + dGET_WORLD_PARAM()->WorldSizeHalf;
-				XCnt		= (RwInt32)(dGET_WORLD_PARAM()->WorldSectorTileNum - (RwInt32)((CPosX - SPosX) / TileSize));
-				ZCnt		= (RwInt32)((CPosZ - SPosZ) / (RwReal)TileSize);
-				CntVert		= XCnt + ZCnt * dGET_WORLD_PARAM()->WorldSectorVertNum;
+		TileSize	= (RwReal)dGET_WORLD_PARAM()->WorldSectorTileSize;
+		SPosX		= SectorSPos.x + dGET_WORLD_PARAM()->WorldSizeHalf;
+		SPosZ		= SectorSPos.z + dGET_WORLD_PARAM()->WorldSizeHalf;
+		CPosX		= _PosTile.x + dGET_WORLD_PARAM()->WorldSizeHalf;
+		CPosZ		= _PosTile.z + dGET_WORLD_PARAM()->WorldSizeHalf;
+		XCnt		= (RwInt32)(dGET_WORLD_PARAM()->WorldSectorTileNum - (RwInt32)((CPosX - SPosX) / TileSize));
+		ZCnt		= (RwInt32)((CPosZ - SPosZ) / (RwReal)TileSize);
+		CntVert		= XCnt + ZCnt * dGET_WORLD_PARAM()->WorldSectorVertNum;
 
-				GetNtlWorldSectorInfo()->SectorMaterialSkipToFile(pFile);
-				GetNtlWorldSectorInfo()->SectorHeightfieldSkipToFileGetVertex(pFile, CntVert, 1, &Result);
-				_PosTile.y = Result.y;
+		GetNtlWorldSectorInfo()->SectorMaterialSkipToFile(pFile);
+		GetNtlWorldSectorInfo()->SectorHeightfieldSkipToFileGetVertex(pFile, CntVert, 1, &Result);
+		_PosTile.y = Result.y;
 
-				::fclose(pFile);
-				::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-				return TRUE;
-			}
-			else
-			{				
-				GetNtlWorldSectorInfo()->OutdoorSectorSkipToFile(pFile);
-			}
-		}
+		::fclose(pFile);
+		return TRUE;
 	}
 
 	DBO_TRACE(FALSE, "CNtlWorldFieldManager::GetHeightFromFile, nothing matched.");
 
 	::fclose(pFile);
-	::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
 
 	return FALSE;
 }
 
 RwBool CNtlWorldFieldManager::GetVertFromFile(RwV3d& DatumPt, RwV3d& Result)
 {
-	RwInt32 l, m;
 	RwInt32 IdxSector	= GetSectorIdx(DatumPt);
 	RwInt32 IdxField	= GetFieldIdx(DatumPt);
 
@@ -2072,17 +2153,18 @@ RwBool CNtlWorldFieldManager::GetVertFromFile(RwV3d& DatumPt, RwV3d& Result)
 		return FALSE;
 	}
 
-	::_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-	::_chdir("fields");
+	RwChar chFieldPath[NTL_MAX_DIR_PATH];
+	GetWorldFieldFilePath(chFieldPath, NTL_MAX_DIR_PATH, IdxField, "wfif");
 
-	::sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", IdxField);
-	::_chdir(dGET_WORLD_PARAM()->WorldChar64Buf);
+	if(GetNtlResourcePackManager()->GetActiveFlags() & NTL_PACK_TYPE_FLAG_TERRAIN)
+	{
+		return GetVertFromPack(chFieldPath, IdxField, IdxSector, DatumPt, Result);
+	}
 
 	FILE* pFile;
-	if(::fopen_s(&pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb"))
+	if(::fopen_s(&pFile, chFieldPath, "rb"))
 	{
-		DBO_TRACE(FALSE, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
-		::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		DBO_TRACE(FALSE, "file open failed. (" << chFieldPath << ")");
 		return FALSE;
 	}
 
@@ -2095,43 +2177,27 @@ RwBool CNtlWorldFieldManager::GetVertFromFile(RwV3d& DatumPt, RwV3d& Result)
 	RwInt32 ZCnt;		
 	RwInt32	CntVert;
 
-	RwV3d	SPos = m_pFields[IdxField].GetSPos();
 	RwV3d	SectorSPos;
-	for(l = (int)SPos.z; l < (int)SPos.z + dGET_WORLD_PARAM()->WorldFieldSize; l += dGET_WORLD_PARAM()->WorldSectorSize)
-	{
-		for(m = (int)SPos.x; m < (int)SPos.x + dGET_WORLD_PARAM()->WorldFieldSize; m += dGET_WORLD_PARAM()->WorldSectorSize)
-		{
-			SectorSPos.x = (RwReal)m;
-			SectorSPos.z = (RwReal)l;
-
-			if(GetSectorIdx(SectorSPos) == IdxSector)
-			{
-				TileSize	= (RwReal)dGET_WORLD_PARAM()->WorldSectorTileSize;
-				SPosX		= SectorSPos.x + dGET_WORLD_PARAM()->WorldSizeHalf;
-				SPosZ		= SectorSPos.z + dGET_WORLD_PARAM()->WorldSizeHalf;
-				CPosX		= DatumPt.x + dGET_WORLD_PARAM()->WorldSizeHalf;
-				CPosZ		= DatumPt.z + dGET_WORLD_PARAM()->WorldSizeHalf;
-				XCnt		= (RwInt32)(dGET_WORLD_PARAM()->WorldSectorTileNum - (RwInt32)((CPosX - SPosX) / TileSize));
-				ZCnt		= (RwInt32)((CPosZ - SPosZ) / (RwReal)TileSize);
-				CntVert		= XCnt + ZCnt * dGET_WORLD_PARAM()->WorldSectorVertNum;
-
-				GetNtlWorldSectorInfo()->SectorMaterialSkipToFile(pFile);
-				GetNtlWorldSectorInfo()->SectorHeightfieldSkipToFileGetVertex(pFile, CntVert, 1, &Result);
-			
-				::fclose(pFile);
-				::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-				return TRUE;
-			}
-			else
-			{				
-				GetNtlWorldSectorInfo()->OutdoorSectorSkipToFile(pFile);
-			}
-		}
+	if(SkipToSectorInFieldFile(pFile, IdxField, IdxSector, SectorSPos))
+	{
+		TileSize	= (RwReal)dGET_WORLD_PARAM()->WorldSectorTileSize;
+		SPosX		= SectorSPos.x + dGET_WORLD_PARAM()->WorldSizeHalf;
+		SPosZ		= SectorSPos.z + dGET_WORLD_PARAM()->WorldSizeHalf;
+		CPosX		= DatumPt.x + dGET_WORLD_PARAM()->WorldSizeHalf;
+		CPosZ		= DatumPt.z + dGET_WORLD_PARAM()->WorldSizeHalf;
+		XCnt		= (RwInt32)(dGET_WORLD_PARAM()->WorldSectorTileNum - (RwInt32)((CPosX - SPosX) / TileSize));
+		ZCnt		= (RwInt32)((CPosZ - SPosZ) / (RwReal)TileSize);
+		CntVert		= XCnt + ZCnt * dGET_WORLD_PARAM()->WorldSectorVertNum;
+
+		GetNtlWorldSectorInfo()->SectorMaterialSkipToFile(pFile);
+		GetNtlWorldSectorInfo()->SectorHeightfieldSkipToFileGetVertex(pFile, CntVert, 1, &Result);
+	
+		::fclose(pFile);
+		return TRUE;
 	}
 
 	DBO_TRACE(FALSE, "CNtlWorldFieldManager::GetVertFromFile, file stream read failed.");
 	::fclose(pFile);
-	::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
 
 	return FALSE;
 }
@@ -2182,17 +2248,13 @@ RwBool CNtlWorldFieldManager::SetHeight(RwV3d& PosSectorDatum, RwV3d& PosTileDat
 		return FALSE;
 	}
 
-	::_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-	::_chdir("fields");
-
-	::sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", IdxField);
-	::_chdir(dGET_WORLD_PARAM()->WorldChar64Buf);
+	RwChar chFieldPath[NTL_MAX_DIR_PATH];
+	GetWorldFieldFilePath(chFieldPath, NTL_MAX_DIR_PATH, IdxField, "wfif");
 
 	FILE* pFile;
-	if(::fopen_s(&pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb+"))
+	if(::fopen_s(&pFile, chFieldPath, "rb+"))
 	{
-		DBO_TRACE(FALSE, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
-		::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		DBO_TRACE(FALSE, "file open failed. (" << chFieldPath << ")");
 		return FALSE;
 	}
 
@@ -2205,45 +2267,29 @@ RwBool CNtlWorldFieldManager::SetHeight(RwV3d& PosSectorDatum, RwV3d& PosTileDat
 	RwInt32 ZCnt;		
 	RwInt32	CntVert;
 
-	RwV3d	SPos = m_pFields[IdxField].GetSPos();
 	RwV3d	SectorSPos;
-	for(RwInt32 l = (int)SPos.z; l < (int)SPos.z + dGET_WORLD_PARAM()->WorldFieldSize; l += dGET_WORLD_PARAM()->WorldSectorSize)
+	if(SkipToSectorInFieldFile(pFile, IdxField, IdxSector, SectorSPos))
 	{
-		for(RwInt32 m = (int)SPos.x; m < (int)SPos.x + dGET_WORLD_PARAM()->WorldFieldSize; m += dGET_WORLD_PARAM()->WorldSectorSize)
-		{
-			SectorSPos.x = (RwReal)m;
-			SectorSPos.z = (RwReal)l;
-
-			if(GetSectorIdx(SectorSPos) == IdxSector)
-			{
-				TileSize	= (RwReal)dGET_WORLD_PARAM()->WorldSectorTileSize;
-				SPosX		= SectorSPos.x + dGET_WORLD_PARAM()->WorldSizeHalf;
-				SPosZ		= SectorSPos.z + dGET_WORLD_PARAM()->WorldSizeHalf;
-				CPosX		= PosTileDatum.x + dGET_WORLD_PARAM()->WorldSizeHalf;
-				CPosZ		= PosTileDatum.z + dGET_WORLD_PARAM()->WorldSizeHalf;
-				XCnt		= (RwInt32)(dGET_WORLD_PARAM()->WorldSectorTileNum - (RwInt32)((CPosX - SPosX) / TileSize));
-				ZCnt		= (RwInt32)((CPosZ - SPosZ) / (RwReal)TileSize);
-				CntVert		= XCnt + ZCnt * dGET_WORLD_PARAM()->WorldSectorVertNum;
+		TileSize	= (RwReal)dGET_WORLD_PARAM()->WorldSectorTileSize;
+		SPosX		= SectorSPos.x + dGET_WORLD_PARAM()->WorldSizeHalf;
+		SPosZ		= SectorSPos.z + dGET_WORLD_PARAM()->WorldSizeHalf;
+		CPosX		= PosTileDatum.x + dGET_WORLD_PARAM()->WorldSizeHalf;
+		CPosZ		= PosTileDatum.z + dGET_WORLD_PARAM()->WorldSizeHalf;
+		XCnt		= (RwInt32)(dGET_WORLD_PARAM()->WorldSectorTileNum - (RwInt32)((CPosX - SPosX) / TileSize));
+		ZCnt		= (RwInt32)((CPosZ - SPosZ) / (RwReal)TileSize);
+		CntVert		= XCnt + ZCnt * dGET_WORLD_PARAM()->WorldSectorVertNum;
 
-				GetNtlWorldSectorInfo()->SectorMaterialSkipToFile(pFile);
-				GetNtlWorldSectorInfo()->SectorHeightfieldSkipToFileGetVertex(pFile, CntVert, 1, &PosTileDatum);
+		GetNtlWorldSectorInfo()->SectorMaterialSkipToFile(pFile);
+		GetNtlWorldSectorInfo()->SectorHeightfieldSkipToFileGetVertex(pFile, CntVert, 1, &PosTileDatum);
 
-				::fclose(pFile);
-				::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		::fclose(pFile);
 
-				return TRUE;
-			}
-			else
-			{
-				GetNtlWorldSectorInfo()->OutdoorSectorSkipToFile(pFile);
-			}
-		}
+		return TRUE;
 	}
 
 	DBO_TRACE(FALSE, "CNtlWorldFieldManager::SetHeight, stream read failed.");
 
 	::fclose(pFile);
-	::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
 
 	return FALSE;
 }
@@ -2260,17 +2306,13 @@ RwBool CNtlWorldFieldManager::SetClrVertList(RwV3d& PosCurVert, RwRGBA* pClrVert
 		NTL_RETURN(FALSE);
 	}
 
-	::_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-	::_chdir("fields");
-
-	::sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", IdxField);
-	::_chdir(dGET_WORLD_PARAM()->WorldChar64Buf);
+	RwChar chFieldPath[NTL_MAX_DIR_PATH];
+	GetWorldFieldFilePath(chFieldPath, NTL_MAX_DIR_PATH, IdxField, "wfif");
 
 	FILE* pFile;
-	if(::fopen_s(&pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb+"))
+	if(::fopen_s(&pFile, chFieldPath, "rb+"))
 	{
-		DBO_TRACE(FALSE, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
-		::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		DBO_TRACE(FALSE, "file open failed. (" << chFieldPath << ")");
 		NTL_RETURN(FALSE);
 	}
 
@@ -2283,46 +2325,30 @@ RwBool CNtlWorldFieldManager::SetClrVertList(RwV3d& PosCurVert, RwRGBA* pClrVert
 	RwInt32 ZCnt;		
 	RwInt32	CntVert;
 
-	RwV3d	SPos = m_pFields[IdxField].GetSPos();
 	RwV3d	SectorSPos;
-	for(RwInt32 l = (int)SPos.z; l < (int)SPos.z + dGET_WORLD_PARAM()->WorldFieldSize; l += dGET_WORLD_PARAM()->WorldSectorSize)
+	if(SkipToSectorInFieldFile(pFile, IdxField, IdxSector, SectorSPos))
 	{
-		for(RwInt32 m = (int)SPos.x; m < (int)SPos.x + dGET_WORLD_PARAM()->WorldFieldSize; m += dGET_WORLD_PARAM()->WorldSectorSize)
-		{
-			SectorSPos.x = (RwReal)m;
-			SectorSPos.z = (RwReal)l;
-
-			if(GetSectorIdx(SectorSPos) == IdxSector)
-			{
-				TileSize	= (RwReal)dGET_WORLD_PARAM()->WorldSectorTileSize;
-				SPosX		= SectorSPos.x + dGET_WORLD_PARAM()->WorldSizeHalf;
-				SPosZ		= SectorSPos.z + dGET_WORLD_PARAM()->WorldSizeHalf;
-				CPosX		= PosCurVert.x + dGET_WORLD_PARAM()->WorldSizeHalf;
-				CPosZ		= PosCurVert.z + dGET_WORLD_PARAM()->WorldSizeHalf;
-				XCnt		= (RwInt32)(dGET_WORLD_PARAM()->WorldSectorTileNum - (RwInt32)((CPosX - SPosX) / TileSize));
-				ZCnt		= (RwInt32)((CPosZ - SPosZ) / (RwReal)TileSize);
-				CntVert		= XCnt + ZCnt * dGET_WORLD_PARAM()->WorldSectorVertNum;
+		TileSize	= (RwReal)dGET_WORLD_PARAM()->WorldSectorTileSize;
+		SPosX		= SectorSPos.x + dGET_WORLD_PARAM()->WorldSizeHalf;
+		SPosZ		= SectorSPos.z + dGET_WORLD_PARAM()->WorldSizeHalf;
+		CPosX		= PosCurVert.x + dGET_WORLD_PARAM()->WorldSizeHalf;
+		CPosZ		= PosCurVert.z + dGET_WORLD_PARAM()->WorldSizeHalf;
+		XCnt		= (RwInt32)(dGET_WORLD_PARAM()->WorldSectorTileNum - (RwInt32)((CPosX - SPosX) / TileSize));
+		ZCnt		= (RwInt32)((CPosZ - SPosZ) / (RwReal)TileSize);
+		CntVert		= XCnt + ZCnt * dGET_WORLD_PARAM()->WorldSectorVertNum;
 
-				GetNtlWorldSectorInfo()->SectorMaterialSkipToFile(pFile);
-				GetNtlWorldSectorInfo()->SectorHeightfieldSkipToFile(pFile);
+		GetNtlWorldSectorInfo()->SectorMaterialSkipToFile(pFile);
+		GetNtlWorldSectorInfo()->SectorHeightfieldSkipToFile(pFile);
 
-				::fwrite(pClrVertList, sizeof(RwRGBA) * dGET_WORLD_PARAM()->WorldSectorVertNum * dGET_WORLD_PARAM()->WorldSectorVertNum, 1, pFile);
-				::fclose(pFile);
-				::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		::fwrite(pClrVertList, sizeof(RwRGBA) * dGET_WORLD_PARAM()->WorldSectorVertNum * dGET_WORLD_PARAM()->WorldSectorVertNum, 1, pFile);
+		::fclose(pFile);
 
-				NTL_RETURN(TRUE);
-			}
-			else
-			{
-				GetNtlWorldSectorInfo()->OutdoorSectorSkipToFile(pFile);
-			}
-		}
+		NTL_RETURN(TRUE);
 	}
 
 	DBO_TRACE(FALSE, "CNtlWorldFieldManager::SetClrVertList, stream read failed.");
 
 	::fclose(pFile);
-	::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
 
 	NTL_RETURN(FALSE);		
 }
@@ -2339,17 +2365,13 @@ RwBool CNtlWorldFieldManager::GetClrVertList(RwV3d& PosCurVert, RwRGBA* pClrVert
 		NTL_RETURN(FALSE);
 	}
 
-	::_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-	::_chdir("fields");
-
-	::sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", IdxField);
-	::_chdir(dGET_WORLD_PARAM()->WorldChar64Buf);
+	RwChar chFieldPath[NTL_MAX_DIR_PATH];
+	GetWorldFieldFilePath(chFieldPath, NTL_MAX_DIR_PATH, IdxField, "wfif");
 
 	FILE* pFile;
-	if(::fopen_s(&pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb"))
+	if(::fopen_s(&pFile, chFieldPath, "rb"))
 	{
-		DBO_TRACE(FALSE, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
-		::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		DBO_TRACE(FALSE, "file open failed. (" << chFieldPath << ")");
 		NTL_RETURN(FALSE);
 	}
 
@@ -2362,46 +2384,30 @@ RwBool CNtlWorldFieldManager::GetClrVertList(RwV3d& PosCurVert, RwRGBA* pClrVert
 	RwInt32 ZCnt;		
 	RwInt32	CntVert;
 
-	RwV3d	SPos = m_pFields[IdxField].GetSPos();
 	RwV3d	SectorSPos;
-	for(RwInt32 l = (int)SPos.z; l < (int)SPos.z + dGET_WORLD_PARAM()->WorldFieldSize; l += dGET_WORLD_PARAM()->WorldSectorSize)
+	if(SkipToSectorInFieldFile(pFile, IdxField, IdxSector, SectorSPos))
 	{
-		for(RwInt32 m = (int)SPos.x; m < (int)SPos.x + dGET_WORLD_PARAM()->WorldFieldSize; m += dGET_WORLD_PARAM()->WorldSectorSize)
-		{
-			SectorSPos.x = (RwReal)m;
-			SectorSPos.z = (RwReal)l;
-
-			if(GetSectorIdx(SectorSPos) == IdxSector)
-			{
-				TileSize	= (RwReal)dGET_WORLD_PARAM()->WorldSectorTileSize;
-				SPosX		= SectorSPos.x + dGET_WORLD_PARAM()->WorldSizeHalf;
-				SPosZ		= SectorSPos.z + dGET_WORLD_PARAM()->WorldSizeHalf;
-				CPosX		= PosCurVert.x + dGET_WORLD_PARAM()->WorldSizeHalf;
-				CPosZ		= PosCurVert.z + dGET_WORLD_PARAM()->WorldSizeHalf;
-				XCnt		= (RwInt32)(dGET_WORLD_PARAM()->WorldSectorTileNum - (RwInt32)((CPosX - SPosX) / TileSize));
-				ZCnt		= (RwInt32)((CPosZ - SPosZ) / (RwReal)TileSize);
-				CntVert		= XCnt + ZCnt * dGET_WORLD_PARAM()->WorldSectorVertNum;
+		TileSize	= (RwReal)dGET_WORLD_PARAM()->WorldSectorTileSize;
+		SPosX		= SectorSPos.x + dGET_WORLD_PARAM()->WorldSizeHalf;
+		SPosZ		= SectorSPos.z + dGET_WORLD_PARAM()->WorldSizeHalf;
+		CPosX		= PosCurVert.x + dGET_WORLD_PARAM()->WorldSizeHalf;
+		CPosZ		= PosCurVert.z + dGET_WORLD_PARAM()->WorldSizeHalf;
+		XCnt		= (RwInt32)(dGET_WORLD_PARAM()->WorldSectorTileNum - (RwInt32)((CPosX - SPosX) / TileSize));
+		ZCnt		= (RwInt32)((CPosZ - SPosZ) / (RwReal)TileSize);
+		CntVert		= XCnt + ZCnt * dGET_WORLD_PARAM()->WorldSectorVertNum;
 
-				GetNtlWorldSectorInfo()->SectorMaterialSkipToFile(pFile);
+		GetNtlWorldSectorInfo()->SectorMaterialSkipToFile(pFile);
 
-				::fseek(pFile, sizeof(RwV3d) * dGET_WORLD_PARAM()->WorldSectorVertNum * dGET_WORLD_PARAM()->WorldSectorVertNum, SEEK_CUR);
-				::fread(pClrVertList, sizeof(RwRGBA) * dGET_WORLD_PARAM()->WorldSectorVertNum * dGET_WORLD_PARAM()->WorldSectorVertNum, 1, pFile);
-				::fclose(pFile);
-				::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		::fseek(pFile, sizeof(RwV3d) * dGET_WORLD_PARAM()->WorldSectorVertNum * dGET_WORLD_PARAM()->WorldSectorVertNum, SEEK_CUR);
+		::fread(pClrVertList, sizeof(RwRGBA) * dGET_WORLD_PARAM()->WorldSectorVertNum * dGET_WORLD_PARAM()->WorldSectorVertNum, 1, pFile);
+		::fclose(pFile);
 
-				NTL_RETURN(TRUE);
-			}
-			else
-			{
-				GetNtlWorldSectorInfo()->OutdoorSectorSkipToFile(pFile);
-			}
-		}
+		NTL_RETURN(TRUE);
 	}
 
 	DBO_TRACE(FALSE, "CNtlWorldFieldManager::GetClrVertList, stream read failed.");
 
 	::fclose(pFile);
-	::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
 
 	NTL_RETURN(FALSE);		
 }
@@ -2418,51 +2424,31 @@ RwBool CNtlWorldFieldManager::GetPosVertList(RwV3d& PosCurVert, RwV3d* pPosVertL
 		NTL_RETURN(FALSE);
 	}
 
-	::_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-	::_chdir("fields");
-
-	::sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", IdxField);
-	::_chdir(dGET_WORLD_PARAM()->WorldChar64Buf);
+	RwChar chFieldPath[NTL_MAX_DIR_PATH];
+	GetWorldFieldFilePath(chFieldPath, NTL_MAX_DIR_PATH, IdxField, "wfif");
 
 	FILE* pFile;
-	if(::fopen_s(&pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb"))
+	if(::fopen_s(&pFile, chFieldPath, "rb"))
 	{
-		DBO_TRACE(FALSE, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
-		::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		DBO_TRACE(FALSE, "file open failed. (" << chFieldPath << ")");
 		NTL_RETURN(FALSE);
 	}
 
-	RwV3d	SPos = m_pFields[IdxField].GetSPos();
 	RwV3d	SectorSPos;
-	for(RwInt32 l = (int)SPos.z; l < (int)SPos.z + dGET_WORLD_PARAM()->WorldFieldSize; l += dGET_WORLD_PARAM()->WorldSectorSize)
+	if(SkipToSectorInFieldFile(pFile, IdxField, IdxSector, SectorSPos))
 	{
-		for(RwInt32 m = (int)SPos.x; m < (int)SPos.x + dGET_WORLD_PARAM()->WorldFieldSize; m += dGET_WORLD_PARAM()->WorldSectorSize)
-		{
-			SectorSPos.x = (RwReal)m;
-			SectorSPos.z = (RwReal)l;
+		GetNtlWorldSectorInfo()->SectorMaterialSkipToFile(pFile);
+		GetNtlWorldSectorInfo()->SectorHeightfieldSkipToFileGetVertex(pFile, 0, dGET_WORLD_PARAM()->WorldSectorVertNum * dGET_WORLD_PARAM()->WorldSectorVertNum, pPosVertList);
 
-			if(GetSectorIdx(SectorSPos) == IdxSector)
-			{
-				GetNtlWorldSectorInfo()->SectorMaterialSkipToFile(pFile);
-				GetNtlWorldSectorInfo()->SectorHeightfieldSkipToFileGetVertex(pFile, 0, dGET_WORLD_PARAM()->WorldSectorVertNum * dGET_WORLD_PARAM()->WorldSectorVertNum, pPosVertList);
-
-				::fclose(pFile);
+		::fclose(pFile);
 
-				::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
 
-				NTL_RETURN(TRUE);
-			}
-			else
-			{
-				GetNtlWorldSectorInfo()->OutdoorSectorSkipToFile(pFile);
-			}
-		}
+		NTL_RETURN(TRUE);
 	}
 
 	DBO_TRACE(FALSE, "CNtlWorldFieldManager::GetPosVertList, stream read failed.");
 
 	::fclose(pFile);
-	::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
 
 	NTL_RETURN(FALSE);
 }
@@ -3667,99 +3653,32 @@ RwBool CNtlWorldFieldManager::GetAFieldProp(RwV3d& Pos, sNTL_FIELD_PROP& NtlFiel
 	{
 		if(!IsFieldLoaded(Idx))
 		{
-			FILE *pFile = NULL;
-			sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", Idx);
+			RwChar chFieldPath[NTL_MAX_DIR_PATH];
+			GetWorldFieldFilePath(chFieldPath, NTL_MAX_DIR_PATH, Idx, "wfpf");
+
+			CNtlPLPackElementData PropData;
 			if(GetNtlResourcePackManager()->GetActiveFlags() & NTL_PACK_TYPE_FLAG_TERRAIN)
 			{
-				static RwChar chPackPatch[NTL_MAX_DIR_PATH];
-				strcpy_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldProjectFolderName);
-				strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-				strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "fields");
-				strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-				strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-				strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-
-				sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfpf%d", Idx);
-
-				strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-
-				SPackResFileData sPackFileData;
-				RwBool bPack = GetNtlResourcePackManager()->LoadTerrain(chPackPatch, sPackFileData);
-				if(bPack)
-				{
-					_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-					::fopen_s(&pFile, sPackFileData.strPackFileName.c_str(), "rb");
-					if(pFile)
-					{
-						fseek(pFile, sPackFileData.uiOffset, SEEK_SET);
-					}
-				}
+				GetNtlResourcePackManager()->LoadTerrain(chFieldPath, PropData);
 			}
 			else
 			{
-				_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-				_chdir("fields");		
-				_chdir(dGET_WORLD_PARAM()->WorldChar64Buf);
-				sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfpf%d", Idx);
-				::fopen_s(&pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb");
-				_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+				PropData.LoadFile(chFieldPath);
 			}
 
-			if(!pFile)
+			RwInt32 iTileNumInField = (dGET_WORLD_PARAM()->WorldSectorTileNum * 2) * (dGET_WORLD_PARAM()->WorldSectorTileNum * 2);
+
+			BYTE *pFileMem = (BYTE*)PropData.GetData();
+			if(!pFileMem || GetNtlWorldFieldInfo()->FieldPropSkipToFileMem(pFileMem, iTileNumInField) > pFileMem + PropData.GetSize())
 			{
-				DBO_TRACE(FALSE, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
-				::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+				DBO_TRACE(FALSE, "file open failed. (" << chFieldPath << ")");
 				return FALSE;
 			}
 			else
 			{
-				fread(NtlFieldProp._Name, 64, 1, pFile);
-				fread(NtlFieldProp._pBitProp, sizeof(DWORD) * (dGET_WORLD_PARAM()->WorldSectorTileNum * 2) * (dGET_WORLD_PARAM()->WorldSectorTileNum * 2), 1, pFile);
-				fread(&NtlFieldProp._FogColor, sizeof(RwRGBA), 1, pFile);
-				fread(&NtlFieldProp._FogCamPlane[0], sizeof(RwReal), 1, pFile);
-				fread(&NtlFieldProp._FogCamPlane[1], sizeof(RwReal), 1, pFile);
-				fread(&NtlFieldProp._BaseSkyMode, sizeof(RwInt32), 1, pFile);
-				fread(&NtlFieldProp._RGBSkyColor[0], sizeof(RwRGBA), 1, pFile);
-				fread(&NtlFieldProp._RGBSkyColor[1], sizeof(RwRGBA), 1, pFile);
-				fread(&NtlFieldProp._RGBSkyColor[2], sizeof(RwRGBA), 1, pFile);
-				fread(NtlFieldProp._BaseSkyTexName, sizeof(RwChar) * 10, 1, pFile);
-				fread(&NtlFieldProp._BaseSkySpeed, sizeof(RwReal), 1, pFile);
-				fread(NtlFieldProp._BlendedTexName[0], sizeof(RwChar) * 10, 1, pFile);
-				fread(NtlFieldProp._BlendedTexName[1], sizeof(RwChar) * 10, 1, pFile);
-				fread(&NtlFieldProp._BlendedTexSpeed[0], sizeof(RwReal), 1, pFile);
-				fread(&NtlFieldProp._BlendedTexSpeed[1], sizeof(RwReal), 1, pFile);
-				fread(&NtlFieldProp._ClrLightAmbient, sizeof(RwRGBAReal), 1, pFile);
-
-				for(RwInt32 i = 0; i < dNTLPL_PLANET_MAX_CNT; ++i)
-				{
-					fread(&NtlFieldProp._ClrLightDirectional[i], sizeof(RwRGBAReal), 1, pFile);
-					fread(&NtlFieldProp._AngLightDirectional[i], sizeof(RwV3d), 1, pFile);
-					//break;
-				}				
-
-				fread(&NtlFieldProp._IdxBGMTbl, sizeof(RwInt32), 1, pFile);
-				fread(&NtlFieldProp._IdxEnvTbl, sizeof(RwInt32), 1, pFile);
-				for(RwInt32 i = 0; i < 5; ++i)
-				{
-					fread(&NtlFieldProp._IdxShareTbl[i], sizeof(RwInt32), 1, pFile);
-				}
-
-				fread(&NtlFieldProp._MonoPower, sizeof(RwReal), 1, pFile);
-
-				for(RwInt32 i = 0; i < dNTLPL_PLANET_MAX_CNT; ++i)
-					fread(&NtlFieldProp._NtlPlanet[i], sizeof(sNTL_PLANET), 1, pFile);
-
-				fread(&NtlFieldProp._NtlSpecular, sizeof(sNTL_SPECULAR), 1, pFile);
-				fread(NtlFieldProp._pMaterialProp, sizeof(BYTE) * (dGET_WORLD_PARAM()->WorldSectorTileNum * 2) * (dGET_WORLD_PARAM()->WorldSectorTileNum * 2), 1, pFile);
-				fread(&NtlFieldProp._FieldColor, sizeof(RwRGBA), 1, pFile);
-				fread(&NtlFieldProp._IdxWeather, sizeof(RwInt32) * 5, 1, pFile);
-				fread(&NtlFieldProp._NtlHeatHaze, sizeof(sNTL_HEATHAZE), 1, pFile);
-
-				fclose(pFile);
+				GetNtlWorldFieldInfo()->FieldPropLoadFromFileMem(pFileMem, &NtlFieldProp, iTileNumInField);
 			}
 
-			_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-
 			return TRUE;
 		}
 		else
@@ -4488,12 +4407,16 @@ RwBool CNtlWorldFieldManager::DeleteFieldIntoFile(RwInt32 FieldIdx)
 	// 	}
 
 	FILE *pFile;
-	::fopen_s(&pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "wb");
+	::fopen_s(&pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "wb+");
 
 	DBO_ASSERT(pFile, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
 
 	if(pFile)
 	{
+		// the chunk offsets of each sector are taken as it's written, for the directory behind the sectors
+		std::vector<RwInt32>	vecOffset(dGET_WORLD_PARAM()->WorldFieldSectorNum * dGET_WORLD_PARAM()->WorldFieldSectorNum * eNFC_NUM);
+		RwInt32					IdxSectorInField = 0;
+
 		for(l = (int)SPos.z; l < (int)SPos.z + dGET_WORLD_PARAM()->WorldFieldSize; l += dGET_WORLD_PARAM()->WorldSectorSize)
 		{
 			for(m = (int)SPos.x; m < (int)SPos.x + dGET_WORLD_PARAM()->WorldFieldSize; m += dGET_WORLD_PARAM()->WorldSectorSize)
@@ -4501,10 +4424,13 @@ RwBool CNtlWorldFieldManager::DeleteFieldIntoFile(RwInt32 FieldIdx)
 				SectorSPos.x = (RwReal)m;
 				SectorSPos.z = (RwReal)l;
 				SectorIdx = GetSectorIdx(SectorSPos);
-				CNtlWorldSectorManager::DeleteIntoFile(SectorIdx, pFile);
+				CNtlWorldSectorManager::DeleteIntoFile(SectorIdx, pFile, &vecOffset[IdxSectorInField * eNFC_NUM]);
+				++IdxSectorInField;
 			}
 		}
 
+		CNtlWorldFieldDirectory::SaveIntoFile(pFile, FieldIdx, vecOffset);
+
 		::fclose(pFile);
 	}
 
@@ -4649,46 +4575,22 @@ RwBool CNtlWorldFieldManager::CreateFieldFromFile(RwInt32 FieldIdx)
 	// 2007.03.23 ()
 	// Pack file  ߰
 
-	FILE *pFile = NULL;
+	RwChar chFieldPath[NTL_MAX_DIR_PATH];
+	GetWorldFieldFilePath(chFieldPath, NTL_MAX_DIR_PATH, FieldIdx, "wfif");
+
+	// the sector loaders read through a FILE*, a packed field borrows an open stream of the pack data unit.
+	CNtlPLPackStream FieldStream;
 	if(GetNtlResourcePackManager()->GetActiveFlags() & NTL_PACK_TYPE_FLAG_TERRAIN)
 	{
-		static RwChar chPackPatch[NTL_MAX_DIR_PATH];
-
-		sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", FieldIdx);
-
-		strcpy_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldProjectFolderName);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "fields");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-
-		SPackResFileData sPackFileData;
-		RwBool bPack = GetNtlResourcePackManager()->LoadTerrain(chPackPatch, sPackFileData);
-		if(bPack)
-		{
-			_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-			::fopen_s(&pFile, sPackFileData.strPackFileName.c_str(), "rb");
-			if(pFile)
-			{
-				fseek(pFile, sPackFileData.uiOffset, SEEK_SET);
-			}
-		}
+		GetNtlResourcePackManager()->LoadTerrain(chFieldPath, FieldStream);
 	}
 	else
 	{
-		sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", FieldIdx);
-
-		_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-		_chdir("fields");
-		_chdir(dGET_WORLD_PARAM()->WorldChar64Buf);
-
-		::fopen_s(&pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb");
-		_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		FieldStream.OpenFile(chFieldPath);
 	}
 
-	DBO_ASSERT(pFile, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
+	FILE *pFile = FieldStream.GetFile();
+	DBO_ASSERT(pFile, "file open failed. (" << chFieldPath << ")");
 
 	if(pFile != NULL)
 	{
@@ -4703,8 +4605,6 @@ RwBool CNtlWorldFieldManager::CreateFieldFromFile(RwInt32 FieldIdx)
 				CNtlWorldSectorManager::CreateFromFile(m_pFields[FieldIdx].GetTexAttr(), SectorIdx, pFile);
 			}
 		}
-
-		fclose(pFile);
 	}
 
 	NTL_RETURN(TRUE);
@@ -6663,6 +6563,9 @@ void CNtlWorldFieldManager::Init(RpWorld *pNtlWorld, RwV3d& SpawnPos)
 
 	CreateRpWorld();
 
+	// the world folders are set by now, the field files are opened through absolute paths from here on
+	UpdateWorldFilePathRoot();
+
 	InitSingleInstance();
 
 	// ε
@@ -209,6 +209,11 @@ public:
 	RwBool					GetVertInMemory(RwV3d& DatumPt, RwV3d& Result);
 	RwBool					GetVertFromFile(RwV3d& DatumPt, RwV3d& Result);
 	RwBool					GetHeightFromFile(RwV3d& _PosSectorDatum, RwV3d& _PosTile);
+	// moves pFile from the head of the field file to the sector, SectorSPos gets the start pos of the sector
+	RwBool					SkipToSectorInFieldFile(FILE* pFile, RwInt32 IdxField, RwInt32 IdxSector, RwV3d& SectorSPos);
+	BYTE*					SkipToSectorInFieldFileMem(BYTE* pFileMem, RwInt32 FileSize, RwInt32 IdxField, RwInt32 IdxSector, RwV3d& SectorSPos);
+	// GetVertFromFile of a packed field file, read out of the mapped pack data
+	RwBool					GetVertFromPack(const RwChar* pFieldPath, RwInt32 IdxField, RwInt32 IdxSector, RwV3d& DatumPt, RwV3d& Result);
 	RwInt32					GetFieldIdx(RwV3d& Pos);
 	sCUR_FIELD_TEX_INFO*	GetTexAttr();
 	sCUR_FIELD_TEX_INFO*	GetTexAttr(RwInt32 IdxField);
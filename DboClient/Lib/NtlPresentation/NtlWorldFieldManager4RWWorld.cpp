@@ -256,46 +256,22 @@ RwBool CNtlWorldFieldManager4RWWorld::CreateFieldFromFile(RwInt32 FieldIdx)
 	RwV3d SPos = m_pFields[FieldIdx].GetSPos();
 	RwV3d SectorSPos;
 
-	FILE *pFile = NULL;
+	RwChar chFieldPath[NTL_MAX_DIR_PATH];
+	GetWorldFieldFilePath(chFieldPath, NTL_MAX_DIR_PATH, FieldIdx, "wfif");
+
+	CNtlPLPackStream FieldStream;
 	if(GetNtlResourcePackManager()->GetActiveFlags() & NTL_PACK_TYPE_FLAG_TERRAIN)
 	{
-		static RwChar chPackPatch[NTL_MAX_DIR_PATH];
-		
-		sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", FieldIdx);
-
-		strcpy_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldProjectFolderName);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "fields");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-
-		SPackResFileData sPackFileData;
-		RwBool bPack = GetNtlResourcePackManager()->LoadTerrain(chPackPatch, sPackFileData);
-		if(bPack)
-		{
-			_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-			::fopen_s(&pFile, sPackFileData.strPackFileName.c_str(), "rb");
-			if(pFile)
-			{
-				fseek(pFile, sPackFileData.uiOffset, SEEK_SET);
-			}
-		}
+		GetNtlResourcePackManager()->LoadTerrain(chFieldPath, FieldStream);
 	}
 	else
 	{
-		sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", FieldIdx);
-
-		_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-		_chdir("fields");
-		_chdir(dGET_WORLD_PARAM()->WorldChar64Buf);
-
-		::fopen_s(&pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb");
-		_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		FieldStream.OpenFile(chFieldPath);
 	}
 
-	DBO_ASSERT(pFile, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
+	FILE *pFile = FieldStream.GetFile();
+
+	DBO_ASSERT(pFile, "file open failed. (" << chFieldPath << ")");
 
 	if(pFile)
 	{
@@ -310,8 +286,6 @@ RwBool CNtlWorldFieldManager4RWWorld::CreateFieldFromFile(RwInt32 FieldIdx)
 				CNtlWorldSectorManager::CreateFromFile(m_pFields[FieldIdx].GetTexAttr(), SectorIdx, pFile);
 			}
 		}
-
-		fclose(pFile);
 	}
 
 	return TRUE;
@@ -471,23 +445,18 @@ void CNtlWorldFieldManager4RWWorld::CreateRpWorld()
 	string strR = str1 + str2 + str3;
 	sprintf_s(acTempTexPath, MAX_PATH, "texture\\ntlwe\\indoor\\;%s", strR.c_str());	
 
-	void*		pFile	= NULL;
+	RwMemory				memory;
+	CNtlPLPackElementData	ElementData;
 	RwStream*	pStream	= NULL;
 	RpWorld*	pWorld	= NULL;
 
 	if(GetNtlResourcePackManager()->GetActiveFlags() & NTL_PACK_TYPE_FLAG_TERRAIN)
 	{
-		SPackResFileData sPackFileData;
-		RwBool bPack = GetNtlResourcePackManager()->LoadTerrain(acTempPath, sPackFileData);
-		if(bPack)
+		if(GetNtlResourcePackManager()->LoadTerrain(acTempPath, ElementData))
 		{
-			_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-			pFile = RwFopen(sPackFileData.strPackFileName.c_str(), "rb");
-			if(pFile)
-			{
-				RwFseek(pFile, sPackFileData.uiOffset, RTFILE_POS_BEGIN);
-				pStream = RwStreamOpen(rwSTREAMFILE, rwSTREAMREAD, pFile);
-			}
+			memory.start	= (RwUInt8*)ElementData.GetData();
+			memory.length	= ElementData.GetSize();
+			pStream = RwStreamOpen(rwSTREAMMEMORY, rwSTREAMREAD, &memory);
 		}
 	}
 	else
@@ -530,11 +499,6 @@ void CNtlWorldFieldManager4RWWorld::CreateRpWorld()
 			RwStreamClose(pStream, NULL);
 		}
 	}
-
-	if (pFile)
-	{
-		RwFclose(pFile);
-	}
 }
 
 void CNtlWorldFieldManager4RWWorld::DestroyRpWorld()
@@ -52,27 +52,14 @@ RwBool CNtlWorldPathEngineManager::LoadSwapFile(RwInt32 iSectorIdx, RwReal* pPED
 	if (!m_bPathEngineMode)
 		return FALSE;
 
-	_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-	if(_chdir("swap") == -1)
-	{
-		// create folders
-		_mkdir("swap");
-		_chdir("swap");
-	}
-
-	if(_chdir("pe") == -1)
-	{
-		// create folders
-		_mkdir("pe");
-		_chdir("pe");
-	}
+	RwChar chPath[NTL_MAX_DIR_PATH];
+	GetWorldFilePath(chPath, NTL_MAX_DIR_PATH, "swap\\pe\\header.pe");
 
 	FILE* pFile;
 
-	if(::fopen_s(&pFile, "header.pe", "rb"))
+	if(::fopen_s(&pFile, chPath, "rb"))
 	{
-		DBO_TRACE(FALSE, "file open failed. (" << "header.pe" << ")");
-		::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		DBO_TRACE(FALSE, "file open failed. (" << chPath << ")");
 		return FALSE;
 	}
 	
@@ -83,16 +70,16 @@ RwBool CNtlWorldPathEngineManager::LoadSwapFile(RwInt32 iSectorIdx, RwReal* pPED
 	if (iCunkSize != CNtlWorldPathEngineManager::GetInstance()->GetChunkSize())
 	{
 		DBO_TRACE(FALSE, "CNtlWorldPathEngineManager::LoadSwapFile, chunk size error.");
-		::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
 		return FALSE;
 	}	
 
-	::sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "%d_sec.pe", iSectorIdx);
+	RwChar chSectorFile[64];
+	::sprintf_s(chSectorFile, 64, "swap\\pe\\%d_sec.pe", iSectorIdx);
+	GetWorldFilePath(chPath, NTL_MAX_DIR_PATH, chSectorFile);
 
-	if(::fopen_s(&pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb"))
+	if(::fopen_s(&pFile, chPath, "rb"))
 	{
-		DBO_TRACE(FALSE, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
-		::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		DBO_TRACE(FALSE, "file open failed. (" << chPath << ")");
 		return FALSE;
 	}
 
@@ -102,7 +89,6 @@ RwBool CNtlWorldPathEngineManager::LoadSwapFile(RwInt32 iSectorIdx, RwReal* pPED
 	::fread(pPEData, sizeof(RwReal) * iDataSize, 1, pFile);
 
 	::fclose(pFile);
-	::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
 
 	return TRUE;
 }
@@ -112,30 +98,23 @@ RwBool CNtlWorldPathEngineManager::SaveSwapFile(RwInt32 iSectorIdx, RwReal* pPED
 	if (!m_bPathEngineMode)
 		return FALSE;
 
-	_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-	if(_chdir("swap") == -1)
-	{
-		// create folders
-		_mkdir("swap");
-		_chdir("swap");
-	}
+	// create folders
+	RwChar chPath[NTL_MAX_DIR_PATH];
+	GetWorldFilePath(chPath, NTL_MAX_DIR_PATH, "swap");
+	_mkdir(chPath);
+	GetWorldFilePath(chPath, NTL_MAX_DIR_PATH, "swap\\pe");
+	_mkdir(chPath);
 
-	if(_chdir("pe") == -1)
-	{
-		// create folders
-		_mkdir("pe");
-		_chdir("pe");
-	}
+	GetWorldFilePath(chPath, NTL_MAX_DIR_PATH, "swap\\pe\\header.pe");
 
 	FILE* pFile;
 
 	RwInt32 iCunkSize;
-	if(::fopen_s(&pFile, "header.pe", "rb"))
+	if(::fopen_s(&pFile, chPath, "rb"))
 	{
-		if(::fopen_s(&pFile, "header.pe", "wb"))
+		if(::fopen_s(&pFile, chPath, "wb"))
 		{
-			DBO_TRACE(FALSE, "file open failed. (" << "header.pe" << ")");
-			::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+			DBO_TRACE(FALSE, "file open failed. (" << chPath << ")");
 			return FALSE;
 		}
 
@@ -151,17 +130,17 @@ RwBool CNtlWorldPathEngineManager::SaveSwapFile(RwInt32 iSectorIdx, RwReal* pPED
 		if (iCunkSize != CNtlWorldPathEngineManager::GetInstance()->GetChunkSize())
 		{
 			DBO_TRACE(FALSE, "CNtlWorldPathEngineManager::SaveSwapFile, chunk size error.");
-			::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
 			return FALSE;
 		}
 	}
 
-	::sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "%d_sec.pe", iSectorIdx);
+	RwChar chSectorFile[64];
+	::sprintf_s(chSectorFile, 64, "swap\\pe\\%d_sec.pe", iSectorIdx);
+	GetWorldFilePath(chPath, NTL_MAX_DIR_PATH, chSectorFile);
 
-	if(::fopen_s(&pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "wb"))
+	if(::fopen_s(&pFile, chPath, "wb"))
 	{
-		DBO_TRACE(FALSE, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
-		::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		DBO_TRACE(FALSE, "file open failed. (" << chPath << ")");
 		return FALSE;
 	}
 
@@ -171,7 +150,6 @@ RwBool CNtlWorldPathEngineManager::SaveSwapFile(RwInt32 iSectorIdx, RwReal* pPED
 	::fwrite(pPEData, sizeof(RwReal) * iDataSize, 1, pFile);
 	
 	::fclose(pFile);
-	::_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
 
 	return TRUE;
 }
@@ -377,11 +377,8 @@ CNtlWSEFieldCreate::CNtlWSEFieldCreate(RwInt32 iPrimaryKey, RwReal fUsedTime, Rw
 
 CNtlWSEFieldCreate::~CNtlWSEFieldCreate()
 {
-	if (m_pFile)
-	{
-		fclose(m_pFile);
-		m_pFile = NULL;
-	}
+	m_FieldStream.Close();
+	m_pFile = NULL;
 }
 
 RwBool CNtlWSEFieldCreate::Begin()
@@ -397,44 +394,21 @@ RwBool CNtlWSEFieldCreate::Begin()
 	CNtlWorldField*			pFields		= const_cast<CNtlWorldField*>(pWFManager->GetFields());
 
 	RwV3d vSPos = pFields[m_iFieldIdx].GetSPos();
+	RwChar chFieldPath[NTL_MAX_DIR_PATH];
+	GetWorldFieldFilePath(chFieldPath, NTL_MAX_DIR_PATH, m_iFieldIdx, "wfif");
+
 	if(GetNtlResourcePackManager()->GetActiveFlags() & NTL_PACK_TYPE_FLAG_TERRAIN)
 	{
-		sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", m_iFieldIdx);
-
-		static RwChar chPackPatch[NTL_MAX_DIR_PATH];
-		strcpy_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldProjectFolderName);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "fields");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-
-		SPackResFileData sPackFileData;
-		RwBool bPack = GetNtlResourcePackManager()->LoadTerrain(chPackPatch, sPackFileData);
-		if(bPack)
-		{
-			_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-			::fopen_s(&m_pFile, sPackFileData.strPackFileName.c_str(), "rb");
-			if(m_pFile)
-			{
-				fseek(m_pFile, sPackFileData.uiOffset, SEEK_SET);
-			}
-		}
+		GetNtlResourcePackManager()->LoadTerrain(chFieldPath, m_FieldStream);
 	}
 	else
 	{
-		sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", m_iFieldIdx);
-
-		_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-		_chdir("fields");
-		_chdir(dGET_WORLD_PARAM()->WorldChar64Buf);
-
-		::fopen_s(&m_pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb");
-		_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		m_FieldStream.OpenFile(chFieldPath);
 	}
 
-	DBO_ASSERT(m_pFile, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
+	m_pFile = m_FieldStream.GetFile();
+
+	DBO_ASSERT(m_pFile, "file open failed. (" << chFieldPath << ")");
 
 	if (m_pFile)
 	{
@@ -605,11 +579,8 @@ RwBool CNtlWSEFieldCreate::End()
 {
 	CNtlWorldFieldManager* pWFManager = GetSceneManager()->GetWorld()->GetWorldFieldMgr();
 
-	if (m_pFile)
-	{
-		fclose(m_pFile);
-		m_pFile = NULL;
-	}
+	m_FieldStream.Close();
+	m_pFile = NULL;
 
 	return TRUE;
 }
@@ -802,11 +773,8 @@ CNtlWSEFieldCreateIndoor::CNtlWSEFieldCreateIndoor(RwInt32 iPrimaryKey, RwReal f
 
 CNtlWSEFieldCreateIndoor::~CNtlWSEFieldCreateIndoor()
 {
-	if (m_pFile)
-	{
-		fclose(m_pFile);
-		m_pFile = NULL;
-	}
+	m_FieldStream.Close();
+	m_pFile = NULL;
 }
 
 RwBool CNtlWSEFieldCreateIndoor::Begin()
@@ -822,44 +790,21 @@ RwBool CNtlWSEFieldCreateIndoor::Begin()
 	CNtlWorldField*			pFields		= const_cast<CNtlWorldField*>(pWFManager->GetFields());
 
 	RwV3d vSPos = pFields[m_iFieldIdx].GetSPos();
+	RwChar chFieldPath[NTL_MAX_DIR_PATH];
+	GetWorldFieldFilePath(chFieldPath, NTL_MAX_DIR_PATH, m_iFieldIdx, "wfif");
+
 	if(GetNtlResourcePackManager()->GetActiveFlags() & NTL_PACK_TYPE_FLAG_TERRAIN)
 	{
-		sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", m_iFieldIdx);
-
-		static RwChar chPackPatch[NTL_MAX_DIR_PATH];
-		strcpy_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldProjectFolderName);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "fields");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-
-		SPackResFileData sPackFileData;
-		RwBool bPack = GetNtlResourcePackManager()->LoadTerrain(chPackPatch, sPackFileData);
-		if(bPack)
-		{
-			_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-			::fopen_s(&m_pFile, sPackFileData.strPackFileName.c_str(), "rb");
-			if(m_pFile)
-			{
-				fseek(m_pFile, sPackFileData.uiOffset, SEEK_SET);
-			}
-		}
+		GetNtlResourcePackManager()->LoadTerrain(chFieldPath, m_FieldStream);
 	}
 	else
 	{
-		sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", m_iFieldIdx);
-
-		_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-		_chdir("fields");
-		_chdir(dGET_WORLD_PARAM()->WorldChar64Buf);
-
-		::fopen_s(&m_pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb");
-		_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		m_FieldStream.OpenFile(chFieldPath);
 	}
 
-	DBO_ASSERT(m_pFile, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
+	m_pFile = m_FieldStream.GetFile();
+
+	DBO_ASSERT(m_pFile, "file open failed. (" << chFieldPath << ")");
 
 	if (m_pFile)
 	{
@@ -1035,11 +980,8 @@ RwBool CNtlWSEFieldCreateIndoor::End()
 {
 	CNtlWorldFieldManager* pWFManager = GetSceneManager()->GetWorld()->GetWorldFieldMgr();
 
-	if (m_pFile)
-	{
-		fclose(m_pFile);
-		m_pFile = NULL;
-	}
+	m_FieldStream.Close();
+	m_pFile = NULL;
 
 	return TRUE;
 }
@@ -2180,11 +2122,8 @@ CNtlWSEFieldCreate::CNtlWSEFieldCreate(RwInt32 iPrimaryKey, RwReal fUsedTime, Rw
 
 CNtlWSEFieldCreate::~CNtlWSEFieldCreate()
 {
-	if (m_pFile)
-	{
-		fclose(m_pFile);
-		m_pFile = NULL;
-	}
+	m_FieldStream.Close();
+	m_pFile = NULL;
 }
 
 RwBool CNtlWSEFieldCreate::Begin()
@@ -2198,44 +2137,21 @@ RwBool CNtlWSEFieldCreate::Begin()
 	CNtlWorldField*			pFields		= const_cast<CNtlWorldField*>(pWFManager->GetFields());
 
 	RwV3d vSPos = pFields[m_iFieldIdx].GetSPos();
+	RwChar chFieldPath[NTL_MAX_DIR_PATH];
+	GetWorldFieldFilePath(chFieldPath, NTL_MAX_DIR_PATH, m_iFieldIdx, "wfif");
+
 	if(GetNtlResourcePackManager()->GetActiveFlags() & NTL_PACK_TYPE_FLAG_TERRAIN)
 	{
-		sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", m_iFieldIdx);
-
-		static RwChar chPackPatch[NTL_MAX_DIR_PATH];
-		strcpy_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldProjectFolderName);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "fields");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-
-		SPackResFileData sPackFileData;
-		RwBool bPack = GetNtlResourcePackManager()->LoadTerrain(chPackPatch, sPackFileData);
-		if(bPack)
-		{
-			_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-			::fopen_s(&m_pFile, sPackFileData.strPackFileName.c_str(), "rb");
-			if(m_pFile)
-			{
-				fseek(m_pFile, sPackFileData.uiOffset, SEEK_SET);
-			}
-		}
+		GetNtlResourcePackManager()->LoadTerrain(chFieldPath, m_FieldStream);
 	}
 	else
 	{
-		sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", m_iFieldIdx);
-
-		_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-		_chdir("fields");
-		_chdir(dGET_WORLD_PARAM()->WorldChar64Buf);
-
-		::fopen_s(&m_pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb");
-		_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		m_FieldStream.OpenFile(chFieldPath);
 	}
 
-	DBO_ASSERT(m_pFile, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
+	m_pFile = m_FieldStream.GetFile();
+
+	DBO_ASSERT(m_pFile, "file open failed. (" << chFieldPath << ")");
 
 	if (m_pFile)
 	{
@@ -2414,11 +2330,8 @@ RwBool CNtlWSEFieldCreate::End()
 {
 	CNtlWorldFieldManager* pWFManager = GetSceneManager()->GetWorld()->GetWorldFieldMgr();
 
-	if (m_pFile)
-	{
-		fclose(m_pFile);
-		m_pFile = NULL;
-	}
+	m_FieldStream.Close();
+	m_pFile = NULL;
 
 	return TRUE;
 }
@@ -2434,11 +2347,8 @@ CNtlWSEFieldCreateIndoor::CNtlWSEFieldCreateIndoor(RwInt32 iPrimaryKey, RwReal f
 
 CNtlWSEFieldCreateIndoor::~CNtlWSEFieldCreateIndoor()
 {
-	if (m_pFile)
-	{
-		fclose(m_pFile);
-		m_pFile = NULL;
-	}
+	m_FieldStream.Close();
+	m_pFile = NULL;
 }
 
 RwBool CNtlWSEFieldCreateIndoor::Begin()
@@ -2452,44 +2362,21 @@ RwBool CNtlWSEFieldCreateIndoor::Begin()
 	CNtlWorldField*			pFields		= const_cast<CNtlWorldField*>(pWFManager->GetFields());
 
 	RwV3d vSPos = pFields[m_iFieldIdx].GetSPos();
+	RwChar chFieldPath[NTL_MAX_DIR_PATH];
+	GetWorldFieldFilePath(chFieldPath, NTL_MAX_DIR_PATH, m_iFieldIdx, "wfif");
+
 	if(GetNtlResourcePackManager()->GetActiveFlags() & NTL_PACK_TYPE_FLAG_TERRAIN)
 	{
-		sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", m_iFieldIdx);
-
-		static RwChar chPackPatch[NTL_MAX_DIR_PATH];
-		strcpy_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldProjectFolderName);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "fields");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, "\\");
-		strcat_s(chPackPatch, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldChar64Buf);
-
-		SPackResFileData sPackFileData;
-		RwBool bPack = GetNtlResourcePackManager()->LoadTerrain(chPackPatch, sPackFileData);
-		if(bPack)
-		{
-			_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
-			::fopen_s(&m_pFile, sPackFileData.strPackFileName.c_str(), "rb");
-			if(m_pFile)
-			{
-				fseek(m_pFile, sPackFileData.uiOffset, SEEK_SET);
-			}
-		}
+		GetNtlResourcePackManager()->LoadTerrain(chFieldPath, m_FieldStream);
 	}
 	else
 	{
-		sprintf_s(dGET_WORLD_PARAM()->WorldChar64Buf, 64, "wfif%d", m_iFieldIdx);
-
-		_chdir(dGET_WORLD_PARAM()->WorldProjectFolderName);
-		_chdir("fields");
-		_chdir(dGET_WORLD_PARAM()->WorldChar64Buf);
-
-		::fopen_s(&m_pFile, dGET_WORLD_PARAM()->WorldChar64Buf, "rb");
-		_chdir(dGET_WORLD_PARAM()->CurWorkingFolderName);
+		m_FieldStream.OpenFile(chFieldPath);
 	}
 
-	DBO_ASSERT(m_pFile, "file open failed. (" << dGET_WORLD_PARAM()->WorldChar64Buf << ")");
+	m_pFile = m_FieldStream.GetFile();
+
+	DBO_ASSERT(m_pFile, "file open failed. (" << chFieldPath << ")");
 
 	if (m_pFile)
 	{
@@ -2680,11 +2567,8 @@ RwBool CNtlWSEFieldCreateIndoor::End()
 {
 	CNtlWorldFieldManager* pWFManager = GetSceneManager()->GetWorld()->GetWorldFieldMgr();
 
-	if (m_pFile)
-	{
-		fclose(m_pFile);
-		m_pFile = NULL;
-	}
+	m_FieldStream.Close();
+	m_pFile = NULL;
 
 	return TRUE;
 }
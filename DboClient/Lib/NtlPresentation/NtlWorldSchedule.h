@@ -3,6 +3,7 @@
 #include "NtlSchedule.h"
 #include "NtlWorldCommon.h"
 #include "NtlPLEvent.h"
+#include "NtlPLResourcePack.h"
 
 /*
 WorldFileFormat - Schedule
@@ -153,6 +154,7 @@ class CNtlWSEFieldCreate : public CScheduleElement
 {
 protected:
 	RwInt32					m_iFieldIdx;
+	CNtlPLPackStream		m_FieldStream;	// a packed field borrows an open stream of the pack data unit.
 	FILE*					m_pFile;	
 
 	CScheduler				m_Scheduler;
@@ -193,6 +195,7 @@ class CNtlWSEFieldCreateIndoor : public CScheduleElement
 {
 protected:
 	RwInt32					m_iFieldIdx;
+	CNtlPLPackStream		m_FieldStream;	// a packed field borrows an open stream of the pack data unit.
 	FILE*					m_pFile;	
 
 	CScheduler				m_Scheduler;
@@ -245,11 +245,11 @@ RwBool CNtlWorldSectorManager::CreateFromFile(sCUR_FIELD_TEX_INFO& FieldTexInfo,
 	NTL_RETURN(TRUE);
 }
 
-RwBool CNtlWorldSectorManager::DeleteIntoFile(RwInt32 SectorIdx, FILE* pFile)
+RwBool CNtlWorldSectorManager::DeleteIntoFile(RwInt32 SectorIdx, FILE* pFile, RwInt32* pChunkOffset/* = NULL*/)
 {
 	NTL_FUNCTION("CNtlWorldSectorManager::DeleteIntoFile");
 
-	RpNtlWorldSectorGeometryDeleteIntoFile(&m_pSectors[SectorIdx], pFile);
+	RpNtlWorldSectorGeometryDeleteIntoFile(&m_pSectors[SectorIdx], pFile, pChunkOffset);
 
 	NTL_RETURN(TRUE);
 }
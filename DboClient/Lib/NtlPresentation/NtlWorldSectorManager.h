@@ -35,7 +35,7 @@ protected:
 	RwBool CreateInMemory(RwInt32 SectorIdx);
 	RwBool DeleteInMemory(RwInt32 SectorIdx, RwBool SaveSwapInToolMode = TRUE);
 	RwBool CreateFromFile(sCUR_FIELD_TEX_INFO& FieldTexInfo, RwInt32 SectorIdx, FILE* pFile);
-	RwBool DeleteIntoFile(RwInt32 SectorIdx, FILE* pFile);
+	RwBool DeleteIntoFile(RwInt32 SectorIdx, FILE* pFile, RwInt32* pChunkOffset = NULL);
 
 	RwBool UpdateTexLyr(sCUR_FIELD_TEX_INFO& CurFieldTexInfo, RwInt32 SectorIdx, RwInt32 IdxLyr, RwInt32 IdxMenu);
 	RwBool UpdateTexMat(sCUR_FIELD_TEX_INFO& CurFieldTexInfo, RwInt32 SectorIdx, RwInt32 IdxLyr);
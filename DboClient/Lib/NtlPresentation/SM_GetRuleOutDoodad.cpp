@@ -15,6 +15,7 @@
 #include "NtlPLObjectType.h"
 
 #include "SM_GetRuleOutDoodad.h"
+#include "NtlWorldFieldDirectory.h"
 
 //////////////////////////////////////////////////////////////////////////
 // dNTL_WORLD_FILE : DEFINE
@@ -483,10 +484,7 @@ RwBool CSM_GetRuleOutDoodad::Analyze(DWORD _SectorIdx)
 	pPosCurFileMem = CurFieldFileMem.GetDat();
 	//pPosCurFileMem = CNtlWorldFileMemAccessor::GetSPosOfMaterial(CurFieldFileMem.GetDat());
 
-	for(RwInt32 i = 0; i < SelSectorIdxCntInField; ++i)
-	{
-		pPosCurFileMem = GetNtlWorldSectorInfo()->OutdoorSectorSkipToFileMem(pPosCurFileMem);
-	}
+	pPosCurFileMem = CNtlWorldFieldDirectory::SkipToSectorMem(pPosCurFileMem, CurFieldFileMem.GetSize(), CurFieldIdx, SelSectorIdxCntInField);
 
 	m_RetContainer.Clear();
 	if(CheckSector(pPosCurFileMem))
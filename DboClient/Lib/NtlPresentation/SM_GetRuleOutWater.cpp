@@ -12,6 +12,7 @@
 #include "NtlPLWorldEntity.h"
 
 #include "SM_GetRuleOutWater.h"
+#include "NtlWorldFieldDirectory.h"
 
 //////////////////////////////////////////////////////////////////////////
 // dNTL_WORLD_FILE : DEFINE
@@ -181,10 +182,7 @@ RwBool CSM_GetRuleOutWater::Analyze(DWORD _SectorIdx)
 	pPosCurFileMem = CurFieldFileMem.GetDat();
 	//pPosCurFileMem = CNtlWorldFileMemAccessor::GetSPosOfMaterial(CurFieldFileMem.GetDat());
 
-	for(RwInt32 i = 0; i < SelSectorIdxCntInField; ++i)
-	{
-		pPosCurFileMem = GetNtlWorldSectorInfo()->OutdoorSectorSkipToFileMem(pPosCurFileMem);
-	}
+	pPosCurFileMem = CNtlWorldFieldDirectory::SkipToSectorMem(pPosCurFileMem, CurFieldFileMem.GetSize(), CurFieldIdx, SelSectorIdxCntInField);
 
 	if(CheckSector(pPosCurFileMem))
 	{
@@ -10,6 +10,7 @@
 #include "NtlPLWorldEntity.h"
 #include "NtlMath.h"
 #include "FileMem.h"
+#include "NtlWorldFieldDirectory.h"
 
 //////////////////////////////////////////////////////////////////////////
 // dNTL_WORLD_FILE : DEFINE
@@ -236,10 +237,7 @@ RwBool CSM_SplatTexMinBlend::Analyze(DWORD _SectorIdx)
 	pPosCurFileMem = CurFieldFileMem.GetDat();
 	//pPosCurFileMem = CNtlWorldFileMemAccessor::GetSPosOfMaterial(CurFieldFileMem.GetDat());
 
-	for(RwInt32 i = 0; i < SelSectorIdxCntInField; ++i)
-	{
-		pPosCurFileMem = GetNtlWorldSectorInfo()->OutdoorSectorSkipToFileMem(pPosCurFileMem);
-	}
+	pPosCurFileMem = CNtlWorldFieldDirectory::SkipToSectorMem(pPosCurFileMem, CurFieldFileMem.GetSize(), CurFieldIdx, SelSectorIdxCntInField);
 
 	if(CheckSector(pPosCurFileMem))
 	{
@@ -187,4 +187,25 @@ VOID LoadFileWorldState(sNtlWorldParam* pNtlWorldParam, FILE* pFile)
 	strcpy_s(pNtlWorldParam->WorldSaveVer, 10, pNtlWorldParam->WorldVer);
 	strcpy_s(pNtlWorldParam->WorldLoadVer, 10, pNtlWorldParam->WorldVer);
 	
-}
\ No newline at end of file
+}
+
+// absolute copy of WorldProjectFolderName
+static RwChar s_WorldFilePathProject[NTL_MAX_DIR_PATH] = { 0, };
+
+VOID UpdateWorldFilePathRoot()
+{
+	if(!_fullpath(s_WorldFilePathProject, dGET_WORLD_PARAM()->WorldProjectFolderName, NTL_MAX_DIR_PATH))
+	{
+		strcpy_s(s_WorldFilePathProject, NTL_MAX_DIR_PATH, dGET_WORLD_PARAM()->WorldProjectFolderName);
+	}
+}
+
+RwBool GetWorldFilePath(RwChar* pPath, RwInt32 Size, const RwChar* pRelPath)
+{
+	return (_snprintf_s(pPath, Size, _TRUNCATE, "%s\\%s", s_WorldFilePathProject, pRelPath) >= 0);
+}
+
+RwBool GetWorldFieldFilePath(RwChar* pPath, RwInt32 Size, RwInt32 FieldIdx, const RwChar* pFilePrefix)
+{
+	return (_snprintf_s(pPath, Size, _TRUNCATE, "%s\\fields\\wfif%d\\%s%d", s_WorldFilePathProject, FieldIdx, pFilePrefix, FieldIdx) >= 0);
+}
@@ -46,6 +46,15 @@ VOID SaveCurWorldState();
 VOID SaveFileWorldState(sNtlWorldParam* pNtlWorldParam, FILE* pFile);
 VOID LoadFileWorldState(sNtlWorldParam* pNtlWorldParam, FILE* pFile);
 
+// world file paths
+// : built into the caller's buffer from an absolute copy of WorldProjectFolderName. they neither
+//   _chdir() nor use WorldChar64Buf, so world files can be opened off the main thread with them.
+// : UpdateWorldFilePathRoot() takes the copy. call it on the main thread, with the working folder restored, whenever the
+//   folder name changes.
+VOID UpdateWorldFilePathRoot();
+RwBool GetWorldFilePath(RwChar* pPath, RwInt32 Size, const RwChar* pRelPath);									// <project>\pRelPath
+RwBool GetWorldFieldFilePath(RwChar* pPath, RwInt32 Size, RwInt32 FieldIdx, const RwChar* pFilePrefix);		// <project>\fields\wfif<idx>\<pFilePrefix><idx>
+
 /******************************************************************************************************************************
 * enumerations : direction
 ******************************************************************************************************************************/
@@ -73,6 +82,29 @@ enum eNTL_BLOCK_PROPID
 	eNBP_GAMEPROP = 0,
 };
 
+// chunks of an outdoor sector in the field file(wfif), in the order they're written
+enum eNTL_FIELD_CHUNKID
+{
+	eNFC_MESH = 0,
+	eNFC_OBJECT,
+	eNFC_WATER,
+	eNFC_SHADOW,
+	eNFC_EFFECT,
+	eNFC_SOUNDEFFECT,
+	eNFC_CULL,
+	eNFC_TILETRANSPARENCY,
+	eNFC_SHORELINE,
+	eNFC_DECAL,
+	eNFC_PLANT,
+	eNFC_WORLDLIGHT,
+	eNFC_OCCLUDER,
+	eNFC_HEATHAZEOBJECT,
+	eNFC_LIGHTOBJECT,
+	eNFC_DOJO,
+
+	eNFC_NUM,
+};
+
 // Ŭ̾Ʈ ϰ ϽǶ ݵ ּóϽð  ϼ - 
 //#define dNTL_WORLD_TOOL_MODE "DEV"
 #define TW_VER
@@ -60,6 +60,14 @@ RwInt32 CNtlWorldFieldInfo::FieldNameSkipToFile(FILE* pFile)
 	return ftell(pFile);
 }
 
+BYTE* CNtlWorldFieldInfo::FieldNameLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp)
+{
+	memcpy(pNtlFieldProp->_Name, pFileMem, sizeof(RwChar) * 64);
+	pFileMem += sizeof(RwChar) * 64;
+
+	return pFileMem;
+}
+
 BYTE* CNtlWorldFieldInfo::FieldNameSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem)
 {
 	fwrite(pFileMem, sizeof(RwChar) * 64, 1, pFile);
@@ -99,6 +107,14 @@ RwInt32 CNtlWorldFieldInfo::FieldBitPropSkipToFile(FILE* pFile, RwInt32 iTileNum
 	return ftell(pFile);
 }
 
+BYTE* CNtlWorldFieldInfo::FieldBitPropLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp, RwInt32 iTileNumInField)
+{
+	memcpy(pNtlFieldProp->_pBitProp, pFileMem, sizeof(DWORD) * iTileNumInField);
+	pFileMem += sizeof(DWORD) * iTileNumInField;
+
+	return pFileMem;
+}
+
 BYTE* CNtlWorldFieldInfo::FieldBitPropSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem, RwInt32 iTileNumInField)
 {
 	fwrite(pFileMem,  sizeof(DWORD) * iTileNumInField, 1, pFile);
@@ -142,6 +158,18 @@ RwInt32 CNtlWorldFieldInfo::FieldFogSkipToFile(FILE* pFile)
 	return ftell(pFile);
 }
 
+BYTE* CNtlWorldFieldInfo::FieldFogLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp)
+{
+	memcpy(&pNtlFieldProp->_FogColor, pFileMem, sizeof(RwRGBA));
+	pFileMem += sizeof(RwRGBA);
+	memcpy(&pNtlFieldProp->_FogCamPlane[0], pFileMem, sizeof(RwReal));
+	pFileMem += sizeof(RwReal);
+	memcpy(&pNtlFieldProp->_FogCamPlane[1], pFileMem, sizeof(RwReal));
+	pFileMem += sizeof(RwReal);
+
+	return pFileMem;
+}
+
 BYTE* CNtlWorldFieldInfo::FieldFogSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem)
 {
 	RwInt32 SizMemBlock =	sizeof(RwRGBA) +		// fog color
@@ -227,6 +255,38 @@ RwInt32 CNtlWorldFieldInfo::FieldSkySkipToFile(FILE* pFile)
 	return ftell(pFile);
 }
 
+BYTE* CNtlWorldFieldInfo::FieldSkyLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp)
+{
+	memcpy(&pNtlFieldProp->_BaseSkyMode, pFileMem, sizeof(RwInt32));
+	pFileMem += sizeof(RwInt32);
+#ifdef TW_VER
+	// For TW here is 1x DWORD ~Nady
+	memcpy(&pNtlFieldProp->dwUnknown, pFileMem, sizeof(RwInt32));
+	pFileMem += sizeof(RwInt32);
+#endif
+
+	memcpy(&pNtlFieldProp->_RGBSkyColor[0], pFileMem, sizeof(RwRGBA));
+	pFileMem += sizeof(RwRGBA);
+	memcpy(&pNtlFieldProp->_RGBSkyColor[1], pFileMem, sizeof(RwRGBA));
+	pFileMem += sizeof(RwRGBA);
+	memcpy(&pNtlFieldProp->_RGBSkyColor[2], pFileMem, sizeof(RwRGBA));
+	pFileMem += sizeof(RwRGBA);
+	memcpy(pNtlFieldProp->_BaseSkyTexName, pFileMem, sizeof(RwChar) * 10);
+	pFileMem += sizeof(RwChar) * 10;
+	memcpy(&pNtlFieldProp->_BaseSkySpeed, pFileMem, sizeof(RwReal));
+	pFileMem += sizeof(RwReal);
+	memcpy(pNtlFieldProp->_BlendedTexName[0], pFileMem, sizeof(RwChar) * 10);
+	pFileMem += sizeof(RwChar) * 10;
+	memcpy(pNtlFieldProp->_BlendedTexName[1], pFileMem, sizeof(RwChar) * 10);
+	pFileMem += sizeof(RwChar) * 10;
+	memcpy(&pNtlFieldProp->_BlendedTexSpeed[0], pFileMem, sizeof(RwReal));
+	pFileMem += sizeof(RwReal);
+	memcpy(&pNtlFieldProp->_BlendedTexSpeed[1], pFileMem, sizeof(RwReal));
+	pFileMem += sizeof(RwReal);
+
+	return pFileMem;
+}
+
 BYTE* CNtlWorldFieldInfo::FieldSkySaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem)
 {
 	RwInt32 SizMemBlock =	sizeof(RwInt32)	+			// base sky mode
@@ -301,6 +361,22 @@ RwInt32 CNtlWorldFieldInfo::FieldRealLightSkipToFile(FILE* pFile)
 	return ftell(pFile);
 }
 
+BYTE* CNtlWorldFieldInfo::FieldRealLightLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp)
+{
+	memcpy(&pNtlFieldProp->_ClrLightAmbient, pFileMem, sizeof(RwRGBAReal));
+	pFileMem += sizeof(RwRGBAReal);
+
+	for (RwInt32 i = 0; i < dNTL_PL_DIRECTIONAL_LIGHT_NUM; ++i)
+	{
+		memcpy(&pNtlFieldProp->_ClrLightDirectional[i], pFileMem, sizeof(RwRGBAReal));
+		pFileMem += sizeof(RwRGBAReal);
+		memcpy(&pNtlFieldProp->_AngLightDirectional[i], pFileMem, sizeof(RwV3d));
+		pFileMem += sizeof(RwV3d);
+	}
+
+	return pFileMem;
+}
+
 BYTE* CNtlWorldFieldInfo::FieldRealLightSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem)
 {
 	RwInt32 SizMemBlock =	sizeof(RwRGBAReal) +	// light ambient
@@ -369,6 +445,21 @@ RwInt32 CNtlWorldFieldInfo::FieldBGMSkipToFile(FILE* pFile)
 	return ftell(pFile);
 }
 
+BYTE* CNtlWorldFieldInfo::FieldBGMLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp)
+{
+	memcpy(&pNtlFieldProp->_IdxBGMTbl, pFileMem, sizeof(RwInt32));
+	pFileMem += sizeof(RwInt32);
+	memcpy(&pNtlFieldProp->_IdxEnvTbl, pFileMem, sizeof(RwInt32));
+	pFileMem += sizeof(RwInt32);
+	for (RwInt32 i = 0; i < 5; ++i)
+	{
+		memcpy(&pNtlFieldProp->_IdxShareTbl[i], pFileMem, sizeof(RwInt32));
+		pFileMem += sizeof(RwInt32);
+	}
+
+	return pFileMem;
+}
+
 BYTE* CNtlWorldFieldInfo::FieldBGMSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem)
 {
 	// Bgm
@@ -428,6 +519,14 @@ RwInt32 CNtlWorldFieldInfo::FieldBloomSkipToFile(FILE* pFile)
 	return ftell(pFile);
 }
 
+BYTE* CNtlWorldFieldInfo::FieldBloomLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp)
+{
+	memcpy(&pNtlFieldProp->_MonoPower, pFileMem, sizeof(RwReal));
+	pFileMem += sizeof(RwReal);
+
+	return pFileMem;
+}
+
 BYTE* CNtlWorldFieldInfo::FieldBloomSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem)
 {
 	fwrite(pFileMem, sizeof(RwReal), 1, pFile);
@@ -474,6 +573,17 @@ RwInt32 CNtlWorldFieldInfo::FieldPlanetSkipToFile(FILE* pFile)
 	return ftell(pFile);
 }
 
+BYTE* CNtlWorldFieldInfo::FieldPlanetLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp)
+{
+	for (RwInt32 i = 0; i < dNTLPL_PLANET_MAX_CNT; ++i)
+	{
+		memcpy(&pNtlFieldProp->_NtlPlanet[i], pFileMem, sizeof(sNTL_PLANET));
+		pFileMem += sizeof(sNTL_PLANET);
+	}
+
+	return pFileMem;
+}
+
 BYTE* CNtlWorldFieldInfo::FieldPlanetSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem)
 {
 	fwrite(pFileMem, sizeof(sNTL_PLANET) * dNTLPL_PLANET_MAX_CNT, 1, pFile);
@@ -511,6 +621,14 @@ RwInt32 CNtlWorldFieldInfo::FieldSpecularSkipToFile(FILE* pFile)
 	return ftell(pFile);
 }
 
+BYTE* CNtlWorldFieldInfo::FieldSpecularLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp)
+{
+	memcpy(&pNtlFieldProp->_NtlSpecular, pFileMem, sizeof(sNTL_SPECULAR));
+	pFileMem += sizeof(sNTL_SPECULAR);
+
+	return pFileMem;
+}
+
 BYTE* CNtlWorldFieldInfo::FieldSpecularSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem)
 {
 	fwrite(pFileMem, sizeof(sNTL_SPECULAR), 1, pFile);
@@ -549,6 +667,14 @@ RwInt32 CNtlWorldFieldInfo::FieldWorldMaterialSkipToFile(FILE* pFile, RwInt32 iT
 	return ftell(pFile);
 }
 
+BYTE* CNtlWorldFieldInfo::FieldWorldMaterialLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp, RwInt32 iTileNumInField)
+{
+	memcpy(pNtlFieldProp->_pMaterialProp, pFileMem, sizeof(BYTE) * iTileNumInField);
+	pFileMem += sizeof(BYTE) * iTileNumInField;
+
+	return pFileMem;
+}
+
 BYTE* CNtlWorldFieldInfo::FieldWorldMaterialSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem, RwInt32 iTileNumInField)
 {
 	fwrite(pFileMem, sizeof(BYTE) * iTileNumInField, 1, pFile);
@@ -586,6 +712,14 @@ RwInt32 CNtlWorldFieldInfo::FieldColorSkipToFile(FILE* pFile)
 	return ftell(pFile);
 }
 
+BYTE* CNtlWorldFieldInfo::FieldColorLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp)
+{
+	memcpy(&pNtlFieldProp->_FieldColor, pFileMem, sizeof(RwRGBA));
+	pFileMem += sizeof(RwRGBA);
+
+	return pFileMem;
+}
+
 BYTE* CNtlWorldFieldInfo::FieldColorSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem)
 {
 	fwrite(pFileMem, sizeof(RwRGBA), 1, pFile);
@@ -624,6 +758,14 @@ RwInt32 CNtlWorldFieldInfo::FieldWeatherSkipToFile(FILE* pFile)
 	return ftell(pFile);
 }
 
+BYTE* CNtlWorldFieldInfo::FieldWeatherLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp)
+{
+	memcpy(pNtlFieldProp->_IdxWeather, pFileMem, sizeof(RwInt32) * 5);
+	pFileMem += sizeof(RwInt32) * 5;
+
+	return pFileMem;
+}
+
 BYTE* CNtlWorldFieldInfo::FieldWeatherSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem)
 {
 	fwrite(pFileMem, sizeof(RwInt32) * 5, 1, pFile);
@@ -661,6 +803,14 @@ RwInt32 CNtlWorldFieldInfo::FieldHeatHazeSkipToFile(FILE* pFile)
 	return ftell(pFile);
 }
 
+BYTE* CNtlWorldFieldInfo::FieldHeatHazeLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp)
+{
+	memcpy(&pNtlFieldProp->_NtlHeatHaze, pFileMem, sizeof(sNTL_HEATHAZE));
+	pFileMem += sizeof(sNTL_HEATHAZE);
+
+	return pFileMem;
+}
+
 BYTE* CNtlWorldFieldInfo::FieldHeatHazeSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem)
 {
 	fwrite(pFileMem, sizeof(sNTL_HEATHAZE), 1, pFile);
@@ -676,6 +826,45 @@ BYTE* CNtlWorldFieldInfo::FieldHeatHazeSkipToFileMem(BYTE* pFileMem)
 	return pFileMem;
 }
 
+// FieldProp
+BYTE* CNtlWorldFieldInfo::FieldPropLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp, RwInt32 iTileNumInField)
+{
+	pFileMem = FieldNameLoadFromFileMem(pFileMem, pNtlFieldProp);
+	pFileMem = FieldBitPropLoadFromFileMem(pFileMem, pNtlFieldProp, iTileNumInField);
+	pFileMem = FieldFogLoadFromFileMem(pFileMem, pNtlFieldProp);
+	pFileMem = FieldSkyLoadFromFileMem(pFileMem, pNtlFieldProp);
+	pFileMem = FieldRealLightLoadFromFileMem(pFileMem, pNtlFieldProp);
+	pFileMem = FieldBGMLoadFromFileMem(pFileMem, pNtlFieldProp);
+	pFileMem = FieldBloomLoadFromFileMem(pFileMem, pNtlFieldProp);
+	pFileMem = FieldPlanetLoadFromFileMem(pFileMem, pNtlFieldProp);
+	pFileMem = FieldSpecularLoadFromFileMem(pFileMem, pNtlFieldProp);
+	pFileMem = FieldWorldMaterialLoadFromFileMem(pFileMem, pNtlFieldProp, iTileNumInField);
+	pFileMem = FieldColorLoadFromFileMem(pFileMem, pNtlFieldProp);
+	pFileMem = FieldWeatherLoadFromFileMem(pFileMem, pNtlFieldProp);
+	pFileMem = FieldHeatHazeLoadFromFileMem(pFileMem, pNtlFieldProp);
+
+	return pFileMem;
+}
+
+BYTE* CNtlWorldFieldInfo::FieldPropSkipToFileMem(BYTE* pFileMem, RwInt32 iTileNumInField)
+{
+	pFileMem = FieldNameSkipToFileMem(pFileMem);
+	pFileMem = FieldBitPropSkipToFileMem(pFileMem, iTileNumInField);
+	pFileMem = FieldFogSkipToFileMem(pFileMem);
+	pFileMem = FieldSkySkipToFileMem(pFileMem);
+	pFileMem = FieldRealLightSkipToFileMem(pFileMem);
+	pFileMem = FieldBGMSkipToFileMem(pFileMem);
+	pFileMem = FieldBloomSkipToFileMem(pFileMem);
+	pFileMem = FieldPlanetSkipToFileMem(pFileMem);
+	pFileMem = FieldSpecularSkipToFileMem(pFileMem);
+	pFileMem = FieldWorldMaterialSkipToFileMem(pFileMem, iTileNumInField);
+	pFileMem = FieldColorSkipToFileMem(pFileMem);
+	pFileMem = FieldWeatherSkipToFileMem(pFileMem);
+	pFileMem = FieldHeatHazeSkipToFileMem(pFileMem);
+
+	return pFileMem;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // dNTL_WORLD_FILE : DEFINE
 //////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,7 @@ public:
 	RwBool	FieldNameSaveIntoFile(FILE* pFile, sNTL_FIELD_PROP* pNtlFieldProp);
 	RwInt32	FieldNameSkipToFile(FILE* pFile);
 
+	BYTE*	FieldNameLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp);
 	BYTE*	FieldNameSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem);
 	BYTE*	FieldNameSkipToFileMem(BYTE* pFileMem);
 
@@ -40,6 +41,7 @@ public:
 	RwBool	FieldBitPropSaveIntoFile(FILE* pFile, sNTL_FIELD_PROP* pNtlFieldProp, RwInt32 iTileNumInField);
 	RwInt32	FieldBitPropSkipToFile(FILE* pFile, RwInt32 iTileNumInField);
 
+	BYTE*	FieldBitPropLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp, RwInt32 iTileNumInField);
 	BYTE*	FieldBitPropSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem, RwInt32 iTileNumInField);
 	BYTE*	FieldBitPropSkipToFileMem(BYTE* pFileMem, RwInt32 iTileNumInField);
 
@@ -48,6 +50,7 @@ public:
 	RwBool	FieldFogSaveIntoFile(FILE* pFile, sNTL_FIELD_PROP* pNtlFieldProp);
 	RwInt32	FieldFogSkipToFile(FILE* pFile);
 
+	BYTE*	FieldFogLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp);
 	BYTE*	FieldFogSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem);
 	BYTE*	FieldFogSkipToFileMem(BYTE* pFileMem);
 
@@ -56,6 +59,7 @@ public:
 	RwBool	FieldSkySaveIntoFile(FILE* pFile, sNTL_FIELD_PROP* pNtlFieldProp);
 	RwInt32	FieldSkySkipToFile(FILE* pFile);
 
+	BYTE*	FieldSkyLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp);
 	BYTE*	FieldSkySaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem);
 	BYTE*	FieldSkySkipToFileMem(BYTE* pFileMem);
 
@@ -65,6 +69,7 @@ public:
 	RwBool	FieldRealLightSaveIntoFile(FILE* pFile, sNTL_FIELD_PROP* pNtlFieldProp);
 	RwInt32	FieldRealLightSkipToFile(FILE* pFile);
 
+	BYTE*	FieldRealLightLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp);
 	BYTE*	FieldRealLightSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem);
 	BYTE*	FieldRealLightSkipToFileMem(BYTE* pFileMem);
 
@@ -73,6 +78,7 @@ public:
 	RwBool	FieldBGMSaveIntoFile(FILE* pFile, sNTL_FIELD_PROP* pNtlFieldProp);
 	RwInt32	FieldBGMSkipToFile(FILE* pFile);
 
+	BYTE*	FieldBGMLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp);
 	BYTE*	FieldBGMSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem);
 	BYTE*	FieldBGMSkipToFileMem(BYTE* pFileMem);
 
@@ -81,6 +87,7 @@ public:
 	RwBool	FieldBloomSaveIntoFile(FILE* pFile, sNTL_FIELD_PROP* pNtlFieldProp);
 	RwInt32	FieldBloomSkipToFile(FILE* pFile);
 
+	BYTE*	FieldBloomLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp);
 	BYTE*	FieldBloomSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem);
 	BYTE*	FieldBloomSkipToFileMem(BYTE* pFileMem);
 
@@ -89,6 +96,7 @@ public:
 	RwBool	FieldPlanetSaveIntoFile(FILE* pFile, sNTL_FIELD_PROP* pNtlFieldProp);
 	RwInt32	FieldPlanetSkipToFile(FILE* pFile);
 
+	BYTE*	FieldPlanetLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp);
 	BYTE*	FieldPlanetSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem);
 	BYTE*	FieldPlanetSkipToFileMem(BYTE* pFileMem);
 
@@ -97,6 +105,7 @@ public:
 	RwBool	FieldSpecularSaveIntoFile(FILE* pFile, sNTL_FIELD_PROP* pNtlFieldProp);
 	RwInt32	FieldSpecularSkipToFile(FILE* pFile);
 
+	BYTE*	FieldSpecularLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp);
 	BYTE*	FieldSpecularSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem);
 	BYTE*	FieldSpecularSkipToFileMem(BYTE* pFileMem);
 
@@ -105,6 +114,7 @@ public:
 	RwBool	FieldWorldMaterialSaveIntoFile(FILE* pFile, sNTL_FIELD_PROP* pNtlFieldProp, RwInt32 iTileNumInField);
 	RwInt32	FieldWorldMaterialSkipToFile(FILE* pFile, RwInt32 iTileNumInField);
 
+	BYTE*	FieldWorldMaterialLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp, RwInt32 iTileNumInField);
 	BYTE*	FieldWorldMaterialSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem, RwInt32 iTileNumInField);
 	BYTE*	FieldWorldMaterialSkipToFileMem(BYTE* pFileMem, RwInt32 iTileNumInField);
 
@@ -113,6 +123,7 @@ public:
 	RwBool	FieldColorSaveIntoFile(FILE* pFile, sNTL_FIELD_PROP* pNtlFieldProp);
 	RwInt32	FieldColorSkipToFile(FILE* pFile);
 
+	BYTE*	FieldColorLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp);
 	BYTE*	FieldColorSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem);
 	BYTE*	FieldColorSkipToFileMem(BYTE* pFileMem);
 
@@ -121,6 +132,7 @@ public:
 	RwBool	FieldWeatherSaveIntoFile(FILE* pFile, sNTL_FIELD_PROP* pNtlFieldProp);
 	RwInt32	FieldWeatherSkipToFile(FILE* pFile);
 
+	BYTE*	FieldWeatherLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp);
 	BYTE*	FieldWeatherSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem);
 	BYTE*	FieldWeatherSkipToFileMem(BYTE* pFileMem);
 
@@ -129,8 +141,13 @@ public:
 	RwBool	FieldHeatHazeSaveIntoFile(FILE* pFile, sNTL_FIELD_PROP* pNtlFieldProp);
 	RwInt32	FieldHeatHazeSkipToFile(FILE* pFile);
 
+	BYTE*	FieldHeatHazeLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp);
 	BYTE*	FieldHeatHazeSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem);
 	BYTE*	FieldHeatHazeSkipToFileMem(BYTE* pFileMem);
+
+	// every block of a field property file in order. check the skipped size against the data before loading.
+	BYTE*	FieldPropLoadFromFileMem(BYTE* pFileMem, sNTL_FIELD_PROP* pNtlFieldProp, RwInt32 iTileNumInField);
+	BYTE*	FieldPropSkipToFileMem(BYTE* pFileMem, RwInt32 iTileNumInField);
 };
 
 static CNtlWorldFieldInfo* GetNtlWorldFieldInfo()
@@ -727,7 +727,7 @@ RwBool RpNtlWorldSectorGeometryCreateFromFile(sCUR_FIELD_TEX_INFO& CurFieldTexIn
 // 	NTL_RETURN(TRUE);
 // }
 
-RwBool RpNtlWorldSectorGeometryDeleteIntoFile(CNtlWorldSector *pNtlWorldSector, FILE* pFile)
+RwBool RpNtlWorldSectorGeometryDeleteIntoFile(CNtlWorldSector *pNtlWorldSector, FILE* pFile, RwInt32* pChunkOffset/* = NULL*/)
 {
 	NTL_FUNCTION("RpNtlWorldSectorGeometryDeleteIntoFile");
 
@@ -736,7 +736,7 @@ RwBool RpNtlWorldSectorGeometryDeleteIntoFile(CNtlWorldSector *pNtlWorldSector,
 	{
 	case AW_HEGITHFIELD:
 		{
-			GetNtlWorldSectorInfo()->NtlWorldSectorGeometrySaveIntoFile(pNtlWorldSector, pFile);
+			GetNtlWorldSectorInfo()->NtlWorldSectorGeometrySaveIntoFile(pNtlWorldSector, pFile, pChunkOffset);
 		}
 		break;
 	case AW_RWWORLD:
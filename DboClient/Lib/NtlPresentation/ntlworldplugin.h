@@ -41,7 +41,7 @@ extern RwBool RpNtlWorldSectorGeometryDeleteWithoutSwapFileSaving(CNtlWorldSecto
 
 extern RwBool RpNtlWorldSectorGeometryDelete(CNtlWorldSector *pNtlWorldSector);
 extern RwBool RpNtlWorldSectorGeometryCreateFromFile(sCUR_FIELD_TEX_INFO& FieldTexInfo, CNtlWorldSector *pNtlWorldSector, FILE* pFile);
-extern RwBool RpNtlWorldSectorGeometryDeleteIntoFile(CNtlWorldSector *pNtlWorldSector, FILE* pFile);
+extern RwBool RpNtlWorldSectorGeometryDeleteIntoFile(CNtlWorldSector *pNtlWorldSector, FILE* pFile, RwInt32* pChunkOffset = NULL);
 extern RwBool RpNtlWorldSectorUpdateTexLyr(sCUR_FIELD_TEX_INFO& CurFieldTexInfo, CNtlWorldSector *pNtlWorldSector, RwInt32 IdxLyr, RwInt32 IdxMenu);
 extern RwBool RpNtlWorldSectorUpdateTexMat(sCUR_FIELD_TEX_INFO& CurFieldTexInfo, CNtlWorldSector *pNtlWorldSector, RwInt32 IdxLyr);
 extern RwBool RpNtlWorldSectorGeomSetRenderCB();
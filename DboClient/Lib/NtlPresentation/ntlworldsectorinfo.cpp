@@ -299,9 +299,9 @@ RwBool CNtlWorldSectorInfo::NtlWorldSectorGeometryLoadFromFile(CNtlWorldSector *
 	return OutdoorSectorLoadFromFile(pFile, pNtlWorldSector, &CurFieldTexInfo);
 }
 
-RwBool CNtlWorldSectorInfo::NtlWorldSectorGeometrySaveIntoFile(CNtlWorldSector *pNtlWorldSector, FILE* pFile)
+RwBool CNtlWorldSectorInfo::NtlWorldSectorGeometrySaveIntoFile(CNtlWorldSector *pNtlWorldSector, FILE* pFile, RwInt32* pChunkOffset/* = NULL*/)
 {
-	return OutdoorSectorSaveIntoFile(pFile, pNtlWorldSector);
+	return OutdoorSectorSaveIntoFile(pFile, pNtlWorldSector, pChunkOffset);
 }
 
 RwBool CNtlWorldSectorInfo::NtlWorldSectorGeometryLoadFromFileIndoor(CNtlWorldSector *pNtlWorldSector, FILE* pFile)
@@ -636,26 +636,42 @@ RwBool CNtlWorldSectorInfo::OutdoorSectorLoadFromFile(FILE* pFile, CNtlWorldSect
 	return TRUE;
 }
 
-RwBool CNtlWorldSectorInfo::OutdoorSectorSaveIntoFile(FILE* pFile, CNtlWorldSector* pNtlWorldSector)
+RwBool CNtlWorldSectorInfo::OutdoorSectorSaveIntoFile(FILE* pFile, CNtlWorldSector* pNtlWorldSector, RwInt32* pChunkOffset/* = NULL*/)
 {
 	DBO_ASSERTE(pFile);
 	DBO_ASSERTE(pNtlWorldSector);
 
+	if(pChunkOffset) pChunkOffset[eNFC_MESH] = ftell(pFile);
 	SectorMeshSaveIntoFile(pFile, pNtlWorldSector);
+	if(pChunkOffset) pChunkOffset[eNFC_OBJECT] = ftell(pFile);
 	SectorObjectSaveIntoFile(pFile, pNtlWorldSector, AW_HEGITHFIELD);
+	if(pChunkOffset) pChunkOffset[eNFC_WATER] = ftell(pFile);
 	SectorWaterSaveIntoFile(pFile, pNtlWorldSector);
+	if(pChunkOffset) pChunkOffset[eNFC_SHADOW] = ftell(pFile);
 	SectorShadowSaveIntoFile(pFile, pNtlWorldSector);
+	if(pChunkOffset) pChunkOffset[eNFC_EFFECT] = ftell(pFile);
 	SectorEffectSaveIntoFile(pFile, pNtlWorldSector);
+	if(pChunkOffset) pChunkOffset[eNFC_SOUNDEFFECT] = ftell(pFile);
 	SectorSoundEffectSaveIntoFile(pFile, pNtlWorldSector);
+	if(pChunkOffset) pChunkOffset[eNFC_CULL] = ftell(pFile);
 	SectorCullSaveIntoFile(pFile, pNtlWorldSector);
+	if(pChunkOffset) pChunkOffset[eNFC_TILETRANSPARENCY] = ftell(pFile);
 	SectorTileTransparencySaveIntoFile(pFile, pNtlWorldSector);
+	if(pChunkOffset) pChunkOffset[eNFC_SHORELINE] = ftell(pFile);
 	SectorShoreLineSaveIntoFile(pFile, pNtlWorldSector);
+	if(pChunkOffset) pChunkOffset[eNFC_DECAL] = ftell(pFile);
 	SectorDecalSaveIntoFile(pFile, pNtlWorldSector);
+	if(pChunkOffset) pChunkOffset[eNFC_PLANT] = ftell(pFile);
 	SectorPlantSaveIntoFile(pFile, pNtlWorldSector);
+	if(pChunkOffset) pChunkOffset[eNFC_WORLDLIGHT] = ftell(pFile);
 	SectorWorldLightSaveIntoFile(pFile, pNtlWorldSector);
+	if(pChunkOffset) pChunkOffset[eNFC_OCCLUDER] = ftell(pFile);
 	SectorOccluderSaveIntoFile(pFile, pNtlWorldSector);
+	if(pChunkOffset) pChunkOffset[eNFC_HEATHAZEOBJECT] = ftell(pFile);
 	SectorHeatHazeObjectSaveIntoFile(pFile, pNtlWorldSector);
+	if(pChunkOffset) pChunkOffset[eNFC_LIGHTOBJECT] = ftell(pFile);
 	SectorLightObjectSaveIntoFile(pFile, pNtlWorldSector);
+	if(pChunkOffset) pChunkOffset[eNFC_DOJO] = ftell(pFile);
 	SectorDojoSaveIntoFile(pFile, pNtlWorldSector);
 
 	return TRUE;
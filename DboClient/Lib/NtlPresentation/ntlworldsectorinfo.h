@@ -70,7 +70,7 @@ public:
 	RwBool	NtlWorldSectorGeometryDeleteWithoutSwapFileSaving(CNtlWorldSector *pNtlWorldSector);
 
 	RwBool	NtlWorldSectorGeometryLoadFromFile(CNtlWorldSector *pNtlWorldSector, FILE* pFile, sCUR_FIELD_TEX_INFO& CurFieldTexInfo);
-	RwBool  NtlWorldSectorGeometrySaveIntoFile(CNtlWorldSector *pNtlWorldSector, FILE* pFile);
+	RwBool  NtlWorldSectorGeometrySaveIntoFile(CNtlWorldSector *pNtlWorldSector, FILE* pFile, RwInt32* pChunkOffset = NULL);
 
 	// ε
 	RwBool	NtlWorldSectorGeometryLoadFromFileIndoor(CNtlWorldSector *pNtlWorldSector, FILE* pFile);
@@ -83,7 +83,8 @@ public:
 public:
 	// Outdoor Sector
 	RwBool						OutdoorSectorLoadFromFile(FILE* pFile, CNtlWorldSector* pNtlWorldSector, sCUR_FIELD_TEX_INFO* pCurFieldTexInfo);
-	RwBool						OutdoorSectorSaveIntoFile(FILE* pFile, CNtlWorldSector* pNtlWorldSector);
+	// pChunkOffset : receives ftell() at the start of each chunk, indexed by eNTL_FIELD_CHUNKID
+	RwBool						OutdoorSectorSaveIntoFile(FILE* pFile, CNtlWorldSector* pNtlWorldSector, RwInt32* pChunkOffset = NULL);
 	RwInt32						OutdoorSectorSkipToFile(FILE* pFile);
 
 	BYTE*						OutdoorSectorSaveIntoFileFromFileMem(FILE* pFile, BYTE* pFileMem);
@@ -52,11 +52,16 @@ CDboTSCMain::CDboTSCMain( void )
 	m_pObjAgency = 0;
 
 	m_bSchedulingLoad = false;
+	m_bQuestHeaderLoad = false;
 
 	m_pclQuestZip = NULL;
 	m_pclTriggerZip = NULL;
 	m_pclObjectZip = NULL;
 
+	m_pclQuestBin = NULL;
+	m_pclTriggerBin = NULL;
+	m_pclObjectBin = NULL;
+
 	m_pQRecv = 0;
 	m_pTRecv = 0;
 }
@@ -177,6 +182,39 @@ void CDboTSCMain::Delete( void )
 	m_bCreated = false;
 }
 
+bool CDboTSCMain::CompileScripts( void )
+{
+	if ( 0 == m_pEntityFactory )
+	{
+		return false;
+	}
+
+	bool bResult = true;
+
+	if ( 'e' == m_strQuestPath[m_strQuestPath.size()-1] &&
+		 !CompileTSCryptoData( m_strQuestPath, GetBinaryScriptPath( m_strQuestPath ) ) )
+	{
+		CNtlTSLog::Log( "Compiling the scripts is failed. Info[%s]. [%s]", m_strQuestPath.c_str(), TS_CODE_TRACE() );
+		bResult = false;
+	}
+
+	if ( 'e' == m_strTriggerPath[m_strTriggerPath.size()-1] &&
+		 !CompileTSCryptoData( m_strTriggerPath, GetBinaryScriptPath( m_strTriggerPath ) ) )
+	{
+		CNtlTSLog::Log( "Compiling the scripts is failed. Info[%s]. [%s]", m_strTriggerPath.c_str(), TS_CODE_TRACE() );
+		bResult = false;
+	}
+
+	if ( 'e' == m_strObjectPath[m_strObjectPath.size()-1] &&
+		 !CompileTSCryptoData( m_strObjectPath, GetBinaryScriptPath( m_strObjectPath ) ) )
+	{
+		CNtlTSLog::Log( "Compiling the scripts is failed. Info[%s]. [%s]", m_strObjectPath.c_str(), TS_CODE_TRACE() );
+		bResult = false;
+	}
+
+	return bResult;
+}
+
 CDboTSCQAgency* CDboTSCMain::CreateAgency_Quest( void )
 {
 	DeleteAgency_Quest();
@@ -264,7 +302,31 @@ CNtlTSTrigger* CDboTSCMain::FindQuestFromTS( NTL_TS_T_ID tId )
 	{
 		if ( m_bSchedulingLoad )
 		{
-			if ( !LoadTriggerObjectFromUnZip( tId, m_pclQuestZip, m_defQuest ) )
+			bool bLoad;
+
+			if ( m_pclQuestBin && m_pclQuestBin->IsOpened() )
+			{
+				bLoad = LoadTriggerObjectFromBinary( tId, m_pclQuestBin, m_defQuest );
+			}
+			else if ( m_bQuestHeaderLoad )
+			{
+				// header   quest  zip   ʴ´
+				mapdef_TS_HEADER_LIST::iterator itHeader = m_defQuestHeader.find( tId );
+				if ( itHeader == m_defQuestHeader.end() )
+				{
+					return 0;
+				}
+
+				bLoad = LoadTriggerObjectFromHeader( itHeader->second, m_pclQuestZip, m_defQuest );
+
+				m_defQuestHeader.erase( itHeader );
+			}
+			else
+			{
+				bLoad = LoadTriggerObjectFromUnZip( tId, m_pclQuestZip, m_defQuest );
+			}
+
+			if ( !bLoad )
 			{
 				return 0;
 			}
@@ -304,7 +366,11 @@ CNtlTSTrigger* CDboTSCMain::FindTriggerFromTS( NTL_TS_T_ID tId )
 	{
 		if ( m_bSchedulingLoad )
 		{
-			if ( !LoadTriggerObjectFromUnZip( tId, m_pclTriggerZip, m_defTrigger ) )
+			bool bLoad = m_pclTriggerBin && m_pclTriggerBin->IsOpened() ?
+						 LoadTriggerObjectFromBinary( tId, m_pclTriggerBin, m_defTrigger ) :
+						 LoadTriggerObjectFromUnZip( tId, m_pclTriggerZip, m_defTrigger );
+
+			if ( !bLoad )
 			{
 				return 0;
 			}
@@ -344,7 +410,11 @@ CNtlTSTrigger* CDboTSCMain::FindObjectFromTS( NTL_TS_T_ID tId )
 	{
 		if ( m_bSchedulingLoad )
 		{
-			if ( !LoadTriggerObjectFromUnZip( tId, m_pclObjectZip, m_defObject ) )
+			bool bLoad = m_pclObjectBin && m_pclObjectBin->IsOpened() ?
+						 LoadTriggerObjectFromBinary( tId, m_pclObjectBin, m_defObject ) :
+						 LoadTriggerObjectFromUnZip( tId, m_pclObjectZip, m_defObject );
+
+			if ( !bLoad )
 			{
 				return 0;
 			}
@@ -423,11 +493,20 @@ bool CDboTSCMain::LoadFactories( void )
 	m_pUIFactory = NTL_NEW CDboTSCUIFactory;
 	m_pUIFactory->RegisterUIType();
 
+	// Compiled script  entity factory  ü 
+	m_pclQuestBin = NTL_NEW CNtlTSScrBinary( m_pEntityFactory );
+	m_pclTriggerBin = NTL_NEW CNtlTSScrBinary( m_pEntityFactory );
+	m_pclObjectBin = NTL_NEW CNtlTSScrBinary( m_pEntityFactory );
+
 	return true;
 }
 
 void CDboTSCMain::UnloadFactories( void )
 {
+	NTL_DELETE( m_pclQuestBin );
+	NTL_DELETE( m_pclTriggerBin );
+	NTL_DELETE( m_pclObjectBin );
+
 	NTL_DELETE( m_pUIFactory );
 	NTL_DELETE( m_pCtrlFactory );
 	NTL_DELETE( m_pEntityFactory );
@@ -437,14 +516,24 @@ bool CDboTSCMain::LoadScripts( void )
 {
 	UnloadAllScripts();
 
-	if ( 'e' == m_strQuestPath[m_strQuestPath.size()-1] )
+	if ( OpenBinaryScript( m_strQuestPath, m_pclQuestBin ) )
+	{
+		if ( !m_bSchedulingLoad && !LoadTSBinary( m_pclQuestBin, m_defQuest ) )
+		{
+			return false;
+		}
+	}
+	else if ( 'e' == m_strQuestPath[m_strQuestPath.size()-1] )
 	{
 		if ( m_bSchedulingLoad )
 		{
-			if ( !LoadTSCryptoData_UnZip( m_strQuestPath, m_pclQuestZip ) )
+			// quest  zip  ġ  ΰ ó ã  
+			if ( !LoadTSCryptoDataHeader( m_strQuestPath, m_pclQuestZip, m_defQuestHeader, m_defQuest ) )
 			{
 				return false;
 			}
+
+			m_bQuestHeaderLoad = true;
 		}
 		else
 		{
@@ -470,7 +559,14 @@ bool CDboTSCMain::LoadScripts( void )
 		}
 	}
 
-	if ( 'e' == m_strTriggerPath[m_strTriggerPath.size()-1] )
+	if ( OpenBinaryScript( m_strTriggerPath, m_pclTriggerBin ) )
+	{
+		if ( !m_bSchedulingLoad && !LoadTSBinary( m_pclTriggerBin, m_defTrigger ) )
+		{
+			return false;
+		}
+	}
+	else if ( 'e' == m_strTriggerPath[m_strTriggerPath.size()-1] )
 	{
 		if ( m_bSchedulingLoad )
 		{
@@ -503,7 +599,14 @@ bool CDboTSCMain::LoadScripts( void )
 		}
 	}
 
-	if ( 'e' == m_strObjectPath[m_strObjectPath.size()-1] )
+	if ( OpenBinaryScript( m_strObjectPath, m_pclObjectBin ) )
+	{
+		if ( !m_bSchedulingLoad && !LoadTSBinary( m_pclObjectBin, m_defObject ) )
+		{
+			return false;
+		}
+	}
+	else if ( 'e' == m_strObjectPath[m_strObjectPath.size()-1] )
 	{
 		if ( m_bSchedulingLoad )
 		{
@@ -541,6 +644,9 @@ bool CDboTSCMain::LoadScripts( void )
 
 void CDboTSCMain::UnloadAllScripts( void )
 {
+	m_bQuestHeaderLoad = false;
+	m_defQuestHeader.clear();
+
 	mapdef_TLIST::iterator it;
 
 	it = m_defQuest.begin();
@@ -568,6 +674,32 @@ void CDboTSCMain::UnloadAllScripts( void )
 	m_defObject.clear();
 }
 
+bool CDboTSCMain::OpenBinaryScript( const std::string& strPath, CNtlTSScrBinary* pclBinary )
+{
+	if ( 0 == pclBinary )
+	{
+		return false;
+	}
+
+	pclBinary->Close();
+
+	// compiled script     ȣȭǾ ְ,  ũ CRC  ٸ  ʴ´
+	return OpenTSBinary( strPath, GetBinaryScriptPath( strPath ), pclBinary );
+}
+
+std::string CDboTSCMain::GetBinaryScriptPath( const std::string& strPath )
+{
+	char szDrive[_MAX_DRIVE], szPath[_MAX_DIR], szName[_MAX_FNAME];
+	_splitpath_s( strPath.c_str(), szDrive, _MAX_DRIVE, szPath, _MAX_DIR, szName, _MAX_FNAME, 0, 0 );
+
+	std::string strBinPath = szDrive;
+	strBinPath += szPath;
+	strBinPath += szName;
+	strBinPath += ".tsb";
+
+	return strBinPath;
+}
+
 bool CDboTSCMain::LoadEventMappers( void )
 {
 	if ( !LoadEventMapperFromFile() )
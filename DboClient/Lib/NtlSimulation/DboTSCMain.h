@@ -63,12 +63,17 @@ protected:
 	bool								m_bSchedulingLoad;
 
 	CNtlUnzip*							m_pclQuestZip;
+	CNtlTSScrBinary*					m_pclQuestBin;
 	CNtlTSMain::mapdef_TLIST			m_defQuest;
+	bool								m_bQuestHeaderLoad;
+	mapdef_TS_HEADER_LIST				m_defQuestHeader;
 
 	CNtlUnzip*							m_pclTriggerZip;
+	CNtlTSScrBinary*					m_pclTriggerBin;
 	CNtlTSMain::mapdef_TLIST			m_defTrigger;
 
 	CNtlUnzip*							m_pclObjectZip;
+	CNtlTSScrBinary*					m_pclObjectBin;
 	CNtlTSMain::mapdef_TLIST			m_defObject;
 
 	// Trigger receiver
@@ -90,6 +95,9 @@ public:
 	virtual bool						Create( void );
 	virtual void						Delete( void );
 
+	// quest.e, pctrigger.e, objtrigger.e   ġ .tsb  compile Ѵ
+	bool								CompileScripts( void );
+
 	CDboTSCQAgency*						CreateAgency_Quest( void );
 	void								DeleteAgency_Quest( void );
 
@@ -138,6 +146,10 @@ protected:
 	virtual bool						LoadRecv( void );
 	virtual void						UnloadRecv( void );
 
+	// .e  compile  .tsb   
+	bool								OpenBinaryScript( const std::string& strPath, CNtlTSScrBinary* pclBinary );
+	std::string							GetBinaryScriptPath( const std::string& strPath );
+
 	void								RegisterNPCPosition( TBLIDX WorldIdx, TBLIDX NPCIdx, RwV3d& v3Pos );
 	void								ClearAllNPCPosition( void );
 
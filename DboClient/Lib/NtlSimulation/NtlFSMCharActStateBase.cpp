@@ -35,7 +35,13 @@
 #include "NtlSLPacketGenerator.h"
 #include "NtlSLVisualLogic.h"
 
+CNtlFSMCharActStateBase::MapFuncEventHandler CNtlFSMCharActStateBase::m_mapEventFunc;
+
 CNtlFSMCharActStateBase::CNtlFSMCharActStateBase()
+{
+}
+
+void CNtlFSMCharActStateBase::RegisterEventHandler(void)
 {
 	// event handler function link
 	m_mapEventFunc[g_EventActionMapSitAndStand.Get_pEventId()]	= &CNtlFSMCharActStateBase::EventProcActionSitAndStand;
@@ -123,10 +129,10 @@ RwUInt32 CNtlFSMCharActStateBase::HandleEvents(RWS::CMsg &pMsg)
 
 	CNtlFSMStateBase::HandleEvents(pMsg);
 
-	MapFuncEventHandler::iterator it = m_mapEventFunc.find(pMsg.Id);
-	if(it != m_mapEventFunc.end())
+	FuncEventHander pFunc = m_mapEventFunc.Find(pMsg.Id);
+	if(pFunc)
 	{
-		RwUInt32 uiRes = (this->*(*it).second)(pMsg);
+		RwUInt32 uiRes = (this->*pFunc)(pMsg);
 		NTL_RETURN(uiRes);
 	}
 
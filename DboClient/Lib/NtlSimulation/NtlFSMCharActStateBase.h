@@ -21,8 +21,12 @@ class CNtlFSMCharActStateBase : public CNtlFSMStateBase
 protected:
 
 	typedef RwUInt32 (CNtlFSMCharActStateBase::*FuncEventHander)(RWS::CMsg &pMsg);
-	typedef std::map<const RWS::CRegisteredMsgs*, FuncEventHander> MapFuncEventHandler;
-	MapFuncEventHandler m_mapEventFunc;
+	typedef RWS::CEventFuncTable<FuncEventHander> MapFuncEventHandler;
+	static MapFuncEventHandler m_mapEventFunc;
+
+public:
+
+	static void RegisterEventHandler(void);
 
 protected:
 
@@ -406,10 +406,10 @@ RwUInt32 CNtlFSMPlayerController::HandleEvents(RWS::CMsg &pMsg)
 {
 	NTL_FUNCTION("CNtlFSMPlayerController::HandleEvents");
 		
-	MapFuncEventHandler::iterator it = m_mapEventFunc.find(pMsg.Id);
-	if(it != m_mapEventFunc.end())
+	FuncEventHander pFunc = m_mapEventFunc.Find(pMsg.Id);
+	if(pFunc)
 	{
-		RwUInt32 uiRes = (this->*(*it).second)(pMsg);
+		RwUInt32 uiRes = (this->*pFunc)(pMsg);
 		NTL_RETURN(uiRes);
 	}
 
@@ -1377,10 +1377,10 @@ void CNtlFSMPlayerController::NotifyEvents(RWS::CMsg &pMsg, RwUInt32 uiEventResu
 		}
 	}
 
-	MapFuncNotifyEventHandler::iterator it = m_mapNotifyEventFunc.find(pMsg.Id);
-	if(it != m_mapNotifyEventFunc.end())
+	NotifyFuncEventHander pFunc = m_mapNotifyEventFunc.Find(pMsg.Id);
+	if(pFunc)
 	{
-		(this->*(*it).second)(pMsg, uiEventResult, uiParam1, uiParam2);
+		(this->*pFunc)(pMsg, uiEventResult, uiParam1, uiParam2);
 	}
 }
 
@@ -142,11 +142,11 @@ protected:
 	RwUInt8 m_byKeyboardMoveFlags;
 
 	typedef RwUInt32 (CNtlFSMPlayerController::*FuncEventHander)(RWS::CMsg &pMsg);
-	typedef std::map<const RWS::CRegisteredMsgs*, FuncEventHander> MapFuncEventHandler;
+	typedef RWS::CEventFuncTable<FuncEventHander> MapFuncEventHandler;
 	MapFuncEventHandler m_mapEventFunc;
 
 	typedef void (CNtlFSMPlayerController::*NotifyFuncEventHander)(RWS::CMsg &pMsg, RwUInt32, RwUInt32, RwUInt32);
-	typedef std::map<const RWS::CRegisteredMsgs*, NotifyFuncEventHander> MapFuncNotifyEventHandler;
+	typedef RWS::CEventFuncTable<NotifyFuncEventHander> MapFuncNotifyEventHandler;
 	MapFuncNotifyEventHandler m_mapNotifyEventFunc;
 
 private:
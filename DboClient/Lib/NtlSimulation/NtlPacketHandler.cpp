@@ -6,25 +6,36 @@
 
 // core
 #include "NtlDebug.h"
+#include "NtlCoreUtil.h"
 
 // simulation
 #include "NtlSLEvent.h"
 #include "NtlSLEventFunc.h"
 
+#include <algorithm>
 
-CNtlPacketHandler::MapHandler CNtlPacketHandler::m_mapHandler;
+
+CNtlPacketHandler::VecHandler CNtlPacketHandler::m_vecHandler;
+RwBool CNtlPacketHandler::m_bProfile = FALSE;
+LARGE_INTEGER CNtlPacketHandler::m_liFreq;
 
 void CNtlPacketHandler::Register(WORD wProtocolOp, NotifyPacketHander fp)
 {
-	m_mapHandler[wProtocolOp] = fp;
+	if(wProtocolOp >= m_vecHandler.size())
+	{
+		SHandlerEntry sEntry;
+		memset(&sEntry, 0, sizeof(SHandlerEntry));
+
+		m_vecHandler.resize(wProtocolOp + 1, sEntry);
+	}
+
+	m_vecHandler[wProtocolOp].fp = fp;
 }
 
 void CNtlPacketHandler::UnRegister(WORD wProtocolOp)
 {
-	MapHandler::iterator it;
-	it = m_mapHandler.find(wProtocolOp);
-	if(it != m_mapHandler.end())
-		m_mapHandler.erase(it); 
+	if(wProtocolOp < m_vecHandler.size())
+		m_vecHandler[wProtocolOp].fp = NULL; 
 }
 
 void CNtlPacketHandler::DetectPacketHeader(void *pPacket)
@@ -32,14 +43,103 @@ void CNtlPacketHandler::DetectPacketHeader(void *pPacket)
 	sNTLPACKETHEADER *pHeader = (sNTLPACKETHEADER*)pPacket;
 	WORD wOpCode = pHeader->wOpCode;
 
-	MapHandler::iterator it;
-	it = m_mapHandler.find(wOpCode);
-	if(it != m_mapHandler.end())
+	if(wOpCode < m_vecHandler.size() && m_vecHandler[wOpCode].fp)
 	{
-		NotifyPacketHander fp = (*it).second;
-		(*fp)(pPacket);
+		SHandlerEntry& sEntry = m_vecHandler[wOpCode];
+		sEntry.sStat.dwHitCount++;
+
+		if(m_bProfile)
+		{
+			LARGE_INTEGER liBegin, liEnd;
+			QueryPerformanceCounter(&liBegin);
+
+			(*sEntry.fp)(pPacket);
+
+			QueryPerformanceCounter(&liEnd);
+
+			// the handler may have registered a new opcode and moved the table
+			m_vecHandler[wOpCode].sStat.llTicks += liEnd.QuadPart - liBegin.QuadPart;
+		}
+		else
+		{
+			(*sEntry.fp)(pPacket);
+		}
 	}
 
 	CNtlSLEventGenerator::NotifyReceivePacket(pPacket); 
 }
 
+void CNtlPacketHandler::EnableProfile(RwBool bEnable)
+{
+	if(bEnable && !m_bProfile)
+	{
+		QueryPerformanceFrequency(&m_liFreq);
+	}
+
+	m_bProfile = bEnable;
+}
+
+void CNtlPacketHandler::ResetProfile(void)
+{
+	for(VecHandler::iterator it = m_vecHandler.begin(); it != m_vecHandler.end(); ++it)
+	{
+		(*it).sStat.dwHitCount	= 0;
+		(*it).sStat.llTicks		= 0;
+	}
+}
+
+DWORD CNtlPacketHandler::GetHitCount(WORD wProtocolOp)
+{
+	if(wProtocolOp >= m_vecHandler.size())
+		return 0;
+
+	return m_vecHandler[wProtocolOp].sStat.dwHitCount;
+}
+
+RwReal CNtlPacketHandler::GetHandlerTime(WORD wProtocolOp)
+{
+	if(wProtocolOp >= m_vecHandler.size() || m_liFreq.QuadPart == 0)
+		return 0.0f;
+
+	return (RwReal)((double)m_vecHandler[wProtocolOp].sStat.llTicks / (double)m_liFreq.QuadPart);
+}
+
+namespace
+{
+	struct SProfileSort
+	{
+		const std::vector<LONGLONG>* pvecTicks;
+
+		bool operator()(WORD wLeft, WORD wRight) const
+		{
+			return (*pvecTicks)[wLeft] > (*pvecTicks)[wRight];
+		}
+	};
+}
+
+void CNtlPacketHandler::DumpProfile(RwInt32 iTopNum)
+{
+	std::vector<WORD>		vecOpCode;
+	std::vector<LONGLONG>	vecTicks(m_vecHandler.size());
+
+	for(RwUInt32 i = 0; i < m_vecHandler.size(); ++i)
+	{
+		vecTicks[i] = m_vecHandler[i].sStat.llTicks;
+
+		if(m_vecHandler[i].sStat.dwHitCount > 0)
+			vecOpCode.push_back((WORD)i);
+	}
+
+	SProfileSort sSort;
+	sSort.pvecTicks = &vecTicks;
+	std::sort(vecOpCode.begin(), vecOpCode.end(), sSort);
+
+	NtlLogFilePrintArgs("CNtlPacketHandler profile : %u opcodes dispatched", vecOpCode.size());
+
+	for(RwInt32 i = 0; i < iTopNum && i < (RwInt32)vecOpCode.size(); ++i)
+	{
+		WORD wOpCode = vecOpCode[i];
+
+		NtlLogFilePrintArgs("opcode %u : hit %u, time %f sec", wOpCode, GetHitCount(wOpCode), GetHandlerTime(wOpCode));
+	}
+}
@@ -13,14 +13,40 @@
 #ifndef __NTL_PACKET_HANDLER_H__
 #define __NTL_PACKET_HANDLER_H__
 
+#include <vector>
+
 typedef void (*NotifyPacketHander)(void *pPacket);
 
+/**
+ * \brief received packet dispatcher
+ *
+ * the handlers sit in a table indexed by the opcode, which grows up to the largest opcode registered,
+ * so a received packet costs one array access. every dispatch bumps the hit count of its opcode and,
+ * while the profile is enabled, the time spent in the handler is accumulated too.
+ */
 class CNtlPacketHandler
 {
+public:
+
+	struct SHandlerStat
+	{
+		DWORD		dwHitCount;
+		LONGLONG	llTicks;		// QueryPerformanceCounter ticks spent in the handler
+	};
+
 private:
 
-	typedef std::map<WORD, NotifyPacketHander> MapHandler;
-	static MapHandler m_mapHandler;
+	struct SHandlerEntry
+	{
+		NotifyPacketHander	fp;
+		SHandlerStat		sStat;
+	};
+
+	typedef std::vector<SHandlerEntry> VecHandler;
+	static VecHandler m_vecHandler;
+
+	static RwBool			m_bProfile;
+	static LARGE_INTEGER	m_liFreq;
 
 public:
 
@@ -28,6 +54,17 @@ public:
 	static void UnRegister(WORD wProtocolOp);
 
 	static void DetectPacketHeader(void *pPacket);
+
+	// profile
+	static void		EnableProfile(RwBool bEnable);
+	static RwBool	IsEnableProfile(void)		{ return m_bProfile; }
+	static void		ResetProfile(void);
+
+	static DWORD	GetHitCount(WORD wProtocolOp);
+	static RwReal	GetHandlerTime(WORD wProtocolOp);		// sec
+
+	// the iTopNum handlers which took the most time are written to the log file
+	static void		DumpProfile(RwInt32 iTopNum = 20);
 };
 
 
@@ -28,6 +28,7 @@
 #include "NtlSLLuaGlue.h"
 #include "NtlCameraManager.h"
 #include "NtlSobCharProxy.h"
+#include "NtlFSMCharActStateBase.h"
 #include "NtlSobAvatar.h"
 #include "DboTSCQAgency.h"
 #include "DboTSCTAgency.h"
@@ -325,6 +326,7 @@ RwBool CreateTableContainer(RwUInt8 byLoadMethod)
 	fileNameList.SetFileName(CTableContainer::TABLE_GAME_MANIA_TIME,		"Table_GameManiaTime_Data");
 
 	g_pTableContainer = NTL_NEW CTableContainer;
+	g_pTableContainer->SetLoadingThreadCount(0);
 	
 	std::string str;
 	CTable::eLOADING_METHOD eLoadMethod = (CTable::eLOADING_METHOD)byLoadMethod;
@@ -451,6 +453,8 @@ RwBool API_SLInit(RwBool bVirtualNet, CNtlCamera *pCamera, RwUInt8 byLoadMethod,
 	g_pCamera = pCamera;
 
 	// event handler .
+	CNtlSobActor::RegisterEventHandler();
+	CNtlFSMCharActStateBase::RegisterEventHandler();
 	CNtlSobCharProxy::RegisterEventHandler();
 
 	g_pSLGlobal = NTL_NEW CNtlSLGlobal;
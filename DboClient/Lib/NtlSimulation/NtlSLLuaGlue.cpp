@@ -226,32 +226,71 @@ SSLLuaGlueDef SLGlue[] =
 #define MAX_LUAFUNC_LEN		128
 #define MAX_LUACMD_LEN		256
 
+typedef struct
+{
+	char chName[MAX_LUAFUNC_LEN];
+	int  iRef;			// CNtlLuaState::GetFunctionRef  .  ã ʾ NTL_LUA_NOREF
+}SLuaExecHook;
+
 typedef struct 
 {
-	char fpSLSetupData[MAX_LUAFUNC_LEN];
-	char fpSobCreate[MAX_LUAFUNC_LEN];
-	char fpSobDestroy[MAX_LUAFUNC_LEN];
-	char fpCharStateEnter[MAX_LUAFUNC_LEN];
-	char fpCharStateExit[MAX_LUAFUNC_LEN];
-	char fpCharBehaviorEnter[MAX_LUAFUNC_LEN];
-	char fpCharBehaviorExit[MAX_LUAFUNC_LEN];
-	char fpAttack[MAX_LUAFUNC_LEN];
-	char fpHurt[MAX_LUAFUNC_LEN];
-	char fpSkillCastingEnter[MAX_LUAFUNC_LEN];
-	char fpSkillCastingExit[MAX_LUAFUNC_LEN];
-	char fpSkillActionEnter[MAX_LUAFUNC_LEN];
-	char fpSkillActionExit[MAX_LUAFUNC_LEN];
-	char fpHTBSkillStepEnter[MAX_LUAFUNC_LEN];
-	char fpHTBSkillStepExit[MAX_LUAFUNC_LEN];
-	char fpHTBCameraStart[MAX_LUAFUNC_LEN];
-	char fpDragonDNEnter[MAX_LUAFUNC_LEN];	
-	char fpExplosionCamera[MAX_LUAFUNC_LEN];	
-    char fpObserverCamera[MAX_LUAFUNC_LEN];
+	SLuaExecHook fpSLSetupData;
+	SLuaExecHook fpSobCreate;
+	SLuaExecHook fpSobDestroy;
+	SLuaExecHook fpCharStateEnter;
+	SLuaExecHook fpCharStateExit;
+	SLuaExecHook fpCharBehaviorEnter;
+	SLuaExecHook fpCharBehaviorExit;
+	SLuaExecHook fpAttack;
+	SLuaExecHook fpHurt;
+	SLuaExecHook fpSkillCastingEnter;
+	SLuaExecHook fpSkillCastingExit;
+	SLuaExecHook fpSkillActionEnter;
+	SLuaExecHook fpSkillActionExit;
+	SLuaExecHook fpHTBSkillStepEnter;
+	SLuaExecHook fpHTBSkillStepExit;
+	SLuaExecHook fpHTBCameraStart;
+	SLuaExecHook fpDragonDNEnter;	
+	SLuaExecHook fpExplosionCamera;	
+    SLuaExecHook fpObserverCamera;
 }SLuaExecFunc;
 
 SLuaExecFunc g_LuaExecFunc;
 
 
+static void LuaExec_ReleaseHook(SLuaExecHook& sHook)
+{
+	if(g_pLuaState && sHook.iRef != NTL_LUA_NOREF)
+		g_pLuaState->ReleaseFunctionRef(sHook.iRef);
+
+	sHook.iRef = NTL_LUA_NOREF;
+}
+
+// lua state   ų script  ٽ    Լ  .
+static void LuaExec_ResetHooks(void)
+{
+	SLuaExecHook *pHook = reinterpret_cast<SLuaExecHook*>(&g_LuaExecFunc);
+	int iCount = (int)(sizeof(SLuaExecFunc) / sizeof(SLuaExecHook));
+	for(int i = 0; i < iCount; i++)
+	{
+		LuaExec_ReleaseHook(pHook[i]);
+	}
+}
+
+// hook Լ ó Ҹ  registry   ΰ,  ʹ chunk compile  ٷ ȣѴ.
+static void LuaExec_CallHook(SLuaExecHook& sHook, const unsigned int *pArgs, int iArgCount)
+{
+	if(sHook.iRef == NTL_LUA_NOREF)
+	{
+		sHook.iRef = g_pLuaState->GetFunctionRef(sHook.chName);
+		if(sHook.iRef == NTL_LUA_NOREF)
+			return;
+	}
+
+	g_pLuaState->CallFunction(sHook.iRef, pArgs, iArgCount);
+}
+
+
 void LuaState_ErrorHandler(const char *pError)
 {
 	NtlLogFilePrint(const_cast<RwChar*>(pError));
@@ -271,6 +310,8 @@ void SLLua_CreateState(void)
 		g_pLuaState = NULL;
 	}
 
+	LuaExec_ResetHooks();
+
 	g_pLuaState = NTL_NEW CNtlLuaState;
 	g_pLuaState->LinkErrorHandler(LuaState_ErrorHandler);
 
@@ -284,6 +325,8 @@ void SLLua_CreateState(void)
 
 void SLLua_Compile(void)
 {
+	LuaExec_ResetHooks();
+
 	if ( GetNtlResourcePackManager()->GetActiveFlags() & NTL_PACK_TYPE_FLAG_SCRIPT )
 	{
 		char* pBuffer = NULL;
@@ -328,6 +371,8 @@ void SLLua_Release(void)
 		NTL_DELETE(g_pLuaState);
 		g_pLuaState = NULL;
 	}
+
+	LuaExec_ResetHooks();
 }
 
 void LuaExec_SLSetupData(void)
@@ -335,9 +380,8 @@ void LuaExec_SLSetupData(void)
 	if(g_pLuaState == NULL)
 		return;
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u)", g_LuaExecFunc.fpSLSetupData, 1);
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { 1 };
+	LuaExec_CallHook(g_LuaExecFunc.fpSLSetupData, auiArg, _countof(auiArg));
 }
 
 void LuaExec_SobCreate(CNtlSob *pSobObj)
@@ -351,9 +395,8 @@ void LuaExec_SobCreate(CNtlSob *pSobObj)
 	GetLuaGlueStack()->Reset();
 	GetLuaGlueStack()->SetActiveObj(LUA_STACK_ACTIVEOBJ_SOB, reinterpret_cast<void*>(pSobObj)); 
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u,%u,%u)", g_LuaExecFunc.fpSobCreate, pSobObj->GetSerialID(), pSobObj->GetClassID(), pSobObj->GetVisualLuaID());
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { pSobObj->GetSerialID(), pSobObj->GetClassID(), pSobObj->GetVisualLuaID() };
+	LuaExec_CallHook(g_LuaExecFunc.fpSobCreate, auiArg, _countof(auiArg));
 }
 
 void LuaExec_SobDestroy(CNtlSob *pSobObj)
@@ -367,9 +410,8 @@ void LuaExec_SobDestroy(CNtlSob *pSobObj)
 	GetLuaGlueStack()->Reset();
 	GetLuaGlueStack()->SetActiveObj(LUA_STACK_ACTIVEOBJ_SOB, reinterpret_cast<void*>(pSobObj)); 
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u,%u)", g_LuaExecFunc.fpSobDestroy, pSobObj->GetSerialID(), pSobObj->GetClassID());
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { pSobObj->GetSerialID(), pSobObj->GetClassID() };
+	LuaExec_CallHook(g_LuaExecFunc.fpSobDestroy, auiArg, _countof(auiArg));
 }
 
 void LuaExec_CharStateEnter(unsigned int uiSerialId, CNtlFSMStateBase *pState)
@@ -383,9 +425,8 @@ void LuaExec_CharStateEnter(unsigned int uiSerialId, CNtlFSMStateBase *pState)
 	GetLuaGlueStack()->Reset();
 	GetLuaGlueStack()->SetActiveObj(LUA_STACK_ACTIVEOBJ_STATE, reinterpret_cast<void*>(pState)); 
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u,%u)", g_LuaExecFunc.fpCharStateEnter, uiSerialId, pState->GetStateId());
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { uiSerialId, pState->GetStateId() };
+	LuaExec_CallHook(g_LuaExecFunc.fpCharStateEnter, auiArg, _countof(auiArg));
 }
 
 void LuaExec_CharStateExit(unsigned int uiSerialId, CNtlFSMStateBase *pState)
@@ -399,9 +440,8 @@ void LuaExec_CharStateExit(unsigned int uiSerialId, CNtlFSMStateBase *pState)
 	GetLuaGlueStack()->Reset();
 	GetLuaGlueStack()->SetActiveObj(LUA_STACK_ACTIVEOBJ_STATE, reinterpret_cast<void*>(pState)); 
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u,%u)", g_LuaExecFunc.fpCharStateExit, uiSerialId, pState->GetStateId());
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { uiSerialId, pState->GetStateId() };
+	LuaExec_CallHook(g_LuaExecFunc.fpCharStateExit, auiArg, _countof(auiArg));
 }
 
 void LuaExec_CharBehaviorEnter(unsigned int uiSerialId, CNtlBehaviorBase *pBehavior)
@@ -415,9 +455,8 @@ void LuaExec_CharBehaviorEnter(unsigned int uiSerialId, CNtlBehaviorBase *pBehav
 	GetLuaGlueStack()->Reset();
 	GetLuaGlueStack()->SetActiveObj(LUA_STACK_ACTIVEOBJ_BEHAVIOR, reinterpret_cast<void*>(pBehavior)); 
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u,%u)", g_LuaExecFunc.fpCharBehaviorEnter, uiSerialId, pBehavior->GetBehaviorId());
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { uiSerialId, pBehavior->GetBehaviorId() };
+	LuaExec_CallHook(g_LuaExecFunc.fpCharBehaviorEnter, auiArg, _countof(auiArg));
 }
 
 void LuaExec_CharBehaviorExit(unsigned int uiSerialId, CNtlBehaviorBase *pBehavior)
@@ -431,9 +470,8 @@ void LuaExec_CharBehaviorExit(unsigned int uiSerialId, CNtlBehaviorBase *pBehavi
 	GetLuaGlueStack()->Reset();
 	GetLuaGlueStack()->SetActiveObj(LUA_STACK_ACTIVEOBJ_BEHAVIOR, reinterpret_cast<void*>(pBehavior)); 
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u,%u)", g_LuaExecFunc.fpCharBehaviorExit, uiSerialId, pBehavior->GetBehaviorId());
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { uiSerialId, pBehavior->GetBehaviorId() };
+	LuaExec_CallHook(g_LuaExecFunc.fpCharBehaviorExit, auiArg, _countof(auiArg));
 }
 
 void LuaExec_Attack(unsigned int uiAttackerSerialId, unsigned int uiDefenderSerialId, const SHitStuff *pHit)
@@ -447,9 +485,8 @@ void LuaExec_Attack(unsigned int uiAttackerSerialId, unsigned int uiDefenderSeri
 	GetLuaGlueStack()->Reset();
 	GetLuaGlueStack()->SetHit(pHit);
 	
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u,%u)", g_LuaExecFunc.fpAttack, uiAttackerSerialId, uiDefenderSerialId);
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { uiAttackerSerialId, uiDefenderSerialId };
+	LuaExec_CallHook(g_LuaExecFunc.fpAttack, auiArg, _countof(auiArg));
 }
 
 
@@ -464,9 +501,8 @@ void LuaExec_Hurt(unsigned int uiAttackerSerialId, unsigned int uiDefenderSerial
 	GetLuaGlueStack()->Reset();
 	GetLuaGlueStack()->SetHit(pHit);
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u,%u)", g_LuaExecFunc.fpHurt, uiAttackerSerialId, uiDefenderSerialId);
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { uiAttackerSerialId, uiDefenderSerialId };
+	LuaExec_CallHook(g_LuaExecFunc.fpHurt, auiArg, _countof(auiArg));
 }
 
 void LuaExec_SkillCastingEnter(unsigned int uiSerialId, unsigned int uiSkillId)
@@ -476,9 +512,8 @@ void LuaExec_SkillCastingEnter(unsigned int uiSerialId, unsigned int uiSkillId)
 
 	GetLuaGlueStack()->Reset();
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u,%u)", g_LuaExecFunc.fpSkillCastingEnter, uiSerialId, uiSkillId);
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { uiSerialId, uiSkillId };
+	LuaExec_CallHook(g_LuaExecFunc.fpSkillCastingEnter, auiArg, _countof(auiArg));
 }
 
 void LuaExec_SkillCastingExit(unsigned int uiSerialId, unsigned int uiSkillId, unsigned int uiSkillSuccess)
@@ -488,9 +523,8 @@ void LuaExec_SkillCastingExit(unsigned int uiSerialId, unsigned int uiSkillId, u
 
 	GetLuaGlueStack()->Reset();
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u,%u,%u)", g_LuaExecFunc.fpSkillCastingExit, uiSerialId, uiSkillId, uiSkillSuccess);
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { uiSerialId, uiSkillId, uiSkillSuccess };
+	LuaExec_CallHook(g_LuaExecFunc.fpSkillCastingExit, auiArg, _countof(auiArg));
 }
 
 void LuaExec_SkillActionEnter(unsigned int uiSerialId, unsigned int uiSkillId)
@@ -500,9 +534,8 @@ void LuaExec_SkillActionEnter(unsigned int uiSerialId, unsigned int uiSkillId)
 
 	GetLuaGlueStack()->Reset();
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u,%u)", g_LuaExecFunc.fpSkillActionEnter, uiSerialId, uiSkillId);
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { uiSerialId, uiSkillId };
+	LuaExec_CallHook(g_LuaExecFunc.fpSkillActionEnter, auiArg, _countof(auiArg));
 }
 
 void LuaExec_SkillActionExit(unsigned int uiSerialId, unsigned int uiSkillId)
@@ -512,9 +545,8 @@ void LuaExec_SkillActionExit(unsigned int uiSerialId, unsigned int uiSkillId)
 
 	GetLuaGlueStack()->Reset();
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u,%u)", g_LuaExecFunc.fpSkillActionExit, uiSerialId, uiSkillId);
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { uiSerialId, uiSkillId };
+	LuaExec_CallHook(g_LuaExecFunc.fpSkillActionExit, auiArg, _countof(auiArg));
 }
 
 void LuaExec_HTBSkillStepEnter(unsigned int uiSerialId, unsigned int uiHtbTblId, unsigned int uiSkillTblId, unsigned int uiStepId)
@@ -524,9 +556,8 @@ void LuaExec_HTBSkillStepEnter(unsigned int uiSerialId, unsigned int uiHtbTblId,
 
 	GetLuaGlueStack()->Reset();
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u,%u,%u,%u)", g_LuaExecFunc.fpHTBSkillStepEnter, uiSerialId, uiHtbTblId, uiSkillTblId, uiStepId);
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { uiSerialId, uiHtbTblId, uiSkillTblId, uiStepId };
+	LuaExec_CallHook(g_LuaExecFunc.fpHTBSkillStepEnter, auiArg, _countof(auiArg));
 }
 
 void LuaExec_HTBSkillStepExit(unsigned int uiSerialId, unsigned int uiHtbTblId, unsigned int uiSkillTblId, unsigned int uiStepId)
@@ -536,9 +567,8 @@ void LuaExec_HTBSkillStepExit(unsigned int uiSerialId, unsigned int uiHtbTblId,
 
 	GetLuaGlueStack()->Reset();
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u,%u,%u,%u)", g_LuaExecFunc.fpHTBSkillStepExit, uiSerialId, uiHtbTblId, uiSkillTblId, uiStepId);
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { uiSerialId, uiHtbTblId, uiSkillTblId, uiStepId };
+	LuaExec_CallHook(g_LuaExecFunc.fpHTBSkillStepExit, auiArg, _countof(auiArg));
 }
 
 
@@ -550,9 +580,8 @@ void LuaExec_HTBCameraStart(unsigned int  uiAttackSerialId, unsigned int uiTarge
 	GetLuaGlueStack()->SetHTBAttackSerialId(uiAttackSerialId);
 	GetLuaGlueStack()->SetHTBTargetSerialId(uiTargetSerialId);
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u)", g_LuaExecFunc.fpHTBCameraStart, uiHtbTblId);
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { uiHtbTblId };
+	LuaExec_CallHook(g_LuaExecFunc.fpHTBCameraStart, auiArg, _countof(auiArg));
 }
 
 void LuaExec_DragonDNEnter() 
@@ -560,9 +589,7 @@ void LuaExec_DragonDNEnter()
 	if(g_pLuaState == NULL)
 		return;
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, "%s()", g_LuaExecFunc.fpDragonDNEnter);
-	g_pLuaState->RunString(chCmd);
+	LuaExec_CallHook(g_LuaExecFunc.fpDragonDNEnter, NULL, 0);
 }
 
 
@@ -571,9 +598,8 @@ void LuaExec_ExplosionCamera(unsigned int uiExplosionId)
 	if(g_pLuaState == NULL)
 		return;
 
-	char chCmd[MAX_LUACMD_LEN];
-	sprintf_s(chCmd, MAX_LUACMD_LEN, "%s(%u)", g_LuaExecFunc.fpExplosionCamera, uiExplosionId);
-	g_pLuaState->RunString(chCmd);
+	unsigned int auiArg[] = { uiExplosionId };
+	LuaExec_CallHook(g_LuaExecFunc.fpExplosionCamera, auiArg, _countof(auiArg));
 }
 
 void LuaExec_ObserverCamera( unsigned int uiIndex ) 
@@ -581,9 +607,8 @@ void LuaExec_ObserverCamera( unsigned int uiIndex )
     if(g_pLuaState == NULL)
         return;
 
-    char chCmd[MAX_LUACMD_LEN];
-    sprintf_s(chCmd, "%s(%u)", g_LuaExecFunc.fpObserverCamera, uiIndex);
-    g_pLuaState->RunString(chCmd);
+    unsigned int auiArg[] = { uiIndex };
+    LuaExec_CallHook(g_LuaExecFunc.fpObserverCamera, auiArg, _countof(auiArg));
 }
 
 void LuaExec_DirectionStep(const char* pcStepName)
@@ -647,6 +672,9 @@ int LuaGlue_RunScript(lua_State *L)
 		{
 			g_pLuaState->RunScript(chCmd);
 		}
+
+		//  script  hook Լ ٽ   ִ.
+		LuaExec_ResetHooks();
 	}
 
 	return NTL_LUA_GLUE_RESULT_NO;
@@ -655,9 +683,10 @@ int LuaGlue_RunScript(lua_State *L)
 ////////////////////////////////////////////////////////////////////////////
 // lua register function
 ////////////////////////////////////////////////////////////////////////////
-#define LUA_REGISTER(funcName) \
+#define LUA_REGISTER(hook) \
     const char *pKey = g_pLuaState->GetStringArgument(1);\
-    strcpy_s(funcName, MAX_LUAFUNC_LEN, pKey);\
+    LuaExec_ReleaseHook(hook);\
+    strcpy_s(hook.chName, MAX_LUAFUNC_LEN, pKey);\
     return NTL_LUA_GLUE_RESULT_NO;
 
 int LuaGlue_RegisterSLSetupData(lua_State *L)
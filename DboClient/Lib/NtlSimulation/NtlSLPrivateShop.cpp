@@ -54,10 +54,10 @@ void CNtlPrivateShop::HandleEvents(RWS::CMsg &pMsg)
 {
 	NTL_FUNCTION("CNtlPrivateShop::HandleEvents");
 
-	MapFuncEventHandler::iterator it = m_mapEventFunc.find( pMsg.Id );
-	if( it != m_mapEventFunc.end() )
+	FuncEventHander pFunc = m_mapEventFunc.Find( pMsg.Id );
+	if( pFunc )
 	{
-		(this->*(*it).second)(pMsg);
+		(this->*pFunc)(pMsg);
 	}
 
 	NTL_RETURNVOID();
@@ -38,7 +38,7 @@ public:
 
 protected:
 	typedef void (CNtlPrivateShop::*FuncEventHander)(RWS::CMsg &pMsg);
-	typedef std::map<const RWS::CRegisteredMsgs*, FuncEventHander> MapFuncEventHandler;
+	typedef RWS::CEventFuncTable<FuncEventHander> MapFuncEventHandler;
 	MapFuncEventHandler m_mapEventFunc;
 
 	sPRIVATESHOP_SHOP_DATA	m_PrivateShopData;
@@ -23,6 +23,8 @@
 #include "NtlSobProxy.h"
 
 
+CNtlSobActor::MapFuncEventHandler CNtlSobActor::m_mapEventFunc;
+
 CNtlSobActor::CNtlSobActor()
 {
 	m_uiActFlags				= 0;
@@ -38,6 +40,30 @@ CNtlSobActor::~CNtlSobActor()
 {
 }
 
+void CNtlSobActor::RegisterEventHandler(void)
+{
+	// event handler function link
+	m_mapEventFunc[g_EventSobTargetSelect.Get_pEventId()]			= &CNtlSobActor::SobTargetSelectEventHandler;
+	m_mapEventFunc[g_EventSobAttackSelect.Get_pEventId()]			= &CNtlSobActor::SobAttackSelectEventHandler;
+	m_mapEventFunc[g_EventSobTargetSelectRelease.Get_pEventId()]	= &CNtlSobActor::SobTargetSelectReleaseEventHandler;	
+    
+    // Proxy óϴ ̺Ʈ 
+    m_mapEventFunc[g_EventSobAttackMarkRelease.Get_pEventId()]		= &CNtlSobActor::SobProxyEventHandler;	
+    m_mapEventFunc[g_EventSobGotFocus.Get_pEventId()]				= &CNtlSobActor::SobProxyEventHandler;
+    m_mapEventFunc[g_EventSobLostFocus.Get_pEventId()]				= &CNtlSobActor::SobProxyEventHandler;    
+    m_mapEventFunc[g_EventShareTargetSelect.Get_pEventId()]         = &CNtlSobActor::SobProxyEventHandler;
+    m_mapEventFunc[g_EventShareTargetRelease.Get_pEventId()]        = &CNtlSobActor::SobProxyEventHandler;
+    m_mapEventFunc[g_EventTenkaichiMarking.Get_pEventId()]          = &CNtlSobActor::SobProxyEventHandler;
+    m_mapEventFunc[g_EventSobTargetMarkSelect.Get_pEventId()]       = &CNtlSobActor::SobProxyEventHandler;
+    m_mapEventFunc[g_EventSobTargetMarkRelease.Get_pEventId()]      = &CNtlSobActor::SobProxyEventHandler;
+    m_mapEventFunc[g_EventTransform.Get_pEventId()]                 = &CNtlSobActor::SobProxyEventHandler;    
+    m_mapEventFunc[g_EventMobTransform.Get_pEventId()]              = &CNtlSobActor::SobProxyEventHandler;
+    m_mapEventFunc[g_EventTransformCandy.Get_pEventId()]            = &CNtlSobActor::SobProxyEventHandler;
+    m_mapEventFunc[g_EventSobSkillAction.Get_pEventId()]            = &CNtlSobActor::SobProxyEventHandler;
+    m_mapEventFunc[g_EventSobSkillActioned.Get_pEventId()]            = &CNtlSobActor::SobProxyEventHandler;
+    m_mapEventFunc[g_EventAnimHit.Get_pEventId()]                   = &CNtlSobActor::SobProxyEventHandler;
+}
+
 sCHARSTATE* CNtlSobActor::GetServerFullState(void) const
 {
 	if ( m_pFSMLayer )
@@ -89,28 +115,6 @@ RwBool CNtlSobActor::Create(void)
 		NTL_RETURN(FALSE);
 	}
 
-	// event handler function link
-	m_mapEventFunc[g_EventSobTargetSelect.Get_pEventId()]			= &CNtlSobActor::SobTargetSelectEventHandler;
-	m_mapEventFunc[g_EventSobAttackSelect.Get_pEventId()]			= &CNtlSobActor::SobAttackSelectEventHandler;
-	m_mapEventFunc[g_EventSobTargetSelectRelease.Get_pEventId()]	= &CNtlSobActor::SobTargetSelectReleaseEventHandler;	
-    
-    // Proxy óϴ ̺Ʈ 
-    m_mapEventFunc[g_EventSobAttackMarkRelease.Get_pEventId()]		= &CNtlSobActor::SobProxyEventHandler;	
-    m_mapEventFunc[g_EventSobGotFocus.Get_pEventId()]				= &CNtlSobActor::SobProxyEventHandler;
-    m_mapEventFunc[g_EventSobLostFocus.Get_pEventId()]				= &CNtlSobActor::SobProxyEventHandler;    
-    m_mapEventFunc[g_EventShareTargetSelect.Get_pEventId()]         = &CNtlSobActor::SobProxyEventHandler;
-    m_mapEventFunc[g_EventShareTargetRelease.Get_pEventId()]        = &CNtlSobActor::SobProxyEventHandler;
-    m_mapEventFunc[g_EventTenkaichiMarking.Get_pEventId()]          = &CNtlSobActor::SobProxyEventHandler;
-    m_mapEventFunc[g_EventSobTargetMarkSelect.Get_pEventId()]       = &CNtlSobActor::SobProxyEventHandler;
-    m_mapEventFunc[g_EventSobTargetMarkRelease.Get_pEventId()]      = &CNtlSobActor::SobProxyEventHandler;
-    m_mapEventFunc[g_EventTransform.Get_pEventId()]                 = &CNtlSobActor::SobProxyEventHandler;    
-    m_mapEventFunc[g_EventMobTransform.Get_pEventId()]              = &CNtlSobActor::SobProxyEventHandler;
-    m_mapEventFunc[g_EventTransformCandy.Get_pEventId()]            = &CNtlSobActor::SobProxyEventHandler;
-    m_mapEventFunc[g_EventSobSkillAction.Get_pEventId()]            = &CNtlSobActor::SobProxyEventHandler;
-    m_mapEventFunc[g_EventSobSkillActioned.Get_pEventId()]            = &CNtlSobActor::SobProxyEventHandler;
-    m_mapEventFunc[g_EventAnimHit.Get_pEventId()]                   = &CNtlSobActor::SobProxyEventHandler;
-    
-
 	NTL_RETURN(TRUE);
 }
 
@@ -156,10 +160,10 @@ void CNtlSobActor::Update(RwReal fElapsed)
 
 void CNtlSobActor::HandleEvents(RWS::CMsg &pMsg)
 {
-	MapFuncEventHandler::iterator it = m_mapEventFunc.find( pMsg.Id );
-	if ( it != m_mapEventFunc.end() )
+	FuncEventHander pFunc = m_mapEventFunc.Find( pMsg.Id );
+	if ( pFunc )
 	{
-		(this->*(*it).second)( pMsg );
+		(this->*pFunc)( pMsg );
 	}
 
 	CNtlSob* pVehicleObj = GetNtlSobManager()->GetSobObject( GetVehicleID() );
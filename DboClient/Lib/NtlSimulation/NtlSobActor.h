@@ -37,8 +37,12 @@ protected:
 	RwReal				m_fHurtOverTime;
 
 	typedef void (CNtlSobActor::*FuncEventHander)(RWS::CMsg &pMsg);
-	typedef std::map<const RWS::CRegisteredMsgs*, FuncEventHander> MapFuncEventHandler;
-	MapFuncEventHandler m_mapEventFunc;
+	typedef RWS::CEventFuncTable<FuncEventHander> MapFuncEventHandler;
+	static MapFuncEventHandler m_mapEventFunc;
+
+public:
+
+	static void RegisterEventHandler(void);
 	
 protected:
 
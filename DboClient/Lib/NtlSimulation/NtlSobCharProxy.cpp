@@ -448,10 +448,10 @@ void CNtlSobCharProxy::Update(RwReal fElapsed)
 
 void CNtlSobCharProxy::HandleEvents(RWS::CMsg &pMsg)
 {
-	MapFuncEventHandler::iterator it = m_mapEventFunc.find(pMsg.Id);
-	if(it != m_mapEventFunc.end())
+	FuncEventHander pFunc = m_mapEventFunc.Find(pMsg.Id);
+	if(pFunc)
 	{
-		(this->*(*it).second)(pMsg);
+		(this->*pFunc)(pMsg);
 	}
 }	
 
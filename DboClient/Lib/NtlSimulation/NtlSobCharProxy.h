@@ -184,7 +184,7 @@ private:
 public:
 
 	typedef void (CNtlSobCharProxy::*FuncEventHander)(RWS::CMsg &pMsg);
-	typedef std::map<const RWS::CRegisteredMsgs*, FuncEventHander> MapFuncEventHandler;
+	typedef RWS::CEventFuncTable<FuncEventHander> MapFuncEventHandler;
 	static MapFuncEventHandler m_mapEventFunc;
 
 	static void RegisterEventHandler(void);
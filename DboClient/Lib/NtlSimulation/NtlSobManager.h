@@ -57,7 +57,7 @@ private:
 	MapSerialTrigger m_mapTriggerObject;
 
 	typedef void (CNtlSobManager::*FuncEventHander)(RWS::CMsg &pMsg);
-	typedef std::map<const RWS::CRegisteredMsgs*, FuncEventHander> MapFuncEventHandler;
+	typedef RWS::CEventFuncTable<FuncEventHander> MapFuncEventHandler;
 	MapFuncEventHandler m_mapEventFunc;
 
 	// Ư group visual proxy ó.
@@ -822,29 +822,19 @@ void CDirectApplication::CreateWorld(RwV3d& vAvatarPos, const RwChar *pWorldName
 	str += "\\";
 	str += "#######.gwp";
 
-	FILE* pFile = NULL;
-	RwUInt32 uiOffset, uiSize;
-
-	std::string strPackFileName = GetNtlResourcePackManager()->LoadTerrain(str.c_str(), uiOffset, uiSize);
-	
-	if(strPackFileName.size() > 0)
-	{
-		pFile = fopen(strPackFileName.c_str(), "rb");
-		if(pFile)
-			fseek(pFile, uiOffset, SEEK_SET);
-	}
-	else
+	CNtlPLPackStream WorldStream;
+	if(!GetNtlResourcePackManager()->LoadTerrain(str.c_str(), WorldStream))
 	{
 		std::string strWorldFileName = ".";
 		strWorldFileName += str;
-		pFile = fopen(strWorldFileName.c_str(), "rb");
+		WorldStream.OpenFile(strWorldFileName.c_str());
 	}
 	
 	// create a global world param
+	FILE* pFile = WorldStream.GetFile();
 	if(pFile)
 	{
 		LoadFileWorldState(dGET_WORLD_PARAM(), pFile);
-		fclose(pFile);
 	}
 
 	m_pWorldEntity = static_cast<CNtlPLWorldEntity*>(GetSceneManager()->CreateEntity(PLENTITY_WORLD, "NtlWorld"));
@@ -95,6 +95,7 @@ BEGIN_MESSAGE_MAP(CPackEditorDlg, CDialog)
     ON_BN_CLICKED(IDC_BTN_SCRIPT_EXPORT, &CPackEditorDlg::OnBnClickedBtnScriptExport)
     ON_BN_CLICKED(IDC_BTN_TABLE_EXPORT, &CPackEditorDlg::OnBnClickedBtnTableExport)
     ON_BN_CLICKED(IDC_BTN_PROPERTY_EXPORT, &CPackEditorDlg::OnBnClickedBtnPropertyExport)
+	ON_BN_CLICKED(IDC_CHECK_COMPRESS, &CPackEditorDlg::OnBnClickedCheckCompress)
 END_MESSAGE_MAP()
 
 
@@ -141,6 +142,8 @@ BOOL CPackEditorDlg::OnInitDialog()
 
 	GetNtlResourcePackManager()->LinkMakePackNotify(this, &CPackEditorDlg::MakePackNotify);
 
+	CheckDlgButton(IDC_CHECK_COMPRESS, GetNtlResourcePackManager()->IsCompressPack() ? BST_CHECKED : BST_UNCHECKED);
+
 	if(m_byPackUserLevel == PACK_USER_MASTER_ALL || m_byPackUserLevel == PACK_USER_MASTER_PACK)
 	{
 		GetDlgItem(IDC_BTN_TEXTURE_EXPORT)->EnableWindow(TRUE);
@@ -308,6 +311,7 @@ void CPackEditorDlg::EnableAll(void)
 		GetDlgItem(IDC_BTN_SCRIPT_EXPORT)->EnableWindow(TRUE);
 		GetDlgItem(IDC_BTN_TABLE_EXPORT)->EnableWindow(TRUE);
         GetDlgItem(IDC_BTN_PROPERTY_EXPORT)->EnableWindow(TRUE);
+		GetDlgItem(IDC_CHECK_COMPRESS)->EnableWindow(TRUE);
 	}
 	else
 	{
@@ -321,6 +325,7 @@ void CPackEditorDlg::EnableAll(void)
 		GetDlgItem(IDC_BTN_SCRIPT_EXPORT)->EnableWindow(FALSE);
 		GetDlgItem(IDC_BTN_TABLE_EXPORT)->EnableWindow(FALSE);
         GetDlgItem(IDC_BTN_PROPERTY_EXPORT)->EnableWindow(FALSE);
+		GetDlgItem(IDC_CHECK_COMPRESS)->EnableWindow(FALSE);
 	}
 
 	GetDlgItem(IDCANCEL)->EnableWindow(TRUE);
@@ -349,6 +354,7 @@ void CPackEditorDlg::DisableAll(void)
 	GetDlgItem(IDC_BTN_SCRIPT_EXPORT)->EnableWindow(FALSE);
 	GetDlgItem(IDC_BTN_TABLE_EXPORT)->EnableWindow(FALSE);
     GetDlgItem(IDC_BTN_PROPERTY_EXPORT)->EnableWindow(FALSE);
+	GetDlgItem(IDC_CHECK_COMPRESS)->EnableWindow(FALSE);
 	GetDlgItem(IDCANCEL)->EnableWindow(FALSE);
 	GetDlgItem(IDC_BTN_UNPACK)->EnableWindow(FALSE);
 
@@ -519,3 +525,8 @@ void CPackEditorDlg::OnBnClickedBtnPropertyExport()
 {
     ExportPack(NTL_PACK_TYPE_PROPERTY);
 }
+
+void CPackEditorDlg::OnBnClickedCheckCompress()
+{
+	GetNtlResourcePackManager()->SetCompressPack(IsDlgButtonChecked(IDC_CHECK_COMPRESS) == BST_CHECKED);
+}
@@ -90,4 +90,5 @@ public:
 	CStatic m_ctrlPackNotify;
 public:
     afx_msg void OnBnClickedBtnPropertyExport();
+	afx_msg void OnBnClickedCheckCompress();
 };
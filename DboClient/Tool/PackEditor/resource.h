@@ -39,6 +39,7 @@
 #define IDC_BTN_TABLE_EXPORT            1017
 #define IDC_BTN_TABLE_EXPORT2           1018
 #define IDC_BTN_PROPERTY_EXPORT         1018
+#define IDC_CHECK_COMPRESS              1019
 
 // Next default values for new objects
 // 
@@ -46,7 +47,7 @@
 #ifndef APSTUDIO_READONLY_SYMBOLS
 #define _APS_NEXT_RESOURCE_VALUE        132
 #define _APS_NEXT_COMMAND_VALUE         32771
-#define _APS_NEXT_CONTROL_VALUE         1017
+#define _APS_NEXT_CONTROL_VALUE         1020
 #define _APS_NEXT_SYMED_VALUE           101
 #endif
 #endif
@@ -579,6 +579,39 @@ void CTSDoc::OnEncryptionTrigger( void )
 	}
 }
 
+void CTSDoc::OnCompileTrigger( void )
+{
+	CFileDialog clFile( TRUE, NULL, NULL, OFN_HIDEREADONLY, "TS Encrypted files (*.e)|*.e||", NULL, 0 );
+	if ( IDOK != clFile.DoModal() ) return;
+
+	CString strPath = clFile.GetPathName();
+
+	// Ŭ̾Ʈ   ã ̸ ( <name>.tsb )  Ѵ
+	static char szDir[1024];
+	static char szPath[1024];
+	static char szName[1024];
+	_splitpath( strPath, szDir, szPath, szName, 0 );
+	CString strOutputName = szDir;
+	strOutputName += szPath;
+	strOutputName += szName;
+	strOutputName += ".tsb";
+
+	m_clTSMng.Create();
+
+	bool bResult = m_clTSMng.CompileScripts( strPath.GetString(), strOutputName.GetString() );
+
+	m_clTSMng.Delete();
+
+	if ( bResult )
+	{
+		AfxMessageBox( _T("Compiled. ") + strOutputName );
+	}
+	else
+	{
+		AfxMessageBox( _T("Compiling the triggers failed. ") + strPath );
+	}
+}
+
 void CTSDoc::OnExportEventor( void )
 {
 	CExportEventDlg clDlg;
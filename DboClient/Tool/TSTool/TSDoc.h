@@ -94,6 +94,7 @@ public:
 	void								OnExportTriggerAll( void );
 
 	void								OnEncryptionTrigger( void );
+	void								OnCompileTrigger( void );
 
 	void								OnExportEventor( void );
 
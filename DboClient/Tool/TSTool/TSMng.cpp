@@ -527,6 +527,11 @@ void CTSMng::DeleteTrigger( CNtlTSTrigger* pNTLTrigger )
 	m_pEntityFactory->DeleteObj( (CNtlTSScrObject*&)pNTLTrigger );
 }
 
+bool CTSMng::CompileScripts( const std::string& strFile, const std::string& strOutFile )
+{
+	return CompileTSCryptoData( strFile, strOutFile );
+}
+
 bool CTSMng::LoadLog( void )
 {
 	UnloadLog();
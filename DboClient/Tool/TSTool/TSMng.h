@@ -22,6 +22,9 @@ public:
 	CNtlTSTrigger*						CreateTrigger( CTSTrigger* pTSTrigger );
 	void								DeleteTrigger( CNtlTSTrigger* pNTLTrigger );
 
+	// ȣȭ TS  ( .e )  Ŭ̾Ʈ д compiled script  Ѵ
+	bool								CompileScripts( const std::string& strFile, const std::string& strOutFile );
+
 // Implementations
 protected:
 	virtual bool						LoadLog( void );
@@ -73,6 +73,8 @@ BEGIN_MESSAGE_MAP(CTSView, CScrollView)
 	ON_UPDATE_COMMAND_UI(ID_EXPORT_TREEGER_ALL, &CTSView::OnUpdateExportTriggerAll)
 	ON_COMMAND(ID_ENCRYTION, &CTSView::OnEncryptionTrigger)
 	ON_UPDATE_COMMAND_UI(ID_ENCRYTION, &CTSView::OnUpdateEncryptionTrigger)
+	ON_COMMAND(ID_COMPILE_TRIGGER, &CTSView::OnCompileTrigger)
+	ON_UPDATE_COMMAND_UI(ID_COMPILE_TRIGGER, &CTSView::OnUpdateCompileTrigger)
 	ON_COMMAND(ID_EXPORT_EVENTOR, &CTSView::OnExportEventor)
 	ON_UPDATE_COMMAND_UI(ID_EXPORT_EVENTOR, &CTSView::OnUpdateExportEventor)
 	ON_COMMAND(ID_CONT_SELECT, &CTSView::OnContSelect)
@@ -625,6 +627,16 @@ void CTSView::OnUpdateEncryptionTrigger( CCmdUI *pCmdUI )
 	pCmdUI->Enable( TRUE );
 }
 
+void CTSView::OnCompileTrigger( void )
+{
+	GetDocument()->OnCompileTrigger();
+}
+
+void CTSView::OnUpdateCompileTrigger( CCmdUI *pCmdUI )
+{
+	pCmdUI->Enable( TRUE );
+}
+
 void CTSView::OnExportEventor()
 {
 	GetDocument()->OnExportEventor();
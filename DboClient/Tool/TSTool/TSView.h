@@ -150,6 +150,8 @@ public:
 	afx_msg void						OnUpdateExportTriggerAll( CCmdUI *pCmdUI );
 	afx_msg void						OnEncryptionTrigger( void );
 	afx_msg void						OnUpdateEncryptionTrigger( CCmdUI *pCmdUI );
+	afx_msg void						OnCompileTrigger( void );
+	afx_msg void						OnUpdateCompileTrigger( CCmdUI *pCmdUI );
 	afx_msg void						OnExportEventor( void );
 	afx_msg void						OnUpdateExportEventor( CCmdUI *pCmdUI );
 
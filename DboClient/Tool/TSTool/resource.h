@@ -825,6 +825,7 @@
 #define ID_FINDER                       32847
 #define f                               32848
 #define ID_CONT_FINDER                  32849
+#define ID_COMPILE_TRIGGER              32850
 #define IDC_TS_ACT_ATTR_WORLDPLAYSCRIPT_SCRIPTID_STATIC 65535
 #define IDC_TS_ACT_ATTR_WORLDPLAYSCRIPT_SUB_GROUP 65535
 
@@ -833,7 +834,7 @@
 #ifdef APSTUDIO_INVOKED
 #ifndef APSTUDIO_READONLY_SYMBOLS
 #define _APS_NEXT_RESOURCE_VALUE        198
-#define _APS_NEXT_COMMAND_VALUE         32850
+#define _APS_NEXT_COMMAND_VALUE         32851
 #define _APS_NEXT_CONTROL_VALUE         1404
 #define _APS_NEXT_SYMED_VALUE           105
 #endif
@@ -66,19 +66,19 @@ void CDboTSActSToCEvt::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "etype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "etype" ) ) )
 	{
-		SetEvtType( (eSTOC_EVT_TYPE)clProperty.GetValueAsInt( "etype" ) );
+		SetEvtType( (eSTOC_EVT_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "etype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "apptype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "apptype" ) ) )
 	{
-        SetApplyTypeWorld(clProperty.GetValueAsInt( "apptype" ) ? true : false );
+        SetApplyTypeWorld(clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "apptype" ) ) ? true : false );
 	}
 
-	if ( clProperty.IsExist( "eitype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "eitype" ) ) )
 	{
-		SetEvtDataType( (eSTOC_EVT_DATA_TYPE)clProperty.GetValueAsInt( "eitype" ) );
+		SetEvtDataType( (eSTOC_EVT_DATA_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "eitype" ) ) );
 
 		uSTOC_EVT_DATA uEvtData;
 		memset( &uEvtData, 0xffffffff, sizeof( uEvtData ) );
@@ -87,122 +87,122 @@ void CDboTSActSToCEvt::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 		{
 		case eSTOC_EVT_DATA_TYPE_MOB_KILL_CNT:
 			{
-				uEvtData.sMobKillCnt[0].uiMobIdx = clProperty.GetValueAsInt( "idx0" );
-				uEvtData.sMobKillCnt[0].nMobCnt = clProperty.GetValueAsInt( "cnt0" );
+				uEvtData.sMobKillCnt[0].uiMobIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx0" ) );
+				uEvtData.sMobKillCnt[0].nMobCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cnt0" ) );
 				uEvtData.sMobKillCnt[0].nCurMobCnt = 0;
 
-				uEvtData.sMobKillCnt[1].uiMobIdx = clProperty.GetValueAsInt( "idx1" );
-				uEvtData.sMobKillCnt[1].nMobCnt = clProperty.GetValueAsInt( "cnt1" );
+				uEvtData.sMobKillCnt[1].uiMobIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx1" ) );
+				uEvtData.sMobKillCnt[1].nMobCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cnt1" ) );
 				uEvtData.sMobKillCnt[1].nCurMobCnt = 0;
 
-				uEvtData.sMobKillCnt[2].uiMobIdx = clProperty.GetValueAsInt( "idx2" );
-				uEvtData.sMobKillCnt[2].nMobCnt = clProperty.GetValueAsInt( "cnt2" );
+				uEvtData.sMobKillCnt[2].uiMobIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx2" ) );
+				uEvtData.sMobKillCnt[2].nMobCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cnt2" ) );
 				uEvtData.sMobKillCnt[2].nCurMobCnt = 0;
 			}
 			break;
 		case eSTOC_EVT_DATA_TYPE_MOB_KILL_ITEM_CNT:
 			{
-				uEvtData.sMobKillItemCnt[0].uiMobLIIdx = clProperty.GetValueAsInt( "idx0" );
-				uEvtData.sMobKillItemCnt[0].nMobLICnt = clProperty.GetValueAsInt( "cnt0" );
+				uEvtData.sMobKillItemCnt[0].uiMobLIIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx0" ) );
+				uEvtData.sMobKillItemCnt[0].nMobLICnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cnt0" ) );
 				uEvtData.sMobKillItemCnt[0].nCurMobLICnt = 0;
 
-				uEvtData.sMobKillItemCnt[1].uiMobLIIdx = clProperty.GetValueAsInt( "idx1" );
-				uEvtData.sMobKillItemCnt[1].nMobLICnt = clProperty.GetValueAsInt( "cnt1" );
+				uEvtData.sMobKillItemCnt[1].uiMobLIIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx1" ) );
+				uEvtData.sMobKillItemCnt[1].nMobLICnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cnt1" ) );
 				uEvtData.sMobKillItemCnt[1].nCurMobLICnt = 0;
 
-				uEvtData.sMobKillItemCnt[2].uiMobLIIdx = clProperty.GetValueAsInt( "idx2" );
-				uEvtData.sMobKillItemCnt[2].nMobLICnt = clProperty.GetValueAsInt( "cnt2" );
+				uEvtData.sMobKillItemCnt[2].uiMobLIIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx2" ) );
+				uEvtData.sMobKillItemCnt[2].nMobLICnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cnt2" ) );
 				uEvtData.sMobKillItemCnt[2].nCurMobLICnt = 0;
 			}
 			break;
 		case eSTOC_EVT_DATA_TYPE_DELIVERY_ITEM:
 			{
-				uEvtData.sDeliveryItemCnt[0].uiItemIdx = clProperty.GetValueAsInt( "idx0" );
-				uEvtData.sDeliveryItemCnt[0].nItemCnt = clProperty.GetValueAsInt( "cnt0" );
+				uEvtData.sDeliveryItemCnt[0].uiItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx0" ) );
+				uEvtData.sDeliveryItemCnt[0].nItemCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cnt0" ) );
 				uEvtData.sDeliveryItemCnt[0].nCurItemCnt = uEvtData.sDeliveryItemCnt[0].nItemCnt;
 
-				uEvtData.sDeliveryItemCnt[1].uiItemIdx = clProperty.GetValueAsInt( "idx1" );
-				uEvtData.sDeliveryItemCnt[1].nItemCnt = clProperty.GetValueAsInt( "cnt1" );
+				uEvtData.sDeliveryItemCnt[1].uiItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx1" ) );
+				uEvtData.sDeliveryItemCnt[1].nItemCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cnt1" ) );
 				uEvtData.sDeliveryItemCnt[1].nCurItemCnt = uEvtData.sDeliveryItemCnt[1].nItemCnt;
 
-				uEvtData.sDeliveryItemCnt[2].uiItemIdx = clProperty.GetValueAsInt( "idx2" );
-				uEvtData.sDeliveryItemCnt[2].nItemCnt = clProperty.GetValueAsInt( "cnt2" );
+				uEvtData.sDeliveryItemCnt[2].uiItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx2" ) );
+				uEvtData.sDeliveryItemCnt[2].nItemCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cnt2" ) );
 				uEvtData.sDeliveryItemCnt[2].nCurItemCnt = uEvtData.sDeliveryItemCnt[2].nItemCnt;
 			}
 			break;
 		case eSTOC_EVT_DATA_TYPE_OBJECT_ITEM:
 			{
-				uEvtData.sObjectItemCnt[0].uiItemIdx = clProperty.GetValueAsInt( "idx0" );
-				uEvtData.sObjectItemCnt[0].nItemCnt = clProperty.GetValueAsInt( "cnt0" );
+				uEvtData.sObjectItemCnt[0].uiItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx0" ) );
+				uEvtData.sObjectItemCnt[0].nItemCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cnt0" ) );
 				uEvtData.sObjectItemCnt[0].nCurItemCnt = 0;
 
-				uEvtData.sObjectItemCnt[1].uiItemIdx = clProperty.GetValueAsInt( "idx1" );
-				uEvtData.sObjectItemCnt[1].nItemCnt = clProperty.GetValueAsInt( "cnt1" );
+				uEvtData.sObjectItemCnt[1].uiItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx1" ) );
+				uEvtData.sObjectItemCnt[1].nItemCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cnt1" ) );
 				uEvtData.sObjectItemCnt[1].nCurItemCnt = 0;
 
-				uEvtData.sObjectItemCnt[2].uiItemIdx = clProperty.GetValueAsInt( "idx2" );
-				uEvtData.sObjectItemCnt[2].nItemCnt = clProperty.GetValueAsInt( "cnt2" );
+				uEvtData.sObjectItemCnt[2].uiItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx2" ) );
+				uEvtData.sObjectItemCnt[2].nItemCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cnt2" ) );
 				uEvtData.sObjectItemCnt[2].nCurItemCnt = 0;
 			}
 			break;
 		case eSTOC_EVT_DATA_TYPE_PUBLIC_MOB_ITEM_CNT:
 			{
-				uEvtData.sPublicMobItemCnt[0].uiItemIdx = clProperty.GetValueAsInt( "idx0" );
-				uEvtData.sPublicMobItemCnt[0].uiRequireItemIdx = clProperty.GetValueAsInt( "nidx0" );
-				uEvtData.sPublicMobItemCnt[0].fDropRate = (float)atof( clProperty.GetValue( "rate0" ).c_str() );
-				uEvtData.sPublicMobItemCnt[0].nItemCnt = clProperty.GetValueAsInt( "cnt0" );
+				uEvtData.sPublicMobItemCnt[0].uiItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx0" ) );
+				uEvtData.sPublicMobItemCnt[0].uiRequireItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "nidx0" ) );
+				uEvtData.sPublicMobItemCnt[0].fDropRate = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "rate0" ) );
+				uEvtData.sPublicMobItemCnt[0].nItemCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cnt0" ) );
 				uEvtData.sPublicMobItemCnt[0].nCurItemCnt = 0;
 			}
 			break;
 		case eSTOC_EVT_DATA_TYPE_CUSTOM_EVT_CNT:
 			{
-				uEvtData.sCustomEvtCnt[0].uiQTextTblIdx = clProperty.GetValueAsInt( "qtidx" );
-				uEvtData.sCustomEvtCnt[0].uiCustomEvtID = clProperty.GetValueAsInt( "idx0" );
-				uEvtData.sCustomEvtCnt[0].nMaxCnt = clProperty.GetValueAsInt( "cnt0" );
+				uEvtData.sCustomEvtCnt[0].uiQTextTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "qtidx" ) );
+				uEvtData.sCustomEvtCnt[0].uiCustomEvtID = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx0" ) );
+				uEvtData.sCustomEvtCnt[0].nMaxCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cnt0" ) );
 				uEvtData.sCustomEvtCnt[0].nCurCnt = 0;
 			}
 			break;
 		case eSTOC_EVT_DATA_TYPE_VISIT:
 			{
-				if ( clProperty.IsExist( "otype0" ) )
+				if ( clProperty.IsExist( NTL_TS_SCR_KEY( "otype0" ) ) )
 				{
 					uEvtData.sVisitEvt[0].bCompleted		= false;
-					uEvtData.sVisitEvt[0].byObjType			= (UCHAR)clProperty.GetValueAsInt( "otype0" );
-					uEvtData.sVisitEvt[0].uiWorldTblIdx		= clProperty.GetValueAsInt( "widx0" );
-					uEvtData.sVisitEvt[0].uiObjTblIdx		= clProperty.GetValueAsInt( "tidx0" );
-					uEvtData.sVisitEvt[0].uiIndicatorQText	= clProperty.GetValueAsInt( "it0" );
-					uEvtData.sVisitEvt[0].uiDialogText		= clProperty.GetValueAsInt( "dt0" );
-					uEvtData.sVisitEvt[0].uiItemTblIdx		= clProperty.GetValueAsInt( "iidx0" );
+					uEvtData.sVisitEvt[0].byObjType			= (UCHAR)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "otype0" ) );
+					uEvtData.sVisitEvt[0].uiWorldTblIdx		= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "widx0" ) );
+					uEvtData.sVisitEvt[0].uiObjTblIdx		= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tidx0" ) );
+					uEvtData.sVisitEvt[0].uiIndicatorQText	= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "it0" ) );
+					uEvtData.sVisitEvt[0].uiDialogText		= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "dt0" ) );
+					uEvtData.sVisitEvt[0].uiItemTblIdx		= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx0" ) );
 				}
 				else
 				{
 					uEvtData.sVisitEvt[0].bCompleted		= false;
 				}
 
-				if ( clProperty.IsExist( "otype1" ) )
+				if ( clProperty.IsExist( NTL_TS_SCR_KEY( "otype1" ) ) )
 				{
 					uEvtData.sVisitEvt[1].bCompleted		= false;
-					uEvtData.sVisitEvt[1].byObjType			= (UCHAR)clProperty.GetValueAsInt( "otype1" );
-					uEvtData.sVisitEvt[1].uiWorldTblIdx		= clProperty.GetValueAsInt( "widx1" );
-					uEvtData.sVisitEvt[1].uiObjTblIdx		= clProperty.GetValueAsInt( "tidx1" );
-					uEvtData.sVisitEvt[1].uiIndicatorQText	= clProperty.GetValueAsInt( "it1" );
-					uEvtData.sVisitEvt[1].uiDialogText		= clProperty.GetValueAsInt( "dt1" );
-					uEvtData.sVisitEvt[1].uiItemTblIdx		= clProperty.GetValueAsInt( "iidx1" );
+					uEvtData.sVisitEvt[1].byObjType			= (UCHAR)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "otype1" ) );
+					uEvtData.sVisitEvt[1].uiWorldTblIdx		= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "widx1" ) );
+					uEvtData.sVisitEvt[1].uiObjTblIdx		= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tidx1" ) );
+					uEvtData.sVisitEvt[1].uiIndicatorQText	= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "it1" ) );
+					uEvtData.sVisitEvt[1].uiDialogText		= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "dt1" ) );
+					uEvtData.sVisitEvt[1].uiItemTblIdx		= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx1" ) );
 				}
 				else
 				{
 					uEvtData.sVisitEvt[1].bCompleted		= false;
 				}
 
-				if ( clProperty.IsExist( "otype2" ) )
+				if ( clProperty.IsExist( NTL_TS_SCR_KEY( "otype2" ) ) )
 				{
 					uEvtData.sVisitEvt[2].bCompleted		= false;
-					uEvtData.sVisitEvt[2].byObjType			= (UCHAR)clProperty.GetValueAsInt( "otype2" );
-					uEvtData.sVisitEvt[2].uiWorldTblIdx		= clProperty.GetValueAsInt( "widx2" );
-					uEvtData.sVisitEvt[2].uiObjTblIdx		= clProperty.GetValueAsInt( "tidx2" );
-					uEvtData.sVisitEvt[2].uiIndicatorQText	= clProperty.GetValueAsInt( "it2" );
-					uEvtData.sVisitEvt[2].uiDialogText		= clProperty.GetValueAsInt( "dt2" );
-					uEvtData.sVisitEvt[2].uiItemTblIdx		= clProperty.GetValueAsInt( "iidx2" );
+					uEvtData.sVisitEvt[2].byObjType			= (UCHAR)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "otype2" ) );
+					uEvtData.sVisitEvt[2].uiWorldTblIdx		= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "widx2" ) );
+					uEvtData.sVisitEvt[2].uiObjTblIdx		= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tidx2" ) );
+					uEvtData.sVisitEvt[2].uiIndicatorQText	= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "it2" ) );
+					uEvtData.sVisitEvt[2].uiDialogText		= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "dt2" ) );
+					uEvtData.sVisitEvt[2].uiItemTblIdx		= clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx2" ) );
 				}
 				else
 				{
@@ -215,9 +215,9 @@ void CDboTSActSToCEvt::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 		SetEvtData( uEvtData );
 	}
 
-	if ( clProperty.IsExist( "ectype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ectype" ) ) )
 	{
-		SetEvtCondDataType( (eSTOC_EVT_COND_DATA_TYPE)clProperty.GetValueAsInt( "ectype" ) );
+		SetEvtCondDataType( (eSTOC_EVT_COND_DATA_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ectype" ) ) );
 
 		uSTOC_EVT_COND_DATA uEvtCondData;
 		memset( &uEvtCondData, 0xffffffff, sizeof( uEvtCondData ) );
@@ -226,23 +226,23 @@ void CDboTSActSToCEvt::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 		{
 		case eSTOC_EVT_COND_DATA_TYPE_AUTO_EQUIP_ITEM:
 			{
-				uEvtCondData.sAutoEquipItem[0].uiItemTblIdx = clProperty.GetValueAsInt( "cd0" );
+				uEvtCondData.sAutoEquipItem[0].uiItemTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cd0" ) );
 			}
 			break;
 		case eSTOC_EVT_COND_DATA_TYPE_EQUIP_ITEM:
 			{
-				uEvtCondData.sEquipItem[0].uiItemTblIdx = clProperty.GetValueAsInt( "cd0" );
+				uEvtCondData.sEquipItem[0].uiItemTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cd0" ) );
 			}
 			break;
 		case eSTOC_EVT_COND_DATA_TYPE_HAVE_ITEM:
 			{
-				uEvtCondData.sHaveItem[0].uiItemTblIdx = clProperty.GetValueAsInt( "cd0" );
+				uEvtCondData.sHaveItem[0].uiItemTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cd0" ) );
 			}
 			break;
 		case eSTOC_EVT_COND_DATA_TYPE_HAVE_QITEM:
 			{
-				uEvtCondData.sHaveQItem[0].uiQItemTblIdx = clProperty.GetValueAsInt( "cd0" );
-				uEvtCondData.sHaveQItem[0].nQITemCnt = clProperty.GetValueAsInt( "cd1" );
+				uEvtCondData.sHaveQItem[0].uiQItemTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cd0" ) );
+				uEvtCondData.sHaveQItem[0].nQITemCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cd1" ) );
 			}
 			break;
 		}
@@ -250,9 +250,9 @@ void CDboTSActSToCEvt::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 		SetEvtCondData( uEvtCondData );
 	}
 
-	if ( clProperty.IsExist( "esctype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "esctype" ) ) )
 	{
-		unsigned int uiEvtSubCondType = clProperty.GetValueAsInt( "esctype" );
+		unsigned int uiEvtSubCondType = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "esctype" ) );
 
 		SetEvtSubCondDataType( uiEvtSubCondType );
 
@@ -261,7 +261,7 @@ void CDboTSActSToCEvt::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 
 		if ( uiEvtSubCondType & eSTOC_EVT_SUB_COND_DATA_FLAG_LEVEL_DIFF_LESS )
 		{
-			sEvtSubCondData.sLevelDiffLess.nLevelDiff = clProperty.GetValueAsInt( "scd0" );
+			sEvtSubCondData.sLevelDiffLess.nLevelDiff = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "scd0" ) );
 		}
 
 		SetEvtSubCondData( sEvtSubCondData );
@@ -16,19 +16,19 @@ void CDboTSActBroadCast::ApplyScriptDataForScript( const CNtlTSScrProperty& clPr
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "npcidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "npcidx" ) ) )
 	{
-		SetNPCTableIndex( clProperty.GetValueAsInt( "npcidx" ) );
+		SetNPCTableIndex( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "npcidx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "msgtype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "msgtype" ) ) )
 	{
-		SetMessageType( clProperty.GetValueAsInt( "msgtype" ) );
+		SetMessageType( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "msgtype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "speechidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "speechidx" ) ) )
 	{
-		SetSpeechTableIndex( clProperty.GetValueAsInt( "speechidx" ) );
+		SetSpeechTableIndex( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "speechidx" ) ) );
 	}
 }
 
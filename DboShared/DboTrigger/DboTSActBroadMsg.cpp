@@ -28,45 +28,45 @@ void CDboTSActBroadMsg::ApplyScriptDataForScript( const CNtlTSScrProperty& clPro
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "et" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "et" ) ) )
 	{
-		m_eExcuteType = (eBROAD_MSG_EXCUTION_TYPE)clProperty.GetValueAsInt( "et" );
+		m_eExcuteType = (eBROAD_MSG_EXCUTION_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "et" ) );
 	}
-	if ( clProperty.IsExist( "uidt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "uidt" ) ) )
 	{
-		m_eUIDirType = (eBROAD_MSG_UI_DIR_TYPE)clProperty.GetValueAsInt( "uidt" );
+		m_eUIDirType = (eBROAD_MSG_UI_DIR_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "uidt" ) );
 	}
-	if ( clProperty.IsExist( "uisht" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "uisht" ) ) )
 	{
-		m_eUIShowHideDirType = (eBROAD_MSG_UI_SHOWHIDE_DIR_TYPE)clProperty.GetValueAsInt( "uisht" );
+		m_eUIShowHideDirType = (eBROAD_MSG_UI_SHOWHIDE_DIR_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "uisht" ) );
 	}
-	if ( clProperty.IsExist( "uibst" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "uibst" ) ) )
 	{
-		m_eUIBalloonShapeType = (eBROAD_MSG_UI_BALLOON_SHAPE_TYPE)clProperty.GetValueAsInt( "uibst" );
+		m_eUIBalloonShapeType = (eBROAD_MSG_UI_BALLOON_SHAPE_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "uibst" ) );
 	}
-	if ( clProperty.IsExist( "uisdt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "uisdt" ) ) )
 	{
-		m_eUISpeechDirType = (eBROAD_MSG_UI_SPEECH_DIR_TYPE)clProperty.GetValueAsInt( "uisdt" );
+		m_eUISpeechDirType = (eBROAD_MSG_UI_SPEECH_DIR_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "uisdt" ) );
 	}
-	if ( clProperty.IsExist( "oc" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "oc" ) ) )
 	{
-		m_eOwnerCondition = (eBROAD_MSG_OWNER_CONDITION)clProperty.GetValueAsInt( "oc" );
+		m_eOwnerCondition = (eBROAD_MSG_OWNER_CONDITION)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "oc" ) );
 	}
-	if ( clProperty.IsExist( "ot" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ot" ) ) )
 	{
-		m_eOwnerType = (eBROAD_MSG_OWNER_TYPE)clProperty.GetValueAsInt( "ot" );
+		m_eOwnerType = (eBROAD_MSG_OWNER_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ot" ) );
 	}
-	if ( clProperty.IsExist( "oidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "oidx" ) ) )
 	{
-		m_uiOwnerTblIdx = clProperty.GetValueAsInt( "oidx" );
+		m_uiOwnerTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "oidx" ) );
 	}
-	if ( clProperty.IsExist( "oqtidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "oqtidx" ) ) )
 	{
-		m_uiQTextTblIdx = clProperty.GetValueAsInt( "oqtidx" );
+		m_uiQTextTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "oqtidx" ) );
 	}
-	if ( clProperty.IsExist( "dt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "dt" ) ) )
 	{
-		m_uiDisplayTime = clProperty.GetValueAsInt( "dt" );
+		m_uiDisplayTime = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "dt" ) );
 	}
 }
 
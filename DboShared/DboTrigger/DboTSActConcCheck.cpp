@@ -38,24 +38,24 @@ void CDboTSActConcCheck::ApplyScriptDataForScript( const CNtlTSScrProperty& clPr
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "ccnt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ccnt" ) ) )
 	{
-		SetConcurrencyCnt( clProperty.GetValueAsInt( "ccnt" ) );
+		SetConcurrencyCnt( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ccnt" ) ) );
 	}
 
-	if ( clProperty.IsExist( "rtime" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "rtime" ) ) )
 	{
-		SetResetTime( clProperty.GetValueAsInt( "rtime" ) );
+		SetResetTime( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "rtime" ) ) );
 	}
 
-	if ( clProperty.IsExist( "eobjidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "eobjidx" ) ) )
 	{
-		SetExcuteObjTblIdx( clProperty.GetValueAsInt( "eobjidx" ) );
+		SetExcuteObjTblIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "eobjidx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "etsid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "etsid" ) ) )
 	{
-		SetExcuteTID( (NTL_TS_T_ID)clProperty.GetValueAsInt( "etsid" ) );
+		SetExcuteTID( (NTL_TS_T_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "etsid" ) ) );
 	}
 }
 
@@ -24,9 +24,9 @@ void CDboTSActCustomEvt::ApplyScriptDataForScript( const CNtlTSScrProperty& clPr
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "ceid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ceid" ) ) )
 	{
-		SetCustomEvtID( (unsigned int)clProperty.GetValueAsInt( "ceid" ) );
+		SetCustomEvtID( (unsigned int)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ceid" ) ) );
 	}
 }
 
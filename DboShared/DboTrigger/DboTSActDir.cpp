@@ -36,19 +36,19 @@ void CDboTSActDir::ApplyScriptDataForScript( const CNtlTSScrProperty& clProperty
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "rng" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "rng" ) ) )
 	{
-		SetRange( (float)atof( clProperty.GetValue( "rng" ).c_str() ) );
+		SetRange( clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "rng" ) ) );
 	}
 
-	if ( clProperty.IsExist( "type" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "type" ) ) )
 	{
-		SetDirectionType( (unsigned char)clProperty.GetValueAsInt( "type" ) );
+		SetDirectionType( (unsigned char)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "type" ) ) );
 	}
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetDirectionTblIdx( (unsigned int)clProperty.GetValueAsInt( "idx" ) );
+		SetDirectionTblIdx( (unsigned int)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 }
 
@@ -21,27 +21,27 @@ void CDboTSActDirIndicator::ApplyScriptDataForScript( const CNtlTSScrProperty& c
 
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "self" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "self" ) ) )
 	{
-		m_bSelfDirIndicator = B2b(clProperty.GetValueAsInt( "self" ));
+		m_bSelfDirIndicator = B2b(clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "self" ) ));
 	}
 	else
 	{
 		m_bSelfDirIndicator = false;
 	}
 
-	if ( clProperty.IsExist( "stype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "stype" ) ) )
 	{
-		m_bDirIndicatorStart = B2b(clProperty.GetValueAsInt( "stype" ));
+		m_bDirIndicatorStart = B2b(clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "stype" ) ));
 	}
 	else
 	{
 		m_bDirIndicatorStart = true;
 	}
 
-	if ( clProperty.IsExist( "dtype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "dtype" ) ) )
 	{
-		m_byDirType = (unsigned char)clProperty.GetValueAsInt( "dtype" );
+		m_byDirType = (unsigned char)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "dtype" ) );
 	}
 	else
 	{
@@ -52,9 +52,9 @@ void CDboTSActDirIndicator::ApplyScriptDataForScript( const CNtlTSScrProperty& c
 	{
 	case DIRECTION_INDICATE_TYPE_TOBJECT:
 		{
-			if ( clProperty.IsExist( "tblidx" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tblidx" ) ) )
 			{
-				m_uiData.sTObj.uiObjTblIdx = clProperty.GetValueAsInt( "tblidx" );
+				m_uiData.sTObj.uiObjTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tblidx" ) );
 			}
 			else
 			{
@@ -64,9 +64,9 @@ void CDboTSActDirIndicator::ApplyScriptDataForScript( const CNtlTSScrProperty& c
 		break;
 	case DIRECTION_INDICATE_TYPE_NPC:
 		{
-			if ( clProperty.IsExist( "tblidx" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tblidx" ) ) )
 			{
-				m_uiData.sNPC.uiNPCTblIdx = clProperty.GetValueAsInt( "tblidx" );
+				m_uiData.sNPC.uiNPCTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tblidx" ) );
 			}
 			else
 			{
@@ -76,27 +76,27 @@ void CDboTSActDirIndicator::ApplyScriptDataForScript( const CNtlTSScrProperty& c
 		break;
 	case DIRECTION_INDICATE_TYPE_POINT:
 		{
-			if ( clProperty.IsExist( "x" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "x" ) ) )
 			{
-				m_uiData.sPos.fX = (float)atof( clProperty.GetValue( "x" ).c_str() );
+				m_uiData.sPos.fX = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "x" ) );
 			}
 			else
 			{
 				m_uiData.sPos.fX = 0.f;
 			}
 
-			if ( clProperty.IsExist( "y" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "y" ) ) )
 			{
-				m_uiData.sPos.fY = (float)atof( clProperty.GetValue( "y" ).c_str() );
+				m_uiData.sPos.fY = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "y" ) );
 			}
 			else
 			{
 				m_uiData.sPos.fY = 0.f;
 			}
 
-			if ( clProperty.IsExist( "z" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "z" ) ) )
 			{
-				m_uiData.sPos.fZ = (float)atof( clProperty.GetValue( "z" ).c_str() );
+				m_uiData.sPos.fZ = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "z" ) );
 			}
 			else
 			{
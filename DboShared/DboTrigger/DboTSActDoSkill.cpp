@@ -24,9 +24,9 @@ void CDboTSActDoSkill::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetSkillIdx( (unsigned int)clProperty.GetValueAsInt( "idx" ) );
+		SetSkillIdx( (unsigned int)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 }
 
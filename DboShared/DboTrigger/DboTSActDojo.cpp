@@ -25,14 +25,14 @@ void CDboTSActDojo::ApplyScriptDataForScript( const CNtlTSScrProperty& clPropert
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "type" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "type" ) ) )
 	{
-		SetDungeonType( (eDOJO_DUNGEON_TYPE)atoi( clProperty.GetValue( "type" ).c_str() ) );
+		SetDungeonType( (eDOJO_DUNGEON_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "type" ) ) );
 	}
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetDojoTblIdx( atoi( clProperty.GetValue( "idx" ).c_str() ) );
+		SetDojoTblIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 }
 
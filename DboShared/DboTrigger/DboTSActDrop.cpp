@@ -25,14 +25,14 @@ void CDboTSActDrop::ApplyScriptDataForScript( const CNtlTSScrProperty& clPropert
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "ptype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ptype" ) ) )
 	{
-		SetPermissionType( (eQUEST_DROP_PERMISSION_TYPE)clProperty.GetValueAsInt( "ptype" ) );
+		SetPermissionType( (eQUEST_DROP_PERMISSION_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ptype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "tblidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tblidx" ) ) )
 	{
-		SetTableIndex( clProperty.GetValueAsInt( "tblidx" ) );
+		SetTableIndex( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tblidx" ) ) );
 	}
 }
 
@@ -30,14 +30,14 @@ void CDboTSActETimerE::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "tceid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tceid" ) ) )
 	{
-		SetTCId( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "tceid" ) );
+		SetTCId( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tceid" ) ) );
 	}
 
-	if ( clProperty.IsExist( "taeid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "taeid" ) ) )
 	{
-		SetTAId( (NTL_TS_TA_ID)clProperty.GetValueAsInt( "taeid" ) );
+		SetTAId( (NTL_TS_TA_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "taeid" ) ) );
 	}
 }
 
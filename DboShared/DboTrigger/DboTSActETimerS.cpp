@@ -36,19 +36,19 @@ void CDboTSActETimerS::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "sort" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "sort" ) ) )
 	{
-		SetTimerSort( (eEXCEPT_TIMER_SORT)clProperty.GetValueAsInt( "sort" ) );
+		SetTimerSort( (eEXCEPT_TIMER_SORT)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "sort" ) ) );
 	}
 
-	if ( clProperty.IsExist( "time" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "time" ) ) )
 	{
-		SetTime( clProperty.GetValueAsInt( "time" ) );
+		SetTime( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "time" ) ) );
 	}
 
-	if ( clProperty.IsExist( "tgid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tgid" ) ) )
 	{
-		SetTGId( (NTL_TS_TG_ID)clProperty.GetValueAsInt( "tgid" ) );
+		SetTGId( (NTL_TS_TG_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tgid" ) ) );
 	}
 }
 
@@ -17,24 +17,24 @@ void CDboTSActEscort::ApplyScriptDataForScript( const CNtlTSScrProperty& clPrope
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "start" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "start" ) ) )
 	{
-        SetEscortStart( clProperty.GetValueAsInt( "start" ) ? true : false);
+        SetEscortStart( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "start" ) ) ? true : false);
 	}
 
-	if ( clProperty.IsExist( "etype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "etype" ) ) )
 	{
-		SetEscortType( (eESCORT_TYPE)clProperty.GetValueAsInt( "etype" ) );
+		SetEscortType( (eESCORT_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "etype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "tsshare" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tsshare" ) ) )
 	{
-        SetTSShare(clProperty.GetValueAsInt( "tsshare" ) ? true : false);
+        SetTSShare(clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tsshare" ) ) ? true : false);
 	}
 
-	if ( clProperty.IsExist( "tblidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tblidx" ) ) )
 	{
-		SetNPCTableIndex( clProperty.GetValueAsInt( "tblidx" ) );
+		SetNPCTableIndex( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tblidx" ) ) );
 	}
 }
 
@@ -20,14 +20,14 @@ void CDboTSActExcCGroup::ApplyScriptDataForScript( const CNtlTSScrProperty& clPr
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "rtype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "rtype" ) ) )
 	{
-		m_bReg = clProperty.GetValueAsInt( "rtype" ) ? true : false;
+		m_bReg = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "rtype" ) ) ? true : false;
 	}
 
-	if ( clProperty.IsExist( "gid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "gid" ) ) )
 	{
-		m_tgExcCGID = (NTL_TS_TC_ID)clProperty.GetValueAsInt( "gid" );
+		m_tgExcCGID = (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "gid" ) );
 	}
 }
 
@@ -25,14 +25,14 @@ void CDboTSActHint::ApplyScriptDataForScript( const CNtlTSScrProperty& clPropert
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "type" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "type" ) ) )
 	{
-		SetHintType( clProperty.GetValueAsInt( "type" ) );
+		SetHintType( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "type" ) ) );
 	}
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetTableIndex( clProperty.GetValueAsInt( "idx" ) );
+		SetTableIndex( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 }
 
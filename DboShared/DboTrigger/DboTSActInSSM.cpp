@@ -30,14 +30,14 @@ void CDboTSActInSSM::ApplyScriptDataForScript( const CNtlTSScrProperty& clProper
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "ssmid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ssmid" ) ) )
 	{
-		SetSSMId( (eSSM_ID)clProperty.GetValueAsInt( "ssmid" ) );
+		SetSSMId( (eSSM_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ssmid" ) ) );
 	}
 
-	if ( clProperty.IsExist( "val" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "val" ) ) )
 	{
-		SetValue( clProperty.GetValueAsInt( "val" ) );
+		SetValue( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "val" ) ) );
 	}
 }
 
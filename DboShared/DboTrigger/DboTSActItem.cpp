@@ -34,25 +34,25 @@ void CDboTSActItem::ApplyScriptDataForScript( const CNtlTSScrProperty& clPropert
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "type" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "type" ) ) )
 	{
-		SetItemType( (eTSITEM_TYPE)clProperty.GetValueAsInt( "type" ) );
+		SetItemType( (eTSITEM_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "type" ) ) );
 	}
 
-	if ( clProperty.IsExist( "iidx0" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "iidx0" ) ) )
 	{
-		m_stItemInfo[0].eItemSlotType = (eTSITEM_SLOT_TYPE)clProperty.GetValueAsInt( "stype0" );
-		m_stItemInfo[0].uiItemIdx = clProperty.GetValueAsInt( "iidx0" );
+		m_stItemInfo[0].eItemSlotType = (eTSITEM_SLOT_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "stype0" ) );
+		m_stItemInfo[0].uiItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx0" ) );
 	}
-	if ( clProperty.IsExist( "iidx1" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "iidx1" ) ) )
 	{
-		m_stItemInfo[1].eItemSlotType = (eTSITEM_SLOT_TYPE)clProperty.GetValueAsInt( "stype1" );
-		m_stItemInfo[1].uiItemIdx = clProperty.GetValueAsInt( "iidx1" );
+		m_stItemInfo[1].eItemSlotType = (eTSITEM_SLOT_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "stype1" ) );
+		m_stItemInfo[1].uiItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx1" ) );
 	}
-	if ( clProperty.IsExist( "iidx2" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "iidx2" ) ) )
 	{
-		m_stItemInfo[2].eItemSlotType = (eTSITEM_SLOT_TYPE)clProperty.GetValueAsInt( "stype2" );
-		m_stItemInfo[2].uiItemIdx = clProperty.GetValueAsInt( "iidx2" );
+		m_stItemInfo[2].eItemSlotType = (eTSITEM_SLOT_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "stype2" ) );
+		m_stItemInfo[2].uiItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx2" ) );
 	}
 }
 
@@ -19,9 +19,9 @@ void CDboTSActMiniNarration::ApplyScriptDataForScript( const CNtlTSScrProperty&
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "tidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tidx" ) ) )
 	{
-		m_uiNarrationTblIdx = clProperty.GetValueAsInt( "tidx" );
+		m_uiNarrationTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tidx" ) );
 	}
 }
 
@@ -36,19 +36,19 @@ void CDboTSActNPCConv::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetNPCIdx( clProperty.GetValueAsInt( "idx" ) );
+		SetNPCIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "ctype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ctype" ) ) )
 	{
-		SetNPCConvType( (eNPCCONV_TYPE) clProperty.GetValueAsInt( "ctype" ) );
+		SetNPCConvType( (eNPCCONV_TYPE) clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ctype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "conv" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "conv" ) ) )
 	{
-		SetNPCConv( clProperty.GetValueAsInt( "conv" ) );
+		SetNPCConv( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "conv" ) ) );
 	}
 }
 
@@ -23,9 +23,9 @@ void CDboTSActOPCam::ApplyScriptDataForScript( const CNtlTSScrProperty& clProper
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "fname" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "fname" ) ) )
 	{
-		SetFuncName( clProperty.GetValue( "fname" ) );
+		SetFuncName( clProperty.GetValue( NTL_TS_SCR_KEY( "fname" ) ) );
 	}
 }
 
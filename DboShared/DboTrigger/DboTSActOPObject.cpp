@@ -31,19 +31,19 @@ void CDboTSActOPObject::ApplyScriptDataForScript( const CNtlTSScrProperty& clPro
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "apply" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "apply" ) ) )
 	{
-		SetApply( clProperty.GetValueAsInt( "apply" ) ? true : false );
+		SetApply( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "apply" ) ) ? true : false );
 	}
 
-	if ( clProperty.IsExist( "time" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "time" ) ) )
 	{
-		SetOperateTime( clProperty.GetValueAsInt( "time" ) );
+		SetOperateTime( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "time" ) ) );
 	}
 
-	if ( clProperty.IsExist( "tblidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tblidx" ) ) )
 	{
-		SetDirectionTableIndex( clProperty.GetValueAsInt( "tblidx" ) );
+		SetDirectionTableIndex( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tblidx" ) ) );
 	}
 }
 
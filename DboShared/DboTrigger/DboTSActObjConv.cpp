@@ -42,24 +42,24 @@ void CDboTSActObjConv::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "widx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "widx" ) ) )
 	{
-		SetWorldTblIdx( clProperty.GetValueAsInt( "widx" ) );
+		SetWorldTblIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "widx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetObjIdx( clProperty.GetValueAsInt( "idx" ) );
+		SetObjIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "ctype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ctype" ) ) )
 	{
-		SetObjConvType( (eOBJCONV_TYPE) clProperty.GetValueAsInt( "ctype" ) );
+		SetObjConvType( (eOBJCONV_TYPE) clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ctype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "conv" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "conv" ) ) )
 	{
-		SetObjConv( clProperty.GetValueAsInt( "conv" ) );
+		SetObjConv( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "conv" ) ) );
 	}
 }
 
@@ -48,24 +48,24 @@ void CDboTSActObjState::ApplyScriptDataForScript( const CNtlTSScrProperty& clPro
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "widx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "widx" ) ) )
 	{
-		SetWorldIdx( (unsigned int)clProperty.GetValueAsInt( "widx" ) );
+		SetWorldIdx( (unsigned int)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "widx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "oidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "oidx" ) ) )
 	{
-		SetObjectIdx( (unsigned int)clProperty.GetValueAsInt( "oidx" ) );
+		SetObjectIdx( (unsigned int)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "oidx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "mstate" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "mstate" ) ) )
 	{
-		SetObjectMainState( (eMAIN_STATE)clProperty.GetValueAsInt( "mstate" ) );
+		SetObjectMainState( (eMAIN_STATE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "mstate" ) ) );
 	}
 
-	if ( clProperty.IsExist( "osh" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "osh" ) ) )
 	{
-		unsigned char byVal = (unsigned char)clProperty.GetValueAsInt( "osh" );
+		unsigned char byVal = (unsigned char)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "osh" ) );
 
 		switch ( byVal )
 		{
@@ -83,14 +83,14 @@ void CDboTSActObjState::ApplyScriptDataForScript( const CNtlTSScrProperty& clPro
 		SetObjectCheckUncheck( eSUB_STATE_OBJECT_UC_IGNORE );
 	}
 
-	if ( clProperty.IsExist( "osh_sh" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "osh_sh" ) ) )
 	{
-		SetObjectShowHide( (eSUB_STATE_OBJECT_SH)clProperty.GetValueAsInt( "osh_sh" ) );
+		SetObjectShowHide( (eSUB_STATE_OBJECT_SH)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "osh_sh" ) ) );
 	}
 
-	if ( clProperty.IsExist( "osh_uc" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "osh_uc" ) ) )
 	{
-		SetObjectCheckUncheck( (eSUB_STATE_OBJECT_UC)clProperty.GetValueAsInt( "osh_uc" ) );
+		SetObjectCheckUncheck( (eSUB_STATE_OBJECT_UC)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "osh_uc" ) ) );
 	}
 }
 
@@ -24,9 +24,9 @@ void CDboTSActObjWPS::ApplyScriptDataForScript( const CNtlTSScrProperty& clPrope
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "sid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "sid" ) ) )
 	{
-		SetObjWPS( atoi( clProperty.GetValue( "sid" ).c_str() ) );
+		SetObjWPS( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "sid" ) ) );
 	}
 }
 
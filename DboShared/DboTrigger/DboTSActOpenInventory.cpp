@@ -19,9 +19,9 @@ void CDboTSActOpenInventory::ApplyScriptDataForScript( const CNtlTSScrProperty&
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "show" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "show" ) ) )
 	{
-		SetShow( (bool)clProperty.GetValueAsInt( "show" ) );
+		SetShow( (bool)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "show" ) ) );
 	}
 }
 
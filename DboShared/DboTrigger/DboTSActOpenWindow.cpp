@@ -31,19 +31,19 @@ void CDboTSActOpenWindow::ApplyScriptDataForScript( const CNtlTSScrProperty& clP
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "show" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "show" ) ) )
 	{
-		SetShow( clProperty.GetValueAsInt( "show" ) ? true : false );
+		SetShow( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "show" ) ) ? true : false );
 	}
 
-	if ( clProperty.IsExist( "wtype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "wtype" ) ) )
 	{
-		SetWindowType( (eWINDOW_TYPE)clProperty.GetValueAsInt( "wtype" ) );
+		SetWindowType( (eWINDOW_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "wtype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "tblidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tblidx" ) ) )
 	{
-		SetTableIdx( clProperty.GetValueAsInt( "tblidx" ) );
+		SetTableIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tblidx" ) ) );
 	}
 }
 
@@ -20,19 +20,19 @@ void CDboTSActOutMsg::ApplyScriptDataForScript(const CNtlTSScrProperty& clProper
 {
 	CNtlTSAction::ApplyScriptDataForScript(clProperty);
 
-	//if (clProperty.IsExist("rng"))
+	//if (clProperty.IsExist(NTL_TS_SCR_KEY( "rng" )))
 	//{
-	//	SetRange((float)atof(clProperty.GetValue("rng").c_str()));
+	//	SetRange((float)atof(clProperty.GetValue(NTL_TS_SCR_KEY( "rng" )).c_str()));
 	//}
 
-	//if (clProperty.IsExist("type"))
+	//if (clProperty.IsExist(NTL_TS_SCR_KEY( "type" )))
 	//{
-	//	SetDirectionType((unsigned char)clProperty.GetValueAsInt("type"));
+	//	SetDirectionType((unsigned char)clProperty.GetValueAsInt(NTL_TS_SCR_KEY( "type" )));
 	//}
 
-	//if (clProperty.IsExist("idx"))
+	//if (clProperty.IsExist(NTL_TS_SCR_KEY( "idx" )))
 	//{
-	//	SetDirectionTblIdx((unsigned int)clProperty.GetValueAsInt("idx"));
+	//	SetDirectionTblIdx((unsigned int)clProperty.GetValueAsInt(NTL_TS_SCR_KEY( "idx" )));
 	//}
 }
 
@@ -24,9 +24,9 @@ void CDboTSActPCConv::ApplyScriptDataForScript( const CNtlTSScrProperty& clPrope
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "tblidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tblidx" ) ) )
 	{
-		SetConvTblIdx( atoi( clProperty.GetValue( "tblidx" ).c_str() ) );
+		SetConvTblIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tblidx" ) ) );
 	}
 }
 
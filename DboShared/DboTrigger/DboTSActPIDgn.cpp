@@ -31,19 +31,19 @@ void CDboTSActPIDgn::ApplyScriptDataForScript( const CNtlTSScrProperty& clProper
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "type" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "type" ) ) )
 	{
-		SetDungeonType( (ePARTY_DUNGEON_TYPE)atoi( clProperty.GetValue( "type" ).c_str() ) );
+		SetDungeonType( (ePARTY_DUNGEON_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "type" ) ) );
 	}
 
-	if ( clProperty.IsExist( "nidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "nidx" ) ) )
 	{
-		SetNormalDungeonTblIdx( atoi( clProperty.GetValue( "nidx" ).c_str() ) );
+		SetNormalDungeonTblIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "nidx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "hidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "hidx" ) ) )
 	{
-		SetHardDungeonTblIdx( atoi( clProperty.GetValue( "hidx" ).c_str() ) );
+		SetHardDungeonTblIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "hidx" ) ) );
 	}
 }
 
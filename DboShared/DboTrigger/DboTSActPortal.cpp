@@ -42,31 +42,31 @@ void CDboTSActPortal::ApplyScriptDataForScript( const CNtlTSScrProperty& clPrope
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "type" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "type" ) ) )
 	{
-		SetPotalType( (ePORTAL_TYPE)clProperty.GetValueAsInt( "type" ) );
+		SetPotalType( (ePORTAL_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "type" ) ) );
 	}
 
-	if ( clProperty.IsExist( "widx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "widx" ) ) )
 	{
-		SetWorldIdx( clProperty.GetValueAsInt( "widx" ) );
+		SetWorldIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "widx" ) ) );
 	}
 
 	float fX = FLT_MAX;
 	float fY = FLT_MAX;
 	float fZ = FLT_MAX;
 
-	if ( clProperty.IsExist( "px" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "px" ) ) )
 	{
-		fX = (float)atof( clProperty.GetValue( "px" ).c_str() );
+		fX = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "px" ) );
 	}
-	if ( clProperty.IsExist( "py" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "py" ) ) )
 	{
-		fY = (float)atof( clProperty.GetValue( "py" ).c_str() );
+		fY = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "py" ) );
 	}
-	if ( clProperty.IsExist( "pz" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "pz" ) ) )
 	{
-		fZ = (float)atof( clProperty.GetValue( "pz" ).c_str() );
+		fZ = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "pz" ) );
 	}
 	SetPosition( fX, fY, fZ );
 
@@ -74,17 +74,17 @@ void CDboTSActPortal::ApplyScriptDataForScript( const CNtlTSScrProperty& clPrope
 	fY = FLT_MAX;
 	fZ = FLT_MAX;
 
-	if ( clProperty.IsExist( "dx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "dx" ) ) )
 	{
-		fX = (float)atof( clProperty.GetValue( "dx" ).c_str() );
+		fX = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "dx" ) );
 	}
-	if ( clProperty.IsExist( "dy" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "dy" ) ) )
 	{
-		fY = (float)atof( clProperty.GetValue( "dy" ).c_str() );
+		fY = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "dy" ) );
 	}
-	if ( clProperty.IsExist( "dz" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "dz" ) ) )
 	{
-		fZ = (float)atof( clProperty.GetValue( "dz" ).c_str() );
+		fZ = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "dz" ) );
 	}
 	SetDirection( fX, fY, fZ );
 }
@@ -35,28 +35,28 @@ void CDboTSActQItem::ApplyScriptDataForScript( const CNtlTSScrProperty& clProper
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "type" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "type" ) ) )
 	{
-		SetQItemType( (eQITEM_TYPE)clProperty.GetValueAsInt( "type" ) );
+		SetQItemType( (eQITEM_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "type" ) ) );
 	}
 
-	if ( clProperty.IsExist( "iidx0" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "iidx0" ) ) )
 	{
-		m_stQItemInfo[0].uiQItemIdx = clProperty.GetValueAsInt( "iidx0" );
-		m_stQItemInfo[0].nQItemCnt = clProperty.GetValueAsInt( "icnt0" );
-		m_stQItemInfo[0].fProbability = clProperty.IsExist( "iprob0" ) ? (float)atof( clProperty.GetValue( "iprob0" ).c_str() ) : 1.f;
+		m_stQItemInfo[0].uiQItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx0" ) );
+		m_stQItemInfo[0].nQItemCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "icnt0" ) );
+		m_stQItemInfo[0].fProbability = clProperty.IsExist( NTL_TS_SCR_KEY( "iprob0" ) ) ? clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "iprob0" ) ) : 1.f;
 	}
-	if ( clProperty.IsExist( "iidx1" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "iidx1" ) ) )
 	{
-		m_stQItemInfo[1].uiQItemIdx = clProperty.GetValueAsInt( "iidx1" );
-		m_stQItemInfo[1].nQItemCnt = clProperty.GetValueAsInt( "icnt1" );
-		m_stQItemInfo[1].fProbability = clProperty.IsExist( "iprob1" ) ? (float)atof( clProperty.GetValue( "iprob1" ).c_str() ) : 1.f;
+		m_stQItemInfo[1].uiQItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx1" ) );
+		m_stQItemInfo[1].nQItemCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "icnt1" ) );
+		m_stQItemInfo[1].fProbability = clProperty.IsExist( NTL_TS_SCR_KEY( "iprob1" ) ) ? clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "iprob1" ) ) : 1.f;
 	}
-	if ( clProperty.IsExist( "iidx2" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "iidx2" ) ) )
 	{
-		m_stQItemInfo[2].uiQItemIdx = clProperty.GetValueAsInt( "iidx2" );
-		m_stQItemInfo[2].nQItemCnt = clProperty.GetValueAsInt( "icnt2" );
-		m_stQItemInfo[2].fProbability = clProperty.IsExist( "iprob2" ) ? (float)atof( clProperty.GetValue( "iprob2" ).c_str() ) : 1.f;
+		m_stQItemInfo[2].uiQItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx2" ) );
+		m_stQItemInfo[2].nQItemCnt = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "icnt2" ) );
+		m_stQItemInfo[2].fProbability = clProperty.IsExist( NTL_TS_SCR_KEY( "iprob2" ) ) ? clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "iprob2" ) ) : 1.f;
 	}
 }
 
@@ -29,47 +29,47 @@ void CDboTSActRegCTiming::ApplyScriptDataForScript( const CNtlTSScrProperty& clP
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	m_bReg = clProperty.GetValueAsInt( "rtype" ) ? true : false;
+	m_bReg = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "rtype" ) ) ? true : false;
 
 	if ( m_bReg )
 	{
-		if ( clProperty.IsExist( "flags" ) )
+		if ( clProperty.IsExist( NTL_TS_SCR_KEY( "flags" ) ) )
 		{
-			m_uiTimingFlags = clProperty.GetValueAsInt( "flags" );
+			m_uiTimingFlags = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "flags" ) );
 		}
 		if ( m_uiTimingFlags & eREG_C_TIMING_MOB_CLICK_FLAG )
 		{
-			m_sMobClick.uiMobGroupIdx = clProperty.GetValueAsInt( "0_midx" );
+			m_sMobClick.uiMobGroupIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "0_midx" ) );
 		}
 		if ( m_uiTimingFlags & eREG_C_TIMING_NPC_CLICK_FLAG )
 		{
-			m_sNPCClick.uiNpcIdx = clProperty.GetValueAsInt( "1_nidx" );
+			m_sNPCClick.uiNpcIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "1_nidx" ) );
 		}
 		if ( m_uiTimingFlags & eREG_C_TIMING_OBJ_CLICK_FLAG )
 		{
-			m_sObjClick.uiWorldIdx = clProperty.GetValueAsInt( "2_widx" );
-			m_sObjClick.uiObjIdx = clProperty.GetValueAsInt( "2_oidx" );
+			m_sObjClick.uiWorldIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "2_widx" ) );
+			m_sObjClick.uiObjIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "2_oidx" ) );
 		}
 		if ( m_uiTimingFlags & eREG_C_TIMING_ENTER_RGN_FLAG )
 		{
-			m_sEnterRgn.uiWorldIdx  = clProperty.GetValueAsInt( "3_widx" );
-			m_sEnterRgn.fMinX = (float)atof( clProperty.GetValue( "3_minx" ).c_str() );
-			m_sEnterRgn.fMinZ = (float)atof( clProperty.GetValue( "3_minz" ).c_str() );
-			m_sEnterRgn.fMaxX = (float)atof( clProperty.GetValue( "3_maxx" ).c_str() );
-			m_sEnterRgn.fMaxZ = (float)atof( clProperty.GetValue( "3_maxz" ).c_str() );
+			m_sEnterRgn.uiWorldIdx  = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "3_widx" ) );
+			m_sEnterRgn.fMinX = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "3_minx" ) );
+			m_sEnterRgn.fMinZ = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "3_minz" ) );
+			m_sEnterRgn.fMaxX = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "3_maxx" ) );
+			m_sEnterRgn.fMaxZ = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "3_maxz" ) );
 		}
 		if ( m_uiTimingFlags & eREG_C_TIMING_GET_QITEM_FLAG )
 		{
-			m_sGetQItem.uiQItemIdx = clProperty.GetValueAsInt( "4_qidx" );
+			m_sGetQItem.uiQItemIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "4_qidx" ) );
 		}
 
-		if ( clProperty.IsExist( "etype" ) )
+		if ( clProperty.IsExist( NTL_TS_SCR_KEY( "etype" ) ) )
 		{
-			m_eExcuteType = (eREG_C_TIMING_EXCUTE_TYPE)clProperty.GetValueAsInt( "etype" );
+			m_eExcuteType = (eREG_C_TIMING_EXCUTE_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "etype" ) );
 		}
 		if ( m_eExcuteType == eREG_C_TIMING_EXCUTE_TYPE_MINI_NARRATION )
 		{
-			m_uExcuteData.sMiniNarration.uiTblIdx = clProperty.GetValueAsInt( "ntidx" );
+			m_uExcuteData.sMiniNarration.uiTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ntidx" ) );
 		}
 	}
 }
@@ -78,37 +78,37 @@ void CDboTSActRegQInfo::ApplyScriptDataForScript( const CNtlTSScrProperty& clPro
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "title" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "title" ) ) )
 	{
-		SetTitle( clProperty.GetValueAsInt( "title" ) );
+		SetTitle( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "title" ) ) );
 	}
 
-	if ( clProperty.IsExist( "area" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "area" ) ) )
 	{
-		SetArea( clProperty.GetValueAsInt( "area" ) );
+		SetArea( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "area" ) ) );
 	}
 
-	if ( clProperty.IsExist( "goal" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "goal" ) ) )
 	{
-		SetGoal( clProperty.GetValueAsInt( "goal" ) );
+		SetGoal( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "goal" ) ) );
 	}
 
-	if ( clProperty.IsExist( "grade" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "grade" ) ) )
 	{
-		SetGrade( clProperty.GetValueAsInt( "grade" ) );
+		SetGrade( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "grade" ) ) );
 	}
 
-	if ( clProperty.IsExist( "gtype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "gtype" ) ) )
 	{
-		SetGradeType( (eGRADE_TYPE)clProperty.GetValueAsInt( "gtype" ) );
+		SetGradeType( (eGRADE_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "gtype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "stype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "stype" ) ) )
 	{
 		// ũƮ eQUEST_SORT_TYPE ŸԵ Bit flag յǾ ǹǷ
 		// иؼ о鿩 Ѵ.
 		//  eQUEST_SORT_TYPE   ʴ  0 ̴
-		unsigned int uiSType = (unsigned int)clProperty.GetValueAsInt( "stype" );
+		unsigned int uiSType = (unsigned int)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "stype" ) );
 
 		eQUEST_SORT_TYPE eQuestSortType = eQUEST_SORT_TYPE_INVALID;
 
@@ -141,74 +141,74 @@ void CDboTSActRegQInfo::ApplyScriptDataForScript( const CNtlTSScrProperty& clPro
 		SetSortType( eQuestSortType );
 	}
 
-	if ( clProperty.IsExist( "sort" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "sort" ) ) )
 	{
-		SetSort( clProperty.GetValueAsInt( "sort" ) );
+		SetSort( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "sort" ) ) );
 	}
 
-	if ( clProperty.IsExist( "cont" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "cont" ) ) )
 	{
-		SetContents( clProperty.GetValueAsInt( "cont" ) );
+		SetContents( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cont" ) ) );
 	}
 
-	if ( clProperty.IsExist( "rwd" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "rwd" ) ) )
 	{
-		SetReward( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "rwd" ) );
+		SetReward( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "rwd" ) ) );
 	}
 
-	if ( clProperty.IsExist( "m0widx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "m0widx" ) ) )
 	{
-		m_sQuestMarkInfo[0].uiWorldTblIdx = clProperty.GetValueAsInt( "m0widx" );
+		m_sQuestMarkInfo[0].uiWorldTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "m0widx" ) );
 
-		m_sQuestMarkInfo[0].fX = (float)atof( clProperty.GetValue( "m0fx" ).c_str() );
-		m_sQuestMarkInfo[0].fY = (float)atof( clProperty.GetValue( "m0fy" ).c_str() );
-		m_sQuestMarkInfo[0].fZ = (float)atof( clProperty.GetValue( "m0fz" ).c_str() );
+		m_sQuestMarkInfo[0].fX = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "m0fx" ) );
+		m_sQuestMarkInfo[0].fY = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "m0fy" ) );
+		m_sQuestMarkInfo[0].fZ = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "m0fz" ) );
 
-		m_sQuestMarkInfo[0].uiTooltipIdx = clProperty.GetValueAsInt( "m0ttip" );
+		m_sQuestMarkInfo[0].uiTooltipIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "m0ttip" ) );
 	}
 
-	if ( clProperty.IsExist( "m1widx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "m1widx" ) ) )
 	{
-		m_sQuestMarkInfo[1].uiWorldTblIdx = clProperty.GetValueAsInt( "m1widx" );
+		m_sQuestMarkInfo[1].uiWorldTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "m1widx" ) );
 
-		m_sQuestMarkInfo[1].fX = (float)atof( clProperty.GetValue( "m1fx" ).c_str() );
-		m_sQuestMarkInfo[1].fY = (float)atof( clProperty.GetValue( "m1fy" ).c_str() );
-		m_sQuestMarkInfo[1].fZ = (float)atof( clProperty.GetValue( "m1fz" ).c_str() );
+		m_sQuestMarkInfo[1].fX = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "m1fx" ) );
+		m_sQuestMarkInfo[1].fY = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "m1fy" ) );
+		m_sQuestMarkInfo[1].fZ = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "m1fz" ) );
 
-		m_sQuestMarkInfo[1].uiTooltipIdx = clProperty.GetValueAsInt( "m1ttip" );
+		m_sQuestMarkInfo[1].uiTooltipIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "m1ttip" ) );
 	}
 
-	if ( clProperty.IsExist( "m2widx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "m2widx" ) ) )
 	{
-		m_sQuestMarkInfo[2].uiWorldTblIdx = clProperty.GetValueAsInt( "m2widx" );
+		m_sQuestMarkInfo[2].uiWorldTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "m2widx" ) );
 
-		m_sQuestMarkInfo[2].fX = (float)atof( clProperty.GetValue( "m2fx" ).c_str() );
-		m_sQuestMarkInfo[2].fY = (float)atof( clProperty.GetValue( "m2fy" ).c_str() );
-		m_sQuestMarkInfo[2].fZ = (float)atof( clProperty.GetValue( "m2fz" ).c_str() );
+		m_sQuestMarkInfo[2].fX = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "m2fx" ) );
+		m_sQuestMarkInfo[2].fY = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "m2fy" ) );
+		m_sQuestMarkInfo[2].fZ = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "m2fz" ) );
 
-		m_sQuestMarkInfo[2].uiTooltipIdx = clProperty.GetValueAsInt( "m2ttip" );
+		m_sQuestMarkInfo[2].uiTooltipIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "m2ttip" ) );
 	}
 
-	if (clProperty.IsExist("m3widx"))
+	if (clProperty.IsExist(NTL_TS_SCR_KEY( "m3widx" )))
 	{
-		m_sQuestMarkInfo[3].uiWorldTblIdx = clProperty.GetValueAsInt("m3widx");
+		m_sQuestMarkInfo[3].uiWorldTblIdx = clProperty.GetValueAsInt(NTL_TS_SCR_KEY( "m3widx" ));
 
-		m_sQuestMarkInfo[3].fX = (float)atof(clProperty.GetValue("m3fx").c_str());
-		m_sQuestMarkInfo[3].fY = (float)atof(clProperty.GetValue("m3fy").c_str());
-		m_sQuestMarkInfo[3].fZ = (float)atof(clProperty.GetValue("m3fz").c_str());
+		m_sQuestMarkInfo[3].fX = clProperty.GetValueAsFloat(NTL_TS_SCR_KEY( "m3fx" ));
+		m_sQuestMarkInfo[3].fY = clProperty.GetValueAsFloat(NTL_TS_SCR_KEY( "m3fy" ));
+		m_sQuestMarkInfo[3].fZ = clProperty.GetValueAsFloat(NTL_TS_SCR_KEY( "m3fz" ));
 
-		m_sQuestMarkInfo[3].uiTooltipIdx = clProperty.GetValueAsInt("m3ttip");
+		m_sQuestMarkInfo[3].uiTooltipIdx = clProperty.GetValueAsInt(NTL_TS_SCR_KEY( "m3ttip" ));
 	}
 
-	if (clProperty.IsExist("m4widx"))
+	if (clProperty.IsExist(NTL_TS_SCR_KEY( "m4widx" )))
 	{
-		m_sQuestMarkInfo[4].uiWorldTblIdx = clProperty.GetValueAsInt("m4widx");
+		m_sQuestMarkInfo[4].uiWorldTblIdx = clProperty.GetValueAsInt(NTL_TS_SCR_KEY( "m4widx" ));
 
-		m_sQuestMarkInfo[4].fX = (float)atof(clProperty.GetValue("m4fx").c_str());
-		m_sQuestMarkInfo[4].fY = (float)atof(clProperty.GetValue("m4fy").c_str());
-		m_sQuestMarkInfo[4].fZ = (float)atof(clProperty.GetValue("m4fz").c_str());
+		m_sQuestMarkInfo[4].fX = clProperty.GetValueAsFloat(NTL_TS_SCR_KEY( "m4fx" ));
+		m_sQuestMarkInfo[4].fY = clProperty.GetValueAsFloat(NTL_TS_SCR_KEY( "m4fy" ));
+		m_sQuestMarkInfo[4].fZ = clProperty.GetValueAsFloat(NTL_TS_SCR_KEY( "m4fz" ));
 
-		m_sQuestMarkInfo[4].uiTooltipIdx = clProperty.GetValueAsInt("m4ttip");
+		m_sQuestMarkInfo[4].uiTooltipIdx = clProperty.GetValueAsInt(NTL_TS_SCR_KEY( "m4ttip" ));
 	}
 }
 
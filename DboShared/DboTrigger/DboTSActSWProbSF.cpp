@@ -41,19 +41,19 @@ void CDboTSActSWProbSF::ApplyScriptDataForScript( const CNtlTSScrProperty& clPro
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "prob" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "prob" ) ) )
 	{
-		SetProbility( (float)atof( clProperty.GetValue( "prob" ).c_str() ) );
+		SetProbility( clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "prob" ) ) );
 	}
 
-	if ( clProperty.IsExist( "sbi" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "sbi" ) ) )
 	{
-		SetSuccessBID( clProperty.GetValueAsInt( "sbi" ) );
+		SetSuccessBID( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "sbi" ) ) );
 	}
 
-	if ( clProperty.IsExist( "fbi" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "fbi" ) ) )
 	{
-		SetFailBID( clProperty.GetValueAsInt( "fbi" ) );
+		SetFailBID( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "fbi" ) ) );
 	}
 }
 
@@ -49,34 +49,34 @@ void CDboTSActSendSvrEvt::ApplyScriptDataForScript( const CNtlTSScrProperty& clP
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "type" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "type" ) ) )
 	{
-		SetSvrEvtType( clProperty.GetValueAsInt( "type" ) );
+		SetSvrEvtType( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "type" ) ) );
 	}
 
-	if ( clProperty.IsExist( "ttype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ttype" ) ) )
 	{
-		SetSvrEvtTriggerType( (UCHAR)clProperty.GetValueAsInt( "ttype" ) );
+		SetSvrEvtTriggerType( (UCHAR)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ttype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "id" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "id" ) ) )
 	{
-		SetSvrEvtID( clProperty.GetValueAsInt( "id" ) );
+		SetSvrEvtID( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "id" ) ) );
 	}
 
-	if ( clProperty.IsExist( "tblidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tblidx" ) ) )
 	{
-		SetTblIdx( clProperty.GetValueAsInt( "tblidx" ) );
+		SetTblIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tblidx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "stype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "stype" ) ) )
 	{
-		SetEvtSendType( clProperty.GetValueAsInt( "stype" ) );
+		SetEvtSendType( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "stype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "stradius" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "stradius" ) ) )
 	{
-		SetEvtSendType_Radius( (float)atof( clProperty.GetValue( "stradius" ).c_str() ) );
+		SetEvtSendType_Radius( clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "stradius" ) ) );
 	}
 }
 
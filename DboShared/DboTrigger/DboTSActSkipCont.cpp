@@ -25,14 +25,14 @@ void CDboTSActSkipCont::ApplyScriptDataForScript( const CNtlTSScrProperty& clPro
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "stid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "stid" ) ) )
 	{
-		SetSkipQuestID( (NTL_TS_T_ID)clProperty.GetValueAsInt( "stid" ) );
+		SetSkipQuestID( (NTL_TS_T_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "stid" ) ) );
 	}
 
-	if ( clProperty.IsExist( "stcid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "stcid" ) ) )
 	{
-		SetSkipContID( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "stcid" ) );
+		SetSkipContID( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "stcid" ) ) );
 	}
 }
 
@@ -25,14 +25,14 @@ void CDboTSActTLQ::ApplyScriptDataForScript( const CNtlTSScrProperty& clProperty
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "type" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "type" ) ) )
 	{
-		SetDungeonType( (eTLQ_DUNGEON_TYPE)atoi( clProperty.GetValue( "type" ).c_str() ) );
+		SetDungeonType( (eTLQ_DUNGEON_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "type" ) ) );
 	}
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetDungeonTblIdx( atoi( clProperty.GetValue( "idx" ).c_str() ) );
+		SetDungeonTblIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 }
 
@@ -19,9 +19,9 @@ void CDboTSActTMQInfoShow::ApplyScriptDataForScript( const CNtlTSScrProperty& cl
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "itype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "itype" ) ) )
 	{
-		SetTMQInfoType( (eTIMEQUEST_INFORMATION_TYPE)clProperty.GetValueAsInt( "itype" ) );
+		SetTMQInfoType( (eTIMEQUEST_INFORMATION_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "itype" ) ) );
 	}
 }
 
@@ -19,9 +19,9 @@ void CDboTSActTMQStage::ApplyScriptDataForScript( const CNtlTSScrProperty& clPro
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "stage" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "stage" ) ) )
 	{
-		SetTMQStage( (unsigned char)clProperty.GetValueAsInt( "stage" ) );
+		SetTMQStage( (unsigned char)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "stage" ) ) );
 	}
 }
 
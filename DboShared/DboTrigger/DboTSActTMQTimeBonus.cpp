@@ -14,9 +14,9 @@ void CDboTSActTMQTimeBonus::ApplyScriptDataForScript( const CNtlTSScrProperty& c
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "bt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "bt" ) ) )
 	{
-		SetBonusTime( clProperty.GetValueAsInt( "bt" ) );
+		SetBonusTime( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "bt" ) ) );
 	}
 }
 
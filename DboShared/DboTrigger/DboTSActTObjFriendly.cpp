@@ -24,9 +24,9 @@ void CDboTSActTObjFriendly::ApplyScriptDataForScript( const CNtlTSScrProperty& c
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "flgs" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "flgs" ) ) )
 	{
-		SetFriendlyFlags( (unsigned int)clProperty.GetValueAsInt( "flgs" ) );
+		SetFriendlyFlags( (unsigned int)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "flgs" ) ) );
 	}
 }
 
@@ -30,14 +30,14 @@ void CDboTSActTSState::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "type" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "type" ) ) )
 	{
-		SetType( (eTSSTATE_TYPE)clProperty.GetValueAsInt( "type" ) );
+		SetType( (eTSSTATE_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "type" ) ) );
 	}
 
-	if ( clProperty.IsExist( "state" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "state" ) ) )
 	{
-		SetTSState( (unsigned short)clProperty.GetValueAsInt( "state" ) );
+		SetTSState( (unsigned short)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "state" ) ) );
 	}
 }
 
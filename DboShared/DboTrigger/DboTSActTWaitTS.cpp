@@ -24,9 +24,9 @@ void CDboTSActTWaitTS::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "time" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "time" ) ) )
 	{
-		SetWaitTime( clProperty.GetValueAsInt( "time" ) );
+		SetWaitTime( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "time" ) ) );
 	}
 }
 
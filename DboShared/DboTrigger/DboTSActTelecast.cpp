@@ -18,29 +18,29 @@ void CDboTSActTelecast::ApplyScriptDataForScript( const CNtlTSScrProperty& clPro
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "type" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "type" ) ) )
 	{
-		SetTelecastType( (eTSTELECAST_TYPE)clProperty.GetValueAsInt( "type" ) );
+		SetTelecastType( (eTSTELECAST_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "type" ) ) );
 	}
 
-	if ( clProperty.IsExist( "npcidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "npcidx" ) ) )
 	{
-		SetNPCTableIndex( clProperty.GetValueAsInt( "npcidx" ) );
+		SetNPCTableIndex( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "npcidx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "msgtype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "msgtype" ) ) )
 	{
-		SetMessageType((UCHAR)clProperty.GetValueAsInt( "msgtype" ) );
+		SetMessageType((UCHAR)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "msgtype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "speechidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "speechidx" ) ) )
 	{
-		SetSpeechTableIndex( clProperty.GetValueAsInt( "speechidx" ) );
+		SetSpeechTableIndex( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "speechidx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "dsptime" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "dsptime" ) ) )
 	{
-		SetDisplayTime( clProperty.GetValueAsInt( "dsptime" ) );
+		SetDisplayTime( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "dsptime" ) ) );
 	}
 }
 
@@ -31,19 +31,19 @@ void CDboTSActWorldPlayScript::ApplyScriptDataForScript( const CNtlTSScrProperty
 {
 	CNtlTSAction::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "start" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "start" ) ) )
 	{
-		SetStart( clProperty.GetValueAsInt( "start" ) ? true : false );
+		SetStart( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "start" ) ) ? true : false );
 	}
 
-	if ( clProperty.IsExist( "uof" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "uof" ) ) )
 	{
-		SetUserOutFailed( clProperty.GetValueAsInt( "uof" ) ? true : false );
+		SetUserOutFailed( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "uof" ) ) ? true : false );
 	}
 
-	if ( clProperty.IsExist( "sid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "sid" ) ) )
 	{
-		SetScriptID( clProperty.GetValueAsInt( "sid" ) );
+		SetScriptID( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "sid" ) ) );
 	}
 }
 
@@ -46,14 +46,14 @@ void CDboTSCheckAttachObj::ApplyScriptDataForScript( const CNtlTSScrProperty& cl
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "widx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "widx" ) ) )
 	{
-		SetWorldIdx( clProperty.GetValueAsInt( "widx" ) );
+		SetWorldIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "widx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "objidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "objidx" ) ) )
 	{
-		UnPackingObjectIdxList( clProperty.GetValue( "objidx" ), m_defObjIdxList );
+		UnPackingObjectIdxList( clProperty.GetValue( NTL_TS_SCR_KEY( "objidx" ) ), m_defObjIdxList );
 	}
 }
 
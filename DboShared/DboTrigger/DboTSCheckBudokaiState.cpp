@@ -89,13 +89,13 @@ void CDboTSCheckBudokaiState::ApplyScriptDataForScript( const CNtlTSScrProperty&
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "md" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "md" ) ) )
 	{
-		SetMode( (eTS_BUDOKAI_MODE)clProperty.GetValueAsInt( "md" ) );
+		SetMode( (eTS_BUDOKAI_MODE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "md" ) ) );
 	}
-	if ( clProperty.IsExist( "st" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "st" ) ) )
 	{
-		SetState( (eTS_BUDOKAI_STATE)clProperty.GetValueAsInt( "st" ) );
+		SetState( (eTS_BUDOKAI_STATE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "st" ) ) );
 	}
 }
 
@@ -95,14 +95,14 @@ void CDboTSCheckClrQst::ApplyScriptDataForScript( const CNtlTSScrProperty& clPro
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "and" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "and" ) ) )
 	{
-		SetAndIdList( clProperty.GetValue( "and" ) );
+		SetAndIdList( clProperty.GetValue( NTL_TS_SCR_KEY( "and" ) ) );
 	}
 
-	if ( clProperty.IsExist( "or" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "or" ) ) )
 	{
-		SetOrIdList( clProperty.GetValue( "or" ) );
+		SetOrIdList( clProperty.GetValue( NTL_TS_SCR_KEY( "or" ) ) );
 	}
 
 }
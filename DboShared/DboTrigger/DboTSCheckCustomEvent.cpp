@@ -24,9 +24,9 @@ void CDboTSCheckCustomEvent::ApplyScriptDataForScript( const CNtlTSScrProperty&
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "qid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "qid" ) ) )
 	{
-		SetQuestID((NTL_TS_T_ID)clProperty.GetValueAsInt( "qid" ) );
+		SetQuestID((NTL_TS_T_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "qid" ) ) );
 	}
 }
 
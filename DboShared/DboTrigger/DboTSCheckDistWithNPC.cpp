@@ -14,14 +14,14 @@ void CDboTSCheckDistWithNPC::ApplyScriptDataForScript( const CNtlTSScrProperty&
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "dist" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "dist" ) ) )
 	{
-		SetDistance((float)atof( clProperty.GetValue( "dist" ).c_str() ) );
+		SetDistance(clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "dist" ) ) );
 	}
 
-	if ( clProperty.IsExist( "idxlist" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idxlist" ) ) )
 	{
-		std::string strIndexList = clProperty.GetValue( "idxlist" );
+		std::string strIndexList = clProperty.GetValue( NTL_TS_SCR_KEY( "idxlist" ) );
 		SetNPCIndexList( strIndexList );
 	}
 }
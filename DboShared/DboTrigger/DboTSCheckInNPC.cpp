@@ -30,14 +30,14 @@ void CDboTSCheckInNPC::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetNPCIndex( clProperty.GetValueAsInt( "idx" ) );
+		SetNPCIndex( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "rad" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "rad" ) ) )
 	{
-		SetRadius( clProperty.GetValueAsInt( "rad" ) );
+		SetRadius( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "rad" ) ) );
 	}
 }
 
@@ -19,9 +19,9 @@ void CDboTSCheckInWorld::ApplyScriptDataForScript( const CNtlTSScrProperty& clPr
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "widx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "widx" ) ) )
 	{
-		SetWorldTblIdx( clProperty.GetValueAsInt( "widx" ) );
+		SetWorldTblIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "widx" ) ) );
 	}
 }
 
@@ -30,13 +30,13 @@ void CDboTSCheckItem::ApplyScriptDataForScript( const CNtlTSScrProperty& clPrope
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "iidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "iidx" ) ) )
 	{
-		SetItemIdx( clProperty.GetValueAsInt( "iidx" ) );
+		SetItemIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx" ) ) );
 	}
-	if ( clProperty.IsExist( "icnt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "icnt" ) ) )
 	{
-		SetItemCnt( clProperty.GetValueAsInt( "icnt" ) );
+		SetItemCnt( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "icnt" ) ) );
 	}
 }
 
@@ -30,14 +30,14 @@ void CDboTSCheckLvl::ApplyScriptDataForScript( const CNtlTSScrProperty& clProper
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "minlvl" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "minlvl" ) ) )
 	{
-		SetMinLvl( clProperty.GetValueAsInt( "minlvl" ) );
+		SetMinLvl( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "minlvl" ) ) );
 	}
 
-	if ( clProperty.IsExist( "maxlvl" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "maxlvl" ) ) )
 	{
-		SetMaxLvl( clProperty.GetValueAsInt( "maxlvl" ) );
+		SetMaxLvl( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "maxlvl" ) ) );
 	}
 }
 
@@ -13,9 +13,9 @@ void CDboTSCheckNPCDead::ApplyScriptDataForScript( const CNtlTSScrProperty& clPr
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "idxlist" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idxlist" ) ) )
 	{
-		std::string strIndexList = clProperty.GetValue( "idxlist" );
+		std::string strIndexList = clProperty.GetValue( NTL_TS_SCR_KEY( "idxlist" ) );
 		SetNPCIndexList( strIndexList );
 	}
 }
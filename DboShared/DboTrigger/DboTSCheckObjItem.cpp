@@ -24,9 +24,9 @@ void CDboTSCheckObjItem::ApplyScriptDataForScript( const CNtlTSScrProperty& clPr
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "tid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tid" ) ) )
 	{
-		SetQuestId( (NTL_TS_T_ID)clProperty.GetValueAsInt( "tid" ) );
+		SetQuestId( (NTL_TS_T_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tid" ) ) );
 	}
 }
 
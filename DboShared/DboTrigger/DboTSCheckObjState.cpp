@@ -42,24 +42,24 @@ void CDboTSCheckObjState::ApplyScriptDataForScript( const CNtlTSScrProperty& clP
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "widx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "widx" ) ) )
 	{
-		SetWorldIdx( (unsigned int)clProperty.GetValueAsInt( "widx" ) );
+		SetWorldIdx( (unsigned int)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "widx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "oidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "oidx" ) ) )
 	{
-		SetObjectIdx( (unsigned int)clProperty.GetValueAsInt( "oidx" ) );
+		SetObjectIdx( (unsigned int)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "oidx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "mstate" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "mstate" ) ) )
 	{
-		SetObjectMainState( (eMAIN_STATE)clProperty.GetValueAsInt( "mstate" ) );
+		SetObjectMainState( (eMAIN_STATE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "mstate" ) ) );
 	}
 
-	if ( clProperty.IsExist( "osh" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "osh" ) ) )
 	{
-		SetObjectShowHide( (eSUB_STATE_OBJECT)clProperty.GetValueAsInt( "osh" ) );
+		SetObjectShowHide( (eSUB_STATE_OBJECT)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "osh" ) ) );
 	}
 }
 
@@ -37,21 +37,21 @@ void CDboTSCheckOutRGN::ApplyScriptDataForScript( const CNtlTSScrProperty& clPro
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "widx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "widx" ) ) )
 	{
-		SetWorldTblIdx( clProperty.GetValueAsInt( "widx" ) );
+		SetWorldTblIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "widx" ) ) );
 	}
-	if ( clProperty.IsExist( "fx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "fx" ) ) )
 	{
-		SetPosX( (float)atof( clProperty.GetValue( "fx" ).c_str() ) );
+		SetPosX( clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "fx" ) ) );
 	}
-	if ( clProperty.IsExist( "fz" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "fz" ) ) )
 	{
-		SetPosZ( (float)atof( clProperty.GetValue( "fz" ).c_str() ) );
+		SetPosZ( clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "fz" ) ) );
 	}
-	if ( clProperty.IsExist( "fr" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "fr" ) ) )
 	{
-		SetRadius( (float)atof( clProperty.GetValue( "fr" ).c_str() ) );
+		SetRadius( clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "fr" ) ) );
 	}
 }
 
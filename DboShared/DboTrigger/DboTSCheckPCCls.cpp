@@ -24,9 +24,9 @@ void CDboTSCheckPCCls::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "clsflg" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "clsflg" ) ) )
 	{
-		SetClsFlags( clProperty.GetValueAsInt( "clsflg" ) );
+		SetClsFlags( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "clsflg" ) ) );
 	}
 }
 
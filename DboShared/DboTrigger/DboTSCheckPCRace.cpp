@@ -24,9 +24,9 @@ void CDboTSCheckPCRace::ApplyScriptDataForScript( const CNtlTSScrProperty& clPro
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "raceflg" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "raceflg" ) ) )
 	{
-		SetRaceFlags( clProperty.GetValueAsInt( "raceflg" ) );
+		SetRaceFlags( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "raceflg" ) ) );
 	}
 }
 
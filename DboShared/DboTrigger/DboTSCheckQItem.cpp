@@ -36,19 +36,19 @@ void CDboTSCheckQItem::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "ct" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ct" ) ) )
 	{
-		SetCheckType( (eQUEST_ITEM_CHECK_TYPE)clProperty.GetValueAsInt( "ct" ) );
+		SetCheckType( (eQUEST_ITEM_CHECK_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ct" ) ) );
 	}
 
-	if ( clProperty.IsExist( "iidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "iidx" ) ) )
 	{
-		SetItemIdx( clProperty.GetValueAsInt( "iidx" ) );
+		SetItemIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "icnt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "icnt" ) ) )
 	{
-		SetItemCnt( clProperty.GetValueAsInt( "icnt" ) );
+		SetItemCnt( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "icnt" ) ) );
 	}
 }
 
@@ -30,14 +30,14 @@ void CDboTSCheckReputation::ApplyScriptDataForScript( const CNtlTSScrProperty& c
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "minrt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "minrt" ) ) )
 	{
-		SetMinReputation( clProperty.GetValueAsInt( "minrt" ) );
+		SetMinReputation( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "minrt" ) ) );
 	}
 
-	if ( clProperty.IsExist( "maxrt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "maxrt" ) ) )
 	{
-		SetMaxReputation( clProperty.GetValueAsInt( "maxrt" ) );
+		SetMaxReputation( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "maxrt" ) ) );
 	}
 }
 
@@ -36,19 +36,19 @@ void CDboTSCheckSSM::ApplyScriptDataForScript( const CNtlTSScrProperty& clProper
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "op" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "op" ) ) )
 	{
-		SetOPType( (eSSM_OP_TYPE)clProperty.GetValueAsInt( "op" ) );
+		SetOPType( (eSSM_OP_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "op" ) ) );
 	}
 
-	if ( clProperty.IsExist( "ssmid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ssmid" ) ) )
 	{
-		SetSSMId( (eSSM_ID)clProperty.GetValueAsInt( "ssmid" ) );
+		SetSSMId( (eSSM_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ssmid" ) ) );
 	}
 
-	if ( clProperty.IsExist( "var" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "var" ) ) )
 	{
-		SetVariable( clProperty.GetValueAsInt( "var" ) );
+		SetVariable( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "var" ) ) );
 	}
 }
 
@@ -45,31 +45,31 @@ void CDboTSCheckSToCDelivery::ApplyScriptDataForScript( const CNtlTSScrProperty&
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "iidx0" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "iidx0" ) ) )
 	{
-		m_uiItemIdx[0] = clProperty.GetValueAsInt( "iidx0" );
+		m_uiItemIdx[0] = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx0" ) );
 	}
-	if ( clProperty.IsExist( "icnt0" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "icnt0" ) ) )
 	{
-		m_nItemCnt[0] = clProperty.GetValueAsInt( "icnt0" );
+		m_nItemCnt[0] = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "icnt0" ) );
 	}
 
-	if ( clProperty.IsExist( "iidx1" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "iidx1" ) ) )
 	{
-		m_uiItemIdx[1] = clProperty.GetValueAsInt( "iidx1" );
+		m_uiItemIdx[1] = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx1" ) );
 	}
-	if ( clProperty.IsExist( "icnt1" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "icnt1" ) ) )
 	{
-		m_nItemCnt[1] = clProperty.GetValueAsInt( "icnt1" );
+		m_nItemCnt[1] = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "icnt1" ) );
 	}
 
-	if ( clProperty.IsExist( "iidx2" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "iidx2" ) ) )
 	{
-		m_uiItemIdx[2] = clProperty.GetValueAsInt( "iidx2" );
+		m_uiItemIdx[2] = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx2" ) );
 	}
-	if ( clProperty.IsExist( "icnt2" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "icnt2" ) ) )
 	{
-		m_nItemCnt[2] = clProperty.GetValueAsInt( "icnt2" );
+		m_nItemCnt[2] = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "icnt2" ) );
 	}
 }
 
@@ -24,9 +24,9 @@ void CDboTSCheckSToCEvt::ApplyScriptDataForScript( const CNtlTSScrProperty& clPr
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "itype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "itype" ) ) )
 	{
-		SetSToCEvtDataType( (eSTOC_EVT_DATA_TYPE)clProperty.GetValueAsInt( "itype" ) );
+		SetSToCEvtDataType( (eSTOC_EVT_DATA_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "itype" ) ) );
 	}
 }
 
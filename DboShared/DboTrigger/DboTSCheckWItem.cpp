@@ -24,9 +24,9 @@ void CDboTSCheckWItem::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 {
 	CNtlTSCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "iidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "iidx" ) ) )
 	{
-		SetItemIdx( clProperty.GetValueAsInt( "iidx" ) );
+		SetItemIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "iidx" ) ) );
 	}
 }
 
@@ -24,9 +24,9 @@ void CDboTSClickMob::ApplyScriptDataForScript( const CNtlTSScrProperty& clProper
 {
 	CNtlTSEvent::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "mgidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "mgidx" ) ) )
 	{
-		SetMobGroupIdx( clProperty.GetValueAsInt( "mgidx" ) );
+		SetMobGroupIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "mgidx" ) ) );
 	}
 }
 
@@ -24,9 +24,9 @@ void CDboTSClickNPC::ApplyScriptDataForScript( const CNtlTSScrProperty& clProper
 {
 	CNtlTSEvent::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "npcidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "npcidx" ) ) )
 	{
-		SetNPCIdx( clProperty.GetValueAsInt( "npcidx" ) );
+		SetNPCIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "npcidx" ) ) );
 	}
 }
 
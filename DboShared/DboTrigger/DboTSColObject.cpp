@@ -51,14 +51,14 @@ void CDboTSColObject::ApplyScriptDataForScript( const CNtlTSScrProperty& clPrope
 {
 	CNtlTSEvent::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "widx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "widx" ) ) )
 	{
-		SetWorldIdx( clProperty.GetValueAsInt( "widx" ) );
+		SetWorldIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "widx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "objidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "objidx" ) ) )
 	{
-		UnPackingObjectIdxList( clProperty.GetValue( "objidx" ), m_defObjIdxList );
+		UnPackingObjectIdxList( clProperty.GetValue( NTL_TS_SCR_KEY( "objidx" ) ), m_defObjIdxList );
 	}
 }
 
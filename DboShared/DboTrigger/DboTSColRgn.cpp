@@ -163,46 +163,46 @@ void CDboTSColRgn::ApplyScriptDataForScript( const CNtlTSScrProperty& clProperty
 {
 	CNtlTSEvent::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "widx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "widx" ) ) )
 	{
-		m_uiWorldTblIdx = clProperty.GetValueAsInt( "widx" );
+		m_uiWorldTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "widx" ) );
 	}
 
-	if ( clProperty.IsExist( "cct" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "cct" ) ) )
 	{
-		m_uiColCheckType = clProperty.GetValueAsInt( "cct" );
+		m_uiColCheckType = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cct" ) );
 	}
 
-	if ( clProperty.IsExist( "crt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "crt" ) ) )
 	{
-		m_eColRgnType = (eEVENT_COL_RGN_TYPE)clProperty.GetValueAsInt( "crt" );
+		m_eColRgnType = (eEVENT_COL_RGN_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "crt" ) );
 	}
 
 	switch ( m_eColRgnType )
 	{
 	case eEVENT_COL_RGN_TYPE_RADIUS:
 		{
-			if ( clProperty.IsExist( "x" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "x" ) ) )
 			{
-				m_uColRngData.sRadius.x = (float)atof( clProperty.GetValue( "x" ).c_str() );
+				m_uColRngData.sRadius.x = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "x" ) );
 			}
 			else
 			{
 				m_uColRngData.sRadius.x = FLT_MAX;
 			}
 
-			if ( clProperty.IsExist( "z" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "z" ) ) )
 			{
-				m_uColRngData.sRadius.z = (float)atof( clProperty.GetValue( "z" ).c_str() );
+				m_uColRngData.sRadius.z = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "z" ) );
 			}
 			else
 			{
 				m_uColRngData.sRadius.z = FLT_MAX;
 			}
 
-			if ( clProperty.IsExist( "r" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "r" ) ) )
 			{
-				m_uColRngData.sRadius.r = (float)atof( clProperty.GetValue( "r" ).c_str() );
+				m_uColRngData.sRadius.r = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "r" ) );
 			}
 			else
 			{
@@ -213,72 +213,72 @@ void CDboTSColRgn::ApplyScriptDataForScript( const CNtlTSScrProperty& clProperty
 
 	case eEVENT_COL_RGN_TYPE_RECTANGLE:
 		{
-			if ( clProperty.IsExist( "x0" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "x0" ) ) )
 			{
-				m_uColRngData.sRectangle.x[0] = (float)atof( clProperty.GetValue( "x0" ).c_str() );
+				m_uColRngData.sRectangle.x[0] = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "x0" ) );
 			}
 			else
 			{
 				m_uColRngData.sRectangle.x[0] = FLT_MAX;
 			}
 
-			if ( clProperty.IsExist( "z0" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "z0" ) ) )
 			{
-				m_uColRngData.sRectangle.z[0] = (float)atof( clProperty.GetValue( "z0" ).c_str() );
+				m_uColRngData.sRectangle.z[0] = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "z0" ) );
 			}
 			else
 			{
 				m_uColRngData.sRectangle.z[0] = FLT_MAX;
 			}
 
-			if ( clProperty.IsExist( "x1" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "x1" ) ) )
 			{
-				m_uColRngData.sRectangle.x[1] = (float)atof( clProperty.GetValue( "x1" ).c_str() );
+				m_uColRngData.sRectangle.x[1] = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "x1" ) );
 			}
 			else
 			{
 				m_uColRngData.sRectangle.x[1] = FLT_MAX;
 			}
 
-			if ( clProperty.IsExist( "z1" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "z1" ) ) )
 			{
-				m_uColRngData.sRectangle.z[1] = (float)atof( clProperty.GetValue( "z1" ).c_str() );
+				m_uColRngData.sRectangle.z[1] = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "z1" ) );
 			}
 			else
 			{
 				m_uColRngData.sRectangle.z[1] = FLT_MAX;
 			}
 
-			if ( clProperty.IsExist( "x2" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "x2" ) ) )
 			{
-				m_uColRngData.sRectangle.x[2] = (float)atof( clProperty.GetValue( "x2" ).c_str() );
+				m_uColRngData.sRectangle.x[2] = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "x2" ) );
 			}
 			else
 			{
 				m_uColRngData.sRectangle.x[2] = FLT_MAX;
 			}
 
-			if ( clProperty.IsExist( "z2" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "z2" ) ) )
 			{
-				m_uColRngData.sRectangle.z[2] = (float)atof( clProperty.GetValue( "z2" ).c_str() );
+				m_uColRngData.sRectangle.z[2] = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "z2" ) );
 			}
 			else
 			{
 				m_uColRngData.sRectangle.z[2] = FLT_MAX;
 			}
 
-			if ( clProperty.IsExist( "x3" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "x3" ) ) )
 			{
-				m_uColRngData.sRectangle.x[3] = (float)atof( clProperty.GetValue( "x3" ).c_str() );
+				m_uColRngData.sRectangle.x[3] = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "x3" ) );
 			}
 			else
 			{
 				m_uColRngData.sRectangle.x[3] = FLT_MAX;
 			}
 
-			if ( clProperty.IsExist( "z3" ) )
+			if ( clProperty.IsExist( NTL_TS_SCR_KEY( "z3" ) ) )
 			{
-				m_uColRngData.sRectangle.z[3] = (float)atof( clProperty.GetValue( "z3" ).c_str() );
+				m_uColRngData.sRectangle.z[3] = clProperty.GetValueAsFloat( NTL_TS_SCR_KEY( "z3" ) );
 			}
 			else
 			{
@@ -24,9 +24,9 @@ void CDboTSContEnd::ApplyScriptDataForScript( const CNtlTSScrProperty& clPropert
 {
 	CNtlTSCont::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "type" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "type" ) ) )
 	{
-		SetEndType( (eEND_TYPE)clProperty.GetValueAsInt( "type" ) );
+		SetEndType( (eEND_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "type" ) ) );
 	}
 }
 
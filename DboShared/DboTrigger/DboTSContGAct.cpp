@@ -56,14 +56,14 @@ void CDboTSContGAct::ApplyScriptDataForScript( const CNtlTSScrProperty& clProper
 {
 	CNtlTSCont::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "nextlnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "nextlnk" ) ) )
 	{
-		AttachNextLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "nextlnk" ) );
+		AttachNextLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "nextlnk" ) ) );
 	}
 
-	if ( clProperty.IsExist( "elnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "elnk" ) ) )
 	{
-		AttachErrorLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "elnk" ) );
+		AttachErrorLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "elnk" ) ) );
 	}
 }
 
@@ -62,19 +62,19 @@ void CDboTSContGCond::ApplyScriptDataForScript( const CNtlTSScrProperty& clPrope
 {
 	CNtlTSCont::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "yeslnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "yeslnk" ) ) )
 	{
-		AttachYesLinkID( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "yeslnk" ) );
+		AttachYesLinkID( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "yeslnk" ) ) );
 	}
 
-	if ( clProperty.IsExist( "nolnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "nolnk" ) ) )
 	{
-		AttachNoLinkID( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "nolnk" ) );
+		AttachNoLinkID( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "nolnk" ) ) );
 	}
 
-	if ( clProperty.IsExist( "rm" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "rm" ) ) )
 	{
-		SetRewardMark( clProperty.GetValueAsInt( "rm" ) ? true : false );
+		SetRewardMark( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "rm" ) ) ? true : false );
 	}
 }
 
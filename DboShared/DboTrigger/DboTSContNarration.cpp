@@ -85,59 +85,59 @@ void CDboTSContNarration::ApplyScriptDataForScript( const CNtlTSScrProperty& clP
 {
 	CNtlTSCont::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "pt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "pt" ) ) )
 	{
-		SetProgressState( (eNARRATION_PROGRESS_STATE)clProperty.GetValueAsInt( "pt" ) );
+		SetProgressState( (eNARRATION_PROGRESS_STATE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "pt" ) ) );
 	}
 
-	if ( clProperty.IsExist( "ot" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ot" ) ) )
 	{
-		SetOwnerType( (eNARRATION_OWNER_TYPE)clProperty.GetValueAsInt( "ot" ) );
+		SetOwnerType( (eNARRATION_OWNER_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ot" ) ) );
 	}
 
-	if ( clProperty.IsExist( "oi" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "oi" ) ) )
 	{
-		SetOwnerIdx( clProperty.GetValueAsInt( "oi" ) );
+		SetOwnerIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "oi" ) ) );
 	}
 
-	if ( clProperty.IsExist( "os" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "os" ) ) )
 	{
-		SetOwnerState( (eNARRATION_OWNER_STATE)clProperty.GetValueAsInt( "os" ) );
+		SetOwnerState( (eNARRATION_OWNER_STATE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "os" ) ) );
 	}
 
-	if ( clProperty.IsExist( "dt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "dt" ) ) )
 	{
-		SetDialogDirType( (eNARRATION_DIALOG_DIR_TYPE)clProperty.GetValueAsInt( "dt" ) );
+		SetDialogDirType( (eNARRATION_DIALOG_DIR_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "dt" ) ) );
 	}
 
-	if ( clProperty.IsExist( "dg" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "dg" ) ) )
 	{
-		SetDialog( clProperty.GetValueAsInt( "dg" ) );
+		SetDialog( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "dg" ) ) );
 	}
 
-	if ( clProperty.IsExist( "gt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "gt" ) ) )
 	{
-		SetGUIType( (eNARRATION_GUI_TYPE)clProperty.GetValueAsInt( "gt" ) );
+		SetGUIType( (eNARRATION_GUI_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "gt" ) ) );
 	}
 
-	if ( clProperty.IsExist( "mlt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "mlt" ) ) )
 	{
-		SetMaxLifeTime( (unsigned int)clProperty.GetValueAsInt( "mlt" ) );
+		SetMaxLifeTime( (unsigned int)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "mlt" ) ) );
 	}
 
-	if ( clProperty.IsExist( "oklnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "oklnk" ) ) )
 	{
-		SetOkLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "oklnk" ) );
+		SetOkLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "oklnk" ) ) );
 	}
 
-	if ( clProperty.IsExist( "cancellnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "cancellnk" ) ) )
 	{
-		SetCancelLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "cancellnk" ) );
+		SetCancelLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cancellnk" ) ) );
 	}
 
-	if ( clProperty.IsExist( "lilnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "lilnk" ) ) )
 	{
-		SetLogInLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "lilnk" ) );
+		SetLogInLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "lilnk" ) ) );
 	}
 }
 
@@ -86,58 +86,58 @@ void CDboTSContProposal::ApplyScriptDataForScript( const CNtlTSScrProperty& clPr
 {
 	CNtlTSCont::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "ds" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ds" ) ) )
 	{
-		SetDisplaySummary( clProperty.GetValueAsInt( "ds" ) ? true : false );
+		SetDisplaySummary( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ds" ) ) ? true : false );
 	}
 
-	if ( clProperty.IsExist( "title" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "title" ) ) )
 	{
-		SetTitle( clProperty.GetValueAsInt( "title" ) );
+		SetTitle( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "title" ) ) );
 	}
 
-	if ( clProperty.IsExist( "area" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "area" ) ) )
 	{
-		SetArea( clProperty.GetValueAsInt( "area" ) );
+		SetArea( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "area" ) ) );
 	}
 
-	if ( clProperty.IsExist( "goal" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "goal" ) ) )
 	{
-		SetGoal( clProperty.GetValueAsInt( "goal" ) );
+		SetGoal( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "goal" ) ) );
 	}
 
-	if ( clProperty.IsExist( "grade" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "grade" ) ) )
 	{
-		SetGrade( clProperty.GetValueAsInt( "grade" ) );
+		SetGrade( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "grade" ) ) );
 	}
 
-	if ( clProperty.IsExist( "gtype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "gtype" ) ) )
 	{
-		SetGradeType( (eGRADE_TYPE)clProperty.GetValueAsInt( "gtype" ) );
+		SetGradeType( (eGRADE_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "gtype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "sort" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "sort" ) ) )
 	{
-		SetSort( clProperty.GetValueAsInt( "sort" ) );
+		SetSort( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "sort" ) ) );
 	}
 
-	if ( clProperty.IsExist( "cont" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "cont" ) ) )
 	{
-		SetContents( clProperty.GetValueAsInt( "cont" ) );
+		SetContents( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cont" ) ) );
 	}
 
-	if ( clProperty.IsExist( "rwd" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "rwd" ) ) )
 	{
-		SetReward( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "rwd" ) );
+		SetReward( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "rwd" ) ) );
 	}
 
-	if ( clProperty.IsExist( "oklnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "oklnk" ) ) )
 	{
-		SetOkLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "oklnk" ) );
+		SetOkLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "oklnk" ) ) );
 	}
-	if ( clProperty.IsExist( "cancellnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "cancellnk" ) ) )
 	{
-		SetCancelLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "cancellnk" ) );
+		SetCancelLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cancellnk" ) ) );
 	}
 }
 
@@ -92,39 +92,39 @@ void CDboTSContReward::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 {
 	CNtlTSCont::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "nextlnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "nextlnk" ) ) )
 	{
-		AttachNextLink((NTL_TS_TC_ID)clProperty.GetValueAsInt( "nextlnk" ) );
+		AttachNextLink((NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "nextlnk" ) ) );
 	}
 
-	if ( clProperty.IsExist( "canclnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "canclnk" ) ) )
 	{
-		AttachCancelLink((NTL_TS_TC_ID)clProperty.GetValueAsInt( "canclnk" ) );
+		AttachCancelLink((NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "canclnk" ) ) );
 	}
 
-	if ( clProperty.IsExist( "rwdtype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "rwdtype" ) ) )
 	{
-		SetRewardContType( (eREWARD_CONTAINER_TYPE)clProperty.GetValueAsInt( "rwdtype" ) );
+		SetRewardContType( (eREWARD_CONTAINER_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "rwdtype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "ltime" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ltime" ) ) )
 	{
-		SetLimitTime( clProperty.GetValueAsInt( "ltime" ) );
+		SetLimitTime( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ltime" ) ) );
 	}
 
-	if ( clProperty.IsExist( "desc" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "desc" ) ) )
 	{
-		SetDesc( clProperty.GetValueAsInt( "desc" ) );
+		SetDesc( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "desc" ) ) );
 	}
 
-	if ( clProperty.IsExist( "usetbl" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "usetbl" ) ) )
 	{
-		m_bUseTable = clProperty.GetValueAsBool( "usetbl" ) ? true : false;
+		m_bUseTable = clProperty.GetValueAsBool( NTL_TS_SCR_KEY( "usetbl" ) ) ? true : false;
 	}
 
-	if ( clProperty.IsExist( "rwdtbl" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "rwdtbl" ) ) )
 	{
-		m_uiRewardTblIdx = clProperty.GetValueAsInt( "rwdtbl" );
+		m_uiRewardTblIdx = clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "rwdtbl" ) );
 	}
 
 	if ( !IsUseTable() )
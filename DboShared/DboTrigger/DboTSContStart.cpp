@@ -24,9 +24,9 @@ void CDboTSContStart::ApplyScriptDataForScript( const CNtlTSScrProperty& clPrope
 {
 	CDboTSContGCond::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "stdiag" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "stdiag" ) ) )
 	{
-		SetSTDiag( clProperty.GetValueAsInt( "stdiag" ) );
+		SetSTDiag( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "stdiag" ) ) );
 	}
 }
 
@@ -43,24 +43,24 @@ void CDboTSContUnifiedNarration::ApplyScriptDataForScript( const CNtlTSScrProper
 {
 	CNtlTSCont::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetNarrationTblIdx( clProperty.GetValueAsInt( "idx" ) );
+		SetNarrationTblIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "oklnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "oklnk" ) ) )
 	{
-		SetOkLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "oklnk" ) );
+		SetOkLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "oklnk" ) ) );
 	}
 
-	if ( clProperty.IsExist( "cancellnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "cancellnk" ) ) )
 	{
-		SetCancelLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "cancellnk" ) );
+		SetCancelLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cancellnk" ) ) );
 	}
 
-	if ( clProperty.IsExist( "lilnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "lilnk" ) ) )
 	{
-		SetLogInLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "lilnk" ) );
+		SetLogInLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "lilnk" ) ) );
 	}
 }
 
@@ -116,29 +116,29 @@ void CDboTSContUsrSel::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 {
 	CNtlTSCont::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "ust" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ust" ) ) )
 	{
-		SetUserSelType( (eUSER_SEL_TYPE)clProperty.GetValueAsInt( "ust" ) );
+		SetUserSelType( (eUSER_SEL_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ust" ) ) );
 	}
 
-	if ( clProperty.IsExist( "uspt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "uspt" ) ) )
 	{
-		SetUserSelProgState( (eUSER_SEL_PROGRESS_STATE)clProperty.GetValueAsInt( "uspt" ) );
+		SetUserSelProgState( (eUSER_SEL_PROGRESS_STATE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "uspt" ) ) );
 	}
 
-	if ( clProperty.IsExist( "type" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "type" ) ) )
 	{
-		SetTargetType( (eUSER_SEL_TARGET_TYPE)clProperty.GetValueAsInt( "type" ) );
+		SetTargetType( (eUSER_SEL_TARGET_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "type" ) ) );
 	}
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetTargetTblIdx( clProperty.GetValueAsInt( "idx" ) );
+		SetTargetTblIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "desc" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "desc" ) ) )
 	{
-		SetDesc( clProperty.GetValueAsInt( "desc" ) );
+		SetDesc( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "desc" ) ) );
 	}
 
 	const std::string strId = "nid";
@@ -157,14 +157,14 @@ void CDboTSContUsrSel::ApplyScriptDataForScript( const CNtlTSScrProperty& clProp
 		}
 	}
 
-	if ( clProperty.IsExist( "cancellnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "cancellnk" ) ) )
 	{
-		SetCancelLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "cancellnk" ) );
+		SetCancelLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cancellnk" ) ) );
 	}
 
-	if ( clProperty.IsExist( "lilnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "lilnk" ) ) )
 	{
-		SetLogInLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( "lilnk" ) );
+		SetLogInLink( (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "lilnk" ) ) );
 	}
 }
 
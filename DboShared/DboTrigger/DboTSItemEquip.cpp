@@ -19,9 +19,9 @@ void CDboTSItemEquip::ApplyScriptDataForScript( const CNtlTSScrProperty& clPrope
 {
 	CNtlTSEvent::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetItemIdx( clProperty.GetValueAsInt( "idx" ) );
+		SetItemIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 }
 
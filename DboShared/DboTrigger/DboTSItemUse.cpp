@@ -31,19 +31,19 @@ void CDboTSItemUse::ApplyScriptDataForScript( const CNtlTSScrProperty& clPropert
 {
 	CNtlTSEvent::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetItemIdx( clProperty.GetValueAsInt( "idx" ) );
+		SetItemIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "ttype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ttype" ) ) )
 	{
-		SetItemTargetType( (eEVENT_ITEM_TARGET_TYPE)clProperty.GetValueAsInt( "ttype" ) );
+		SetItemTargetType( (eEVENT_ITEM_TARGET_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ttype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "tidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tidx" ) ) )
 	{
-		SetItemTargetIdx( clProperty.GetValueAsInt( "tidx" ) );
+		SetItemTargetIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tidx" ) ) );
 	}
 }
 
@@ -9,6 +9,66 @@
 #include "zip.h"
 #include "NtlCipher.h"
 
+#include <process.h>
+
+
+// ѹ script  εϴ ִ thread 
+#define TS_LOAD_MAX_THREAD				(8)
+// thread ϳ  ּ  
+#define TS_LOAD_MIN_FILE_PER_THREAD		(64)
+
+
+struct CDboTSMain::sTS_LOAD_RESULT
+{
+	sTS_LOAD_RESULT( void ) : bHeader( false ), tID( NTL_TS_T_ID_INVALID ) { sPos.dwPosInZipDir = sPos.dwNumFile = 0; }
+
+	std::vector<CNtlTSScrObject*>		vecObjList;
+
+	bool								bHeader;
+	NTL_TS_T_ID							tID;
+	sUZ_FILEPOS							sPos;
+};
+
+struct CDboTSMain::sTS_LOAD_THREAD
+{
+	CDboTSMain*							pTSMain;
+
+	const char*							pZipName;
+	const char*							pZipBuf;
+	int									nZipSize;
+
+	int									nThread;
+	int									nThreadCnt;
+	bool								bHeaderOnly;
+
+	std::vector<sTS_LOAD_RESULT>*		pResult;
+
+	// thread   log. join  ڿ main thread  
+	std::vector<std::string>			vecLog;
+};
+
+
+namespace
+{
+	// "<tid>.t"  ̸ trigger ID  ´ ( LoadTriggerObjectFromUnZip   Ģ )
+	bool GetTriggerIDFromFileName( const char* pFileName, NTL_TS_T_ID& tID )
+	{
+		unsigned int uiID = 0;
+
+		const char* pPos = pFileName;
+		for ( ; *pPos >= '0' && *pPos <= '9'; ++pPos )
+		{
+			uiID = uiID * 10 + ( *pPos - '0' );
+			if ( uiID >= NTL_TS_T_ID_INVALID ) return false;
+		}
+
+		if ( pPos == pFileName || 0 != strcmp( pPos, ".t" ) ) return false;
+
+		tID = (NTL_TS_T_ID)uiID;
+		return true;
+	}
+}
+
 
 /** 
 	Client main
@@ -244,10 +304,57 @@ bool CDboTSMain::LoadTSZip( std::string strFile, mapdef_TLIST& defTList )
 
 bool CDboTSMain::LoadTSCryptoData( std::string strFile, mapdef_TLIST& defTList )
 {
-	char szFPath[_MAX_DIR];
-	_splitpath_s( strFile.c_str(), 0, 0, szFPath, _MAX_DIR, 0, 0, 0, 0 );
-	std::string strPath = szFPath;
-	if ( '\\' != strPath[strPath.size()-1] ) strPath += "\\";
+	char* pZipBuf;
+	int nZipSize;
+	if ( !DecryptTSCryptoData( strFile, pZipBuf, nZipSize ) )
+	{
+		return false;
+	}
+
+	bool bResult = LoadTSZipParallel( strFile, pZipBuf, nZipSize, defTList, 0 );
+
+	delete [] pZipBuf;
+
+	return bResult;
+}
+
+bool CDboTSMain::LoadTSCryptoData_UnZip( std::string strFile, CNtlUnzip* pclUnzip )
+{
+	char* pZipBuf;
+	int nZipSize;
+	if ( !DecryptTSCryptoData( strFile, pZipBuf, nZipSize ) )
+	{
+		return false;
+	}
+
+	bool bResult = pclUnzip->OpenZip( strFile.c_str(), pZipBuf, nZipSize );
+
+	delete [] pZipBuf;
+
+	return bResult;
+}
+
+bool CDboTSMain::LoadTSCryptoDataHeader( std::string strFile, CNtlUnzip* pclUnzip, mapdef_TS_HEADER_LIST& defHeaderList, mapdef_TLIST& defTList )
+{
+	char* pZipBuf;
+	int nZipSize;
+	if ( !DecryptTSCryptoData( strFile, pZipBuf, nZipSize ) )
+	{
+		return false;
+	}
+
+	bool bResult = pclUnzip->OpenZip( strFile.c_str(), pZipBuf, nZipSize ) &&
+				   LoadTSZipParallel( strFile, pZipBuf, nZipSize, defTList, &defHeaderList );
+
+	delete [] pZipBuf;
+
+	return bResult;
+}
+
+bool CDboTSMain::DecryptTSCryptoData( std::string strFile, char*& pZipBuf, int& nZipSize )
+{
+	pZipBuf = 0;
+	nZipSize = 0;
 
 	//  ε
 	FILE* pFile;
@@ -260,12 +367,25 @@ bool CDboTSMain::LoadTSCryptoData( std::string strFile, mapdef_TLIST& defTList )
 	fseek( pFile, 0, SEEK_END );
 	int nReadSize = ftell( pFile ) - 4;
 	fseek( pFile, 0, SEEK_SET );
+	if ( nReadSize <= 0 )
+	{
+		fclose( pFile );
+		return false;
+	}
 	char* pReadBuf = new char[nReadSize];
 	int nOriginSize;
 	fread( &nOriginSize, sizeof(int), 1, pFile );
 	fread( pReadBuf, 1, nReadSize, pFile );
 	fclose( pFile );
 
+	// ȣȭ ũ⺸  ũⰡ Ŭ  
+	if ( nOriginSize <= 0 || nOriginSize > nReadSize )
+	{
+		CNtlTSLog::Log( "The crypto data is broken. Info[%s]. [%s]", strFile.c_str(), TS_CODE_TRACE() );
+		delete [] pReadBuf;
+		return false;
+	}
+
 	// ȣȭ Ǭ
 	std::string strKey = "tddkaghghkqlalfqjsghdlqslek";
 	CNtlCipher Cipher;
@@ -274,23 +394,212 @@ bool CDboTSMain::LoadTSCryptoData( std::string strFile, mapdef_TLIST& defTList )
 	ZeroMemory( pDecryptBuf, nReadSize+256 );
 	Cipher.Decrypt( pReadBuf, nReadSize, pDecryptBuf, nReadSize+256 );
 
-	CNtlUnzip clZip;
-	clZip.OpenZip( strFile.c_str(), pDecryptBuf, nOriginSize );
+	delete [] pReadBuf;
 
-	if ( !clZip.GotoFirstFile() )
+	pZipBuf = pDecryptBuf;
+	nZipSize = nOriginSize;
+
+	return true;
+}
+
+bool CDboTSMain::EncryptTSCryptoData( std::string strFile, const char* pBuf, int nSize )
+{
+	// ȣȭ
+	std::string strKey = "tddkaghghkqlalfqjsghdlqslek";
+	CNtlCipher Cipher;
+	Cipher.SetKey( DES_CIPHER, strKey.c_str(), (int)strKey.size() );
+	char* pEncryptBuf = new char[nSize+256];
+	ZeroMemory( pEncryptBuf, nSize+256 );
+	int nEncSize = Cipher.Encrypt( pBuf, nSize, pEncryptBuf, nSize+256 );
+
+	if ( nEncSize <= 0 )
 	{
-		delete [] pReadBuf;
-		delete [] pDecryptBuf;
+		delete [] pEncryptBuf;
+		return false;
+	}
 
+	// Ͽ 
+	FILE* pFile;
+	fopen_s( &pFile, strFile.c_str(), "wb" );
+	if ( NULL == pFile )
+	{
+		CNtlTSLog::Log( "Can not save the crypto data. Info[%s]. [%s]", strFile.c_str(), TS_CODE_TRACE() );
+		delete [] pEncryptBuf;
 		return false;
 	}
 
+	bool bResult = 1 == fwrite( &nSize, sizeof(int), 1, pFile ) &&
+				   (size_t)nEncSize == fwrite( pEncryptBuf, 1, nEncSize, pFile );
+
+	fclose( pFile );
+
+	delete [] pEncryptBuf;
+
+	if ( !bResult )
+	{
+		CNtlTSLog::Log( "Writing the crypto data is failed. Info[%s]. [%s]", strFile.c_str(), TS_CODE_TRACE() );
+	}
+
+	return bResult;
+}
+
+bool CDboTSMain::GetTSCryptoDataCRC( std::string strFile, unsigned int& uiSize, unsigned int& uiCRC )
+{
+	uiSize = 0;
+	uiCRC = crc32( 0L, Z_NULL, 0 );
+
+	FILE* pFile;
+	fopen_s( &pFile, strFile.c_str(), "rb" );
+	if ( NULL == pFile )
+	{
+		return false;
+	}
+
+	const size_t BUFFER_SIZE = 65536;
+	unsigned char* pBuf = new unsigned char[BUFFER_SIZE];
+
+	size_t nRead;
+	while ( 0 != ( nRead = fread( pBuf, 1, BUFFER_SIZE, pFile ) ) )
+	{
+		uiCRC = crc32( uiCRC, pBuf, (uInt)nRead );
+		uiSize += (unsigned int)nRead;
+	}
+
+	bool bResult = 0 == ferror( pFile );
+
+	fclose( pFile );
+
+	delete [] pBuf;
+
+	return bResult;
+}
+
+bool CDboTSMain::LoadTSZipParallel( const std::string& strFile, const char* pZipBuf, int nZipSize, mapdef_TLIST& defTList, mapdef_TS_HEADER_LIST* pHeaderList )
+{
+	CNtlUnzip clZip;
+	if ( !clZip.OpenZip( strFile.c_str(), pZipBuf, nZipSize ) || !clZip.GotoFirstFile() )
+	{
+		return false;
+	}
+
+	int nFileCnt = clZip.GetFileCount();
+	clZip.CloseZip();
+
+	std::vector<sTS_LOAD_RESULT> vecResult( nFileCnt );
+
+	SYSTEM_INFO sSysInfo;
+	GetSystemInfo( &sSysInfo );
+
+	int nThreadCnt = (int)sSysInfo.dwNumberOfProcessors;
+	if ( nThreadCnt > TS_LOAD_MAX_THREAD ) nThreadCnt = TS_LOAD_MAX_THREAD;
+	if ( nThreadCnt > nFileCnt / TS_LOAD_MIN_FILE_PER_THREAD ) nThreadCnt = nFileCnt / TS_LOAD_MIN_FILE_PER_THREAD;
+	if ( nThreadCnt < 1 ) nThreadCnt = 1;
+
+	std::vector<sTS_LOAD_THREAD> vecThread( nThreadCnt );
+	std::vector<HANDLE> vecHandle;
+
+	for ( int i = 0; i < nThreadCnt; ++i )
+	{
+		sTS_LOAD_THREAD& sThread = vecThread[i];
+		sThread.pTSMain = this;
+		sThread.pZipName = strFile.c_str();
+		sThread.pZipBuf = pZipBuf;
+		sThread.nZipSize = nZipSize;
+		sThread.nThread = i;
+		sThread.nThreadCnt = nThreadCnt;
+		sThread.bHeaderOnly = ( 0 != pHeaderList );
+		sThread.pResult = &vecResult;
+	}
+
+	// 0   thread  óϰ,   thread   ⼭ óѴ
+	std::vector<int> vecLocal( 1, 0 );
+
+	for ( int i = 1; i < nThreadCnt; ++i )
+	{
+		HANDLE hThread = (HANDLE)_beginthreadex( NULL, 0, &LoadThreadFunc, &vecThread[i], 0, NULL );
+		if ( hThread ) vecHandle.push_back( hThread );
+		else vecLocal.push_back( i );
+	}
+
+	for ( std::vector<int>::iterator it = vecLocal.begin(); it != vecLocal.end(); ++it )
+	{
+		CNtlTSLog::SetThreadCapture( &vecThread[*it].vecLog );
+		RunLoadThread( &vecThread[*it] );
+		CNtlTSLog::SetThreadCapture( 0 );
+	}
+
+	if ( !vecHandle.empty() )
+	{
+		WaitForMultipleObjects( (DWORD)vecHandle.size(), &vecHandle[0], TRUE, INFINITE );
+
+		for ( std::vector<HANDLE>::iterator it = vecHandle.begin(); it != vecHandle.end(); ++it )
+		{
+			CloseHandle( *it );
+		}
+	}
+
+	// log  thread  
+	for ( std::vector<sTS_LOAD_THREAD>::iterator it = vecThread.begin(); it != vecThread.end(); ++it )
+	{
+		std::vector<std::string>::iterator itLog = it->vecLog.begin();
+		for ( ; itLog != it->vecLog.end(); ++itLog )
+		{
+			CNtlTSLog::Log( "%s", itLog->c_str() );
+		}
+	}
+
+	//  ID  zip       ģ
+	for ( std::vector<sTS_LOAD_RESULT>::iterator it = vecResult.begin(); it != vecResult.end(); ++it )
+	{
+		sTS_LOAD_RESULT& sResult = *it;
+
+		if ( sResult.bHeader )
+		{
+			sTS_HEADER& sHeader = (*pHeaderList)[sResult.tID];
+			sHeader.uiZipDirPos = sResult.sPos.dwPosInZipDir;
+			sHeader.uiZipFileNum = sResult.sPos.dwNumFile;
+			continue;
+		}
+
+		std::vector<CNtlTSScrObject*>::iterator itObjList = sResult.vecObjList.begin();
+		for ( ; itObjList != sResult.vecObjList.end(); ++itObjList )
+		{
+			if ( (*itObjList)->IsDerivedClass( "CNtlTSTrigger" ) )
+			{
+				CNtlTSTrigger* pTriObj = (CNtlTSTrigger*) *itObjList;
+				defTList[pTriObj->GetID()] = pTriObj;
+			}
+			else
+			{
+				CNtlTSLog::Log( "The root class type must have to be the CNtlTSTrigger class. Info[%s]. [%s]", (*itObjList)->GetClassName(), TS_CODE_TRACE() );
+				m_pEntityFactory->DeleteObj( *itObjList );
+			}
+		}
+	}
+
+	return true;
+}
+
+void CDboTSMain::RunLoadThread( sTS_LOAD_THREAD* pThread )
+{
+	CNtlUnzip clZip;
+	if ( !clZip.OpenZip( pThread->pZipName, pThread->pZipBuf, pThread->nZipSize ) ) return;
+
+	if ( !clZip.GotoFirstFile() ) return;
+
+	std::vector<sTS_LOAD_RESULT>& vecResult = *pThread->pResult;
+
 	unsigned int MAX_BUFFER_SIZE = 102400;
 	char* pBuf = new char[MAX_BUFFER_SIZE];
 
 	sUZ_FILEINFO sInfo;
+	int nFile = 0;
 	do 
 	{
+		// ϸ ư thread   ش. ǳʶٴ   Ǯ ʴ´
+		if ( nFile >= (int)vecResult.size() ) break;
+		if ( pThread->nThread != nFile++ % pThread->nThreadCnt ) continue;
+
 		clZip.GetFileInfo( sInfo );
 
 		if ( sInfo.bFolder ) continue;
@@ -298,8 +607,26 @@ bool CDboTSMain::LoadTSCryptoData( std::string strFile, mapdef_TLIST& defTList )
 		int nNameLength = (int)strlen( sInfo.szFileName );
 		if ( nNameLength <= 2 ) continue;
 		if ( '.' != sInfo.szFileName[nNameLength-2] ||
-			't' != sInfo.szFileName[nNameLength-1] )
-			continue;
+			 't' != sInfo.szFileName[nNameLength-1] )
+			 continue;
+
+		if ( 0 == sInfo.dwUncompressedSize ) continue;
+
+		sTS_LOAD_RESULT& sResult = vecResult[nFile - 1];
+
+		//  Ǯ ʰ zip  ġ  ξٰ LoadTriggerObjectFromHeader  Ǭ
+		if ( pThread->bHeaderOnly )
+		{
+			NTL_TS_T_ID tID;
+			if ( GetTriggerIDFromFileName( sInfo.szFileName, tID ) && clZip.GetFilePos( sResult.sPos ) )
+			{
+				sResult.bHeader = true;
+				sResult.tID = tID;
+				continue;
+			}
+
+			// ̸ ID     script  ٷ 
+		}
 
 		if ( MAX_BUFFER_SIZE < sInfo.dwUncompressedSize )
 		{
@@ -311,66 +638,32 @@ bool CDboTSMain::LoadTSCryptoData( std::string strFile, mapdef_TLIST& defTList )
 		if ( !clZip.ReadFileData( pBuf, sInfo.dwUncompressedSize ) )
 		{
 			CNtlTSLog::Log( "Load TS compressed file. Info[%s]. [%s]", sInfo.szFileName, TS_CODE_TRACE() );
+			continue;
 		}
-		else
+
+		CNtlTSScrStream clStream( m_pEntityFactory, sInfo.szFileName, pBuf, sInfo.dwUncompressedSize );
+		if ( clStream.Load() )
 		{
-			LoadTriggerObject( strPath, sInfo.szFileName, pBuf, sInfo.dwUncompressedSize, defTList );
+			sResult.vecObjList.swap( clStream.GetObjList() );
 		}
 	}
 	while ( clZip.GotoNextFile() );
 
 	delete [] pBuf;
-
-	delete [] pReadBuf;
-	delete [] pDecryptBuf;
-
-	return true;
 }
 
-bool CDboTSMain::LoadTSCryptoData_UnZip( std::string strFile, CNtlUnzip* pclUnzip )
+unsigned int __stdcall CDboTSMain::LoadThreadFunc( void* pParam )
 {
-	char szFPath[_MAX_DIR];
-	_splitpath_s( strFile.c_str(), 0, 0, szFPath, _MAX_DIR, 0, 0, 0, 0 );
-	std::string strPath = szFPath;
-	if ( '\\' != strPath[strPath.size()-1] ) strPath += "\\";
+	sTS_LOAD_THREAD* pThread = (sTS_LOAD_THREAD*)pParam;
 
-	//  ε
-	FILE* pFile;
-	fopen_s( &pFile, strFile.c_str(), "rb" );
-	if(NULL == pFile)
-	{
-		return false;
-	}
+	// ۾ thread  OnLogEvent ( assert  )  θ ʴ´
+	CNtlTSLog::SetThreadCapture( &pThread->vecLog );
 
-	fseek( pFile, 0, SEEK_END );
-	int nReadSize = ftell( pFile ) - 4;
-	fseek( pFile, 0, SEEK_SET );
-	char* pReadBuf = new char[nReadSize];
-	int nOriginSize;
-	fread( &nOriginSize, sizeof(int), 1, pFile );
-	fread( pReadBuf, 1, nReadSize, pFile );
-	fclose( pFile );
+	pThread->pTSMain->RunLoadThread( pThread );
 
-	// ȣȭ Ǭ
-	std::string strKey = "tddkaghghkqlalfqjsghdlqslek";
-	CNtlCipher Cipher;
-	Cipher.SetKey( DES_CIPHER, strKey.c_str(), (int)strKey.size() );
-	char* pDecryptBuf = new char[nReadSize+256];
-	ZeroMemory( pDecryptBuf, nReadSize+256 );
-	Cipher.Decrypt( pReadBuf, nReadSize, pDecryptBuf, nReadSize+256 );
+	CNtlTSLog::SetThreadCapture( 0 );
 
-	if ( !pclUnzip->OpenZip( strFile.c_str(), pDecryptBuf, nOriginSize ) )
-	{
-		delete [] pReadBuf;
-		delete [] pDecryptBuf;
-
-		return false;
-    }
-
-    delete [] pReadBuf;
-    delete [] pDecryptBuf;
-
-	return true;
+	return 0;
 }
 
 bool CDboTSMain::LoadTriggerObject( const std::string& strPath, const char* pFileName, mapdef_TLIST& defTList )
@@ -503,4 +796,203 @@ bool CDboTSMain::LoadTriggerObjectFromUnZip( NTL_TS_T_ID tID, CNtlUnzip* pclUnzi
 	delete [] pBuf;
 
 	return true;
-}
\ No newline at end of file
+}
+
+bool CDboTSMain::LoadTriggerObjectFromHeader( const sTS_HEADER& sHeader, CNtlUnzip* pclUnzip, mapdef_TLIST& defTList )
+{
+	sUZ_FILEPOS sPos;
+	sPos.dwPosInZipDir = sHeader.uiZipDirPos;
+	sPos.dwNumFile = sHeader.uiZipFileNum;
+
+	if ( !pclUnzip->GotoFilePos( sPos ) )
+	{
+		return false;
+	}
+
+	sUZ_FILEINFO sInfo;
+	if ( !pclUnzip->GetFileInfo( sInfo ) || 0 == sInfo.dwUncompressedSize )
+	{
+		return false;
+	}
+
+	char* pBuf = new char[sInfo.dwUncompressedSize + 1];
+
+	bool bResult = false;
+
+	if ( !pclUnzip->ReadFileData( pBuf, sInfo.dwUncompressedSize ) )
+	{
+		CNtlTSLog::Log( "Load TS compressed file. Info[%s]. [%s]", sInfo.szFileName, TS_CODE_TRACE() );
+	}
+	else
+	{
+		bResult = LoadTriggerObject( "", sInfo.szFileName, pBuf, sInfo.dwUncompressedSize, defTList );
+	}
+
+	delete [] pBuf;
+
+	return bResult;
+}
+
+bool CDboTSMain::LoadTSBinary( CNtlTSScrBinary* pclBinary, mapdef_TLIST& defTList )
+{
+	if ( 0 == pclBinary || !pclBinary->IsOpened() )
+	{
+		return false;
+	}
+
+	for ( int i = 0; i < pclBinary->GetScriptCount(); ++i )
+	{
+		LoadTriggerObjectFromBinaryIndex( i, pclBinary, defTList );
+	}
+
+	return true;
+}
+
+bool CDboTSMain::CompileTSCryptoData( std::string strFile, std::string strOutFile )
+{
+	CNtlUnzip clZip;
+	if ( !LoadTSCryptoData_UnZip( strFile, &clZip ) )
+	{
+		return false;
+	}
+
+	if ( !clZip.GotoFirstFile() )
+	{
+		return false;
+	}
+
+	CNtlTSScrCompiler clCompiler( m_pEntityFactory );
+
+	unsigned int MAX_BUFFER_SIZE = 102400;
+	char* pBuf = new char[MAX_BUFFER_SIZE];
+
+	bool bResult = true;
+
+	sUZ_FILEINFO sInfo;
+	do 
+	{
+		clZip.GetFileInfo( sInfo );
+
+		if ( sInfo.bFolder ) continue;
+
+		int nNameLength = (int)strlen( sInfo.szFileName );
+		if ( nNameLength <= 2 ) continue;
+		if ( '.' != sInfo.szFileName[nNameLength-2] ||
+			 't' != sInfo.szFileName[nNameLength-1] )
+			 continue;
+
+		if ( MAX_BUFFER_SIZE < sInfo.dwUncompressedSize )
+		{
+			MAX_BUFFER_SIZE = sInfo.dwUncompressedSize + 1;
+			delete [] pBuf;
+			pBuf = new char[MAX_BUFFER_SIZE];
+		}
+
+		// ϳ  compiled script   ʴ´
+		if ( !clZip.ReadFileData( pBuf, sInfo.dwUncompressedSize ) )
+		{
+			CNtlTSLog::Log( "Load TS compressed file. Info[%s]. [%s]", sInfo.szFileName, TS_CODE_TRACE() );
+			bResult = false;
+			break;
+		}
+
+		if ( !clCompiler.AddScript( sInfo.szFileName, pBuf, sInfo.dwUncompressedSize ) )
+		{
+			bResult = false;
+			break;
+		}
+	}
+	while ( clZip.GotoNextFile() );
+
+	delete [] pBuf;
+
+	if ( !bResult )
+	{
+		return false;
+	}
+
+	//     д
+	unsigned int uiSourceSize, uiSourceCRC;
+	if ( !GetTSCryptoDataCRC( strFile, uiSourceSize, uiSourceCRC ) )
+	{
+		return false;
+	}
+
+	std::vector<char> vecData;
+	if ( !clCompiler.Save( vecData, uiSourceSize, uiSourceCRC ) )
+	{
+		return false;
+	}
+
+	//    ȣȭؼ Ѵ
+	return EncryptTSCryptoData( strOutFile, &vecData[0], (int)vecData.size() );
+}
+
+bool CDboTSMain::OpenTSBinary( std::string strSrcFile, std::string strBinFile, CNtlTSScrBinary* pclBinary )
+{
+	unsigned int uiSourceSize, uiSourceCRC;
+	if ( !GetTSCryptoDataCRC( strSrcFile, uiSourceSize, uiSourceCRC ) )
+	{
+		return false;
+	}
+
+	char* pBuf;
+	int nSize;
+	if ( !DecryptTSCryptoData( strBinFile, pBuf, nSize ) )
+	{
+		return false;
+	}
+
+	bool bResult = pclBinary->Open( strBinFile, pBuf, nSize, uiSourceSize, uiSourceCRC );
+
+	delete [] pBuf;
+
+	return bResult;
+}
+
+bool CDboTSMain::LoadTriggerObjectFromBinary( NTL_TS_T_ID tID, CNtlTSScrBinary* pclBinary, mapdef_TLIST& defTList )
+{
+	char szFileName[128] = {0,};
+	sprintf_s( szFileName, "%d.t", tID );
+
+	int nScript = pclBinary->FindScript( szFileName );
+	if ( -1 == nScript )
+	{
+		return false;
+	}
+
+	return LoadTriggerObjectFromBinaryIndex( nScript, pclBinary, defTList );
+}
+
+bool CDboTSMain::LoadTriggerObjectFromBinaryIndex( int nScript, CNtlTSScrBinary* pclBinary, mapdef_TLIST& defTList )
+{
+	std::vector<CNtlTSScrObject*> vecObjList;
+	if ( !pclBinary->Load( nScript, vecObjList ) )
+	{
+		return false;
+	}
+
+	bool bResult = true;
+
+	std::vector<CNtlTSScrObject*>::iterator itObjList = vecObjList.begin();
+	for ( ; itObjList != vecObjList.end(); ++itObjList )
+	{
+		if ( bResult && (*itObjList)->IsDerivedClass( "CNtlTSTrigger" ) )
+		{
+			CNtlTSTrigger* pTriObj = (CNtlTSTrigger*) *itObjList;
+			defTList[pTriObj->GetID()] = pTriObj;
+		}
+		else
+		{
+			if ( bResult )
+			{
+				CNtlTSLog::Log( "The root class type must have to be the CNtlTSTrigger class. Info[%s]. [%s]", (*itObjList)->GetClassName(), TS_CODE_TRACE() );
+				bResult = false;
+			}
+
+			m_pEntityFactory->DeleteObj( *itObjList );
+		}
+	}
+
+	return bResult;
+}
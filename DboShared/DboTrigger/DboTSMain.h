@@ -28,6 +28,18 @@ class CDboTSMain : public CNtlTSMain
 public:
 	typedef stdext::hash_map<std::string, CNtlTSEvtMapper*> hashdef_EVT_MAPPER_LIST;
 
+	//  Ǯ ʰ zip  ġ   trigger. ó ã   ġ ٷ  ü 
+	struct sTS_HEADER
+	{
+		unsigned int					uiZipDirPos;
+		unsigned int					uiZipFileNum;
+	};
+	typedef std::map<NTL_TS_T_ID, sTS_HEADER> mapdef_TS_HEADER_LIST;
+
+protected:
+	struct sTS_LOAD_RESULT;
+	struct sTS_LOAD_THREAD;
+
 // Member variables
 protected:
 	// Log
@@ -81,14 +93,37 @@ protected:
 	bool								LoadTSPath( std::string strPath, mapdef_TLIST& defTList );
 	// Zip Ͼ TS ( .t ) εѴ
 	bool								LoadTSZip( std::string strFile, mapdef_TLIST& defTList );
-	// ȣȭ Zip Ͼ TS ( .t ) εѴ
+	// ȣȭ Zip Ͼ TS ( .t )  thread  εѴ
 	bool								LoadTSCryptoData( std::string strFile, mapdef_TLIST& defTList );
 	// ȣȭ Ͼ Zip  εѴ
 	bool								LoadTSCryptoData_UnZip( std::string strFile, CNtlUnzip* pclUnzip );
+	// ȣȭ Ͼ Zip   "<tid>.t" ϵ zip  ġ Ѵ
+	// ̸ ID     script  ٷ  defTList  ִ´
+	bool								LoadTSCryptoDataHeader( std::string strFile, CNtlUnzip* pclUnzip, mapdef_TS_HEADER_LIST& defHeaderList, mapdef_TLIST& defTList );
+	// ȣȭ Ǯ Zip ͸ ´. pZipBuf  delete []   Ѵ
+	bool								DecryptTSCryptoData( std::string strFile, char*& pZipBuf, int& nZipSize );
+	// DecryptTSCryptoData  д  ȣȭؼ Ѵ
+	bool								EncryptTSCryptoData( std::string strFile, const char* pBuf, int nSize );
+	//  ũ CRC. compiled script      
+	bool								GetTSCryptoDataCRC( std::string strFile, unsigned int& uiSize, unsigned int& uiCRC );
+	// ޸𸮿 ִ Zip   TS ( .t ) thread     εѴ
+	bool								LoadTSZipParallel( const std::string& strFile, const char* pZipBuf, int nZipSize, mapdef_TLIST& defTList, mapdef_TS_HEADER_LIST* pHeaderList );
+	// compiled script ( CNtlTSScrCompiler )  TS   εѴ
+	bool								LoadTSBinary( CNtlTSScrBinary* pclBinary, mapdef_TLIST& defTList );
+	// ȣȭ Zip Ͼ TS ( .t ) compiled script ϳ ȣȭؼ Ѵ
+	bool								CompileTSCryptoData( std::string strFile, std::string strOutFile );
+	// CompileTSCryptoData   compiled script  . strSrcFile  compile  ڷ ٲ Ѵ
+	bool								OpenTSBinary( std::string strSrcFile, std::string strBinFile, CNtlTSScrBinary* pclBinary );
 
 	bool								LoadTriggerObject( const std::string& strPath, const char* pFileName, mapdef_TLIST& defTList );
 	bool								LoadTriggerObject( const std::string& strPath, const char* pFileName, char* pBuff, int nSize, mapdef_TLIST& defTList );
 	bool								LoadTriggerObjectFromUnZip( NTL_TS_T_ID tID, CNtlUnzip* pclUnzip, mapdef_TLIST& defTList );
+	bool								LoadTriggerObjectFromHeader( const sTS_HEADER& sHeader, CNtlUnzip* pclUnzip, mapdef_TLIST& defTList );
+	bool								LoadTriggerObjectFromBinary( NTL_TS_T_ID tID, CNtlTSScrBinary* pclBinary, mapdef_TLIST& defTList );
+	bool								LoadTriggerObjectFromBinaryIndex( int nScript, CNtlTSScrBinary* pclBinary, mapdef_TLIST& defTList );
+
+	void								RunLoadThread( sTS_LOAD_THREAD* pThread );
+	static unsigned int __stdcall		LoadThreadFunc( void* pParam );
 };
 
 
@@ -25,14 +25,14 @@ void CDboTSRB::ApplyScriptDataForScript( const CNtlTSScrProperty& clProperty )
 {
 	CNtlTSEvent::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetRBTblIdx( clProperty.GetValueAsInt( "idx" ) );
+		SetRBTblIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "cond" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "cond" ) ) )
 	{
-		SetRBCondition( clProperty.GetValueAsInt( "cond" ) );
+		SetRBCondition( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cond" ) ) );
 	}
 }
 
@@ -19,9 +19,9 @@ void CDboTSRcvSvrEvt::ApplyScriptDataForScript( const CNtlTSScrProperty& clPrope
 {
 	CNtlTSEvent::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "id" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "id" ) ) )
 	{
-		SetEvtID( clProperty.GetValueAsInt( "id" ) );
+		SetEvtID( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "id" ) ) );
 	}
 }
 
@@ -31,19 +31,19 @@ void CDboTSScoutUse::ApplyScriptDataForScript( const CNtlTSScrProperty& clProper
 {
 	CNtlTSEvent::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetItemIdx( clProperty.GetValueAsInt( "idx" ) );
+		SetItemIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "tt" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tt" ) ) )
 	{
-		SetTargetType( (eEVENT_SCOUTER_TARGET_TYPE)clProperty.GetValueAsInt( "tt" ) );
+		SetTargetType( (eEVENT_SCOUTER_TARGET_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tt" ) ) );
 	}
 
-	if ( clProperty.IsExist( "tidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tidx" ) ) )
 	{
-		SetTargetIdx( clProperty.GetValueAsInt( "tidx" ) );
+		SetTargetIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tidx" ) ) );
 	}
 }
 
@@ -43,29 +43,29 @@ void CDboTSSkillUse::ApplyScriptDataForScript( const CNtlTSScrProperty& clProper
 {
 	CNtlTSEvent::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "stype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "stype" ) ) )
 	{
-		SetSkillType( (eEVENT_SKILL_TYPE)clProperty.GetValueAsInt( "stype" ) );
+		SetSkillType( (eEVENT_SKILL_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "stype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "idx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "idx" ) ) )
 	{
-		SetSkillIdx( clProperty.GetValueAsInt( "idx" ) );
+		SetSkillIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "idx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "ttype" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "ttype" ) ) )
 	{
-		SetSkillTargetType( (eEVENT_SKILL_TARGET_TYPE)clProperty.GetValueAsInt( "ttype" ) );
+		SetSkillTargetType( (eEVENT_SKILL_TARGET_TYPE)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "ttype" ) ) );
 	}
 
-	if ( clProperty.IsExist( "tidx" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tidx" ) ) )
 	{
-		SetSkillTargetIdx( clProperty.GetValueAsInt( "tidx" ) );
+		SetSkillTargetIdx( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tidx" ) ) );
 	}
 
-	if ( clProperty.IsExist( "rp" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "rp" ) ) )
 	{
-		SetSkillRPFlags( clProperty.GetValueAsInt( "rp" ) );
+		SetSkillRPFlags( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "rp" ) ) );
 	}
 }
 
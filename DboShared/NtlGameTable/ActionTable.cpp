@@ -191,10 +191,12 @@ bool CActionTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sACTION_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sACTION_TBLDAT* pTableData = new sACTION_TBLDAT;
+		sACTION_TBLDAT* pTableData = NewRow<sACTION_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -204,7 +206,7 @@ bool CActionTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -212,7 +214,7 @@ bool CActionTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -437,10 +437,12 @@ bool CBasicDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sBASIC_DROP_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sBASIC_DROP_TBLDAT* pTableData = new sBASIC_DROP_TBLDAT;
+		sBASIC_DROP_TBLDAT* pTableData = NewRow<sBASIC_DROP_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -450,7 +452,7 @@ bool CBasicDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -458,7 +460,7 @@ bool CBasicDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
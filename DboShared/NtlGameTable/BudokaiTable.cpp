@@ -723,7 +723,7 @@ bool CBudokaiTable::AddTable(void * pvTable, bool bReload)
 //-----------------------------------------------------------------------------------
 bool CBudokaiTable::SetTableData( void* pvTable, WCHAR* pwszSheetName, std::wstring* pstrDataName, BSTR bstrData )
 {
-	static char szTemp[1024] = { 0x00, };
+	char szTemp[1024] = { 0x00, };
 
 	if ( 0 == wcscmp( pwszSheetName, L"Table_Data_KOR" ) )
 	{
@@ -178,10 +178,12 @@ bool CCharmTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sCHARM_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sCHARM_TBLDAT* pTableData = new sCHARM_TBLDAT;
+		sCHARM_TBLDAT* pTableData = NewRow<sCHARM_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -191,7 +193,7 @@ bool CCharmTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -199,7 +201,7 @@ bool CCharmTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
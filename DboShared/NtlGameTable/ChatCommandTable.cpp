@@ -193,10 +193,12 @@ bool CChatCommandTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sCHAT_COMMAND_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sCHAT_COMMAND_TBLDAT* pTableData = new sCHAT_COMMAND_TBLDAT;
+		sCHAT_COMMAND_TBLDAT* pTableData = NewRow<sCHAT_COMMAND_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -206,7 +208,7 @@ bool CChatCommandTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -214,7 +216,7 @@ bool CChatCommandTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -147,10 +147,12 @@ bool CChattingFilterTable::LoadFromBinary(CNtlSerializer& serializer, bool bRelo
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sCHAT_FILTER_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sCHAT_FILTER_TBLDAT* pTableData = new sCHAT_FILTER_TBLDAT;
+		sCHAT_FILTER_TBLDAT* pTableData = NewRow<sCHAT_FILTER_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -160,7 +162,7 @@ bool CChattingFilterTable::LoadFromBinary(CNtlSerializer& serializer, bool bRelo
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -168,7 +170,7 @@ bool CChattingFilterTable::LoadFromBinary(CNtlSerializer& serializer, bool bRelo
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
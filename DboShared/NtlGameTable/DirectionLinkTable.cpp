@@ -178,7 +178,7 @@ bool CDirectionLinkTable::AddTable(void * pvTable, bool bReload)
 //-----------------------------------------------------------------------------------
 bool CDirectionLinkTable::SetTableData( void* pvTable, WCHAR* pwszSheetName, std::wstring* pstrDataName, BSTR bstrData )
 {
-	static char szTemp[1024] = { 0x00, };
+	char szTemp[1024] = { 0x00, };
 
 	if ( 0 == wcscmp( pwszSheetName, L"Table_Data_KOR" ) )
 	{
@@ -256,10 +256,12 @@ bool CDirectionLinkTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sDIRECTION_LINK_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sDIRECTION_LINK_TBLDAT* pTableData = new sDIRECTION_LINK_TBLDAT;
+		sDIRECTION_LINK_TBLDAT* pTableData = NewRow<sDIRECTION_LINK_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -269,7 +271,7 @@ bool CDirectionLinkTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -277,7 +279,7 @@ bool CDirectionLinkTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -156,7 +156,7 @@ bool CDojoTable::AddTable(void * pvTable, bool bReload)
 //-----------------------------------------------------------------------------------
 bool CDojoTable::SetTableData( void* pvTable, WCHAR* pwszSheetName, std::wstring* pstrDataName, BSTR bstrData )
 {
-	static char szTemp[1024] = { 0x00, };
+	char szTemp[1024] = { 0x00, };
 
 	if ( 0 == wcscmp( pwszSheetName, L"Table_Data_KOR" ) )
 	{
@@ -434,10 +434,12 @@ bool CDojoTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sDOJO_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sDOJO_TBLDAT* pTableData = new sDOJO_TBLDAT;
+		sDOJO_TBLDAT* pTableData = NewRow<sDOJO_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -447,7 +449,7 @@ bool CDojoTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -455,7 +457,7 @@ bool CDojoTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -183,10 +183,12 @@ bool CDragonBallRewardTable::LoadFromBinary(CNtlSerializer& serializer, bool bRe
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sDRAGONBALL_REWARD_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sDRAGONBALL_REWARD_TBLDAT* pTableData = new sDRAGONBALL_REWARD_TBLDAT;
+		sDRAGONBALL_REWARD_TBLDAT* pTableData = NewRow<sDRAGONBALL_REWARD_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -196,7 +198,7 @@ bool CDragonBallRewardTable::LoadFromBinary(CNtlSerializer& serializer, bool bRe
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -204,7 +206,7 @@ bool CDragonBallRewardTable::LoadFromBinary(CNtlSerializer& serializer, bool bRe
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -268,10 +268,12 @@ bool CDragonBallTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sDRAGONBALL_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sDRAGONBALL_TBLDAT* pTableData = new sDRAGONBALL_TBLDAT;
+		sDRAGONBALL_TBLDAT* pTableData = NewRow<sDRAGONBALL_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -281,7 +283,7 @@ bool CDragonBallTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -289,7 +291,7 @@ bool CDragonBallTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
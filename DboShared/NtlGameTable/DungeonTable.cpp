@@ -156,7 +156,7 @@ bool CDungeonTable::AddTable(void * pvTable, bool bReload)
 //-----------------------------------------------------------------------------------
 bool CDungeonTable::SetTableData( void* pvTable, WCHAR* pwszSheetName, std::wstring* pstrDataName, BSTR bstrData )
 {
-	static char szTemp[1024] = { 0x00, };
+	char szTemp[1024] = { 0x00, };
 
 	if ( 0 == wcscmp( pwszSheetName, L"Table_Data_KOR" ) )
 	{
@@ -247,10 +247,12 @@ bool CDungeonTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sDUNGEON_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sDUNGEON_TBLDAT* pTableData = new sDUNGEON_TBLDAT;
+		sDUNGEON_TBLDAT* pTableData = NewRow<sDUNGEON_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -260,7 +262,7 @@ bool CDungeonTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -268,7 +270,7 @@ bool CDungeonTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
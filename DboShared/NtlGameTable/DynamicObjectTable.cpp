@@ -143,7 +143,7 @@ bool CDynamicObjectTable::SetTableData( void* pvTable, WCHAR* pwszSheetName, std
 		}																			\
 	}
 
-	static char szTemp[1024];
+	char szTemp[1024];
 
 	if ( 0 == wcscmp( pwszSheetName, L"Table_Data_KOR" ) )
 	{
@@ -237,10 +237,12 @@ bool CDynamicObjectTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sDYNAMIC_OBJECT_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sDYNAMIC_OBJECT_TBLDAT* pTableData = new sDYNAMIC_OBJECT_TBLDAT;
+		sDYNAMIC_OBJECT_TBLDAT* pTableData = NewRow<sDYNAMIC_OBJECT_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -250,7 +252,7 @@ bool CDynamicObjectTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -258,7 +260,7 @@ bool CDynamicObjectTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -223,10 +223,12 @@ bool CExcellentDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sEXCELLENT_DROP_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sEXCELLENT_DROP_TBLDAT* pTableData = new sEXCELLENT_DROP_TBLDAT;
+		sEXCELLENT_DROP_TBLDAT* pTableData = NewRow<sEXCELLENT_DROP_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -236,7 +238,7 @@ bool CExcellentDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -244,7 +246,7 @@ bool CExcellentDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
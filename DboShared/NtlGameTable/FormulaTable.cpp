@@ -199,10 +199,12 @@ bool CFormulaTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sFORMULA_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sFORMULA_TBLDAT* pTableData = new sFORMULA_TBLDAT;
+		sFORMULA_TBLDAT* pTableData = NewRow<sFORMULA_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -212,7 +214,7 @@ bool CFormulaTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -220,7 +222,7 @@ bool CFormulaTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if (false == AddTable(pTableData, bReload))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
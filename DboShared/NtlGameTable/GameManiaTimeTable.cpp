@@ -217,10 +217,12 @@ bool CGameManiaTimeTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sGMT_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sGMT_TBLDAT* pTableData = new sGMT_TBLDAT;
+		sGMT_TBLDAT* pTableData = NewRow<sGMT_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -230,7 +232,7 @@ bool CGameManiaTimeTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -238,7 +240,7 @@ bool CGameManiaTimeTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -171,10 +171,12 @@ bool CGuideHintTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sGUIDE_HINT_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sGUIDE_HINT_TBLDAT* pTableData = new sGUIDE_HINT_TBLDAT;
+		sGUIDE_HINT_TBLDAT* pTableData = NewRow<sGUIDE_HINT_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -184,7 +186,7 @@ bool CGuideHintTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -192,7 +194,7 @@ bool CGuideHintTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -400,10 +400,12 @@ bool CHLSItemTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sHLS_ITEM_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sHLS_ITEM_TBLDAT* pTableData = new sHLS_ITEM_TBLDAT;
+		sHLS_ITEM_TBLDAT* pTableData = NewRow<sHLS_ITEM_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -413,7 +415,7 @@ bool CHLSItemTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -421,7 +423,7 @@ bool CHLSItemTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -169,10 +169,12 @@ bool CHLSMerchantTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sHLS_MERCHANT_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sHLS_MERCHANT_TBLDAT* pTableData = new sHLS_MERCHANT_TBLDAT;
+		sHLS_MERCHANT_TBLDAT* pTableData = NewRow<sHLS_MERCHANT_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -182,7 +184,7 @@ bool CHLSMerchantTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -190,7 +192,7 @@ bool CHLSMerchantTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
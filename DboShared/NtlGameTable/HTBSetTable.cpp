@@ -260,10 +260,12 @@ bool CHTBSetTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sHTB_SET_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sHTB_SET_TBLDAT* pTableData = new sHTB_SET_TBLDAT;
+		sHTB_SET_TBLDAT* pTableData = NewRow<sHTB_SET_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -273,7 +275,7 @@ bool CHTBSetTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -281,7 +283,7 @@ bool CHTBSetTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
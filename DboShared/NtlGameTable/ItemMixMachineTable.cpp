@@ -216,10 +216,12 @@ bool CItemMixMachineTable::LoadFromBinary(CNtlSerializer& serializer, bool bRelo
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sITEM_MIX_MACHINE_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sITEM_MIX_MACHINE_TBLDAT* pTableData = new sITEM_MIX_MACHINE_TBLDAT;
+		sITEM_MIX_MACHINE_TBLDAT* pTableData = NewRow<sITEM_MIX_MACHINE_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -229,7 +231,7 @@ bool CItemMixMachineTable::LoadFromBinary(CNtlSerializer& serializer, bool bRelo
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -237,7 +239,7 @@ bool CItemMixMachineTable::LoadFromBinary(CNtlSerializer& serializer, bool bRelo
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -298,10 +298,12 @@ bool CItemOptionTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sITEM_OPTION_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sITEM_OPTION_TBLDAT* pTableData = new sITEM_OPTION_TBLDAT;
+		sITEM_OPTION_TBLDAT* pTableData = NewRow<sITEM_OPTION_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -311,7 +313,7 @@ bool CItemOptionTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -319,7 +321,7 @@ bool CItemOptionTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
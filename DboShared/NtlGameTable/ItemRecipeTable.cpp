@@ -325,10 +325,12 @@ bool CItemRecipeTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sITEM_RECIPE_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sITEM_RECIPE_TBLDAT* pTableData = new sITEM_RECIPE_TBLDAT;
+		sITEM_RECIPE_TBLDAT* pTableData = NewRow<sITEM_RECIPE_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -338,7 +340,7 @@ bool CItemRecipeTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -346,7 +348,7 @@ bool CItemRecipeTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -513,10 +513,12 @@ bool CItemTable::LoadFromBinary(CNtlSerializer & serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sITEM_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sITEM_TBLDAT* pTableData = new sITEM_TBLDAT;
+		sITEM_TBLDAT* pTableData = NewRow<sITEM_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -526,7 +528,7 @@ bool CItemTable::LoadFromBinary(CNtlSerializer & serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -534,7 +536,7 @@ bool CItemTable::LoadFromBinary(CNtlSerializer & serializer, bool bReload)
 		//  [4/26/2008 zeroera] : 설명 : 실패하더라도 Load의 종료여부는 File Loading에서 결정한다
 		if (false == AddTable(pTableData, bReload))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
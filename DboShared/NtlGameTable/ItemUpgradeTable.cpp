@@ -219,10 +219,12 @@ bool CItemUpgradeTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sITEM_UPGRADE_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sITEM_UPGRADE_TBLDAT* pTableData = new sITEM_UPGRADE_TBLDAT;
+		sITEM_UPGRADE_TBLDAT* pTableData = NewRow<sITEM_UPGRADE_TBLDAT>();
 		if ( NULL == pTableData )
 		{
 			//- yoshiki : To log system!
@@ -232,7 +234,7 @@ bool CItemUpgradeTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -240,7 +242,7 @@ bool CItemUpgradeTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -199,10 +199,12 @@ bool CLandMarkTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sLAND_MARK_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sLAND_MARK_TBLDAT* pTableData = new sLAND_MARK_TBLDAT;
+		sLAND_MARK_TBLDAT* pTableData = NewRow<sLAND_MARK_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -212,7 +214,7 @@ bool CLandMarkTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -220,7 +222,7 @@ bool CLandMarkTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
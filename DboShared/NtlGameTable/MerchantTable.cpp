@@ -197,10 +197,12 @@ bool CMerchantTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sMERCHANT_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sMERCHANT_TBLDAT* pTableData = new sMERCHANT_TBLDAT;
+		sMERCHANT_TBLDAT* pTableData = NewRow<sMERCHANT_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -210,7 +212,7 @@ bool CMerchantTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -218,7 +220,7 @@ bool CMerchantTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -177,10 +177,12 @@ bool CMobMovePatternTable::LoadFromBinary(CNtlSerializer& serializer, bool bRelo
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sMOVE_PATTERN_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sMOVE_PATTERN_TBLDAT* pTableData = new sMOVE_PATTERN_TBLDAT;
+		sMOVE_PATTERN_TBLDAT* pTableData = NewRow<sMOVE_PATTERN_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -190,7 +192,7 @@ bool CMobMovePatternTable::LoadFromBinary(CNtlSerializer& serializer, bool bRelo
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -198,7 +200,7 @@ bool CMobMovePatternTable::LoadFromBinary(CNtlSerializer& serializer, bool bRelo
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
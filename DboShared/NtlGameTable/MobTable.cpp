@@ -620,10 +620,12 @@ bool CMobTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sMOB_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sMOB_TBLDAT* pTableData = new sMOB_TBLDAT;
+		sMOB_TBLDAT* pTableData = NewRow<sMOB_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -635,7 +637,7 @@ bool CMobTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		// ⼭ return false Ѵ
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -643,7 +645,7 @@ bool CMobTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
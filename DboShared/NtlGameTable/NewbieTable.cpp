@@ -479,10 +479,12 @@ bool CNewbieTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sNEWBIE_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sNEWBIE_TBLDAT* pTableData = new sNEWBIE_TBLDAT;
+		sNEWBIE_TBLDAT* pTableData = NewRow<sNEWBIE_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -492,7 +494,7 @@ bool CNewbieTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -500,7 +502,7 @@ bool CNewbieTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -223,10 +223,12 @@ bool CNormalDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sNORMAL_DROP_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sNORMAL_DROP_TBLDAT* pTableData = new sNORMAL_DROP_TBLDAT;
+		sNORMAL_DROP_TBLDAT* pTableData = NewRow<sNORMAL_DROP_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -236,7 +238,7 @@ bool CNormalDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -244,7 +246,7 @@ bool CNormalDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
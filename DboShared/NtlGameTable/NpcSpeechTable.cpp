@@ -271,10 +271,12 @@ bool CNpcSpeechTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sNPC_SPEECH_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sNPC_SPEECH_TBLDAT* pTableData = new sNPC_SPEECH_TBLDAT;
+		sNPC_SPEECH_TBLDAT* pTableData = NewRow<sNPC_SPEECH_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -284,7 +286,7 @@ bool CNpcSpeechTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -292,7 +294,7 @@ bool CNpcSpeechTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -165,7 +165,7 @@ bool CObjectTable::SetTableData( void* pvTable, WCHAR* pwszSheetName, std::wstri
 		}																			\
 	}
 
-	static char szTemp[1024];
+	char szTemp[1024];
 
 	if ( 0 == wcscmp( pwszSheetName, L"Table_Data_KOR" ) )
 	{
@@ -352,10 +352,12 @@ bool CObjectTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sOBJECT_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sOBJECT_TBLDAT* pTableData = new sOBJECT_TBLDAT;
+		sOBJECT_TBLDAT* pTableData = NewRow<sOBJECT_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -365,7 +367,7 @@ bool CObjectTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -373,7 +375,7 @@ bool CObjectTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
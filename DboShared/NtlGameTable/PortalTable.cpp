@@ -225,10 +225,12 @@ bool CPortalTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sPORTAL_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sPORTAL_TBLDAT* pTableData = new sPORTAL_TBLDAT;
+		sPORTAL_TBLDAT* pTableData = NewRow<sPORTAL_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -238,7 +240,7 @@ bool CPortalTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -246,7 +248,7 @@ bool CPortalTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -189,10 +189,12 @@ bool CQuestDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sQUEST_DROP_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sQUEST_DROP_TBLDAT* pTableData = new sQUEST_DROP_TBLDAT;
+		sQUEST_DROP_TBLDAT* pTableData = NewRow<sQUEST_DROP_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -202,7 +204,7 @@ bool CQuestDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -210,7 +212,7 @@ bool CQuestDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
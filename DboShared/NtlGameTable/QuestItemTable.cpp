@@ -162,10 +162,12 @@ bool CQuestItemTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sQUESTITEM_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sQUESTITEM_TBLDAT* pTableData = new sQUESTITEM_TBLDAT;
+		sQUESTITEM_TBLDAT* pTableData = NewRow<sQUESTITEM_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -175,7 +177,7 @@ bool CQuestItemTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -183,7 +185,7 @@ bool CQuestItemTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
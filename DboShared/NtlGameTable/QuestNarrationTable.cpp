@@ -350,10 +350,12 @@ bool CQuestNarrationTable::LoadFromBinary(CNtlSerializer& serializer, bool bRelo
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sQUEST_NARRATION_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sQUEST_NARRATION_TBLDAT* pTableData = new sQUEST_NARRATION_TBLDAT;
+		sQUEST_NARRATION_TBLDAT* pTableData = NewRow<sQUEST_NARRATION_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -363,7 +365,7 @@ bool CQuestNarrationTable::LoadFromBinary(CNtlSerializer& serializer, bool bRelo
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -371,7 +373,7 @@ bool CQuestNarrationTable::LoadFromBinary(CNtlSerializer& serializer, bool bRelo
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -238,10 +238,12 @@ bool CQuestProbabilityTable::LoadFromBinary(CNtlSerializer& serializer, bool bRe
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sQUEST_PROBABILITY_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sQUEST_PROBABILITY_TBLDAT* pTableData = new sQUEST_PROBABILITY_TBLDAT;
+		sQUEST_PROBABILITY_TBLDAT* pTableData = NewRow<sQUEST_PROBABILITY_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			// Log : [11/29/2007 niam]
@@ -252,7 +254,7 @@ bool CQuestProbabilityTable::LoadFromBinary(CNtlSerializer& serializer, bool bRe
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -260,7 +262,7 @@ bool CQuestProbabilityTable::LoadFromBinary(CNtlSerializer& serializer, bool bRe
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -245,10 +245,12 @@ bool CQuestRewardTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sQUEST_REWARD_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sQUEST_REWARD_TBLDAT* pTableData = new sQUEST_REWARD_TBLDAT;
+		sQUEST_REWARD_TBLDAT* pTableData = NewRow<sQUEST_REWARD_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -258,7 +260,7 @@ bool CQuestRewardTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -266,7 +268,7 @@ bool CQuestRewardTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -163,7 +163,7 @@ bool CQuestTextDataTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 
 	while (0 < serializer.GetDataSize())
 	{
-		sQUEST_TEXT_DATA_TBLDAT* pTableData = new sQUEST_TEXT_DATA_TBLDAT;
+		sQUEST_TEXT_DATA_TBLDAT* pTableData = NewRow<sQUEST_TEXT_DATA_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -176,7 +176,7 @@ bool CQuestTextDataTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 		{
 			//- yoshiki : To log system!
 
-			delete pTableData;
+			DeleteRow(pTableData);
 
 			Destroy();
 			return false;
@@ -188,7 +188,7 @@ bool CQuestTextDataTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 		{
 			//- yoshiki : To log system!
 
-			delete pTableData;
+			DeleteRow(pTableData);
 
 			Destroy();
 			return false;
@@ -199,7 +199,7 @@ bool CQuestTextDataTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 		{
 			//- yoshiki : To log system!
 
-			delete pTableData;
+			DeleteRow(pTableData);
 
 			Destroy();
 			return false;
@@ -214,7 +214,7 @@ bool CQuestTextDataTable::LoadFromBinary(CNtlSerializer& serializer, bool bReloa
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 	};
 
@@ -158,7 +158,7 @@ bool CRankBattleTable::AddTable(void * pvTable, bool bReload)
 //-----------------------------------------------------------------------------------
 bool CRankBattleTable::SetTableData( void* pvTable, WCHAR* pwszSheetName, std::wstring* pstrDataName, BSTR bstrData )
 {
-	static char szTemp[1024] = { 0x00, };
+	char szTemp[1024] = { 0x00, };
 
 	if ( 0 == wcscmp( pwszSheetName, L"Table_Data_KOR" ) )
 	{
@@ -364,10 +364,12 @@ bool CRankBattleTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sRANKBATTLE_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sRANKBATTLE_TBLDAT* pTableData = new sRANKBATTLE_TBLDAT;
+		sRANKBATTLE_TBLDAT* pTableData = NewRow<sRANKBATTLE_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -377,7 +379,7 @@ bool CRankBattleTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -385,7 +387,7 @@ bool CRankBattleTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
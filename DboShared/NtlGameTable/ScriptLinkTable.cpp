@@ -151,10 +151,12 @@ bool CScriptLinkTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sSCRIPT_LINK_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sSCRIPT_LINK_TBLDAT* pTableData = new sSCRIPT_LINK_TBLDAT;
+		sSCRIPT_LINK_TBLDAT* pTableData = NewRow<sSCRIPT_LINK_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -164,7 +166,7 @@ bool CScriptLinkTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -172,7 +174,7 @@ bool CScriptLinkTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
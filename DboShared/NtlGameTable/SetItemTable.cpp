@@ -191,10 +191,12 @@ bool CSetItemTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sSET_ITEM_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sSET_ITEM_TBLDAT* pTableData = new sSET_ITEM_TBLDAT;
+		sSET_ITEM_TBLDAT* pTableData = NewRow<sSET_ITEM_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -204,7 +206,7 @@ bool CSetItemTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -212,7 +214,7 @@ bool CSetItemTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -465,10 +465,12 @@ bool CSkillTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sSKILL_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sSKILL_TBLDAT* pTableData = new sSKILL_TBLDAT;
+		sSKILL_TBLDAT* pTableData = NewRow<sSKILL_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -478,7 +480,7 @@ bool CSkillTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -486,7 +488,7 @@ bool CSkillTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -347,10 +347,12 @@ bool CSpawnTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sSPAWN_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sSPAWN_TBLDAT* pTableData = new sSPAWN_TBLDAT;
+		sSPAWN_TBLDAT* pTableData = NewRow<sSPAWN_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -360,7 +362,7 @@ bool CSpawnTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -368,7 +370,7 @@ bool CSpawnTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -213,10 +213,12 @@ bool CStatusTransformTable::LoadFromBinary(CNtlSerializer& serializer, bool bRel
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sSTATUS_TRANSFORM_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sSTATUS_TRANSFORM_TBLDAT* pTableData = new sSTATUS_TRANSFORM_TBLDAT;
+		sSTATUS_TRANSFORM_TBLDAT* pTableData = NewRow<sSTATUS_TRANSFORM_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -226,7 +228,7 @@ bool CStatusTransformTable::LoadFromBinary(CNtlSerializer& serializer, bool bRel
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -234,7 +236,7 @@ bool CStatusTransformTable::LoadFromBinary(CNtlSerializer& serializer, bool bRel
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -232,10 +232,12 @@ bool CSuperiorDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sSUPERIOR_DROP_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sSUPERIOR_DROP_TBLDAT* pTableData = new sSUPERIOR_DROP_TBLDAT;
+		sSUPERIOR_DROP_TBLDAT* pTableData = NewRow<sSUPERIOR_DROP_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -245,7 +247,7 @@ bool CSuperiorDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -253,7 +255,7 @@ bool CSuperiorDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -279,10 +279,12 @@ bool CSystemEffectTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sSYSTEM_EFFECT_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sSYSTEM_EFFECT_TBLDAT* pTableData = new sSYSTEM_EFFECT_TBLDAT;
+		sSYSTEM_EFFECT_TBLDAT* pTableData = NewRow<sSYSTEM_EFFECT_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -292,7 +294,7 @@ bool CSystemEffectTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -300,7 +302,7 @@ bool CSystemEffectTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -13,6 +13,7 @@
 #include "stdafx.h"
 #include "Table.h"
 #include "NtlXMLDoc.h"
+#include "TableXmlReader.h"
 #include "NtlDebug.h"
 #include "NtlSerializer.h"
 #include "NtlStringHandler.h"
@@ -20,6 +21,9 @@
 Dbo_TableErrorCallback CTable::m_pfnErrorCallback = NULL;
 void* CTable::m_pvErrorCallbackArg = NULL;
 
+// Set only on table loader worker threads.
+static __declspec(thread) std::vector<std::string>* s_pvecThreadErrorMessage = NULL;
+
 CTable::CTable(void)
 {
 	Init();
@@ -53,14 +57,31 @@ void CTable::Reset()
 {
 	for( TABLEIT it = m_mapTableList.begin(); it != m_mapTableList.end(); it++ )
 	{
-		delete it->second;
+		DeleteRow( it->second );
 	}
 
 	m_mapTableList.clear();
+	m_rowArena.Release();
 
 	::ZeroMemory(m_wszXmlFileName, sizeof(m_wszXmlFileName));
 }
 
+void CTable::DeleteRow(sTBLDAT* pTbldat)
+{
+	if (NULL == pTbldat)
+	{
+		return;
+	}
+
+	if (m_rowArena.IsOwner(pTbldat))
+	{
+		pTbldat->~sTBLDAT();
+		return;
+	}
+
+	delete pTbldat;
+}
+
 bool CTable::LoadFromXml(char* pszFileName, bool bReload)
 {
 	WCHAR* pwszFileName = Ntl_MB2WC(pszFileName);
@@ -83,6 +104,11 @@ bool CTable::LoadFromXml(WCHAR* pwszFileName, bool bReload)
 		return false;
 	}
 
+	return InitializeFromXmlFile(pwszFileName, bReload);
+}
+
+bool CTable::LoadFromXmlDoc(WCHAR* pwszFileName, bool bReload)
+{
 	CNtlXMLDoc doc;
 	doc.Create();
 
@@ -101,6 +127,42 @@ bool CTable::LoadFromXml(WCHAR* pwszFileName, bool bReload)
 	return InitializeFromXmlDoc(&doc, pwszFileName, bReload);
 }
 
+INT64 CTable::StringToInt64(const WCHAR* pwszString)
+{
+	while (L' ' == *pwszString || L'\t' == *pwszString || L'\r' == *pwszString || L'\n' == *pwszString)
+	{
+		pwszString++;
+	}
+
+	bool bNegative = false;
+	if (L'-' == *pwszString || L'+' == *pwszString)
+	{
+		bNegative = (L'-' == *pwszString);
+		pwszString++;
+	}
+
+	// Accumulates negatively so that _I64_MIN doesn't overflow.
+	INT64 nValue = 0;
+	while (L'0' <= *pwszString && L'9' >= *pwszString)
+	{
+		INT64 nDigit = *pwszString - L'0';
+		if (nValue < (_I64_MIN + nDigit) / 10)
+		{
+			return bNegative ? _I64_MIN : _I64_MAX;
+		}
+
+		nValue = nValue * 10 - nDigit;
+		pwszString++;
+	}
+
+	if (false != bNegative)
+	{
+		return nValue;
+	}
+
+	return (_I64_MIN == nValue) ? _I64_MAX : -nValue;
+}
+
 DWORD CTable::HexToDec(WCHAR* pwszHexString)
 {
 	if (NULL == pwszHexString)
@@ -139,6 +201,179 @@ DWORD CTable::HexToDec(WCHAR* pwszHexString)
 	return dwValue;
 }
 
+// Per sheet state of CTable::InitializeFromXmlFile().
+struct sXML_SHEET
+{
+	sXML_SHEET() : dwCellCount(0), bHasHeader(false), bIsEnded(false), iRowIndex(1) {}
+
+	// Taken from the first row of the sheet, by cell position.
+	std::vector<std::wstring>	vecFieldName;
+	DWORD						dwCellCount;
+	bool						bHasHeader;
+	bool						bIsEnded;
+	int							iRowIndex;
+};
+
+bool CTable::InitializeFromXmlFile(WCHAR* pwszFileName, bool bReload)
+{
+	CTableXmlReader reader;
+	if (false == reader.Open(pwszFileName))
+	{
+		if (false == reader.HasError())
+		{
+			return LoadFromXmlDoc(pwszFileName, bReload);
+		}
+
+		CTable::CallErrorCallbackFunction(L"[File] : %s\n[Error] : %s(Line : %u)", pwszFileName, reader.GetError(), reader.GetLineNumber());
+		return false;
+	}
+
+	if( false == bReload )
+	{
+		Reset();
+	}
+
+	// Stores the XML file name.
+	{
+		wcsncpy_s<_countof(m_wszXmlFileName)>(m_wszXmlFileName, pwszFileName, _countof(m_wszXmlFileName) - 1);
+		m_wszXmlFileName[_countof(m_wszXmlFileName) - 1] = L'\0';
+	}
+
+	WCHAR** ppwszSheetList = GetSheetListInWChar();
+
+	DWORD dwSheetCount = 0;
+	while (NULL != ppwszSheetList[dwSheetCount])
+	{
+		dwSheetCount++;
+	}
+
+	std::vector<sXML_SHEET> vecSheet(dwSheetCount);
+
+	// Rows are read in document order. Every sheet keeps its own header and row index,
+	// so the result is the same as querying "/dataroot/sheet[n]" row after row.
+	const WCHAR* pwszRowName = NULL;
+	while (false != reader.NextRow(&pwszRowName))
+	{
+		DWORD dwSheetIndex = 0;
+		while (dwSheetIndex < dwSheetCount && 0 != wcscmp(ppwszSheetList[dwSheetIndex], pwszRowName))
+		{
+			dwSheetIndex++;
+		}
+
+		if (dwSheetIndex >= dwSheetCount || false != vecSheet[dwSheetIndex].bIsEnded)
+		{
+			continue;
+		}
+
+		sXML_SHEET& sheet = vecSheet[dwSheetIndex];
+		WCHAR* pwszText = NULL;
+
+		// Retrieves field names.
+		if (false == sheet.bHasHeader)
+		{
+			sheet.bHasHeader = true;
+
+			bool bIsNameMissing = false;
+			while (false != reader.NextCell(&pwszText))
+			{
+				if (false == bIsNameMissing)
+				{
+					if (NULL == pwszText)
+					{
+						CTable::CallErrorCallbackFunction("[File] : %S\n[Error] : A field name may be null.(Index : %d)", pwszFileName, (int)sheet.dwCellCount);
+						bIsNameMissing = true;
+					}
+					else
+					{
+						sheet.vecFieldName.push_back(pwszText);
+					}
+				}
+
+				sheet.dwCellCount++;
+			}
+
+			continue;
+		}
+
+		// Retrieves data.
+		void* pvTable = AllocNewTable(ppwszSheetList[dwSheetIndex], m_dwCodePage);
+		if (NULL == pvTable)
+		{
+			return false;
+		}
+
+		bool bIsEndOfSheet = false;
+		DWORD dwCellIndex = 0;
+
+		while (false != reader.NextCell(&pwszText))
+		{
+			DWORD i = dwCellIndex++;
+			if (i >= sheet.dwCellCount)
+			{
+				continue;
+			}
+
+			if (i >= sheet.vecFieldName.size())
+			{
+				DeallocNewTable(pvTable, ppwszSheetList[dwSheetIndex]);
+				return false;
+			}
+
+			if (NULL == pwszText)
+			{
+				CTable::CallErrorCallbackFunction("[File] : %S\n[Error] : Table data is null.(Row Index : %d, Field Name = %S)", pwszFileName, sheet.iRowIndex - 1, sheet.vecFieldName[i].c_str());
+
+				if (0 == i)
+				{
+					bIsEndOfSheet = true;
+					break;
+				}
+
+				continue;
+			}
+
+			// The text is borrowed from the reader's buffer. No table keeps it after SetTableData().
+			SetTableData(pvTable, ppwszSheetList[dwSheetIndex], &(sheet.vecFieldName[i]), (BSTR)pwszText);
+		}
+
+		if (reader.HasError())
+		{
+			DeallocNewTable(pvTable, ppwszSheetList[dwSheetIndex]);
+			break;
+		}
+
+		if (0 == dwCellIndex || false != bIsEndOfSheet)
+		{
+			DeallocNewTable(pvTable, ppwszSheetList[dwSheetIndex]);
+			sheet.bIsEnded = true;
+			continue;
+		}
+
+		if ( false == AddTable( pvTable, bReload ) )
+		{
+			DeallocNewTable(pvTable, ppwszSheetList[dwSheetIndex]);
+		}
+
+		sheet.iRowIndex++;
+	}
+
+	if (reader.HasError())
+	{
+		CTable::CallErrorCallbackFunction(L"[File] : %s\n[Error] : %s(Line : %u)", pwszFileName, reader.GetError(), reader.GetLineNumber());
+		return false;
+	}
+
+	for (DWORD dwSheetIndex = 0; dwSheetIndex < dwSheetCount; dwSheetIndex++)
+	{
+		if (false == vecSheet[dwSheetIndex].bHasHeader)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 bool CTable::InitializeFromXmlDoc(CNtlXMLDoc* pXmlDoc, WCHAR* pwszFileName, bool bReload)
 {
 	if (NULL == pXmlDoc)
@@ -411,7 +646,7 @@ char CTable::READ_CHAR(BSTR bstr, const WCHAR* pwszFieldName, BYTE chInvalidValu
 		return chInvalidValue;
 	}
 
-	INT64 nTemp = _wtoi64(bstr);
+	INT64 nTemp = StringToInt64(bstr);
 	if( nTemp < -128 || nTemp > 127)
 	{
 		CTable::CallErrorCallbackFunction(L"[File] : %s\n[Error] : The value exceeds the max. value of the field!(Field Name = %s, Field Type = char, Value = %s)", m_wszXmlFileName, pwszFieldName, bstr);
@@ -433,7 +668,7 @@ BYTE CTable::READ_BYTE(BSTR bstr, const WCHAR* pwszFieldName, BYTE byInvalidValu
 		return byInvalidValue;
 	}
 
-	DWORD dwTemp = (DWORD)_wtoi64(bstr);
+	DWORD dwTemp = (DWORD)StringToInt64(bstr);
 	if( dwTemp >= INVALID_BYTE )
 	{
 		CTable::CallErrorCallbackFunction(L"[File] : %s\n[Error] : The value exceeds the max. value of the field!(Field Name = %s, Field Type = BYTE, Value = %s)", m_wszXmlFileName, pwszFieldName, bstr);
@@ -455,7 +690,7 @@ WORD CTable::READ_WORD(BSTR bstr, const WCHAR* pwszFieldName, WORD wInvalidValue
 		return wInvalidValue;
 	}
 
-	DWORD dwTemp = (DWORD)_wtoi64(bstr);
+	DWORD dwTemp = (DWORD)StringToInt64(bstr);
 	if( dwTemp >= INVALID_WORD )
 	{
 		CTable::CallErrorCallbackFunction(L"[File] : %s\n[Error] : The value exceeds the max. value of the field!(Field Name = %s, Field Type = WORD, Value = %s)", m_wszXmlFileName, pwszFieldName, bstr);
@@ -499,7 +734,7 @@ bool CTable::READ_BOOL(BSTR bstr, const WCHAR* pwszFieldName, bool bInvalidlValu
 		return bInvalidlValue;
 	}
 
-	DWORD dwTemp = (DWORD)_wtoi64(bstr);
+	DWORD dwTemp = (DWORD)StringToInt64(bstr);
 	if( dwTemp > (DWORD) true )
 	{
 		CTable::CallErrorCallbackFunction(L"[File] : %s\n[Error] : The value exceeds the max. value of the field!(Field Name = %s, Field Type = bool, Value = %s)", m_wszXmlFileName, pwszFieldName, bstr);
@@ -704,7 +939,7 @@ void CTable::SetErrorCallbackFunction(Dbo_TableErrorCallback pfnErrorCallback, v
 //-----------------------------------------------------------------------------------
 void CTable::CallErrorCallbackFunction(char* pszFormatString, ...)
 {
-	if (NULL != m_pfnErrorCallback)
+	if (NULL != m_pfnErrorCallback || NULL != s_pvecThreadErrorMessage)
 	{
 		char szErrorMessage[1024 + 1];
 
@@ -713,6 +948,12 @@ void CTable::CallErrorCallbackFunction(char* pszFormatString, ...)
 		vsprintf_s<_countof(szErrorMessage)>(szErrorMessage, pszFormatString, args);
 		va_end(args);
 
+		if (NULL != s_pvecThreadErrorMessage)
+		{
+			s_pvecThreadErrorMessage->push_back(szErrorMessage);
+			return;
+		}
+
 		m_pfnErrorCallback(szErrorMessage, m_pvErrorCallbackArg);
 	}
 }
@@ -724,7 +965,7 @@ void CTable::CallErrorCallbackFunction(char* pszFormatString, ...)
 //-----------------------------------------------------------------------------------
 void CTable::CallErrorCallbackFunction(WCHAR* pwszFormatString, ...)
 {
-	if (NULL != m_pfnErrorCallback)
+	if (NULL != m_pfnErrorCallback || NULL != s_pvecThreadErrorMessage)
 	{
 		WCHAR wszErrorMessage[1024 + 1];
 		char szErrorMessage[1024 + 1];
@@ -735,6 +976,23 @@ void CTable::CallErrorCallbackFunction(WCHAR* pwszFormatString, ...)
 		va_end(args);
 
 		::WideCharToMultiByte(::GetACP(), 0, wszErrorMessage, -1, szErrorMessage, _countof(szErrorMessage), NULL, NULL);
+
+		if (NULL != s_pvecThreadErrorMessage)
+		{
+			s_pvecThreadErrorMessage->push_back(szErrorMessage);
+			return;
+		}
+
 		m_pfnErrorCallback(szErrorMessage, m_pvErrorCallbackArg);
 	}
 }
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+void CTable::SetThreadErrorBuffer(std::vector<std::string>* pvecErrorMessage)
+{
+	s_pvecThreadErrorMessage = pvecErrorMessage;
+}
@@ -15,8 +15,12 @@
 #include "NtlSharedType.h"
 
 #include "NtlSerializer.h"
+#include "TableStorage.h"
 #include <comutil.h>
 #include <map>
+#include <new>
+#include <string>
+#include <vector>
 
 class CNtlSerializer;
 class CNtlXMLDoc;
@@ -85,6 +89,7 @@ public:
 		LOADING_METHOD_XML = 0,
 		LOADING_METHOD_BINARY,
 		LOADING_METHOD_SECURED_BINARY,
+		LOADING_METHOD_MAPPED_IMAGE,		// unencrypted, memory-mapped *.tbi (see CTableImage)
 
 		LOADING_METHOD_INVALID = 0xFFui8
 	};
@@ -96,7 +101,7 @@ public:
 
 public:
 
-	typedef std::map<TBLIDX, sTBLDAT *> TABLE;
+	typedef CTableIndex TABLE;
 	typedef TABLE::iterator TABLEIT;
 	typedef TABLE::value_type TABLEVAL;
 	
@@ -120,6 +125,42 @@ public:
 	virtual sTBLDAT *			FindData(TBLIDX tblidx) { (void) tblidx; return NULL; }
 	size_t GetNumberOfTables() { return m_mapTableList.size(); }
 
+protected:
+
+	// Rows created here are placed in m_rowArena instead of getting their own heap block.
+	// Release them with DeleteRow(), never with delete.
+	template <class TBLDAT>
+	TBLDAT*						NewRow()
+	{
+		void* pvRow = m_rowArena.Alloc(sizeof(TBLDAT));
+		if (NULL == pvRow)
+		{
+			return NULL;
+		}
+
+		return new (pvRow) TBLDAT;
+	}
+
+	// Sizes the arena for every fixed-size row left in the serializer, so the whole table
+	// ends up in one contiguous block. One extra slot covers the row whose read hits the
+	// end of the data.
+	template <class TBLDAT>
+	void						ReserveRows(CNtlSerializer& serializer)
+	{
+		int nRowDataSize = (int)(sizeof(TBLDAT) - sizeof(void*));
+		if (0 >= nRowDataSize || 0 >= serializer.GetDataSize())
+		{
+			return;
+		}
+
+		size_t nRowCount = (size_t)(serializer.GetDataSize() / nRowDataSize);
+
+		m_rowArena.Reserve(nRowCount + 1, sizeof(TBLDAT));
+		m_mapTableList.reserve(m_mapTableList.size() + nRowCount);
+	}
+
+	void						DeleteRow(sTBLDAT* pTbldat);
+
 protected:
 
 	virtual WCHAR** GetSheetListInWChar() = 0;
@@ -150,6 +191,11 @@ public:
 
 protected:
 
+	// Streams the file through CTableXmlReader, files it can't decode go through LoadFromXmlDoc().
+	virtual bool				InitializeFromXmlFile(WCHAR* pwszFileName, bool bReload);
+
+	bool						LoadFromXmlDoc(WCHAR* pwszFileName, bool bReload);
+
 	virtual bool				InitializeFromXmlDoc(CNtlXMLDoc* pXmlDoc, WCHAR* pwszFileName, bool bReload);
 
 
@@ -157,15 +203,18 @@ protected:
 
 	bool						CheckInvalidValue(BSTR bstr) { return bstr[0] == L'@' ? true : false; }
 
+	// Same result as _wtoi64() for the decimal numbers the tables hold, without the locale and errno handling.
+	static INT64				StringToInt64(const WCHAR* pwszString);
+
 	char						READ_CHAR(BSTR bstr, const WCHAR* pwszFieldName, BYTE chInvalidValue = 0);
 
 	BYTE						READ_BYTE(BSTR bstr, const WCHAR* pwszFieldName, BYTE byInvalidValue = INVALID_BYTE);
 
 	WORD						READ_WORD(BSTR bstr, const WCHAR* pwszFieldName, WORD wInvalidValue = INVALID_WORD);
 
-	DWORD						READ_DWORD(BSTR bstr, DWORD dwInvalidValue = INVALID_DWORD){ return CheckInvalidValue( bstr ) ? dwInvalidValue : (DWORD)(_wtoi64(bstr));}
+	DWORD						READ_DWORD(BSTR bstr, DWORD dwInvalidValue = INVALID_DWORD){ return CheckInvalidValue( bstr ) ? dwInvalidValue : (DWORD)(StringToInt64(bstr));}
 
-	TBLIDX						READ_TBLIDX(BSTR bstr, DWORD dwInvalidValue = INVALID_TBLIDX){ return CheckInvalidValue( bstr ) ? dwInvalidValue : (DWORD)(_wtoi64(bstr));}
+	TBLIDX						READ_TBLIDX(BSTR bstr, DWORD dwInvalidValue = INVALID_TBLIDX){ return CheckInvalidValue( bstr ) ? dwInvalidValue : (DWORD)(StringToInt64(bstr));}
 
 	FLOAT						READ_FLOAT(BSTR bstr, const WCHAR* pwszFieldName, float fInvalidValue = INVALID_FLOAT);
 
@@ -195,11 +244,16 @@ public:
 
 	static void					CallErrorCallbackFunction(WCHAR* pwszFormatString, ...);
 
+	// While a buffer is set, error messages raised on the calling thread are stored in it instead of being passed to the callback.
+	static void					SetThreadErrorBuffer(std::vector<std::string>* pvecErrorMessage);
+
 	WCHAR*						GetWszXmlFileName() { return m_wszXmlFileName; }
 protected:
 
 	TABLE						m_mapTableList;
 
+	CTableRowArena				m_rowArena;
+
 protected:
 	DWORD						m_dwCodePage;
 
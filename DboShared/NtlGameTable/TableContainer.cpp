@@ -100,55 +100,78 @@
 #include "HLSItemTable.h"
 #include "HLSMerchantTable.h"
 
+#include "TableImage.h"
+#include "TableLoader.h"
+
 #include "NtlFileSerializer.h"
 #include "NtlStringHandler.h"
 #include "NtlBitFlagManager.h"
 
+//-----------------------------------------------------------------------------------
+// Tables whose loading writes static state. CTableLoader doesn't run them on a worker;
+// they are loaded on the calling thread like the serial loader does.
+//
+//	CFormulaTable	: AddTable() fills the static CFormulaTable::m_afRate and Init()/Destroy() clear it.
+//-----------------------------------------------------------------------------------
+template <class TABLE_CLASS> struct sTABLE_SERIAL_LOAD { enum { VALUE = false }; };
+template <> struct sTABLE_SERIAL_LOAD<CFormulaTable> { enum { VALUE = true }; };
+
 #define DBO_CREATE_TABLE(table_class_name, serializer, file_name_without_extension, table_pointer_variable, table_call_back)		\
 	{																											\
-		if (NULL != table_pointer_variable)																		\
-		{																										\
-			CTable::CallErrorCallbackFunction("The table is already created.(Table : %s)", #table_class_name);	\
-			delete table_pointer_variable;																		\
-		}																										\
-		table_class_name* pTable = new table_class_name;														\
-		if (NULL == pTable)																						\
-		{																										\
-			CTable::CallErrorCallbackFunction("new operation failed.(Table : %s)", #table_class_name);			\
-			Destroy();																							\
-			return false;																						\
-		}																										\
-		if (false == pTable->Create(m_dwCodePage))																\
-		{																										\
-			CTable::CallErrorCallbackFunction("%s::Create() failed.(Table : %s)", #table_class_name);			\
-			delete pTable;																						\
-																												\
-			Destroy();																							\
-			return false;																						\
-		}																										\
-		if (NULL == table_call_back)																			\
+		if (NULL != m_pTableLoader && false == sTABLE_SERIAL_LOAD<table_class_name>::VALUE)						\
 		{																										\
-			if (false == InitializeTable(pTable, serializer, file_name_without_extension, table_call_back))		\
+			if (false == m_pTableLoader->AddJob(new CTableCreateJob<table_class_name>(this, #table_class_name, file_name_without_extension, &table_pointer_variable, table_call_back)))	\
 			{																									\
-				CTable::CallErrorCallbackFunction("InitializeTable() failed.(Table : %s)", #table_class_name);	\
-				delete pTable;																					\
-																												\
 				Destroy();																						\
 				return false;																					\
 			}																									\
 		}																										\
 		else																									\
 		{																										\
-			if (false == InitializePackTable(pTable, serializer, file_name_without_extension, table_call_back))	\
+			if (NULL != table_pointer_variable)																	\
+			{																									\
+				CTable::CallErrorCallbackFunction("The table is already created.(Table : %s)", #table_class_name);	\
+				delete table_pointer_variable;																	\
+			}																									\
+			table_class_name* pTable = new table_class_name;													\
+			if (NULL == pTable)																					\
 			{																									\
-				CTable::CallErrorCallbackFunction("InitializeTable() failed.(Table : %s)", #table_class_name);	\
+				CTable::CallErrorCallbackFunction("new operation failed.(Table : %s)", #table_class_name);		\
+				Destroy();																						\
+				return false;																					\
+			}																									\
+			if (false == pTable->Create(m_dwCodePage))															\
+			{																									\
+				CTable::CallErrorCallbackFunction("%s::Create() failed.(Table : %s)", #table_class_name);		\
 				delete pTable;																					\
 																												\
 				Destroy();																						\
 				return false;																					\
 			}																									\
+			if (NULL == table_call_back)																		\
+			{																									\
+				if (false == InitializeTable(pTable, serializer, file_name_without_extension, table_call_back))	\
+				{																								\
+					CTable::CallErrorCallbackFunction("InitializeTable() failed.(Table : %s)", #table_class_name);	\
+					delete pTable;																				\
+																												\
+					Destroy();																					\
+					return false;																				\
+				}																								\
+			}																									\
+			else																								\
+			{																									\
+				if (false == InitializePackTable(pTable, serializer, file_name_without_extension, table_call_back))	\
+				{																								\
+					CTable::CallErrorCallbackFunction("InitializeTable() failed.(Table : %s)", #table_class_name);	\
+					delete pTable;																				\
+																												\
+					Destroy();																					\
+					return false;																				\
+				}																								\
+			}																									\
+			table_pointer_variable = pTable;																	\
 		}																										\
-		table_pointer_variable = pTable;																		\
 	}																											\
 
 #define DBO_RELOAD_TABLE(table_class_name, serializer, file_name_without_extension, table_pointer_variable)		\
@@ -167,20 +190,31 @@
 
 #define DBO_CREATE_AND_REGISTER_TABLE(table_class_name, serializer, file_name_without_extension, table_map, tblidx, table_call_back)		\
 	{																													\
-		table_class_name* pNewTable = NULL;																				\
-		DBO_CREATE_TABLE(table_class_name, serializer, file_name_without_extension, pNewTable, table_call_back);							\
-																														\
-		if (false == table_map.insert(std::pair<TBLIDX, table_class_name*>(tblidx, pNewTable)).second)					\
+		if (NULL != m_pTableLoader && false == sTABLE_SERIAL_LOAD<table_class_name>::VALUE)								\
+		{																												\
+			if (false == m_pTableLoader->AddJob(new CTableCreateJob<table_class_name>(this, #table_class_name, file_name_without_extension, &table_map, tblidx, table_call_back)))	\
+			{																											\
+				Destroy();																								\
+				return false;																							\
+			}																											\
+		}																												\
+		else																											\
 		{																												\
-			_ASSERTE( !"table_map.insert Fail");																		\
-			delete pNewTable;																							\
+			table_class_name* pNewTable = NULL;																			\
+			DBO_CREATE_TABLE(table_class_name, serializer, file_name_without_extension, pNewTable, table_call_back);						\
 																														\
-			Destroy();																									\
-			return false;																								\
+			if (false == table_map.insert(std::pair<TBLIDX, table_class_name*>(tblidx, pNewTable)).second)				\
+			{																											\
+				_ASSERTE( !"table_map.insert Fail");																	\
+				delete pNewTable;																						\
+																														\
+				Destroy();																								\
+				return false;																							\
+			}																											\
 		}																												\
 	}
 
-#define DBO_EXPORT_TABLE(table_object_pointer, serializer, file_name_without_extension, need_to_encrypt)		\
+#define DBO_EXPORT_TABLE(table_object_pointer, serializer, file_name_without_extension, save_method)			\
 	{																											\
 		serializer.Refresh();																					\
 																												\
@@ -189,7 +223,13 @@
 		wstrFullPath = m_wstrPath;																				\
 		wstrFullPath += L"\\";																					\
 		wstrFullPath += file_name_without_extension;															\
-		if (false == need_to_encrypt)																			\
+		if (CTable::LOADING_METHOD_MAPPED_IMAGE == save_method)													\
+		{																										\
+			wstrFullPath += L".tbi";																			\
+																												\
+			SaveTableImage(table_object_pointer, (WCHAR*)(wstrFullPath.c_str()));								\
+		}																										\
+		else if (CTable::LOADING_METHOD_SECURED_BINARY != save_method)											\
 		{																										\
 			wstrFullPath += L".rdf";																			\
 																												\
@@ -212,7 +252,7 @@
 		}																										\
 	}
 
-#define DBO_EXPORT_REGISTERED_TABLE(table_class_name, serializer, file_name_without_extension, need_to_encrypt, table_map, tblidx)		\
+#define DBO_EXPORT_REGISTERED_TABLE(table_class_name, serializer, file_name_without_extension, save_method, table_map, tblidx)    		\
 	{																																	\
 		std::map<TBLIDX, table_class_name*>::iterator iter;																				\
 		iter = table_map.find(tblidx);																									\
@@ -222,11 +262,182 @@
 			table_class_name* pTable = iter->second;																					\
 			if (NULL != pTable)																											\
 			{																															\
-				DBO_EXPORT_TABLE(pTable, serializer, file_name_without_extension, need_to_encrypt);										\
+				DBO_EXPORT_TABLE(pTable, serializer, file_name_without_extension, save_method);														\
 			}																															\
 		}																																\
 	}
 
+//-----------------------------------------------------------------------------------
+// Creates one table on a CTableLoader worker. The table reaches the container only
+// in Commit(), so a failed or discarded job never leaves a half-loaded table behind.
+//-----------------------------------------------------------------------------------
+template <class TABLE_CLASS>
+class CTableContainer::CTableCreateJob : public CTableLoadJob
+{
+public:
+
+	typedef std::map<TBLIDX, TABLE_CLASS*> TABLE_MAP;
+
+public:
+
+	CTableCreateJob(CTableContainer* pContainer, const char* pszClassName, WCHAR* pwszFileNameWithoutExtension, TABLE_CLASS** ppTable, ICallBack* pCall)
+		:m_pContainer(pContainer)
+		,m_pszClassName(pszClassName)
+		,m_pCall(pCall)
+		,m_pTable(NULL)
+		,m_ppTable(ppTable)
+		,m_pTableMap(NULL)
+		,m_tblidx(INVALID_TBLIDX)
+	{
+		if (NULL != pwszFileNameWithoutExtension)
+		{
+			m_wstrFileName = pwszFileNameWithoutExtension;
+		}
+	}
+
+	CTableCreateJob(CTableContainer* pContainer, const char* pszClassName, WCHAR* pwszFileNameWithoutExtension, TABLE_MAP* pTableMap, TBLIDX tblidx, ICallBack* pCall)
+		:m_pContainer(pContainer)
+		,m_pszClassName(pszClassName)
+		,m_pCall(pCall)
+		,m_pTable(NULL)
+		,m_ppTable(NULL)
+		,m_pTableMap(pTableMap)
+		,m_tblidx(tblidx)
+	{
+		if (NULL != pwszFileNameWithoutExtension)
+		{
+			m_wstrFileName = pwszFileNameWithoutExtension;
+		}
+	}
+
+	virtual ~CTableCreateJob(void)
+	{
+		if (NULL != m_pTable)
+		{
+			delete m_pTable;
+		}
+	}
+
+public:
+
+	virtual bool Load(CNtlFileSerializer& serializer)
+	{
+		m_pTable = new TABLE_CLASS;
+		if (NULL == m_pTable)
+		{
+			CTable::CallErrorCallbackFunction("new operation failed.(Table : %s)", m_pszClassName);
+			return false;
+		}
+		if (false == m_pTable->Create(m_pContainer->m_dwCodePage))
+		{
+			CTable::CallErrorCallbackFunction("%s::Create() failed.(Table : %s)", m_pszClassName, m_pszClassName);
+			return false;
+		}
+
+		bool bResult = false;
+		if (NULL == m_pCall)
+		{
+			bResult = m_pContainer->InitializeTable(m_pTable, serializer, (WCHAR*)m_wstrFileName.c_str(), m_pCall);
+		}
+		else
+		{
+			bResult = m_pContainer->InitializePackTable(m_pTable, serializer, (WCHAR*)m_wstrFileName.c_str(), m_pCall);
+		}
+
+		if (false == bResult)
+		{
+			CTable::CallErrorCallbackFunction("InitializeTable() failed.(Table : %s)", m_pszClassName);
+			return false;
+		}
+
+		return true;
+	}
+
+	virtual bool Commit(void)
+	{
+		if (NULL != m_ppTable)
+		{
+			if (NULL != *m_ppTable)
+			{
+				CTable::CallErrorCallbackFunction("The table is already created.(Table : %s)", m_pszClassName);
+				delete *m_ppTable;
+			}
+
+			*m_ppTable = m_pTable;
+		}
+		else
+		{
+			if (false == m_pTableMap->insert(std::pair<TBLIDX, TABLE_CLASS*>(m_tblidx, m_pTable)).second)
+			{
+				_ASSERTE( !"table_map.insert Fail");
+				return false;
+			}
+		}
+
+		m_pTable = NULL;
+
+		return true;
+	}
+
+protected:
+
+	CTableContainer*				m_pContainer;
+
+	const char*						m_pszClassName;
+
+	std::wstring					m_wstrFileName;
+
+	ICallBack*						m_pCall;
+
+	TABLE_CLASS*					m_pTable;
+
+	// Exactly one of them is set.
+	TABLE_CLASS**					m_ppTable;
+
+	TABLE_MAP*						m_pTableMap;
+
+	TBLIDX							m_tblidx;
+};
+
+
+//-----------------------------------------------------------------------------------
+// The pack callback reads from shared pack files, so the loading threads go
+// through it one at a time. Only the read is serialized, not the parsing.
+//-----------------------------------------------------------------------------------
+class CTablePackCallBackLock : public CTableContainer::ICallBack
+{
+public:
+
+	CTablePackCallBackLock(CTableContainer::ICallBack* pCall)
+		:m_pCall(pCall)
+	{
+		::InitializeCriticalSection(&m_lock);
+	}
+
+	virtual ~CTablePackCallBackLock(void)
+	{
+		::DeleteCriticalSection(&m_lock);
+	}
+
+public:
+
+	virtual bool Call(const char* pfilename, CNtlFileSerializer* pSeralize, const char* pszCryptPassword)
+	{
+		::EnterCriticalSection(&m_lock);
+		bool bResult = m_pCall->Call(pfilename, pSeralize, pszCryptPassword);
+		::LeaveCriticalSection(&m_lock);
+
+		return bResult;
+	}
+
+protected:
+
+	CTableContainer::ICallBack*		m_pCall;
+
+	CRITICAL_SECTION				m_lock;
+};
+
+
 //-----------------------------------------------------------------------------------
 //		Purpose	:
 //		Return	:
@@ -347,6 +558,8 @@ void CTableContainer::Init()
 	m_pHLSItemTable = NULL;
 	m_pHLSMerchantTable = NULL;
 
+	m_dwLoadingThreadCount = 1;
+	m_pTableLoader = NULL;
 }
 
 
@@ -392,6 +605,22 @@ bool CTableContainer::Create(CNtlBitFlagManager& rTableFlag, WCHAR* pwszPath, CT
 	m_dwCodePage = dwCodePage;
 
 	CNtlFileSerializer serializer;
+
+	CTablePackCallBackLock packCallBackLock(pCall);
+
+	if (1 != m_dwLoadingThreadCount)
+	{
+		m_pTableLoader = new CTableLoader;
+		if (NULL == m_pTableLoader || false == m_pTableLoader->Create(m_dwLoadingThreadCount))
+		{
+			// Falls back to the serial loading.
+			DestroyTableLoader();
+		}
+		else if (NULL != pCall)
+		{
+			pCall = &packCallBackLock;
+		}
+	}
 	
 	//--------------------------------------------------------------------------------
 	// Character
@@ -599,6 +828,13 @@ bool CTableContainer::Create(CNtlBitFlagManager& rTableFlag, WCHAR* pwszPath, CT
 	{
 		DBO_CREATE_TABLE(CWorldPlayTable, serializer, pFileNameList->GetFileNameW(TABLE_WORLD_PLAY), m_pWorldPlayTable, pCall);
 	}
+
+	// The object and spawn tables are listed in the world table.
+	if (false == WaitLoadingTables())
+	{
+		Destroy();
+		return false;
+	}
 	if (false != rTableFlag.IsSet(TABLE_OBJECT))
 	{
 		for (CTable::TABLEIT iter = m_pWorldTable->Begin() ; m_pWorldTable->End() != iter ; iter++)
@@ -825,16 +1061,58 @@ bool CTableContainer::Create(CNtlBitFlagManager& rTableFlag, WCHAR* pwszPath, CT
 		DBO_CREATE_TABLE(CHLSItemTable, serializer, pFileNameList->GetFileNameW(TABLE_HLS_ITEM), m_pHLSItemTable, pCall);
 	}
 
+	bool bResult = WaitLoadingTables();
+
+	DestroyTableLoader();
+
+	if (false == bResult)
+	{
+		Destroy();
+		return false;
+	}
+
 	return true;
 }
 
 
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+bool CTableContainer::WaitLoadingTables()
+{
+	if (NULL == m_pTableLoader)
+	{
+		return true;
+	}
+
+	return m_pTableLoader->Wait();
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+void CTableContainer::DestroyTableLoader()
+{
+	if (NULL != m_pTableLoader)
+	{
+		delete m_pTableLoader;
+		m_pTableLoader = NULL;
+	}
+}
+
+
 //-----------------------------------------------------------------------------------
 //		Purpose	:
 //		Return	:
 //-----------------------------------------------------------------------------------
 void CTableContainer::Destroy()
 {
+	// The workers still read the path and the loading method.
+	DestroyTableLoader();
+
 	m_wstrPath.clear();
 	m_eLoadingMethod = CTable::LOADING_METHOD_INVALID;
 	m_dwCodePage = 0;
@@ -1445,6 +1723,16 @@ bool CTableContainer::Reload(CNtlBitFlagManager& rTableFlag, CTableFileNameList*
 //		Return	:
 //-----------------------------------------------------------------------------------
 bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameList* pFileNameList, bool bNeedToEncrypt)
+{
+	return SaveToFile(rTableFlag, pFileNameList, bNeedToEncrypt ? CTable::LOADING_METHOD_SECURED_BINARY : CTable::LOADING_METHOD_BINARY);
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameList* pFileNameList, CTable::eLOADING_METHOD eSaveMethod)
 {
 	CNtlFileSerializer serializer;
 
@@ -1453,43 +1741,43 @@ bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameL
 	//--------------------------------------------------------------------------------
 	if (false != rTableFlag.IsSet(TABLE_EXP))
 	{
-		DBO_EXPORT_TABLE(m_pExpTable, serializer, pFileNameList->GetFileNameW(TABLE_EXP), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pExpTable, serializer, pFileNameList->GetFileNameW(TABLE_EXP), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_HELP))
 	{
-		DBO_EXPORT_TABLE(m_pHelpTable, serializer, pFileNameList->GetFileNameW(TABLE_HELP), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pHelpTable, serializer, pFileNameList->GetFileNameW(TABLE_HELP), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_MERCHANT))
 	{
-		DBO_EXPORT_TABLE(m_pMerchantTable, serializer, pFileNameList->GetFileNameW(TABLE_MERCHANT), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pMerchantTable, serializer, pFileNameList->GetFileNameW(TABLE_MERCHANT), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_MOB))
 	{
-		DBO_EXPORT_TABLE(m_pMobTable, serializer, pFileNameList->GetFileNameW(TABLE_MOB), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pMobTable, serializer, pFileNameList->GetFileNameW(TABLE_MOB), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_NEWBIE))
 	{
-		DBO_EXPORT_TABLE(m_pNewbieTable, serializer, pFileNameList->GetFileNameW(TABLE_NEWBIE), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pNewbieTable, serializer, pFileNameList->GetFileNameW(TABLE_NEWBIE), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_NPC))
 	{
-		DBO_EXPORT_TABLE(m_pNpcTable, serializer, pFileNameList->GetFileNameW(TABLE_NPC), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pNpcTable, serializer, pFileNameList->GetFileNameW(TABLE_NPC), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_PC))
 	{
-		DBO_EXPORT_TABLE(m_pPcTable, serializer, pFileNameList->GetFileNameW(TABLE_PC), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pPcTable, serializer, pFileNameList->GetFileNameW(TABLE_PC), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_STATUS_TRANSFORM))
 	{
-		DBO_EXPORT_TABLE(m_pStatusTransformTable, serializer, pFileNameList->GetFileNameW(TABLE_STATUS_TRANSFORM), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pStatusTransformTable, serializer, pFileNameList->GetFileNameW(TABLE_STATUS_TRANSFORM), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_GAME_MANIA_TIME))
 	{
-		DBO_EXPORT_TABLE(m_pGameManiaTimeTable, serializer, pFileNameList->GetFileNameW(TABLE_GAME_MANIA_TIME), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pGameManiaTimeTable, serializer, pFileNameList->GetFileNameW(TABLE_GAME_MANIA_TIME), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_GUIDE_HINT))
 	{
-		DBO_EXPORT_TABLE(m_pGuideHintTable, serializer, pFileNameList->GetFileNameW(TABLE_GUIDE_HINT), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pGuideHintTable, serializer, pFileNameList->GetFileNameW(TABLE_GUIDE_HINT), eSaveMethod);
 	}
 	//--------------------------------------------------------------------------------
 
@@ -1498,55 +1786,55 @@ bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameL
 	//--------------------------------------------------------------------------------
 	if (false != rTableFlag.IsSet(TABLE_BASIC_DROP))
 	{
-		DBO_EXPORT_TABLE(m_pBasicDropTable, serializer, pFileNameList->GetFileNameW(TABLE_BASIC_DROP), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pBasicDropTable, serializer, pFileNameList->GetFileNameW(TABLE_BASIC_DROP), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_ITEM_OPTION))
 	{
-		DBO_EXPORT_TABLE(m_pItemOptionTable, serializer, pFileNameList->GetFileNameW(TABLE_ITEM_OPTION), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pItemOptionTable, serializer, pFileNameList->GetFileNameW(TABLE_ITEM_OPTION), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_ITEM))
 	{
-		DBO_EXPORT_TABLE(m_pItemTable, serializer, pFileNameList->GetFileNameW(TABLE_ITEM), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pItemTable, serializer, pFileNameList->GetFileNameW(TABLE_ITEM), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_NORMAL_DROP))
 	{
-		DBO_EXPORT_TABLE(m_pNormalDropTable, serializer, pFileNameList->GetFileNameW(TABLE_NORMAL_DROP), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pNormalDropTable, serializer, pFileNameList->GetFileNameW(TABLE_NORMAL_DROP), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_LEGENDARY_DROP))
 	{
-		DBO_EXPORT_TABLE(m_pLegendaryDropTable, serializer, pFileNameList->GetFileNameW(TABLE_LEGENDARY_DROP), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pLegendaryDropTable, serializer, pFileNameList->GetFileNameW(TABLE_LEGENDARY_DROP), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_SUPERIOR_DROP))
 	{
-		DBO_EXPORT_TABLE(m_pSuperiorDropTable, serializer, pFileNameList->GetFileNameW(TABLE_SUPERIOR_DROP), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pSuperiorDropTable, serializer, pFileNameList->GetFileNameW(TABLE_SUPERIOR_DROP), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_EACH_DROP))
 	{
-		DBO_EXPORT_TABLE(m_pEachDropTable, serializer, pFileNameList->GetFileNameW(TABLE_EACH_DROP), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pEachDropTable, serializer, pFileNameList->GetFileNameW(TABLE_EACH_DROP), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_TYPE_DROP))
 	{
-		DBO_EXPORT_TABLE(m_pTypeDropTable, serializer, pFileNameList->GetFileNameW(TABLE_TYPE_DROP), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pTypeDropTable, serializer, pFileNameList->GetFileNameW(TABLE_TYPE_DROP), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_USE_ITEM))
 	{
-		DBO_EXPORT_TABLE(m_pUseItemTable, serializer, pFileNameList->GetFileNameW(TABLE_USE_ITEM), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pUseItemTable, serializer, pFileNameList->GetFileNameW(TABLE_USE_ITEM), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_SET_ITEM))
 	{
-		DBO_EXPORT_TABLE(m_pSetItemTable, serializer, pFileNameList->GetFileNameW(TABLE_SET_ITEM), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pSetItemTable, serializer, pFileNameList->GetFileNameW(TABLE_SET_ITEM), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_DRAGONBALL))
 	{
-		DBO_EXPORT_TABLE(m_pDragonBallTable, serializer, pFileNameList->GetFileNameW(TABLE_DRAGONBALL), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pDragonBallTable, serializer, pFileNameList->GetFileNameW(TABLE_DRAGONBALL), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_DRAGONBALL_REWARD))
 	{
-		DBO_EXPORT_TABLE(m_pDragonBallRewardTable, serializer, pFileNameList->GetFileNameW(TABLE_DRAGONBALL_REWARD), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pDragonBallRewardTable, serializer, pFileNameList->GetFileNameW(TABLE_DRAGONBALL_REWARD), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_EXCELLENT_DROP))
 	{
-		DBO_EXPORT_TABLE(m_pExcellentDropTable, serializer, pFileNameList->GetFileNameW(TABLE_EXCELLENT_DROP), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pExcellentDropTable, serializer, pFileNameList->GetFileNameW(TABLE_EXCELLENT_DROP), eSaveMethod);
 	}
 	//--------------------------------------------------------------------------------
 
@@ -1555,19 +1843,19 @@ bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameL
 	//--------------------------------------------------------------------------------
 	if (false != rTableFlag.IsSet(TABLE_ACTION))
 	{
-		DBO_EXPORT_TABLE(m_pActionTable, serializer, pFileNameList->GetFileNameW(TABLE_ACTION), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pActionTable, serializer, pFileNameList->GetFileNameW(TABLE_ACTION), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_CHAT_COMMAND))
 	{
-		DBO_EXPORT_TABLE(m_pChatCommandTable, serializer, pFileNameList->GetFileNameW(TABLE_CHAT_COMMAND), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pChatCommandTable, serializer, pFileNameList->GetFileNameW(TABLE_CHAT_COMMAND), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_DIRECTION_LINK))
 	{
-		DBO_EXPORT_TABLE(m_pDirectionLinkTable, serializer, pFileNameList->GetFileNameW(TABLE_DIRECTION_LINK), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pDirectionLinkTable, serializer, pFileNameList->GetFileNameW(TABLE_DIRECTION_LINK), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_FORMULA))
 	{
-		DBO_EXPORT_TABLE(m_pFormulaTable, serializer, pFileNameList->GetFileNameW(TABLE_FORMULA), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pFormulaTable, serializer, pFileNameList->GetFileNameW(TABLE_FORMULA), eSaveMethod);
 	}
 	//--------------------------------------------------------------------------------
 
@@ -1576,7 +1864,7 @@ bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameL
 	//--------------------------------------------------------------------------------
 	if (false != rTableFlag.IsSet(TABLE_CHARM))
 	{
-		DBO_EXPORT_TABLE(m_pCharmTable, serializer, pFileNameList->GetFileNameW(TABLE_CHARM), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pCharmTable, serializer, pFileNameList->GetFileNameW(TABLE_CHARM), eSaveMethod);
 	}
 	//--------------------------------------------------------------------------------
 
@@ -1585,23 +1873,23 @@ bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameL
 	//--------------------------------------------------------------------------------
 	if (false != rTableFlag.IsSet(TABLE_QUEST_DROP))
 	{
-		DBO_EXPORT_TABLE(m_pQuestDropTable, serializer, pFileNameList->GetFileNameW(TABLE_QUEST_DROP), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pQuestDropTable, serializer, pFileNameList->GetFileNameW(TABLE_QUEST_DROP), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_QUEST_ITEM))
 	{
-		DBO_EXPORT_TABLE(m_pQuestItemTable, serializer, pFileNameList->GetFileNameW(TABLE_QUEST_ITEM), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pQuestItemTable, serializer, pFileNameList->GetFileNameW(TABLE_QUEST_ITEM), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_QUEST_PROBABILITY))
 	{
-		DBO_EXPORT_TABLE(m_pQuestProbalityTable, serializer, pFileNameList->GetFileNameW(TABLE_QUEST_PROBABILITY), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pQuestProbalityTable, serializer, pFileNameList->GetFileNameW(TABLE_QUEST_PROBABILITY), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_QUEST_TEXT_DATA))
 	{
-		DBO_EXPORT_TABLE(m_pQuestTextDataTable, serializer, pFileNameList->GetFileNameW(TABLE_QUEST_TEXT_DATA), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pQuestTextDataTable, serializer, pFileNameList->GetFileNameW(TABLE_QUEST_TEXT_DATA), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_QUEST_REWARD))
 	{
-		DBO_EXPORT_TABLE(m_pQuestRewardTable, serializer, pFileNameList->GetFileNameW(TABLE_QUEST_REWARD), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pQuestRewardTable, serializer, pFileNameList->GetFileNameW(TABLE_QUEST_REWARD), eSaveMethod);
 	}
 	//--------------------------------------------------------------------------------
 
@@ -1610,15 +1898,15 @@ bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameL
 	//--------------------------------------------------------------------------------
 	if (false != rTableFlag.IsSet(TABLE_HTB_SET))
 	{
-		DBO_EXPORT_TABLE(m_pHTBSetTable, serializer, pFileNameList->GetFileNameW(TABLE_HTB_SET), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pHTBSetTable, serializer, pFileNameList->GetFileNameW(TABLE_HTB_SET), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_SKILL))
 	{
-		DBO_EXPORT_TABLE(m_pSkillTable, serializer, pFileNameList->GetFileNameW(TABLE_SKILL), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pSkillTable, serializer, pFileNameList->GetFileNameW(TABLE_SKILL), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_SYSTEM_EFFECT))
 	{
-		DBO_EXPORT_TABLE(m_pSystemEffectTable, serializer, pFileNameList->GetFileNameW(TABLE_SYSTEM_EFFECT), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pSystemEffectTable, serializer, pFileNameList->GetFileNameW(TABLE_SYSTEM_EFFECT), eSaveMethod);
 	}
 	//--------------------------------------------------------------------------------
 
@@ -1627,15 +1915,15 @@ bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameL
 	//--------------------------------------------------------------------------------
 	if (false != rTableFlag.IsSet(TABLE_TEXT_ALL))
 	{
-		DBO_EXPORT_TABLE(m_pTextAllTable, serializer, pFileNameList->GetFileNameW(TABLE_TEXT_ALL), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pTextAllTable, serializer, pFileNameList->GetFileNameW(TABLE_TEXT_ALL), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_CHATTING_FILTER))
 	{
-		DBO_EXPORT_TABLE(m_pChattingFilterTable, serializer, pFileNameList->GetFileNameW(TABLE_CHATTING_FILTER), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pChattingFilterTable, serializer, pFileNameList->GetFileNameW(TABLE_CHATTING_FILTER), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_TEXT_SERVER))
 	{
-		DBO_EXPORT_TABLE(m_pTextServerTable, serializer, pFileNameList->GetFileNameW(TABLE_TEXT_SERVER), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pTextServerTable, serializer, pFileNameList->GetFileNameW(TABLE_TEXT_SERVER), eSaveMethod);
 	}
 	//--------------------------------------------------------------------------------
 
@@ -1644,11 +1932,11 @@ bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameL
 	//--------------------------------------------------------------------------------
 	if (false != rTableFlag.IsSet(TABLE_WORLD))
 	{
-		DBO_EXPORT_TABLE(m_pWorldTable, serializer, pFileNameList->GetFileNameW(TABLE_WORLD), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pWorldTable, serializer, pFileNameList->GetFileNameW(TABLE_WORLD), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_WORLD_ZONE))
 	{
-		DBO_EXPORT_TABLE(m_pWorldZoneTable, serializer, pFileNameList->GetFileNameW(TABLE_WORLD_ZONE), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pWorldZoneTable, serializer, pFileNameList->GetFileNameW(TABLE_WORLD_ZONE), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_OBJECT))
 	{
@@ -1656,7 +1944,7 @@ bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameL
 		{
 			sWORLD_TBLDAT* pWorldTableData = (sWORLD_TBLDAT*)(iter->second);
 
-			DBO_EXPORT_REGISTERED_TABLE(CObjectTable, serializer, pWorldTableData->wszObjSpawn_Table_Name, bNeedToEncrypt, m_mapObjectTable, pWorldTableData->tblidx);
+			DBO_EXPORT_REGISTERED_TABLE(CObjectTable, serializer, pWorldTableData->wszObjSpawn_Table_Name, eSaveMethod, m_mapObjectTable, pWorldTableData->tblidx);
 		}
 	}
 	if (false != rTableFlag.IsSet(TABLE_NPC_SPAWN))
@@ -1665,7 +1953,7 @@ bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameL
 		{
 			sWORLD_TBLDAT* pWorldTableData = (sWORLD_TBLDAT*)(iter->second);
 
-			DBO_EXPORT_REGISTERED_TABLE(CSpawnTable, serializer, pWorldTableData->wszNpcSpawn_Table_Name, bNeedToEncrypt, m_mapNpcSpawnTable, pWorldTableData->tblidx);
+			DBO_EXPORT_REGISTERED_TABLE(CSpawnTable, serializer, pWorldTableData->wszNpcSpawn_Table_Name, eSaveMethod, m_mapNpcSpawnTable, pWorldTableData->tblidx);
 		}
 	}
 	if (false != rTableFlag.IsSet(TABLE_MOB_SPAWN))
@@ -1674,16 +1962,16 @@ bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameL
 		{
 			sWORLD_TBLDAT* pWorldTableData = (sWORLD_TBLDAT*)(iter->second);
 
-			DBO_EXPORT_REGISTERED_TABLE(CSpawnTable, serializer, pWorldTableData->wszMobSpawn_Table_Name, bNeedToEncrypt, m_mapMobSpawnTable, pWorldTableData->tblidx);
+			DBO_EXPORT_REGISTERED_TABLE(CSpawnTable, serializer, pWorldTableData->wszMobSpawn_Table_Name, eSaveMethod, m_mapMobSpawnTable, pWorldTableData->tblidx);
 		}
 	}
 	if (false != rTableFlag.IsSet(TABLE_WORLD_MAP))
 	{
-		DBO_EXPORT_TABLE(m_pWorldMapTable, serializer, pFileNameList->GetFileNameW(TABLE_WORLD_MAP), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pWorldMapTable, serializer, pFileNameList->GetFileNameW(TABLE_WORLD_MAP), eSaveMethod);
 	}
 	if (false != rTableFlag.IsSet(TABLE_LAND_MARK))
 	{
-		DBO_EXPORT_TABLE(m_pLandMarkTable, serializer, pFileNameList->GetFileNameW(TABLE_LAND_MARK), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pLandMarkTable, serializer, pFileNameList->GetFileNameW(TABLE_LAND_MARK), eSaveMethod);
 	}
 	//--------------------------------------------------------------------------------
 
@@ -1693,17 +1981,17 @@ bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameL
 	//--------------------------------------------------------------------------------
 	if (false != rTableFlag.IsSet(TABLE_TIMEQUEST))
 	{
-		DBO_EXPORT_TABLE(m_pTimeQuestTable, serializer, pFileNameList->GetFileNameW(TABLE_TIMEQUEST), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pTimeQuestTable, serializer, pFileNameList->GetFileNameW(TABLE_TIMEQUEST), eSaveMethod);
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_RANKBATTLE))
 	{
-		DBO_EXPORT_TABLE(m_pRankBattleTable, serializer, pFileNameList->GetFileNameW(TABLE_RANKBATTLE), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pRankBattleTable, serializer, pFileNameList->GetFileNameW(TABLE_RANKBATTLE), eSaveMethod);
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_BUDOKAI))
 	{
-		DBO_EXPORT_TABLE(m_pBudokaiTable, serializer, pFileNameList->GetFileNameW(TABLE_BUDOKAI), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pBudokaiTable, serializer, pFileNameList->GetFileNameW(TABLE_BUDOKAI), eSaveMethod);
 	}
 
 
@@ -1716,77 +2004,77 @@ bool CTableContainer::SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameL
 
 	if (false != rTableFlag.IsSet(TABLE_PORTAL))
 	{
-		DBO_EXPORT_TABLE(m_pPortalTable, serializer, pFileNameList->GetFileNameW(TABLE_PORTAL), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pPortalTable, serializer, pFileNameList->GetFileNameW(TABLE_PORTAL), eSaveMethod);
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_SPEECH))
 	{
-		DBO_EXPORT_TABLE(m_pNpcSpeechTable, serializer, pFileNameList->GetFileNameW(TABLE_SPEECH), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pNpcSpeechTable, serializer, pFileNameList->GetFileNameW(TABLE_SPEECH), eSaveMethod);
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_WORLD_PLAY))
 	{
-		DBO_EXPORT_TABLE(m_pWorldPlayTable, serializer, pFileNameList->GetFileNameW(TABLE_WORLD_PLAY), bNeedToEncrypt);
+		DBO_EXPORT_TABLE(m_pWorldPlayTable, serializer, pFileNameList->GetFileNameW(TABLE_WORLD_PLAY), eSaveMethod);
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_SCRIPT_LINK))
 	{
-		DBO_EXPORT_TABLE( m_pScriptLinkTable, serializer, pFileNameList->GetFileNameW(TABLE_SCRIPT_LINK), bNeedToEncrypt );
+		DBO_EXPORT_TABLE( m_pScriptLinkTable, serializer, pFileNameList->GetFileNameW(TABLE_SCRIPT_LINK), eSaveMethod );
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_DUNGEON))
 	{
-		DBO_EXPORT_TABLE( m_pDungeonTable, serializer, pFileNameList->GetFileNameW(TABLE_DUNGEON), bNeedToEncrypt );
+		DBO_EXPORT_TABLE( m_pDungeonTable, serializer, pFileNameList->GetFileNameW(TABLE_DUNGEON), eSaveMethod );
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_QUEST_NARRATION))
 	{
-		DBO_EXPORT_TABLE( m_pQuestNarrationTable, serializer, pFileNameList->GetFileNameW(TABLE_QUEST_NARRATION), bNeedToEncrypt );
+		DBO_EXPORT_TABLE( m_pQuestNarrationTable, serializer, pFileNameList->GetFileNameW(TABLE_QUEST_NARRATION), eSaveMethod );
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_VEHICLE))
 	{
-		DBO_EXPORT_TABLE( m_pVehicleTable, serializer, pFileNameList->GetFileNameW(TABLE_VEHICLE), bNeedToEncrypt );
+		DBO_EXPORT_TABLE( m_pVehicleTable, serializer, pFileNameList->GetFileNameW(TABLE_VEHICLE), eSaveMethod );
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_ITEM_RECIPE))
 	{
-		DBO_EXPORT_TABLE( m_pItemRecipeTable, serializer, pFileNameList->GetFileNameW(TABLE_ITEM_RECIPE), bNeedToEncrypt );
+		DBO_EXPORT_TABLE( m_pItemRecipeTable, serializer, pFileNameList->GetFileNameW(TABLE_ITEM_RECIPE), eSaveMethod );
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_DYNAMIC_OBJECT))
 	{
-		DBO_EXPORT_TABLE( m_pDynamicObjectTable, serializer, pFileNameList->GetFileNameW(TABLE_DYNAMIC_OBJECT), bNeedToEncrypt );
+		DBO_EXPORT_TABLE( m_pDynamicObjectTable, serializer, pFileNameList->GetFileNameW(TABLE_DYNAMIC_OBJECT), eSaveMethod );
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_MOB_MOVE_PATTERN))
 	{
-		DBO_EXPORT_TABLE( m_pMobMovePatternTable, serializer, pFileNameList->GetFileNameW(TABLE_MOB_MOVE_PATTERN), bNeedToEncrypt );
+		DBO_EXPORT_TABLE( m_pMobMovePatternTable, serializer, pFileNameList->GetFileNameW(TABLE_MOB_MOVE_PATTERN), eSaveMethod );
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_DOJO))
 	{
-		DBO_EXPORT_TABLE( m_pDojoTable, serializer, pFileNameList->GetFileNameW(TABLE_DOJO), bNeedToEncrypt);
+		DBO_EXPORT_TABLE( m_pDojoTable, serializer, pFileNameList->GetFileNameW(TABLE_DOJO), eSaveMethod);
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_ITEM_UPGRADE))
 	{
-		DBO_EXPORT_TABLE( m_pItemUpgradeTable, serializer, pFileNameList->GetFileNameW(TABLE_ITEM_UPGRADE), bNeedToEncrypt );
+		DBO_EXPORT_TABLE( m_pItemUpgradeTable, serializer, pFileNameList->GetFileNameW(TABLE_ITEM_UPGRADE), eSaveMethod );
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_MIX_MACHINE))
 	{
-		DBO_EXPORT_TABLE( m_pItemMixMachineTable, serializer, pFileNameList->GetFileNameW(TABLE_MIX_MACHINE), bNeedToEncrypt );
+		DBO_EXPORT_TABLE( m_pItemMixMachineTable, serializer, pFileNameList->GetFileNameW(TABLE_MIX_MACHINE), eSaveMethod );
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_HLS_MERCHANT))
 	{
-		DBO_EXPORT_TABLE( m_pHLSMerchantTable, serializer, pFileNameList->GetFileNameW(TABLE_HLS_MERCHANT), bNeedToEncrypt);
+		DBO_EXPORT_TABLE( m_pHLSMerchantTable, serializer, pFileNameList->GetFileNameW(TABLE_HLS_MERCHANT), eSaveMethod);
 	}
 
 	if (false != rTableFlag.IsSet(TABLE_HLS_ITEM))
 	{
-		DBO_EXPORT_TABLE( m_pHLSItemTable, serializer, pFileNameList->GetFileNameW(TABLE_HLS_ITEM), bNeedToEncrypt);
+		DBO_EXPORT_TABLE( m_pHLSItemTable, serializer, pFileNameList->GetFileNameW(TABLE_HLS_ITEM), eSaveMethod);
 	}
 	return true;
 }
@@ -1867,7 +2155,29 @@ bool CTableContainer::ReloadTable(CTable* pTable, CNtlFileSerializer& serializer
 			serializer >> nDataSize;
 
 			CNtlFileSerializer dataSerializer;
-			serializer.Out(dataSerializer, nDataSize);
+			serializer.OutView(dataSerializer, nDataSize);
+
+			if ( false == pTable->LoadFromBinary( dataSerializer, true ) )
+			{
+				return false;
+			}
+		}
+		break;
+
+	case CTable::LOADING_METHOD_MAPPED_IMAGE:
+		{
+			wstrFullPath += L".tbi";
+
+			CTableImage image;
+			if ( false == image.Open( wstrFullPath.c_str() ) )
+			{
+				CTable::CallErrorCallbackFunction(L"[File] : %s\n[Error] : The table image can't be mapped or its version doesn't match.", (WCHAR*)wstrFullPath.c_str());
+				return false;
+			}
+
+			// dataSerializer borrows the mapped view, so it has to go away before image unmaps it.
+			CNtlFileSerializer dataSerializer;
+			image.ReadData( dataSerializer );
 
 			if ( false == pTable->LoadFromBinary( dataSerializer, true ) )
 			{
@@ -1887,6 +2197,40 @@ bool CTableContainer::ReloadTable(CTable* pTable, CNtlFileSerializer& serializer
 }
 
 
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+bool CTableContainer::SaveTableImage(CTable* pTable, WCHAR* pwszFullPath)
+{
+	if (false == CTableImage::SaveImage(pTable, pwszFullPath))
+	{
+		CTable::CallErrorCallbackFunction(L"[File] : %s\n[Error] : Failed to save the table image.", pwszFullPath);
+		return false;
+	}
+
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	: CTextAllTable rows are variable-length, so its image has no row index.
+//		Return	:
+//-----------------------------------------------------------------------------------
+bool CTableContainer::SaveTableImage(CTextAllTable* pTextAllTable, WCHAR* pwszFullPath)
+{
+	CNtlFileSerializer dataSerializer;
+	if (false == pTextAllTable->SaveToBinary(dataSerializer) ||
+		false == CTableImage::SaveImage(dataSerializer, 0, 0, pwszFullPath))
+	{
+		CTable::CallErrorCallbackFunction(L"[File] : %s\n[Error] : Failed to save the table image.", pwszFullPath);
+		return false;
+	}
+
+	return true;
+}
+
+
 //-----------------------------------------------------------------------------------
 //		Purpose	:
 //		Return	:
@@ -1965,7 +2309,29 @@ bool CTableContainer::InitializeTable(CTable* pTable, CNtlFileSerializer& serial
 			serializer >> nDataSize;
 
 			CNtlFileSerializer dataSerializer;
-			serializer.Out(dataSerializer, nDataSize);
+			serializer.OutView(dataSerializer, nDataSize);
+
+			if ( false == pTable->LoadFromBinary( dataSerializer, false ) )
+			{
+				return false;
+			}
+		}
+		break;
+
+	case CTable::LOADING_METHOD_MAPPED_IMAGE:
+		{
+			wstrFullPath += L".tbi";
+
+			CTableImage image;
+			if ( false == image.Open( wstrFullPath.c_str() ) )
+			{
+				CTable::CallErrorCallbackFunction(L"[File] : %s\n[Error] : The table image can't be mapped or its version doesn't match.", (WCHAR*)wstrFullPath.c_str());
+				return false;
+			}
+
+			// dataSerializer borrows the mapped view, so it has to go away before image unmaps it.
+			CNtlFileSerializer dataSerializer;
+			image.ReadData( dataSerializer );
 
 			if ( false == pTable->LoadFromBinary( dataSerializer, false ) )
 			{
@@ -2079,7 +2445,7 @@ bool CTableContainer::InitializePackTable(CTable* pTable, CNtlFileSerializer& se
 			serializer >> nDataSize;
 
 			CNtlFileSerializer dataSerializer;
-			serializer.Out(dataSerializer, nDataSize);
+			serializer.OutView(dataSerializer, nDataSize);
 
 			Ntl_CleanUpHeapString(pchFileName);
 
@@ -2090,6 +2456,34 @@ bool CTableContainer::InitializePackTable(CTable* pTable, CNtlFileSerializer& se
 		}
 		break;
 
+	case CTable::LOADING_METHOD_MAPPED_IMAGE:
+		{
+			strFullFileName += ".tbi";
+
+			if ( false == pCall->Call(strFullFileName.c_str(), &serializer, pszCryptPassword) )
+			{
+				return false;
+			}
+
+			Ntl_CleanUpHeapString(pchFileName);
+
+			// Packed images can't be mapped, so they are read through the callback instead.
+			CTableImage image;
+			if ( false == image.Attach( serializer.GetData() + serializer.GetStartPointer(), (DWORD)serializer.GetDataSize() ) )
+			{
+				return false;
+			}
+
+			CNtlFileSerializer dataSerializer;
+			image.ReadData( dataSerializer );
+
+			if ( false == pTable->LoadFromBinary( dataSerializer, false ) )
+			{
+				return false;
+			}
+		}
+		break;
+
 	default:
 		{
 			return false;
@@ -2176,7 +2570,7 @@ bool CTableContainer::InitializeTable(CTextAllTable* pTextAllTable, CNtlFileSeri
 			serializer >> nDataSize;
 
 			CNtlFileSerializer dataSerializer;
-			serializer.Out(dataSerializer, nDataSize);
+			serializer.OutView(dataSerializer, nDataSize);
 
 			if (false == pTextAllTable->LoadFromBinary(dataSerializer))
 			{
@@ -2185,6 +2579,28 @@ bool CTableContainer::InitializeTable(CTextAllTable* pTextAllTable, CNtlFileSeri
 		}
 		break;
 
+	case CTable::LOADING_METHOD_MAPPED_IMAGE:
+		{
+			wstrFullPath += L".tbi";
+
+			CTableImage image;
+			if ( false == image.Open( wstrFullPath.c_str() ) )
+			{
+				CTable::CallErrorCallbackFunction(L"[File] : %s\n[Error] : The table image can't be mapped or its version doesn't match.", (WCHAR*)wstrFullPath.c_str());
+				return false;
+			}
+
+			// dataSerializer borrows the mapped view, so it has to go away before image unmaps it.
+			CNtlFileSerializer dataSerializer;
+			image.ReadData( dataSerializer );
+
+			if ( false == pTextAllTable->LoadFromBinary( dataSerializer ) )
+			{
+				return false;
+			}
+		}
+		break;
+
 	default:
 		{
 			//- yoshiki : To log system!
@@ -2292,7 +2708,7 @@ bool CTableContainer::InitializePackTable(CTextAllTable* pTextAllTable, CNtlFile
 			serializer >> nDataSize;
 
 			CNtlFileSerializer dataSerializer;
-			serializer.Out(dataSerializer, nDataSize);
+			serializer.OutView(dataSerializer, nDataSize);
 
 			Ntl_CleanUpHeapString(pchFileName);
 
@@ -2303,6 +2719,34 @@ bool CTableContainer::InitializePackTable(CTextAllTable* pTextAllTable, CNtlFile
 		}
 		break;
 
+	case CTable::LOADING_METHOD_MAPPED_IMAGE:
+		{
+			strFullFileName += ".tbi";
+
+			if ( false == pCall->Call(strFullFileName.c_str(), &serializer, pszCryptPassword) )
+			{
+				return false;
+			}
+
+			Ntl_CleanUpHeapString(pchFileName);
+
+			// Packed images can't be mapped, so they are read through the callback instead.
+			CTableImage image;
+			if ( false == image.Attach( serializer.GetData() + serializer.GetStartPointer(), (DWORD)serializer.GetDataSize() ) )
+			{
+				return false;
+			}
+
+			CNtlFileSerializer dataSerializer;
+			image.ReadData( dataSerializer );
+
+			if ( false == pTextAllTable->LoadFromBinary( dataSerializer ) )
+			{
+				return false;
+			}
+		}
+		break;
+
 	default:
 		{
 			return false;
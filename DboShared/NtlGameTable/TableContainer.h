@@ -84,6 +84,7 @@ class CBudokaiTable;
 class CDungeonTable;
 
 class CTableFileNameList;
+class CTableLoader;
 
 class CGuideHintTable;
 class CPortalTable;
@@ -252,12 +253,27 @@ public:
 
 	bool							SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameList* pFileNameList, bool bNeedToEncrypt);
 
+	// eSaveMethod : LOADING_METHOD_BINARY(*.rdf), LOADING_METHOD_SECURED_BINARY(*.edf) or LOADING_METHOD_MAPPED_IMAGE(*.tbi)
+	bool							SaveToFile(CNtlBitFlagManager& rTableFlag, CTableFileNameList* pFileNameList, CTable::eLOADING_METHOD eSaveMethod);
+
 	void							SetPath(char* pszPath);
 
 	void							SetPath(WCHAR* pwszPath) { m_wstrPath = pwszPath; }
 
+	// 1 loads the tables one after another, 0 uses one loading thread per core.
+	void							SetLoadingThreadCount(DWORD dwThreadCount) { m_dwLoadingThreadCount = dwThreadCount; }
+
+	DWORD							GetLoadingThreadCount() { return m_dwLoadingThreadCount; }
+
 protected:
 
+	template <class TABLE_CLASS> class CTableCreateJob;
+
+	// Joins the tables queued so far. Only needed before a table that depends on another one.
+	bool							WaitLoadingTables();
+
+	void							DestroyTableLoader();
+
 	bool							InitializeTable(CTable* pTable, CNtlFileSerializer& serializer, char* pszFileNameWithoutExtension, ICallBack* pCall);
 
 	bool							InitializeTable(CTable* pTable, CNtlFileSerializer& serializer, WCHAR* pwszFileNameWithoutExtension, ICallBack* pCall);
@@ -278,6 +294,10 @@ protected:
 
 	bool							ReloadTable(CTable* pTable, CNtlFileSerializer& serializer, WCHAR* pwszFileNameWithoutExtension);
 
+	bool							SaveTableImage(CTable* pTable, WCHAR* pwszFullPath);
+
+	bool							SaveTableImage(CTextAllTable* pTextAllTable, WCHAR* pwszFullPath);
+
 
 public:
 
@@ -449,6 +469,10 @@ protected:
 
 	DWORD							m_dwCodePage;
 
+	DWORD							m_dwLoadingThreadCount;
+
+	CTableLoader*					m_pTableLoader;
+
 // Character
 	CExpTable*						m_pExpTable;
 
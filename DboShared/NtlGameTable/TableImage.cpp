@@ -0,0 +1,243 @@
+//***********************************************************************************
+//
+//	File		:	TableImage.cpp
+//
+//	Begin		:	2026-10-17
+//
+//	Copyright	:	NTL-Inc Co., Ltd
+//
+//	Desc		:
+//
+//***********************************************************************************
+
+#include "stdafx.h"
+#include "TableImage.h"
+#include "Table.h"
+#include "NtlFileSerializer.h"
+
+CTableImage::CTableImage(void)
+:m_pbyImage(NULL)
+,m_dwImageSize(0)
+,m_hFile(INVALID_HANDLE_VALUE)
+,m_hMapping(NULL)
+{
+}
+
+CTableImage::~CTableImage(void)
+{
+	Close();
+}
+
+bool CTableImage::Open(const WCHAR* pwszFullPath)
+{
+	Close();
+
+	if (NULL == pwszFullPath)
+	{
+		return false;
+	}
+
+	m_hFile = ::CreateFileW(pwszFullPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (INVALID_HANDLE_VALUE == m_hFile)
+	{
+		return false;
+	}
+
+	DWORD dwFileSize = ::GetFileSize(m_hFile, NULL);
+	if (INVALID_FILE_SIZE == dwFileSize || sizeof(sTABLE_IMAGE_HEADER) > dwFileSize)
+	{
+		Close();
+		return false;
+	}
+
+	m_hMapping = ::CreateFileMappingW(m_hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (NULL == m_hMapping)
+	{
+		Close();
+		return false;
+	}
+
+	m_pbyImage = (const BYTE*)::MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+	if (NULL == m_pbyImage)
+	{
+		Close();
+		return false;
+	}
+
+	m_dwImageSize = dwFileSize;
+
+	if (false == Validate())
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+bool CTableImage::Attach(const void* pvImage, DWORD dwImageSize)
+{
+	Close();
+
+	if (NULL == pvImage || sizeof(sTABLE_IMAGE_HEADER) > dwImageSize)
+	{
+		return false;
+	}
+
+	m_pbyImage = (const BYTE*)pvImage;
+	m_dwImageSize = dwImageSize;
+
+	if (false == Validate())
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void CTableImage::Close(void)
+{
+	if (NULL != m_hMapping)
+	{
+		if (NULL != m_pbyImage)
+		{
+			::UnmapViewOfFile(m_pbyImage);
+		}
+
+		::CloseHandle(m_hMapping);
+		m_hMapping = NULL;
+	}
+
+	if (INVALID_HANDLE_VALUE != m_hFile)
+	{
+		::CloseHandle(m_hFile);
+		m_hFile = INVALID_HANDLE_VALUE;
+	}
+
+	m_pbyImage = NULL;
+	m_dwImageSize = 0;
+}
+
+const void* CTableImage::GetData(void) const
+{
+	if (NULL == m_pbyImage)
+	{
+		return NULL;
+	}
+
+	return m_pbyImage + GetHeader()->dwDataOffset;
+}
+
+DWORD CTableImage::GetDataSize(void) const
+{
+	if (NULL == m_pbyImage)
+	{
+		return 0;
+	}
+
+	return GetHeader()->dwDataSize;
+}
+
+bool CTableImage::ReadData(CNtlSerializer& serializer) const
+{
+	if (NULL == m_pbyImage)
+	{
+		return false;
+	}
+
+	// The rows are read straight out of the mapped view, LoadFromBinary() copies them out.
+	serializer.Attach(GetData(), (int)GetDataSize());
+
+	return true;
+}
+
+bool CTableImage::SaveImage(CTable* pTable, const WCHAR* pwszFullPath)
+{
+	if (NULL == pTable || NULL == pwszFullPath)
+	{
+		return false;
+	}
+
+	CNtlFileSerializer dataSerializer;
+	if (false == pTable->SaveToBinary(dataSerializer))
+	{
+		return false;
+	}
+
+	DWORD dwDataSize = (DWORD)dataSerializer.GetDataSize();
+	DWORD dwRowCount = (DWORD)pTable->GetNumberOfTables();
+	DWORD dwRowSize = 0;
+
+	// Only images whose rows all have the same size record it, Validate() checks it against the data size.
+	if (0 < dwRowCount && 0 == (dwDataSize - 1) % dwRowCount)
+	{
+		if ((DWORD)pTable->Begin()->second->GetDataSize() == (dwDataSize - 1) / dwRowCount)
+		{
+			dwRowSize = (dwDataSize - 1) / dwRowCount;
+		}
+	}
+
+	return SaveImage(dataSerializer, dwRowCount, dwRowSize, pwszFullPath);
+}
+
+bool CTableImage::SaveImage(CNtlSerializer& dataSerializer, DWORD dwRowCount, DWORD dwRowSize, const WCHAR* pwszFullPath)
+{
+	if (NULL == pwszFullPath || 0 >= dataSerializer.GetDataSize())
+	{
+		return false;
+	}
+
+	sTABLE_IMAGE_HEADER header;
+	::ZeroMemory(&header, sizeof(header));
+
+	header.dwMagic = IMAGE_MAGIC;
+	header.wVersion = IMAGE_VERSION;
+	header.wHeaderSize = sizeof(header);
+	header.dwRowSize = dwRowSize;
+	header.dwRowCount = dwRowCount;
+	header.dwDataSize = (DWORD)dataSerializer.GetDataSize();
+
+	// The first row has to start on an aligned offset, the margin byte sits right before it.
+	DWORD dwRowOffset = (sizeof(header) + 1 + IMAGE_ROW_ALIGNMENT - 1) & ~((DWORD)IMAGE_ROW_ALIGNMENT - 1);
+	header.dwDataOffset = dwRowOffset - 1;
+
+	CNtlFileSerializer serializer;
+	serializer.Reserve(dwRowOffset + header.dwDataSize);
+	serializer.In(&header, sizeof(header));
+
+	BYTE abyPadding[IMAGE_ROW_ALIGNMENT] = { 0, };
+	serializer.In(abyPadding, header.dwDataOffset - sizeof(header));
+
+	serializer.In(dataSerializer.GetData() + dataSerializer.GetStartPointer(), header.dwDataSize);
+
+	return serializer.SaveFile((WCHAR*)pwszFullPath, false);
+}
+
+bool CTableImage::Validate(void) const
+{
+	const sTABLE_IMAGE_HEADER* pHeader = GetHeader();
+
+	if (IMAGE_MAGIC != pHeader->dwMagic || IMAGE_VERSION != pHeader->wVersion || sizeof(sTABLE_IMAGE_HEADER) != pHeader->wHeaderSize)
+	{
+		return false;
+	}
+
+	if (pHeader->dwDataOffset < sizeof(sTABLE_IMAGE_HEADER) || pHeader->dwDataOffset > m_dwImageSize)
+	{
+		return false;
+	}
+
+	if (pHeader->dwDataSize > m_dwImageSize - pHeader->dwDataOffset || 0 == pHeader->dwDataSize)
+	{
+		return false;
+	}
+
+	// 64 bit, so a forged row count can't wrap around to a matching size.
+	if (0 != pHeader->dwRowSize && (DWORD64)pHeader->dwRowSize * pHeader->dwRowCount + 1 != pHeader->dwDataSize)
+	{
+		return false;
+	}
+
+	return true;
+}
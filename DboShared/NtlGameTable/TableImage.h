@@ -0,0 +1,107 @@
+//***********************************************************************************
+//
+//	File		:	TableImage.h
+//
+//	Begin		:	2026-10-17
+//
+//	Copyright	:	NTL-Inc Co., Ltd
+//
+//	Desc		:	Pre-laid-out, memory-mapped table image (*.tbi)
+//
+//***********************************************************************************
+
+#pragma once
+
+#include "NtlSharedType.h"
+
+class CNtlSerializer;
+class CTable;
+
+#pragma pack(push, 4)
+struct sTABLE_IMAGE_HEADER
+{
+	DWORD				dwMagic;
+	WORD				wVersion;
+	WORD				wHeaderSize;
+	DWORD				dwRowSize;			// serialized row size, 0 if rows are variable-length
+	DWORD				dwRowCount;
+	DWORD				dwDataOffset;		// offset of the margin byte, rows follow it
+	DWORD				dwDataSize;			// margin byte + rows, exactly what SaveToBinary() writes
+};
+#pragma pack(pop)
+
+
+//-----------------------------------------------------------------------------------
+// CTableImage
+//
+// A table image is the unencrypted SaveToBinary() output behind a small header,
+// padded so that the first row starts on an 8 byte boundary. Open() maps the file
+// read-only, so every process loading the same image shares its physical pages
+// and nothing is read or decrypted up front.
+//
+// The rows are still copied into the table's own sTBLDAT objects by
+// CTable::LoadFromBinary(), so the image only saves the file read and the decryption.
+// It can be closed as soon as the table is loaded.
+//-----------------------------------------------------------------------------------
+class CTableImage
+{
+public:
+
+	enum eCONSTANT
+	{
+		IMAGE_MAGIC = 0x49425444,	// 'DTBI'
+		IMAGE_VERSION = 1,
+		IMAGE_ROW_ALIGNMENT = 8
+	};
+
+public:
+
+	CTableImage(void);
+	~CTableImage(void);
+
+public:
+
+	bool					Open(const WCHAR* pwszFullPath);
+
+	// Uses a buffer owned by the caller (e.g. a resource pack entry). The buffer must outlive the image.
+	bool					Attach(const void* pvImage, DWORD dwImageSize);
+
+	void					Close(void);
+
+	bool					IsOpened(void) const { return NULL != m_pbyImage; }
+
+public:
+
+	const sTABLE_IMAGE_HEADER*	GetHeader(void) const { return (const sTABLE_IMAGE_HEADER*)m_pbyImage; }
+
+	// Margin byte + rows, ready to be handed to CTable::LoadFromBinary().
+	const void*				GetData(void) const;
+	DWORD					GetDataSize(void) const;
+
+	// serializer borrows the image, it must not be used after Close(). Declare it after the image
+	// so it is destroyed first.
+	bool					ReadData(CNtlSerializer& serializer) const;
+
+public:
+
+	static bool				SaveImage(CTable* pTable, const WCHAR* pwszFullPath);
+
+	static bool				SaveImage(CNtlSerializer& dataSerializer, DWORD dwRowCount, DWORD dwRowSize, const WCHAR* pwszFullPath);
+
+protected:
+
+	bool					Validate(void) const;
+
+protected:
+
+	const BYTE*				m_pbyImage;
+	DWORD					m_dwImageSize;
+
+	HANDLE					m_hFile;
+	HANDLE					m_hMapping;
+
+private:
+
+	CTableImage(const CTableImage&);
+	CTableImage& operator=(const CTableImage&);
+};
@@ -0,0 +1,242 @@
+//***********************************************************************************
+//
+//	File		:	TableLoader.cpp
+//
+//	Begin		:	2026-10-17
+//
+//	Copyright	:	NTL-Inc Co., Ltd
+//
+//	Desc		:
+//
+//***********************************************************************************
+
+#include "stdafx.h"
+#include "TableLoader.h"
+#include "Table.h"
+#include "NtlFileSerializer.h"
+
+#include <process.h>
+#include <objbase.h>
+
+CTableLoader::CTableLoader(void)
+{
+	::InitializeCriticalSection(&m_lock);
+
+	Init();
+}
+
+CTableLoader::~CTableLoader(void)
+{
+	Destroy();
+
+	::DeleteCriticalSection(&m_lock);
+}
+
+void CTableLoader::Init(void)
+{
+	m_nNextJob = 0;
+	m_nNextCommit = 0;
+	m_bStop = false;
+
+	m_hJobSemaphore = NULL;
+	m_hDoneSemaphore = NULL;
+
+	for (DWORD i = 0; i < MAX_THREAD_COUNT; ++i)
+	{
+		m_ahThread[i] = NULL;
+	}
+	m_dwThreadCount = 0;
+}
+
+bool CTableLoader::Create(DWORD dwThreadCount)
+{
+	Destroy();
+
+	if (0 == dwThreadCount)
+	{
+		dwThreadCount = GetDefaultThreadCount();
+	}
+	if (MAX_THREAD_COUNT < dwThreadCount)
+	{
+		dwThreadCount = MAX_THREAD_COUNT;
+	}
+
+	m_hJobSemaphore = ::CreateSemaphore(NULL, 0, LONG_MAX, NULL);
+	m_hDoneSemaphore = ::CreateSemaphore(NULL, 0, LONG_MAX, NULL);
+	if (NULL == m_hJobSemaphore || NULL == m_hDoneSemaphore)
+	{
+		Destroy();
+		return false;
+	}
+
+	for (DWORD i = 0; i < dwThreadCount; ++i)
+	{
+		m_ahThread[i] = (HANDLE)_beginthreadex(NULL, 0, &WorkerThreadFunc, this, 0, NULL);
+		if (NULL == m_ahThread[i])
+		{
+			Destroy();
+			return false;
+		}
+
+		m_dwThreadCount++;
+	}
+
+	return true;
+}
+
+void CTableLoader::Destroy(void)
+{
+	if (0 != m_dwThreadCount)
+	{
+		::EnterCriticalSection(&m_lock);
+		m_bStop = true;
+		::LeaveCriticalSection(&m_lock);
+
+		::ReleaseSemaphore(m_hJobSemaphore, (LONG)m_dwThreadCount, NULL);
+
+		::WaitForMultipleObjects(m_dwThreadCount, m_ahThread, TRUE, INFINITE);
+
+		for (DWORD i = 0; i < m_dwThreadCount; ++i)
+		{
+			::CloseHandle(m_ahThread[i]);
+		}
+	}
+
+	if (NULL != m_hJobSemaphore)
+	{
+		::CloseHandle(m_hJobSemaphore);
+	}
+	if (NULL != m_hDoneSemaphore)
+	{
+		::CloseHandle(m_hDoneSemaphore);
+	}
+
+	for (size_t i = m_nNextCommit; i < m_vecJob.size(); ++i)
+	{
+		delete m_vecJob[i];
+	}
+	m_vecJob.clear();
+
+	Init();
+}
+
+bool CTableLoader::AddJob(CTableLoadJob* pJob)
+{
+	if (NULL == pJob)
+	{
+		return false;
+	}
+
+	if (0 == m_dwThreadCount)
+	{
+		delete pJob;
+		return false;
+	}
+
+	::EnterCriticalSection(&m_lock);
+	m_vecJob.push_back(pJob);
+	::LeaveCriticalSection(&m_lock);
+
+	::ReleaseSemaphore(m_hJobSemaphore, 1, NULL);
+
+	return true;
+}
+
+bool CTableLoader::Wait(void)
+{
+	::EnterCriticalSection(&m_lock);
+	size_t nJobCount = m_vecJob.size();
+	::LeaveCriticalSection(&m_lock);
+
+	for (size_t i = m_nNextCommit; i < nJobCount; ++i)
+	{
+		::WaitForSingleObject(m_hDoneSemaphore, INFINITE);
+	}
+
+	// Every job up to nJobCount is finished, so they can be read without the lock.
+	bool bResult = true;
+	for ( ; m_nNextCommit < nJobCount; ++m_nNextCommit)
+	{
+		CTableLoadJob* pJob = m_vecJob[m_nNextCommit];
+
+		if (false != bResult)
+		{
+			for (size_t i = 0; i < pJob->m_vecErrorMessage.size(); ++i)
+			{
+				CTable::CallErrorCallbackFunction("%s", pJob->m_vecErrorMessage[i].c_str());
+			}
+
+			if (false == pJob->m_bResult || false == pJob->Commit())
+			{
+				bResult = false;
+			}
+		}
+
+		delete pJob;
+		m_vecJob[m_nNextCommit] = NULL;
+	}
+
+	return bResult;
+}
+
+DWORD CTableLoader::GetDefaultThreadCount(void)
+{
+	SYSTEM_INFO systemInfo;
+	::GetSystemInfo(&systemInfo);
+
+	DWORD dwThreadCount = systemInfo.dwNumberOfProcessors;
+	if (0 == dwThreadCount)
+	{
+		dwThreadCount = 1;
+	}
+	if (MAX_THREAD_COUNT < dwThreadCount)
+	{
+		dwThreadCount = MAX_THREAD_COUNT;
+	}
+
+	return dwThreadCount;
+}
+
+void CTableLoader::RunWorker(void)
+{
+	// XML tables are parsed through MSXML.
+	HRESULT hResult = ::CoInitialize(NULL);
+
+	CNtlFileSerializer serializer;
+
+	while (true)
+	{
+		::WaitForSingleObject(m_hJobSemaphore, INFINITE);
+
+		::EnterCriticalSection(&m_lock);
+		if (false != m_bStop)
+		{
+			::LeaveCriticalSection(&m_lock);
+			break;
+		}
+		CTableLoadJob* pJob = m_vecJob[m_nNextJob];
+		m_nNextJob++;
+		::LeaveCriticalSection(&m_lock);
+
+		CTable::SetThreadErrorBuffer(&pJob->m_vecErrorMessage);
+
+		serializer.Refresh();
+		pJob->m_bResult = pJob->Load(serializer);
+
+		CTable::SetThreadErrorBuffer(NULL);
+
+		::ReleaseSemaphore(m_hDoneSemaphore, 1, NULL);
+	}
+
+	if (SUCCEEDED(hResult))
+	{
+		::CoUninitialize();
+	}
+}
+
+unsigned int __stdcall CTableLoader::WorkerThreadFunc(void* pvParam)
+{
+	((CTableLoader*)pvParam)->RunWorker();
+
+	return 0;
+}
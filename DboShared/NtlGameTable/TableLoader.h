@@ -0,0 +1,125 @@
+//***********************************************************************************
+//
+//	File		:	TableLoader.h
+//
+//	Begin		:	2026-10-17
+//
+//	Copyright	:	NTL-Inc Co., Ltd
+//
+//	Desc		:	Worker pool used by CTableContainer to load tables in parallel
+//
+//***********************************************************************************
+
+#pragma once
+
+#include "NtlSharedType.h"
+
+#include <string>
+#include <vector>
+
+class CNtlFileSerializer;
+
+
+//-----------------------------------------------------------------------------------
+// CTableLoadJob
+//
+// Load() runs on a worker thread and must only touch the job's own table.
+// Commit() runs on the thread that called CTableLoader::Wait(), in the order the
+// jobs were added, and publishes the table to its owner.
+// A job that was never committed still owns its table and deletes it.
+//-----------------------------------------------------------------------------------
+class CTableLoadJob
+{
+	friend class CTableLoader;
+
+public:
+
+	CTableLoadJob(void) : m_bResult(false) {}
+
+	virtual ~CTableLoadJob(void) {}
+
+public:
+
+	virtual bool					Load(CNtlFileSerializer& serializer) = 0;
+
+	virtual bool					Commit(void) = 0;
+
+protected:
+
+	// Messages CTable::CallErrorCallbackFunction() raised while Load() was running.
+	std::vector<std::string>		m_vecErrorMessage;
+
+	bool							m_bResult;
+};
+
+
+//-----------------------------------------------------------------------------------
+// CTableLoader
+//
+// Jobs start as soon as they are added. Wait() joins every job added so far, then
+// reports their errors through Dbo_TableErrorCallback and commits them strictly
+// in the order they were added, stopping at the first failed job exactly like the
+// serial loader does. The result and the messages don't depend on thread timing.
+//-----------------------------------------------------------------------------------
+class CTableLoader
+{
+public:
+
+	enum eCONSTANT
+	{
+		MAX_THREAD_COUNT = 16
+	};
+
+public:
+
+	CTableLoader(void);
+
+	~CTableLoader(void);
+
+public:
+
+	bool							Create(DWORD dwThreadCount);
+
+	// Stops the workers after their current job and deletes every uncommitted job.
+	void							Destroy(void);
+
+	// The loader takes the ownership of pJob.
+	bool							AddJob(CTableLoadJob* pJob);
+
+	bool							Wait(void);
+
+public:
+
+	static DWORD					GetDefaultThreadCount(void);
+
+protected:
+
+	void							Init(void);
+
+	void							RunWorker(void);
+
+	static unsigned int __stdcall	WorkerThreadFunc(void* pvParam);
+
+protected:
+
+	CRITICAL_SECTION				m_lock;
+
+	std::vector<CTableLoadJob*>		m_vecJob;
+
+	// Next job to hand to a worker / first job not committed yet.
+	size_t							m_nNextJob;
+	size_t							m_nNextCommit;
+
+	bool							m_bStop;
+
+	HANDLE							m_hJobSemaphore;
+	HANDLE							m_hDoneSemaphore;
+
+	HANDLE							m_ahThread[MAX_THREAD_COUNT];
+	DWORD							m_dwThreadCount;
+
+private:
+
+	CTableLoader(const CTableLoader&);
+	CTableLoader& operator=(const CTableLoader&);
+};
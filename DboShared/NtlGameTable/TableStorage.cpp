@@ -0,0 +1,105 @@
+//***********************************************************************************
+//
+//	File		:	TableStorage.cpp
+//
+//	Begin		:	2026-10-17
+//
+//	Copyright	:	NTL-Inc Co., Ltd
+//
+//	Desc		:	
+//
+//***********************************************************************************
+
+#include "stdafx.h"
+#include "TableStorage.h"
+
+CTableRowArena::CTableRowArena(void)
+{
+}
+
+CTableRowArena::~CTableRowArena(void)
+{
+	Release();
+}
+
+void CTableRowArena::Reserve(size_t nRowCount, size_t nRowSize)
+{
+	size_t nRequired = nRowCount * AlignSize(nRowSize);
+	if (0 == nRequired)
+	{
+		return;
+	}
+
+	if (false == m_vecChunk.empty())
+	{
+		sCHUNK& rChunk = m_vecChunk.back();
+		if (rChunk.nSize - rChunk.nUsed >= nRequired)
+		{
+			return;
+		}
+	}
+
+	AddChunk(nRequired);
+}
+
+void* CTableRowArena::Alloc(size_t nSize)
+{
+	nSize = AlignSize(nSize);
+
+	if (m_vecChunk.empty() || m_vecChunk.back().nSize - m_vecChunk.back().nUsed < nSize)
+	{
+		size_t nChunkSize = nSize > (size_t)DEFAULT_CHUNK_SIZE ? nSize : (size_t)DEFAULT_CHUNK_SIZE;
+		if (false == AddChunk(nChunkSize))
+		{
+			return NULL;
+		}
+	}
+
+	sCHUNK& rChunk = m_vecChunk.back();
+	void* pvRow = rChunk.pbyBuffer + rChunk.nUsed;
+	rChunk.nUsed += nSize;
+
+	return pvRow;
+}
+
+bool CTableRowArena::IsOwner(const void* pvRow) const
+{
+	const BYTE* pbyRow = (const BYTE*)pvRow;
+
+	for (std::vector<sCHUNK>::const_iterator it = m_vecChunk.begin(); it != m_vecChunk.end(); it++)
+	{
+		if (it->pbyBuffer <= pbyRow && pbyRow < it->pbyBuffer + it->nSize)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void CTableRowArena::Release(void)
+{
+	for (std::vector<sCHUNK>::iterator it = m_vecChunk.begin(); it != m_vecChunk.end(); it++)
+	{
+		::free(it->pbyBuffer);
+	}
+
+	std::vector<sCHUNK>().swap(m_vecChunk);
+}
+
+bool CTableRowArena::AddChunk(size_t nSize)
+{
+	sCHUNK chunk;
+	chunk.pbyBuffer = (BYTE*)::malloc(nSize);
+	if (NULL == chunk.pbyBuffer)
+	{
+		return false;
+	}
+
+	chunk.nSize = nSize;
+	chunk.nUsed = 0;
+
+	m_vecChunk.push_back(chunk);
+
+	return true;
+}
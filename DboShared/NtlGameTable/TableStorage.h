@@ -0,0 +1,168 @@
+//***********************************************************************************
+//
+//	File		:	TableStorage.h
+//
+//	Begin		:	2026-10-17
+//
+//	Copyright	:	NTL-Inc Co., Ltd
+//
+//	Desc		:	Contiguous row storage and flat tblidx index used by CTable
+//
+//***********************************************************************************
+
+#pragma once
+
+#include "NtlSharedType.h"
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+struct sTBLDAT;
+
+
+//-----------------------------------------------------------------------------------
+// CTableIndex
+//
+// tblidx-sorted array of (tblidx, row) pairs. Keeps the subset of the std::map
+// interface that the tables use, so Begin()/End()/FindData() work unchanged while
+// lookups become a binary search over one contiguous block.
+// Rows saved by SaveToBinary are already sorted, so loading appends in O(1).
+//-----------------------------------------------------------------------------------
+class CTableIndex
+{
+public:
+
+	typedef std::pair<TBLIDX, sTBLDAT*>		value_type;
+	typedef std::vector<value_type>			CONTAINER;
+	typedef CONTAINER::iterator				iterator;
+	typedef CONTAINER::const_iterator		const_iterator;
+	typedef CONTAINER::size_type			size_type;
+
+public:
+
+	iterator				begin() { return m_vecRow.begin(); }
+	iterator				end() { return m_vecRow.end(); }
+	const_iterator			begin() const { return m_vecRow.begin(); }
+	const_iterator			end() const { return m_vecRow.end(); }
+
+	size_type				size() const { return m_vecRow.size(); }
+	bool					empty() const { return m_vecRow.empty(); }
+
+	void					clear() { CONTAINER().swap(m_vecRow); }
+	void					reserve(size_type nCount) { m_vecRow.reserve(nCount); }
+
+	iterator				find(TBLIDX tblidx)
+	{
+		iterator it = LowerBound(tblidx);
+		if (m_vecRow.end() == it || it->first != tblidx)
+		{
+			return m_vecRow.end();
+		}
+
+		return it;
+	}
+
+	std::pair<iterator, bool> insert(const value_type& val)
+	{
+		if (m_vecRow.empty() || m_vecRow.back().first < val.first)
+		{
+			m_vecRow.push_back(val);
+			return std::pair<iterator, bool>(m_vecRow.end() - 1, true);
+		}
+
+		iterator it = LowerBound(val.first);
+		if (m_vecRow.end() != it && it->first == val.first)
+		{
+			return std::pair<iterator, bool>(it, false);
+		}
+
+		it = m_vecRow.insert(it, val);
+		return std::pair<iterator, bool>(it, true);
+	}
+
+	size_type				erase(TBLIDX tblidx)
+	{
+		iterator it = find(tblidx);
+		if (m_vecRow.end() == it)
+		{
+			return 0;
+		}
+
+		m_vecRow.erase(it);
+		return 1;
+	}
+
+	iterator				erase(iterator it) { return m_vecRow.erase(it); }
+
+protected:
+
+	struct sKEY_LESS
+	{
+		bool operator()(const value_type& lhs, TBLIDX rhs) const { return lhs.first < rhs; }
+	};
+
+	iterator				LowerBound(TBLIDX tblidx) { return std::lower_bound(m_vecRow.begin(), m_vecRow.end(), tblidx, sKEY_LESS()); }
+
+protected:
+
+	CONTAINER				m_vecRow;
+};
+
+
+//-----------------------------------------------------------------------------------
+// CTableRowArena
+//
+// Bump allocator for table rows. LoadFromBinary reserves one block sized from the
+// serializer so that a whole table is constructed in a single allocation.
+// Rows are never moved once allocated; the memory is returned only by Release().
+//-----------------------------------------------------------------------------------
+class CTableRowArena
+{
+public:
+
+	enum eCONSTANT
+	{
+		ROW_ALIGNMENT = 8,
+		DEFAULT_CHUNK_SIZE = 64 * 1024
+	};
+
+public:
+
+	CTableRowArena(void);
+	~CTableRowArena(void);
+
+public:
+
+	void					Reserve(size_t nRowCount, size_t nRowSize);
+
+	void*					Alloc(size_t nSize);
+
+	bool					IsOwner(const void* pvRow) const;
+
+	void					Release(void);
+
+	size_t					GetChunkCount(void) const { return m_vecChunk.size(); }
+
+protected:
+
+	static size_t			AlignSize(size_t nSize) { return (nSize + ROW_ALIGNMENT - 1) & ~((size_t)ROW_ALIGNMENT - 1); }
+
+	bool					AddChunk(size_t nSize);
+
+protected:
+
+	struct sCHUNK
+	{
+		BYTE*				pbyBuffer;
+		size_t				nSize;
+		size_t				nUsed;
+	};
+
+	std::vector<sCHUNK>		m_vecChunk;
+
+private:
+
+	CTableRowArena(const CTableRowArena&);
+	CTableRowArena& operator=(const CTableRowArena&);
+};
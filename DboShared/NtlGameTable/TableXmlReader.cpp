@@ -0,0 +1,726 @@
+//***********************************************************************************
+//
+//	File		:	TableXmlReader.cpp
+//
+//	Begin		:	2026-10-17
+//
+//	Copyright	:	NTL-Inc Co., Ltd
+//
+//	Desc		:
+//
+//***********************************************************************************
+
+#include "stdafx.h"
+#include "TableXmlReader.h"
+
+#include <stdio.h>
+#include <string>
+
+CTableXmlReader::CTableXmlReader(void)
+:m_pwszCursor(NULL)
+,m_bInRow(false)
+,m_bEndOfRoot(true)
+,m_pwszError(NULL)
+{
+}
+
+CTableXmlReader::~CTableXmlReader(void)
+{
+	Close();
+}
+
+bool CTableXmlReader::Open(const WCHAR* pwszFullPath)
+{
+	Close();
+
+	if (NULL == pwszFullPath)
+	{
+		return false;
+	}
+
+	FILE* pFile = NULL;
+	if (0 != _wfopen_s(&pFile, pwszFullPath, L"rb"))
+	{
+		return false;
+	}
+
+	fseek(pFile, 0, SEEK_END);
+	long lSize = ftell(pFile);
+	fseek(pFile, 0, SEEK_SET);
+
+	if (0 >= lSize)
+	{
+		fclose(pFile);
+		return false;
+	}
+
+	std::vector<BYTE> vecFile(lSize);
+	size_t nRead = fread(&vecFile[0], 1, lSize, pFile);
+	fclose(pFile);
+
+	if ((size_t)lSize != nRead)
+	{
+		return false;
+	}
+
+	if (false == DecodeFile(vecFile))
+	{
+		Close();
+		return false;
+	}
+
+	m_pwszCursor = &m_vecBuffer[0];
+	m_bEndOfRoot = false;
+
+	return ReadRoot();
+}
+
+void CTableXmlReader::Close(void)
+{
+	std::vector<WCHAR>().swap(m_vecBuffer);
+
+	m_pwszCursor = NULL;
+	m_bInRow = false;
+	m_bEndOfRoot = true;
+	m_pwszError = NULL;
+}
+
+bool CTableXmlReader::NextRow(const WCHAR** ppwszRowName)
+{
+	if (HasError() || false != m_bEndOfRoot)
+	{
+		return false;
+	}
+
+	// Skips whatever the caller left unread in the previous row.
+	WCHAR* pwszText = NULL;
+	while (false != m_bInRow)
+	{
+		if (false == NextCell(&pwszText) && HasError())
+		{
+			return false;
+		}
+	}
+
+	SkipMisc();
+
+	if (L'<' == m_pwszCursor[0] && L'/' == m_pwszCursor[1])
+	{
+		m_bEndOfRoot = true;
+		ReadEndTag();
+		return false;
+	}
+
+	if (L'<' != m_pwszCursor[0])
+	{
+		return SetError(L"Text can't be placed directly in <dataroot>.");
+	}
+
+	WCHAR* pwszRowName = NULL;
+	bool bIsEmptyElement = false;
+	if (false == ReadStartTag(&pwszRowName, &bIsEmptyElement))
+	{
+		return false;
+	}
+
+	m_bInRow = (false == bIsEmptyElement);
+	*ppwszRowName = pwszRowName;
+
+	return true;
+}
+
+bool CTableXmlReader::NextCell(WCHAR** ppwszText)
+{
+	*ppwszText = NULL;
+
+	if (HasError() || false == m_bInRow)
+	{
+		return false;
+	}
+
+	SkipMisc();
+
+	if (L'<' == m_pwszCursor[0] && L'/' == m_pwszCursor[1])
+	{
+		m_bInRow = false;
+		ReadEndTag();
+		return false;
+	}
+
+	if (L'<' != m_pwszCursor[0])
+	{
+		m_bInRow = false;
+		return SetError(L"Text can't be placed directly in a row.");
+	}
+
+	WCHAR* pwszCellName = NULL;
+	bool bIsEmptyElement = false;
+	if (false == ReadStartTag(&pwszCellName, &bIsEmptyElement))
+	{
+		m_bInRow = false;
+		return false;
+	}
+
+	if (false != bIsEmptyElement)
+	{
+		return true;
+	}
+
+	WCHAR* pwszText = NULL;
+	WCHAR* pwszTextEnd = NULL;
+	if (false == ReadText(&pwszText, &pwszTextEnd) || false == ReadEndTag())
+	{
+		m_bInRow = false;
+		return false;
+	}
+
+	// The terminator may overwrite the '<' of the end tag, so it's written only now.
+	if (NULL != pwszText)
+	{
+		*pwszTextEnd = L'\0';
+	}
+
+	*ppwszText = pwszText;
+
+	return true;
+}
+
+DWORD CTableXmlReader::GetLineNumber(void) const
+{
+	if (m_vecBuffer.empty() || NULL == m_pwszCursor)
+	{
+		return 0;
+	}
+
+	DWORD dwLine = 1;
+	for (const WCHAR* pwsz = &m_vecBuffer[0]; pwsz < m_pwszCursor; ++pwsz)
+	{
+		if (L'\n' == *pwsz)
+		{
+			dwLine++;
+		}
+	}
+
+	return dwLine;
+}
+
+bool CTableXmlReader::DecodeFile(const std::vector<BYTE>& vecFile)
+{
+	size_t nSize = vecFile.size();
+	const BYTE* pbyData = &vecFile[0];
+
+	// UTF-16 needs a byte order mark.
+	if (2 <= nSize && ((0xFF == pbyData[0] && 0xFE == pbyData[1]) || (0xFE == pbyData[0] && 0xFF == pbyData[1])))
+	{
+		bool bBigEndian = (0xFE == pbyData[0]);
+		size_t nLength = (nSize - 2) / sizeof(WCHAR);
+
+		m_vecBuffer.resize(nLength + 1);
+		for (size_t i = 0; i < nLength; ++i)
+		{
+			BYTE byLow = pbyData[2 + i * 2];
+			BYTE byHigh = pbyData[2 + i * 2 + 1];
+			if (false != bBigEndian)
+			{
+				BYTE byTemp = byLow;
+				byLow = byHigh;
+				byHigh = byTemp;
+			}
+
+			m_vecBuffer[i] = (WCHAR)(byLow | (byHigh << 8));
+		}
+		m_vecBuffer[nLength] = L'\0';
+
+		return true;
+	}
+
+	if (3 <= nSize && 0xEF == pbyData[0] && 0xBB == pbyData[1] && 0xBF == pbyData[2])
+	{
+		pbyData += 3;
+		nSize -= 3;
+	}
+	else
+	{
+		// Without a byte order mark the declaration decides, UTF-8 being the default.
+		const char* pszData = (const char*)pbyData;
+		if (5 <= nSize && 0 == strncmp(pszData, "<?xml", 5))
+		{
+			size_t nDeclEnd = 5;
+			while (nDeclEnd + 1 < nSize && false == ('?' == pszData[nDeclEnd] && '>' == pszData[nDeclEnd + 1]))
+			{
+				nDeclEnd++;
+			}
+
+			std::string strDecl(pszData, nDeclEnd);
+			size_t nPos = strDecl.find("encoding");
+			if (std::string::npos != nPos)
+			{
+				nPos = strDecl.find_first_of("\"'", nPos);
+				if (std::string::npos == nPos)
+				{
+					return false;
+				}
+
+				size_t nEnd = strDecl.find(strDecl[nPos], nPos + 1);
+				if (std::string::npos == nEnd)
+				{
+					return false;
+				}
+
+				std::string strEncoding = strDecl.substr(nPos + 1, nEnd - nPos - 1);
+				if (0 != _stricmp(strEncoding.c_str(), "utf-8") && 0 != _stricmp(strEncoding.c_str(), "utf8"))
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	if (0 == nSize)
+	{
+		return false;
+	}
+
+	int nLength = ::MultiByteToWideChar(CP_UTF8, 0, (const char*)pbyData, (int)nSize, NULL, 0);
+	if (0 >= nLength)
+	{
+		return false;
+	}
+
+	m_vecBuffer.resize(nLength + 1);
+	::MultiByteToWideChar(CP_UTF8, 0, (const char*)pbyData, (int)nSize, &m_vecBuffer[0], nLength);
+	m_vecBuffer[nLength] = L'\0';
+
+	return true;
+}
+
+bool CTableXmlReader::ReadRoot(void)
+{
+	SkipMisc();
+
+	if (L'<' != m_pwszCursor[0])
+	{
+		return SetError(L"The root element is missing.");
+	}
+
+	WCHAR* pwszRootName = NULL;
+	bool bIsEmptyElement = false;
+	if (false == ReadStartTag(&pwszRootName, &bIsEmptyElement))
+	{
+		return false;
+	}
+
+	if (0 != wcscmp(pwszRootName, L"dataroot"))
+	{
+		return SetError(L"The root element isn't <dataroot>.");
+	}
+
+	m_bEndOfRoot = bIsEmptyElement;
+
+	return true;
+}
+
+void CTableXmlReader::SkipMisc(void)
+{
+	while (true)
+	{
+		while (IsSpace(*m_pwszCursor))
+		{
+			m_pwszCursor++;
+		}
+
+		if (L'<' != m_pwszCursor[0])
+		{
+			return;
+		}
+
+		if (L'?' == m_pwszCursor[1])
+		{
+			WCHAR* pwszEnd = wcsstr(m_pwszCursor, L"?>");
+			if (NULL == pwszEnd)
+			{
+				SetError(L"A processing instruction isn't closed.");
+				return;
+			}
+
+			m_pwszCursor = pwszEnd + 2;
+		}
+		else if (0 == wcsncmp(m_pwszCursor, L"<!--", 4))
+		{
+			WCHAR* pwszEnd = wcsstr(m_pwszCursor + 4, L"-->");
+			if (NULL == pwszEnd)
+			{
+				SetError(L"A comment isn't closed.");
+				return;
+			}
+
+			m_pwszCursor = pwszEnd + 3;
+		}
+		else if (0 == wcsncmp(m_pwszCursor, L"<!DOCTYPE", 9))
+		{
+			int nDepth = 0;
+			while (L'\0' != *m_pwszCursor && false == (L'>' == *m_pwszCursor && 0 == nDepth))
+			{
+				if (L'[' == *m_pwszCursor)
+				{
+					nDepth++;
+				}
+				else if (L']' == *m_pwszCursor)
+				{
+					nDepth--;
+				}
+
+				m_pwszCursor++;
+			}
+
+			if (L'\0' == *m_pwszCursor)
+			{
+				SetError(L"The document type declaration isn't closed.");
+				return;
+			}
+
+			m_pwszCursor++;
+		}
+		else
+		{
+			return;
+		}
+	}
+}
+
+bool CTableXmlReader::ReadStartTag(WCHAR** ppwszName, bool* pbIsEmptyElement)
+{
+	if (HasError())
+	{
+		return false;
+	}
+
+	// Skips '<'.
+	m_pwszCursor++;
+
+	WCHAR* pwszName = m_pwszCursor;
+	while (IsNameChar(*m_pwszCursor))
+	{
+		m_pwszCursor++;
+	}
+
+	WCHAR* pwszNameEnd = m_pwszCursor;
+	if (pwszName == pwszNameEnd)
+	{
+		return SetError(L"An element name is missing.");
+	}
+
+	*pbIsEmptyElement = false;
+
+	while (true)
+	{
+		while (IsSpace(*m_pwszCursor))
+		{
+			m_pwszCursor++;
+		}
+
+		if (L'>' == *m_pwszCursor)
+		{
+			m_pwszCursor++;
+			break;
+		}
+
+		if (L'/' == m_pwszCursor[0] && L'>' == m_pwszCursor[1])
+		{
+			*pbIsEmptyElement = true;
+			m_pwszCursor += 2;
+			break;
+		}
+
+		// Attributes aren't used by the tables, they are only skipped.
+		WCHAR* pwszAttributeName = m_pwszCursor;
+		while (IsNameChar(*m_pwszCursor))
+		{
+			m_pwszCursor++;
+		}
+
+		if (pwszAttributeName == m_pwszCursor)
+		{
+			return SetError(L"A start tag is malformed.");
+		}
+
+		while (IsSpace(*m_pwszCursor))
+		{
+			m_pwszCursor++;
+		}
+
+		if (L'=' != *m_pwszCursor)
+		{
+			return SetError(L"An attribute has no value.");
+		}
+		m_pwszCursor++;
+
+		while (IsSpace(*m_pwszCursor))
+		{
+			m_pwszCursor++;
+		}
+
+		WCHAR wchQuote = *m_pwszCursor;
+		if (L'"' != wchQuote && L'\'' != wchQuote)
+		{
+			return SetError(L"An attribute value isn't quoted.");
+		}
+
+		WCHAR* pwszValueEnd = wcschr(m_pwszCursor + 1, wchQuote);
+		if (NULL == pwszValueEnd)
+		{
+			return SetError(L"An attribute value isn't closed.");
+		}
+
+		m_pwszCursor = pwszValueEnd + 1;
+	}
+
+	// The name is terminated only after the whole tag is read, the terminator may overwrite '>'.
+	*pwszNameEnd = L'\0';
+	*ppwszName = pwszName;
+
+	return true;
+}
+
+bool CTableXmlReader::ReadEndTag(void)
+{
+	if (HasError())
+	{
+		return false;
+	}
+
+	if (L'<' != m_pwszCursor[0] || L'/' != m_pwszCursor[1])
+	{
+		return SetError(L"An end tag is expected.");
+	}
+	m_pwszCursor += 2;
+
+	while (IsNameChar(*m_pwszCursor))
+	{
+		m_pwszCursor++;
+	}
+
+	while (IsSpace(*m_pwszCursor))
+	{
+		m_pwszCursor++;
+	}
+
+	if (L'>' != *m_pwszCursor)
+	{
+		return SetError(L"An end tag isn't closed.");
+	}
+	m_pwszCursor++;
+
+	return true;
+}
+
+bool CTableXmlReader::ReadText(WCHAR** ppwszText, WCHAR** ppwszTextEnd)
+{
+	WCHAR* pwszStart = m_pwszCursor;
+	WCHAR* pwszOut = m_pwszCursor;
+
+	while (true)
+	{
+		WCHAR wch = *m_pwszCursor;
+
+		if (L'\0' == wch)
+		{
+			return SetError(L"An element isn't closed.");
+		}
+
+		if (L'<' == wch)
+		{
+			if (0 == wcsncmp(m_pwszCursor, L"<![CDATA[", 9))
+			{
+				WCHAR* pwszEnd = wcsstr(m_pwszCursor + 9, L"]]>");
+				if (NULL == pwszEnd)
+				{
+					return SetError(L"A CDATA section isn't closed.");
+				}
+
+				for (WCHAR* pwsz = m_pwszCursor + 9; pwsz < pwszEnd; ++pwsz)
+				{
+					*pwszOut++ = *pwsz;
+				}
+
+				m_pwszCursor = pwszEnd + 3;
+				continue;
+			}
+
+			if (0 == wcsncmp(m_pwszCursor, L"<!--", 4))
+			{
+				WCHAR* pwszEnd = wcsstr(m_pwszCursor + 4, L"-->");
+				if (NULL == pwszEnd)
+				{
+					return SetError(L"A comment isn't closed.");
+				}
+
+				m_pwszCursor = pwszEnd + 3;
+				continue;
+			}
+
+			if (L'/' != m_pwszCursor[1])
+			{
+				return SetError(L"A cell can't contain elements.");
+			}
+
+			break;
+		}
+
+		if (L'&' == wch)
+		{
+			WCHAR* pwszEntity = m_pwszCursor + 1;
+			WCHAR* pwszSemicolon = pwszEntity;
+			while (L'\0' != *pwszSemicolon && L';' != *pwszSemicolon && L'<' != *pwszSemicolon)
+			{
+				pwszSemicolon++;
+			}
+
+			if (L';' != *pwszSemicolon)
+			{
+				return SetError(L"An entity reference isn't closed.");
+			}
+
+			size_t nEntityLength = pwszSemicolon - pwszEntity;
+
+			if (2 == nEntityLength && 0 == wcsncmp(pwszEntity, L"lt", 2))
+			{
+				*pwszOut++ = L'<';
+			}
+			else if (2 == nEntityLength && 0 == wcsncmp(pwszEntity, L"gt", 2))
+			{
+				*pwszOut++ = L'>';
+			}
+			else if (3 == nEntityLength && 0 == wcsncmp(pwszEntity, L"amp", 3))
+			{
+				*pwszOut++ = L'&';
+			}
+			else if (4 == nEntityLength && 0 == wcsncmp(pwszEntity, L"quot", 4))
+			{
+				*pwszOut++ = L'"';
+			}
+			else if (4 == nEntityLength && 0 == wcsncmp(pwszEntity, L"apos", 4))
+			{
+				*pwszOut++ = L'\'';
+			}
+			else if (2 <= nEntityLength && L'#' == pwszEntity[0])
+			{
+				DWORD dwCodePoint = 0;
+				if (L'x' == pwszEntity[1] || L'X' == pwszEntity[1])
+				{
+					for (WCHAR* pwsz = pwszEntity + 2; pwsz < pwszSemicolon; ++pwsz)
+					{
+						if (L'0' <= *pwsz && L'9' >= *pwsz)
+						{
+							dwCodePoint = dwCodePoint * 16 + (*pwsz - L'0');
+						}
+						else if (L'a' <= *pwsz && L'f' >= *pwsz)
+						{
+							dwCodePoint = dwCodePoint * 16 + 10 + (*pwsz - L'a');
+						}
+						else if (L'A' <= *pwsz && L'F' >= *pwsz)
+						{
+							dwCodePoint = dwCodePoint * 16 + 10 + (*pwsz - L'A');
+						}
+						else
+						{
+							return SetError(L"A character reference is malformed.");
+						}
+					}
+				}
+				else
+				{
+					for (WCHAR* pwsz = pwszEntity + 1; pwsz < pwszSemicolon; ++pwsz)
+					{
+						if (L'0' > *pwsz || L'9' < *pwsz)
+						{
+							return SetError(L"A character reference is malformed.");
+						}
+
+						dwCodePoint = dwCodePoint * 10 + (*pwsz - L'0');
+					}
+				}
+
+				if (0x10FFFF < dwCodePoint)
+				{
+					return SetError(L"A character reference is out of range.");
+				}
+
+				// "&#65536;" is long enough for the surrogate pair, so the output never passes the cursor.
+				if (0xFFFF < dwCodePoint)
+				{
+					dwCodePoint -= 0x10000;
+					*pwszOut++ = (WCHAR)(0xD800 + (dwCodePoint >> 10));
+					*pwszOut++ = (WCHAR)(0xDC00 + (dwCodePoint & 0x3FF));
+				}
+				else
+				{
+					*pwszOut++ = (WCHAR)dwCodePoint;
+				}
+			}
+			else
+			{
+				return SetError(L"An unknown entity is referenced.");
+			}
+
+			m_pwszCursor = pwszSemicolon + 1;
+			continue;
+		}
+
+		// Line ends are normalized to '\n'.
+		if (L'\r' == wch)
+		{
+			*pwszOut++ = L'\n';
+			m_pwszCursor++;
+			if (L'\n' == *m_pwszCursor)
+			{
+				m_pwszCursor++;
+			}
+			continue;
+		}
+
+		*pwszOut++ = wch;
+		m_pwszCursor++;
+	}
+
+	while (pwszStart < pwszOut && IsSpace(*pwszStart))
+	{
+		pwszStart++;
+	}
+	while (pwszOut > pwszStart && IsSpace(*(pwszOut - 1)))
+	{
+		pwszOut--;
+	}
+
+	*ppwszText = (pwszStart == pwszOut) ? NULL : pwszStart;
+	*ppwszTextEnd = pwszOut;
+
+	return true;
+}
+
+bool CTableXmlReader::SetError(const WCHAR* pwszError)
+{
+	if (NULL == m_pwszError)
+	{
+		m_pwszError = pwszError;
+	}
+
+	m_bEndOfRoot = true;
+
+	return false;
+}
+
+bool CTableXmlReader::IsNameChar(WCHAR wch)
+{
+	if ((L'a' <= wch && L'z' >= wch) || (L'A' <= wch && L'Z' >= wch) || (L'0' <= wch && L'9' >= wch))
+	{
+		return true;
+	}
+
+	if (L'_' == wch || L'-' == wch || L'.' == wch || L':' == wch)
+	{
+		return true;
+	}
+
+	return 0x80 <= wch;
+}
@@ -0,0 +1,103 @@
+//***********************************************************************************
+//
+//	File		:	TableXmlReader.h
+//
+//	Begin		:	2026-10-17
+//
+//	Copyright	:	NTL-Inc Co., Ltd
+//
+//	Desc		:	Forward-only reader for the table xml files
+//
+//***********************************************************************************
+
+#pragma once
+
+#include "NtlSharedType.h"
+
+#include <vector>
+
+
+//-----------------------------------------------------------------------------------
+// CTableXmlReader
+//
+// Table xml files are a <dataroot> element holding one element per row, each row
+// holding one element per cell. The reader converts the whole file to UTF-16 once
+// and then walks it front to back, without building a DOM.
+//
+// Cell text is decoded in place and terminated inside the reader's buffer, so the
+// pointers NextCell() returns stay valid until the reader is closed. Whitespace
+// around the text is trimmed and blank cells come back as NULL, the same as
+// IXMLDOMNode::get_firstChild()/get_text() with the default MSXML settings.
+//-----------------------------------------------------------------------------------
+class CTableXmlReader
+{
+public:
+
+	CTableXmlReader(void);
+
+	~CTableXmlReader(void);
+
+public:
+
+	// Fails if the file can't be read or its encoding isn't UTF-8 / UTF-16.
+	bool					Open(const WCHAR* pwszFullPath);
+
+	void					Close(void);
+
+public:
+
+	// Moves to the next row. Returns false at the end of <dataroot> or on an error.
+	bool					NextRow(const WCHAR** ppwszRowName);
+
+	// Moves to the next cell of the current row. Returns false at the end of the row or on an error.
+	bool					NextCell(WCHAR** ppwszText);
+
+	bool					HasError(void) const { return NULL != m_pwszError; }
+
+	const WCHAR*			GetError(void) const { return m_pwszError; }
+
+	// 1-based line of the current position.
+	DWORD					GetLineNumber(void) const;
+
+protected:
+
+	bool					DecodeFile(const std::vector<BYTE>& vecFile);
+
+	bool					ReadRoot(void);
+
+	// Skips whitespace, comments and processing instructions.
+	void					SkipMisc(void);
+
+	// Parses "<name attr='...'" up to and including '>' or "/>".
+	bool					ReadStartTag(WCHAR** ppwszName, bool* pbIsEmptyElement);
+
+	bool					ReadEndTag(void);
+
+	// Decodes the character data at the cursor in place and stops at the end tag.
+	// The text isn't terminated yet, *ppwszTextEnd is where the terminator goes.
+	bool					ReadText(WCHAR** ppwszText, WCHAR** ppwszTextEnd);
+
+	bool					SetError(const WCHAR* pwszError);
+
+	static bool				IsSpace(WCHAR wch) { return L' ' == wch || L'\t' == wch || L'\r' == wch || L'\n' == wch; }
+
+	static bool				IsNameChar(WCHAR wch);
+
+protected:
+
+	std::vector<WCHAR>		m_vecBuffer;
+
+	WCHAR*					m_pwszCursor;
+
+	// Set while the cells of a row haven't all been read.
+	bool					m_bInRow;
+
+	bool					m_bEndOfRoot;
+
+	const WCHAR*			m_pwszError;
+
+private:
+
+	CTableXmlReader(const CTableXmlReader&);
+	CTableXmlReader& operator=(const CTableXmlReader&);
+};
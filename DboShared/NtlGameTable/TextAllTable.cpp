@@ -143,7 +143,7 @@ bool CTextTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 	while (0 < serializer.GetDataSize())
 	{
-		sTEXT_TBLDAT* pTableData = new sTEXT_TBLDAT;
+		sTEXT_TBLDAT* pTableData = NewRow<sTEXT_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -156,7 +156,7 @@ bool CTextTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		{
 			//- yoshiki : To log system!
 
-			delete pTableData;
+			DeleteRow(pTableData);
 
 			Destroy();
 			return false;
@@ -168,7 +168,7 @@ bool CTextTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		{
 			//- yoshiki : To log system!
 
-			delete pTableData;
+			DeleteRow(pTableData);
 
 			Destroy();
 			return false;
@@ -179,7 +179,7 @@ bool CTextTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		{
 			//- yoshiki : To log system!
 
-			delete pTableData;
+			DeleteRow(pTableData);
 
 			Destroy();
 			return false;
@@ -194,7 +194,7 @@ bool CTextTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	};
@@ -760,7 +760,7 @@ bool CTextAllTable::LoadFromBinary(CNtlSerializer& serializer)
 		}
 
 		CNtlSerializer partialSerializer;
-		serializer.Out(partialSerializer, nPayloadLength);
+		serializer.OutView(partialSerializer, nPayloadLength);
 
 		if ( false == pTable->LoadFromBinary(partialSerializer, false ) )
 		{
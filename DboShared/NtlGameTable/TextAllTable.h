@@ -67,6 +67,9 @@ public:
 
 protected:
 
+	// Text sheets are queried column by column, so they stay on MSXML.
+	virtual bool				InitializeFromXmlFile(WCHAR* pwszFileName, bool bReload) { return LoadFromXmlDoc(pwszFileName, bReload); }
+
 	virtual bool				InitializeFromXmlDoc(CNtlXMLDoc* pXmlDoc, WCHAR* pwszFileName, bool bReload);
 
 
@@ -144,7 +144,7 @@ bool CTextServerTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 	while (0 < serializer.GetDataSize())
 	{
-		sTEXT_SERVER_TBLDAT* pTableData = new sTEXT_SERVER_TBLDAT;
+		sTEXT_SERVER_TBLDAT* pTableData = NewRow<sTEXT_SERVER_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -157,7 +157,7 @@ bool CTextServerTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		{
 			//- yoshiki : To log system!
 
-			delete pTableData;
+			DeleteRow(pTableData);
 
 			Destroy();
 			return false;
@@ -169,7 +169,7 @@ bool CTextServerTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		{
 			//- yoshiki : To log system!
 
-			delete pTableData;
+			DeleteRow(pTableData);
 
 			Destroy();
 			return false;
@@ -180,7 +180,7 @@ bool CTextServerTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		{
 			//- yoshiki : To log system!
 
-			delete pTableData;
+			DeleteRow(pTableData);
 
 			Destroy();
 			return false;
@@ -195,7 +195,7 @@ bool CTextServerTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 	};
 
@@ -156,7 +156,7 @@ bool CTimeQuestTable::AddTable(void * pvTable, bool bReload)
 //-----------------------------------------------------------------------------------
 bool CTimeQuestTable::SetTableData( void* pvTable, WCHAR* pwszSheetName, std::wstring* pstrDataName, BSTR bstrData )
 {
-	static char szTemp[1024] = { 0x00, };
+	char szTemp[1024] = { 0x00, };
 
 	if ( 0 == wcscmp( pwszSheetName, L"Table_Data_KOR" ) )
 	{
@@ -645,10 +645,12 @@ bool CTimeQuestTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sTIMEQUEST_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sTIMEQUEST_TBLDAT* pTableData = new sTIMEQUEST_TBLDAT;
+		sTIMEQUEST_TBLDAT* pTableData = NewRow<sTIMEQUEST_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -658,7 +660,7 @@ bool CTimeQuestTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -666,7 +668,7 @@ bool CTimeQuestTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -214,10 +214,12 @@ bool CTypeDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sTYPE_DROP_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sTYPE_DROP_TBLDAT* pTableData = new sTYPE_DROP_TBLDAT;
+		sTYPE_DROP_TBLDAT* pTableData = NewRow<sTYPE_DROP_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -227,7 +229,7 @@ bool CTypeDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -235,7 +237,7 @@ bool CTypeDropTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
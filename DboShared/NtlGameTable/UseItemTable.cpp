@@ -351,10 +351,12 @@ bool CUseItemTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sUSE_ITEM_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sUSE_ITEM_TBLDAT* pTableData = new sUSE_ITEM_TBLDAT;
+		sUSE_ITEM_TBLDAT* pTableData = NewRow<sUSE_ITEM_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -364,7 +366,7 @@ bool CUseItemTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -372,7 +374,7 @@ bool CUseItemTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
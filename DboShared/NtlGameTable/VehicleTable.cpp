@@ -195,10 +195,12 @@ bool CVehicleTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sVEHICLE_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sVEHICLE_TBLDAT* pTableData = new sVEHICLE_TBLDAT;
+		sVEHICLE_TBLDAT* pTableData = NewRow<sVEHICLE_TBLDAT>();
 		if ( NULL == pTableData )
 		{
 			//- yoshiki : To log system!
@@ -208,7 +210,7 @@ bool CVehicleTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -216,7 +218,7 @@ bool CVehicleTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
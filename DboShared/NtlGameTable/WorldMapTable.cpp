@@ -218,10 +218,12 @@ bool CWorldMapTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sWORLD_MAP_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sWORLD_MAP_TBLDAT* pTableData = new sWORLD_MAP_TBLDAT;
+		sWORLD_MAP_TBLDAT* pTableData = NewRow<sWORLD_MAP_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -231,7 +233,7 @@ bool CWorldMapTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -239,7 +241,7 @@ bool CWorldMapTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -198,10 +198,12 @@ bool CWorldPlayTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sWORLDPLAY_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sWORLDPLAY_TBLDAT* pTableData = new sWORLDPLAY_TBLDAT;
+		sWORLDPLAY_TBLDAT* pTableData = NewRow<sWORLDPLAY_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -211,7 +213,7 @@ bool CWorldPlayTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -219,7 +221,7 @@ bool CWorldPlayTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
@@ -467,10 +467,12 @@ bool CWorldTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sWORLD_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sWORLD_TBLDAT* pTableData = new sWORLD_TBLDAT;
+		sWORLD_TBLDAT* pTableData = NewRow<sWORLD_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -480,7 +482,7 @@ bool CWorldTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -488,7 +490,7 @@ bool CWorldTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
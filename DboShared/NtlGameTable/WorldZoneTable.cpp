@@ -182,10 +182,12 @@ bool CWorldZoneTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 	BYTE byMargin = 1;
 	serializer >> byMargin;
 
+	ReserveRows<sWORLD_ZONE_TBLDAT>(serializer);
+
 	bool bLoop = true;
 	do
 	{
-		sWORLD_ZONE_TBLDAT* pTableData = new sWORLD_ZONE_TBLDAT;
+		sWORLD_ZONE_TBLDAT* pTableData = NewRow<sWORLD_ZONE_TBLDAT>();
 		if (NULL == pTableData)
 		{
 			//- yoshiki : To log system!
@@ -195,7 +197,7 @@ bool CWorldZoneTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 
 		if (false == pTableData->LoadFromBinary(serializer))
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 			bLoop = false;
 			break;
 		}
@@ -203,7 +205,7 @@ bool CWorldZoneTable::LoadFromBinary(CNtlSerializer& serializer, bool bReload)
 		//  [4/26/2008 zeroera] :  : ϴ Load Ῡδ File Loading Ѵ
 		if( false == AddTable(pTableData, bReload) )
 		{
-			delete pTableData;
+			DeleteRow(pTableData);
 		}
 
 	} while (false != bLoop);
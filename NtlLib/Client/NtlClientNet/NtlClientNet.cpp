@@ -24,6 +24,7 @@
 
 #include "NtlPacketEncoder_XOR.h"
 #include "NtlPacketEncoder_RandKey.h"
+#include "NtlPacketCipher.h"
 
 
 #include "NtlQueue.h"
@@ -34,12 +35,300 @@
 #include <process.h>
 #include <deque>
 #include <map>
+#include <vector>
 
 #if __SGPRO_BOTSYSTEM_SENDANDRECVTESTCODE__
 #include <tchar.h>
 #endif
 
-typedef CNtlQueue<CNtlPacket*> PACKETQUEUE;
+//---------------------------------------------------------------------------------------
+// Pooled packet
+//
+// Every packet pushed by the application and every packet completed in the recv buffer
+// used to be a new CNtlPacket with a calloc'd body, which makes the allocator the
+// bottleneck when a mass combat bursts hundreds of packets in a frame.
+// The packets now live in size classed free lists and go back there on their last Release().
+//---------------------------------------------------------------------------------------
+class CPacketBufferPool;
+class CPooledPacket : public CNtlPacket
+{
+	friend class CPacketBufferPool;
+
+protected:
+
+	CPooledPacket(int nSizeClass, int nBufferSize);
+
+	virtual ~CPooledPacket();
+
+
+public:
+
+	//   ϼ Ŷ 
+	void							Assign(BYTE * pPacketBuffer, WORD wPacketSize);
+
+	// CNtlPacket( BYTE * pPacketData, WORD wPacketBodySize )   Ŷ 
+	void							Build(BYTE * pPacketData, WORD wPacketBodySize);
+
+
+public:
+
+	void							AddRef() { InterlockedIncrement( &m_lReferenceCount ); }
+
+	void							Release();
+
+
+private:
+
+	BYTE *							m_pPoolBuffer;
+
+	int								m_nSizeClass;
+
+	LONG							m_lReferenceCount;
+
+};
+
+
+//---------------------------------------------------------------------------------------
+// Packet buffer pool
+//---------------------------------------------------------------------------------------
+class CPacketBufferPool
+{
+public:
+
+	enum
+	{
+		SIZE_CLASS_COUNT = 4,
+		MAX_FREE_PACKET = 512, // Ŭ  ִ Ŷ 
+	};
+
+
+public:
+
+	CPacketBufferPool();
+
+	virtual ~CPacketBufferPool();
+
+
+public:
+
+	// ۷ īƮ 1  ش
+	CPooledPacket *					Alloc(int nPacketSize);
+
+	void							Free(CPooledPacket * pPacket);
+
+
+protected:
+
+	int								GetSizeClass(int nPacketSize);
+
+
+private:
+
+	static const int				SIZE_CLASS[SIZE_CLASS_COUNT];
+
+	std::vector<CPooledPacket*>		m_freeList[SIZE_CLASS_COUNT];
+
+	CNtlMutex						m_mutex;
+
+};
+
+
+const int CPacketBufferPool::SIZE_CLASS[SIZE_CLASS_COUNT] = { 128, 512, PACKET_MAX_SIZE, PACKET_HEADSIZE + PACKET_LIMIT_SIZE };
+
+// ޽ , ̺Ʈ , ø̼ 尡  Ѵ
+static CPacketBufferPool			s_packetPool;
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+CPooledPacket::CPooledPacket(int nSizeClass, int nBufferSize)
+:
+m_nSizeClass( nSizeClass ),
+m_lReferenceCount( 0 )
+{
+	m_pPoolBuffer = (BYTE*) malloc( nBufferSize );
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+CPooledPacket::~CPooledPacket()
+{
+	Destroy();
+
+	SAFE_FREE( m_pPoolBuffer );
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+void CPooledPacket::Assign(BYTE * pPacketBuffer, WORD wPacketSize)
+{
+	memcpy( m_pPoolBuffer, pPacketBuffer, wPacketSize );
+
+	InitUseExternalBuffer( m_pPoolBuffer, wPacketSize );
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+void CPooledPacket::Build(BYTE * pPacketData, WORD wPacketBodySize)
+{
+	//  ̹Ƿ  ȣȭ ÷   ( new CNtlPacket  calloc ̾ )
+	ZeroMemory( m_pPoolBuffer, PACKET_HEADSIZE );
+
+	InitUseExternalBuffer( m_pPoolBuffer, (WORD)GetHeaderSize() + wPacketBodySize );
+	SetPacket( pPacketData, wPacketBodySize );
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+void CPooledPacket::Release()
+{
+	if( 0 == InterlockedDecrement( &m_lReferenceCount ) )
+	{
+		s_packetPool.Free( this );
+	}
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+CPacketBufferPool::CPacketBufferPool()
+{
+	for( int i = 0; i < SIZE_CLASS_COUNT; i++ )
+	{
+		m_freeList[i].reserve( MAX_FREE_PACKET );
+	}
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+CPacketBufferPool::~CPacketBufferPool()
+{
+	for( int i = 0; i < SIZE_CLASS_COUNT; i++ )
+	{
+		for( std::vector<CPooledPacket*>::iterator it = m_freeList[i].begin(); it != m_freeList[i].end(); it++ )
+		{
+			delete *it;
+		}
+
+		m_freeList[i].clear();
+	}
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:	 Ŭ,  ũ⸦  -1
+//-----------------------------------------------------------------------------------
+int CPacketBufferPool::GetSizeClass(int nPacketSize)
+{
+	for( int i = 0; i < SIZE_CLASS_COUNT; i++ )
+	{
+		if( nPacketSize <= SIZE_CLASS[i] )
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+CPooledPacket * CPacketBufferPool::Alloc(int nPacketSize)
+{
+	int nSizeClass = GetSizeClass( nPacketSize );
+	if( nSizeClass < 0 || nPacketSize < PACKET_HEADSIZE )
+	{
+		return NULL;
+	}
+
+
+	CPooledPacket * pPacket = NULL;
+
+	m_mutex.Lock();
+
+	if( false == m_freeList[nSizeClass].empty() )
+	{
+		pPacket = m_freeList[nSizeClass].back();
+		m_freeList[nSizeClass].pop_back();
+	}
+
+	m_mutex.Unlock();
+
+
+	if( NULL == pPacket )
+	{
+		pPacket = new CPooledPacket( nSizeClass, SIZE_CLASS[nSizeClass] );
+		if( NULL == pPacket->m_pPoolBuffer )
+		{
+			delete pPacket;
+			return NULL;
+		}
+	}
+
+	pPacket->m_lReferenceCount = 1;
+
+	return pPacket;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+void CPacketBufferPool::Free(CPooledPacket * pPacket)
+{
+	pPacket->Destroy();
+
+	m_mutex.Lock();
+
+	if( m_freeList[pPacket->m_nSizeClass].size() < (size_t) MAX_FREE_PACKET )
+	{
+		m_freeList[pPacket->m_nSizeClass].push_back( pPacket );
+		pPacket = NULL;
+	}
+
+	m_mutex.Unlock();
+
+
+	// Ʈ    Ŷ ش
+	if( pPacket )
+	{
+		delete pPacket;
+	}
+}
+
+
+//---------------------------------------------------------------------------------------
+//
+//---------------------------------------------------------------------------------------
+#define RELEASE_PACKET(p)  if( p ) { p->Release(); p = NULL; }
+//---------------------------------------------------------------------------------------
+
+
+typedef CNtlQueue<CPooledPacket*> PACKETQUEUE;
 
 
 //---------------------------------------------------------------------------------------
@@ -67,6 +356,12 @@ void NtlClientNetSetPrintFlag( unsigned int dwFlag )
 }
 
 
+bool NtlClientNetCipherBenchmark( int nPacketSize, int nIteration, NtlClientNetLogCallback LogCallback )
+{
+	return NtlCipherBenchmark( nPacketSize, nIteration, LogCallback );
+}
+
+
 //---------------------------------------------------------------------------------------
 // CServerConnection class ( CNtlClientNet inner class )
 //---------------------------------------------------------------------------------------
@@ -135,6 +430,8 @@ public:
 
 	int								SendPendingData();
 
+	int								EncodeToSendBuffer(BYTE * pPacketData, WORD wPacketBodySize);
+
 
 public:
 
@@ -393,6 +690,8 @@ public:
 
 	bool						IsProgress(HSERVER hServer);
 
+	void						SetTraceCallback(NtlClientNetTraceCallback TraceCallback) { m_pfnTraceCallback = TraceCallback; }
+
 	void						Log(const char * lpszFile, const char * lpszFunc, int nLine, bool bDate, const char * lpszText, ...);
 
 
@@ -449,6 +748,8 @@ protected:
 
 	NtlClientNetLogCallback 	m_pfnLogCallBack;
 
+	NtlClientNetTraceCallback volatile	m_pfnTraceCallback;
+
 	DWORD						m_dwAliveTime;
 
 	int							m_nCurConnection;
@@ -458,6 +759,36 @@ protected:
 };
 
 
+//---------------------------------------------------------------------------------------
+// Trace Callback    θ ( continue   END  Ҹ )
+//---------------------------------------------------------------------------------------
+class CNetTraceScope
+{
+public:
+
+	CNetTraceScope(NtlClientNetTraceCallback TraceCallback, const char * lpszName)
+		:m_pfnTraceCallback( TraceCallback )
+	{
+		if( m_pfnTraceCallback )
+		{
+			m_pfnTraceCallback( NETCLIENT_TRACE_BEGIN, lpszName );
+		}
+	}
+
+	~CNetTraceScope()
+	{
+		if( m_pfnTraceCallback )
+		{
+			m_pfnTraceCallback( NETCLIENT_TRACE_END, NULL );
+		}
+	}
+
+private:
+
+	NtlClientNetTraceCallback	m_pfnTraceCallback;
+};
+
+
 //-----------------------------------------------------------------------------------
 //		Purpose	: ClientNetworkImp Thread Procedure
 //		Return	:
@@ -694,6 +1025,21 @@ void CNtlClientNet::Destroy()
 }
 
 
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+void CNtlClientNet::SetTraceCallback(NtlClientNetTraceCallback TraceCallback)
+{
+	_ASSERT( NULL != m_pImp );
+
+	if( m_pImp )
+	{
+		m_pImp->SetTraceCallback( TraceCallback );
+	}
+}
+
+
 //-----------------------------------------------------------------------------------
 //		Purpose	:
 //		Return	:
@@ -886,27 +1232,27 @@ void CNtlClientNet::RecvPacketProcess( CRecvPacketProcess& rProc )
 		return;
 	}
 
-	CNtlPacket* pPacket = pConnection->GetRecvQueue()->Peek();
+	CPooledPacket* pPacket = pConnection->GetRecvQueue()->Peek();
 	while ( NULL != pPacket )
 	{
 #if __SGPRO_BOTSYSTEM_SENDANDRECVTESTCODE__
 		if( false == rProc.RecvPacketProcess( pPacket ) )
 		{
 			pPacket = pConnection->GetRecvQueue()->Pop();
-			SAFE_DELETE( pPacket );
+			RELEASE_PACKET( pPacket );
 			return;
 		}
 #else
 		if( false == rProc.RecvPacketProcess( pPacket->GetPacketData() ) )
 		{					
 			pPacket = pConnection->GetRecvQueue()->Pop();
-			SAFE_DELETE( pPacket );
+			RELEASE_PACKET( pPacket );
 			return;
 		}
 #endif
 
 		pPacket = pConnection->GetRecvQueue()->Pop();
-		SAFE_DELETE( pPacket );
+		RELEASE_PACKET( pPacket );
 
 		if( false == rProc.IsActivePop() )
 		{
@@ -1007,18 +1353,18 @@ bool CServerConnection::Create(CClientNetImp * pParent, CNtlSocket &rSocket, CNt
 //-----------------------------------------------------------------------------------
 void CServerConnection::Destroy()
 {
-	CNtlPacket * pPacket = NULL;
+	CPooledPacket * pPacket = NULL;
 
 	do
 	{
 		pPacket = m_sendQueue.Pop();
-		SAFE_DELETE( pPacket );        
+		RELEASE_PACKET( pPacket );        
 	} while(!m_sendQueue.IsEmpty());
 
 	do
 	{
 		pPacket = m_recvQueue.Pop();		
-		SAFE_DELETE( pPacket );
+		RELEASE_PACKET( pPacket );
 	} while(!m_recvQueue.IsEmpty());
 
 
@@ -1204,13 +1550,15 @@ int	CServerConnection::RecvPendingData()
 		m_recvBuffer.IncreaseWorkPos( packet.GetUsedSize() );
 
 
-		CNtlPacket* pPacket = new CNtlPacket( packet );        
+		CPooledPacket* pPacket = s_packetPool.Alloc( packet.GetUsedSize() );
 		if( NULL == pPacket )
 		{
 			CONNECTION_LOGDL( "Packet Memory Allocate Error" );
 			return -1;
 		}
 
+		pPacket->Assign( packet.GetPacketBuffer(), packet.GetUsedSize() );
+
 #if __SGPRO_BOTSYSTEM_SENDANDRECVTESTCODE__
 #else
 		if( m_pPacketEncoder )
@@ -1219,7 +1567,7 @@ int	CServerConnection::RecvPendingData()
 			if( NTL_SUCCESS != rc )
 			{
 				CONNECTION_LOGDL( "RxDecrypt Fail : (%d)%s", rc, NtlGetErrorMessage(rc) );
-				SAFE_DELETE( pPacket );
+				RELEASE_PACKET( pPacket );
 				return -1;
 			}
 		}
@@ -1273,7 +1621,7 @@ int CServerConnection::SendPendingData()
 	int rc = NTL_SUCCESS;
 #endif
 
-	CNtlPacket * pPacket = m_sendQueue.Peek();
+	CPooledPacket * pPacket = m_sendQueue.Peek();
 
 	while( pPacket )	
 	{
@@ -1302,7 +1650,7 @@ int CServerConnection::SendPendingData()
 
 		m_sendQueue.Pop();
 
-		SAFE_DELETE( pPacket );
+		RELEASE_PACKET( pPacket );
 
 		++m_dwSendPacketCount;
 
@@ -1314,6 +1662,63 @@ int CServerConnection::SendPendingData()
 }
 
 
+//-----------------------------------------------------------------------------------
+//		Purpose	: ť ġ ʰ send  push ġ ٷ Ŷ  ȣȭѴ
+//				  ( send ۴ Ŷ ִ ũ⸸ŭ extra  ־ ׻    ִ )
+//		Return	:	1 ̸ ۿ , 0 ̸ ť ־ , -1 ̸ 
+//-----------------------------------------------------------------------------------
+int CServerConnection::EncodeToSendBuffer(BYTE * pPacketData, WORD wPacketBodySize)
+{
+	int nPacketSize = PACKET_HEADSIZE + wPacketBodySize;
+
+	// տ  Ŷ   Ų
+	if( false == m_sendQueue.IsEmpty() )
+	{
+		return 0;
+	}
+
+	if( nPacketSize >= m_sendBuffer.GetMaxPacketSize() || m_sendBuffer.GetFreeSize() <= nPacketSize )
+	{
+		return 0;
+	}
+
+
+	BYTE * pPushPtr = m_sendBuffer.GetQueuePushPtr();
+	ZeroMemory( pPushPtr, PACKET_HEADSIZE );
+
+	CNtlPacket packet;
+	packet.AttachData( pPushPtr, (WORD) nPacketSize );
+	packet.SetPacket( pPacketData, wPacketBodySize );
+
+	if( false == packet.IsValidPacket() )
+	{
+		return -1;
+	}
+
+	packet.GetPacketHeader()->bySequence = (BYTE) ( m_dwSendPacketCount & PACKET_MAX_SEQUENCE );
+
+#if __SGPRO_BOTSYSTEM_SENDANDRECVTESTCODE__
+#else
+	if( m_pPacketEncoder )
+	{
+		int rc = m_pPacketEncoder->TxEncrypt( packet );
+		if( NTL_SUCCESS != rc )
+		{
+			CONNECTION_LOGDL( "TxDecrypt Fail : (%d)%s", rc, NtlGetErrorMessage(rc) );
+			return -1;
+		}
+	}
+#endif
+
+	m_sendBuffer.IncreasePushPos( packet.GetUsedSize() );
+
+	++m_dwSendPacketCount;
+
+
+	return 1;
+}
+
+
 //-----------------------------------------------------------------------------------
 //		Purpose	:
 //		Return	:
@@ -1369,6 +1774,7 @@ void CClientNetImp::Init()
 	m_pfnLogCallBack = NULL;
 	m_pfnEventCallback = NULL;
 	m_pfnLogCallBack = NULL;
+	m_pfnTraceCallback = NULL;
 }
 
 
@@ -2042,7 +2448,7 @@ void CMsgBaseNetworkImp::PopPacket(HSERVER hServer)
 	}
 
 
-	CNtlPacket * pPacket = pConnection->GetRecvQueue()->Pop();
+	CPooledPacket * pPacket = pConnection->GetRecvQueue()->Pop();
 	char str[1024];
 	int i;
 	for (i = 0; i < pPacket->GetPacketDataSize(); i++)
@@ -2051,7 +2457,7 @@ void CMsgBaseNetworkImp::PopPacket(HSERVER hServer)
 		strcat(str, (const char*)pPacket->GetPacketData()[i]);
 	}
 	NET_LOGDL("PACKET DATA [%s]", str);
-	SAFE_DELETE( pPacket );	
+	RELEASE_PACKET( pPacket );	
 }
 
 
@@ -2074,7 +2480,14 @@ bool CMsgBaseNetworkImp::PushPacket(HSERVER hServer, void * pData, int nDataSize
 	}
 
 
-	CNtlPacket * pPacket = new CNtlPacket( (BYTE*)pData, (WORD)nDataSize );
+	CPooledPacket * pPacket = s_packetPool.Alloc( PACKET_HEADSIZE + nDataSize );
+	if( NULL == pPacket )
+	{
+		NET_LOGDL( "PushPacket Error, Packet Memory Allocate Error Size[%d]", nDataSize );
+		return false;
+	}
+
+	pPacket->Build( (BYTE*)pData, (WORD)nDataSize );
 	char str[1024];
 	int i;
 	for (i = 0; i < pPacket->GetPacketDataSize(); i++)
@@ -2086,7 +2499,7 @@ bool CMsgBaseNetworkImp::PushPacket(HSERVER hServer, void * pData, int nDataSize
 	if( false == pPacket->IsValidPacket() )
 	{
 		NET_LOGDL( "PushPacket Error, Packet wrong" );
-		SAFE_DELETE( pPacket );
+		RELEASE_PACKET( pPacket );
 		return false;
 	}
 
@@ -2491,8 +2904,8 @@ void CEventBaseNetworkImp::PopPacket(HSERVER hServer)
 	}
 
 
-	CNtlPacket * pPacket = pConnection->GetRecvQueue()->Pop();
-	SAFE_DELETE( pPacket );
+	CPooledPacket * pPacket = pConnection->GetRecvQueue()->Pop();
+	RELEASE_PACKET( pPacket );
 }
 
 
@@ -2520,15 +2933,32 @@ bool CEventBaseNetworkImp::PushPacket(HSERVER hServer, void * pData, int nDataSi
 		return false;
 	}
 
-	CNtlPacket * pPacket = new CNtlPacket( (BYTE*)pData, (WORD)nDataSize );
-	if( false == pPacket->IsValidPacket() )
+	//  Ŷ  send ۿ ٷ 
+	int nResult = pConnection->EncodeToSendBuffer( (BYTE*)pData, (WORD)nDataSize );
+	if( nResult < 0 )
 	{
 		NET_LOGDL( "PushPacket Error, Packet wrong" );
-		SAFE_DELETE( pPacket );
 		return false;
 	}
+	else if( 0 == nResult )
+	{
+		CPooledPacket * pPacket = s_packetPool.Alloc( PACKET_HEADSIZE + nDataSize );
+		if( NULL == pPacket )
+		{
+			NET_LOGDL( "PushPacket Error, Packet Memory Allocate Error Size[%d]", nDataSize );
+			return false;
+		}
 
-	pConnection->GetSendQueue()->Push( pPacket );
+		pPacket->Build( (BYTE*)pData, (WORD)nDataSize );
+		if( false == pPacket->IsValidPacket() )
+		{
+			NET_LOGDL( "PushPacket Error, Packet wrong" );
+			RELEASE_PACKET( pPacket );
+			return false;
+		}
+
+		pConnection->GetSendQueue()->Push( pPacket );
+	}
 
 	if( pConnection->SendPendingData() > 0 )
 	{
@@ -2562,10 +2992,18 @@ void CEventBaseNetworkImp::OnThreadProc()
 	DWORD dwTickCur = 0;
 	dwTickOld = dwTickCur = GetTickCount();
 
+	bool bTraceNamed = false;
+
 	while( m_bProgress )
 	{
 		Sleep(1);
 
+		if( false == bTraceNamed && NULL != m_pfnTraceCallback )
+		{
+			m_pfnTraceCallback( NETCLIENT_TRACE_THREAD_NAME, "ClientNet" );
+			bTraceNamed = true;
+		}
+
 		DWORD dwEventTotal = (DWORD) m_nCurConnection;
 
 		//  [5/23/2007 zeroera] : EventTotal 0  2000   
@@ -2587,6 +3025,8 @@ void CEventBaseNetworkImp::OnThreadProc()
 		dwTickCur = GetTickCount();
 		if( dwTickCur - dwTickOld >= m_dwAliveTime )
 		{
+			CNetTraceScope traceScope( m_pfnTraceCallback, "ClientNet::DoAlive" );
+
 			DoAlive();	
 			dwTickOld = dwTickCur;
 		}
@@ -2618,6 +3058,8 @@ void CEventBaseNetworkImp::OnThreadProc()
 		//		continue;
 		//	}
 
+		CNetTraceScope traceScope( m_pfnTraceCallback, "ClientNet::NetworkEvent" );
+
 		DWORD i = dwIndex;
 
 		CAutoPtr_ServerConnection pConnection = Acquire( m_eventInfo.ahServer[i] );
@@ -2723,6 +3165,12 @@ void CEventBaseNetworkImp::OnThreadProc()
 		//} // end of for
 
 	} // end of while
+
+
+	if( bTraceNamed && NULL != m_pfnTraceCallback )
+	{
+		m_pfnTraceCallback( NETCLIENT_TRACE_THREAD_EXIT, NULL );
+	}
 }
 
 
@@ -50,6 +50,11 @@
 #define NETCLIENT_EVENT_DISCONNECTED		0x0002
 #define NETCLIENT_EVENT_CONNECT_FAIL		0x0003
 
+#define NETCLIENT_TRACE_THREAD_NAME			0x0001	// Ʈũ  ̸ ( lpszName )
+#define NETCLIENT_TRACE_BEGIN				0x0002	// lpszName  
+#define NETCLIENT_TRACE_END					0x0003	//     ( lpszName = NULL )
+#define NETCLIENT_TRACE_THREAD_EXIT			0x0004	// Ʈũ   ( lpszName = NULL )
+
 #define INVALID_HSERVER						INVALID_SOCKET
 //---------------------------------------------------------------------------------------
 
@@ -60,6 +65,7 @@ const unsigned int ALIVE_PACKET_FREQUENCY	= 3 * 1000; // 
 typedef SOCKET HSERVER;	//  ڵ  ( =   )
 typedef void (*NtlClientNetLogCallback)(const char * format); // Application Log Callback
 typedef void (*NtlClientNetEventCallback)(HSERVER hServer, int nEvent);	// Application Event Callback
+typedef void (*NtlClientNetTraceCallback)(int nTraceEvent, const char * lpszName);	// Application Profiler Callback ( Ʈũ 忡 Ҹ )
 //-- define -------------------------------------------------------------------------
 class CRecvPacketProcess
 {
@@ -94,6 +100,9 @@ enum eNETCLIENT_ENCODE_TYPE
 //---------------------------------------------------------------------------------------
 
 void NtlClientNetSetPrintFlag( unsigned int dwFlag );
+
+// checks the packet cipher kernels against the scalar one and reports the throughput of each, one line per call of LogCallback
+bool NtlClientNetCipherBenchmark( int nPacketSize, int nIteration, NtlClientNetLogCallback LogCallback );
 //class CPacketConsole
 //{
 //public:
@@ -138,6 +147,9 @@ public:
 
 	void						Destroy();
 
+	// Create Ŀ Ѵ
+	void						SetTraceCallback(NtlClientNetTraceCallback TraceCallback);
+
 
 public:
 
@@ -116,8 +116,13 @@ void CNtlDatabase::Destroy()
 //-----------------------------------------------------------------------------------
 int CNtlDatabase::Query(CNtlQuery * pQuery)
 {
-	m_queryQueue.Push( pQuery );
-	m_dwRecvQuery++;
+	// ť  á DB thread    ٸ
+	while( false == m_queryQueue.Push( pQuery ) )
+	{
+		Sleep( 0 );
+	}
+
+	InterlockedIncrement( (LONG*)&m_dwRecvQuery );
 	
 	return NTL_SUCCESS;
 }
@@ -16,7 +16,7 @@
 #define __NTLDATABASE_H__
 
 #include "NtlSqlBase.h"
-#include "NtlQueue.h"
+#include "NtlLockFreeQueue.h"
 #include "NtlLinkList.h"
 
 class CNtlQuery;
@@ -73,7 +73,7 @@ private:
 
 	CNtlMutex					m_listMutex;
 
-	CNtlQueue<CNtlQuery*>		m_queryQueue;
+	CNtlLockFreeQueue<CNtlQuery*>	m_queryQueue;
 
 	CNtlDatabaseManager *		m_pParent;
 
@@ -86,7 +86,8 @@ int CNtlDatabaseManager::Create(CNtlSqlUnitHelper * pSqlUnitHelper, int nThreadC
 
 
 	//rc = m_threadPool.Create( CNtlThreadPool::POOL_USER_MODE, nThreadCount );
-	rc = m_threadPool.Create( CNtlThreadPool::POOL_KERNEL_MODE, nThreadCount );
+	//rc = m_threadPool.Create( CNtlThreadPool::POOL_KERNEL_MODE, nThreadCount );
+	rc = m_threadPool.Create( CNtlThreadPool::POOL_WORK_STEALING, nThreadCount );
 	if( NTL_SUCCESS != rc )
 	{
 		return rc;
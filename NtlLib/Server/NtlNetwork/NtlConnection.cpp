@@ -163,6 +163,13 @@ void CNtlConnection::Init()
 	m_dwBytesSendSizeMax = 0;
 	m_dwPacketRecvCount = 0;
 	m_dwPacketSendCount = 0;
+
+	m_dwBatchPacketCount = 0;
+	m_dwSendFlushCount = 0;
+	m_dwFlushPacketCount = 0;
+	m_dwFlushPacketCountMax = 0;
+	m_dwFlushBytesSize = 0;
+	m_dwFlushBytesSizeMax = 0;
 }
 
 
@@ -230,6 +237,17 @@ int CNtlConnection::Create(CNtlNetwork * pNetwork)
 		return rc;
 	}
 
+
+	// ÷   ϹǷ Nagle    ʵ Ѵ
+	if( IsSetControlFlag( CONTROL_FLAG_USE_SEND_BATCH ) )
+	{
+		rc = m_socket.SetTCPNoDelay( true );
+		if( NTL_SUCCESS != rc )
+		{
+			return rc;
+		}
+	}
+
 #if __SGPRO_BOTSYSTEM_SENDANDRECVTESTCODE__
 	m_pPacketEncoder = NULL;
 #else
@@ -460,6 +478,8 @@ int CNtlConnection::PostSend()
 	m_sendContext.iomode = IOMODE_SEND;
 	m_sendContext.wsabuf.buf = (char*) m_sendBuffer.GetQueuePopPtr();
 
+	DWORD dwBufferCount = 1;
+
 #if __SGPRO_BOTSYSTEM_SENDANDRECVTESTCODE__
 	bool bIsIf = false;
 #endif
@@ -471,9 +491,16 @@ int CNtlConnection::PostSend()
 		bIsIf = true;
 #endif
 
-		//  [9/13/2007 zeroera] :  :     κ
 		m_sendContext.wsabuf.len = m_sendBuffer.GetQueueSize() - m_sendBuffer.GetPopPos();
 
+		//  ó ư  scatter-gather  ѹ 
+		if( m_sendBuffer.GetCurSize() > (int) m_sendContext.wsabuf.len )
+		{
+			m_sendWsaBuf[1].buf = (char*) m_sendBuffer.InGetQueueBufferPtr();
+			m_sendWsaBuf[1].len = m_sendBuffer.GetCurSize() - m_sendContext.wsabuf.len;
+			dwBufferCount = 2;
+		}
+
 		//if( m_sendBuffer.GetQueueSize() <= m_sendBuffer.GetPopPos() )
 		//{
 		//	NTL_LOG_ASSERT("m_sendBuffer.GetQueueSize() <= m_sendBuffer.GetPopPos(), m_sendBuffer.GetQueueSize() = %d, m_sendBuffer.GetPopPos() = %d", m_sendBuffer.GetQueueSize(), m_sendBuffer.GetPopPos());
@@ -494,10 +521,12 @@ int CNtlConnection::PostSend()
 	}
 
 
+	m_sendWsaBuf[0] = m_sendContext.wsabuf;
+
 	IncreasePostIoCount();
 
-	int rc = m_socket.SendEx(	&m_sendContext.wsabuf,
-							 1,
+	int rc = m_socket.SendEx(	m_sendWsaBuf,
+							 dwBufferCount,
 							 &dwSendBytes,
 							 dwFlags,
 							 &m_sendContext);
@@ -524,6 +553,53 @@ int CNtlConnection::PostSend()
 }
 
 
+//-----------------------------------------------------------------------------------
+//		Purpose	: CONTROL_FLAG_USE_SEND_BATCH  ׾Ƶ Ŷ ѹ send  
+//		Return	:
+//-----------------------------------------------------------------------------------
+// Called by Dispatcher TH ( event queue drained ), Application TH ( flush point of a tick )
+//-----------------------------------------------------------------------------------
+int CNtlConnection::FlushSend()
+{
+	FUNCTION_BEGIN();
+
+	if( false == IsStatus( STATUS_ACTIVE ) )
+	{
+		return NTL_ERR_NET_CONNECTION_STATUS_WRONG;
+	}
+
+
+	m_mutexSend.Lock();
+
+	if( 0 == m_dwBatchPacketCount )
+	{
+		m_mutexSend.Unlock();
+		return NTL_SUCCESS;
+	}
+
+
+	IncreaseSendFlush();
+
+	//  ̸ CompleteSend  ̾ 
+	if( false == m_bSending )
+	{
+		int rc = PostSend();
+		if( NTL_SUCCESS != rc )
+		{
+			m_mutexSend.Unlock();
+			return rc;
+		}
+
+		m_bSending = true;
+	}
+
+	m_mutexSend.Unlock();
+
+
+	return NTL_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------------
 //		Purpose	:
 //		Return	:
@@ -841,6 +917,8 @@ int CNtlConnection::CompleteSend(DWORD dwTransferedBytes)
 
 	if( m_sendBuffer.GetCurSize() )
 	{
+		IncreaseSendFlush();
+
 		rc = PostSend();
 		if( NTL_SUCCESS != rc )
 		{
@@ -1166,6 +1244,19 @@ int CNtlConnection::PushPacket(CNtlPacket * pPacket)
 	IncreasePacketSend();
 
 
+	// ġ 忡 FlushSend  ٸ.  ۰  ̻  ġ  
+	if( IsSetControlFlag( CONTROL_FLAG_USE_SEND_BATCH ) )
+	{
+		if( m_sendBuffer.GetCurSize() < m_sendBuffer.GetQueueSize() / 2 )
+		{
+			m_mutexSend.Unlock();
+			return NTL_SUCCESS;
+		}
+
+		IncreaseSendFlush();
+	}
+
+
 	if( false == m_bSending )
 	{
 		rc = PostSend();
@@ -70,6 +70,7 @@ public:
 		CONTROL_FLAG_CHECK_OPCODE = 0x01 << 1,
 		CONTROL_FLAG_USE_SEND_QUEUE = 0x01 << 2,
 		CONTROL_FLAG_USE_RECV_QUEUE = 0x01 << 3,
+		CONTROL_FLAG_USE_SEND_BATCH = 0x01 << 4, // PushPacket  send ۿ ױ⸸ ϰ FlushSend  
 
 		MAX_CONTROL_FLAG
 	};
@@ -142,6 +143,8 @@ public:
 
 	int									PostSend();	
 
+	int									FlushSend();
+
 	int									PostAccept(CNtlAcceptor* pAcceptor);
 
 	int									PostConnect(CNtlConnector* pConnector);
@@ -256,6 +259,12 @@ public:
 	DWORD								GetRecvQueueMaxUseSize() { return m_recvQueue.GetMaxUsedSize(); }
 	DWORD								GetSendQueueMaxUseSize() { return m_sendQueue.GetMaxUsedSize(); }
 
+	DWORD								GetSendFlushCount() { return m_dwSendFlushCount; }
+	DWORD								GetFlushPacketCount() { return m_dwFlushPacketCount; }
+	DWORD								GetFlushPacketCountMax() { return m_dwFlushPacketCountMax; }
+	DWORD								GetFlushBytesSize() { return m_dwFlushBytesSize; }
+	DWORD								GetFlushBytesSizeMax() { return m_dwFlushBytesSizeMax; }
+
 	virtual int							GetHeaderSize() {return PACKET_HEADSIZE;}
 	virtual int							GetPacketLen(BYTE* pHeaderPointer);
 
@@ -277,6 +286,8 @@ private:
 
 	void								DecreasePostIoCount() { InterlockedDecrement( (LONG*)&m_dwIoPostCount); }
 
+	void								IncreaseSendFlush();
+
 
 private:
 
@@ -301,6 +312,8 @@ private:
 
 	sIOCONTEXT							m_sendContext;
 
+	WSABUF								m_sendWsaBuf[2]; // send ۰ ư    ѹ 
+
 	DWORD								m_dwAliveTime;	
 
 
@@ -344,6 +357,13 @@ private:
 	DWORD								m_dwPacketRecvCount;
 	DWORD								m_dwPacketSendCount;
 
+	DWORD								m_dwBatchPacketCount; //  ÷   Ŷ 
+	DWORD								m_dwSendFlushCount;
+	DWORD								m_dwFlushPacketCount;
+	DWORD								m_dwFlushPacketCountMax;
+	DWORD								m_dwFlushBytesSize;
+	DWORD								m_dwFlushBytesSizeMax;
+
 };
 
 
@@ -379,6 +399,38 @@ inline void CNtlConnection::IncreasePacketRecv()
 inline void CNtlConnection::IncreasePacketSend()
 {
 	InterlockedIncrement( (LONG*)&m_dwPacketSendCount );
+
+	if( IsSetControlFlag( CONTROL_FLAG_USE_SEND_BATCH ) )
+	{
+		++m_dwBatchPacketCount;
+	}
+}
+
+// Called with m_mutexSend locked, when the batched packets are handed to the socket
+inline void CNtlConnection::IncreaseSendFlush()
+{
+	if( 0 == m_dwBatchPacketCount )
+	{
+		return;
+	}
+
+	DWORD dwBytes = (DWORD) m_sendBuffer.GetCurSize();
+
+	++m_dwSendFlushCount;
+
+	m_dwFlushPacketCount += m_dwBatchPacketCount;
+	if( m_dwBatchPacketCount > m_dwFlushPacketCountMax )
+	{
+		m_dwFlushPacketCountMax = m_dwBatchPacketCount;
+	}
+
+	m_dwFlushBytesSize += dwBytes;
+	if( dwBytes > m_dwFlushBytesSizeMax )
+	{
+		m_dwFlushBytesSizeMax = dwBytes;
+	}
+
+	m_dwBatchPacketCount = 0;
 }
 
 inline CNtlConnection::eSTATUS CNtlConnection::GetStatus()
@@ -19,7 +19,7 @@
 
 #include "NtlCircularQueue.h"
 #include "NtlError.h"
-#include "NtlQueue.h"
+#include "NtlLockFreeQueue.h"
 #include "NtlDebug.h"
 
 
@@ -27,6 +27,9 @@
 //
 //-----------------------------------------------------------------------------------
 const unsigned int	DEF_PACKET_MAX_COUNT = 100;
+
+// Ḷ   Ƿ ũ  ʴ´. ġ PushPacket  Ѵ
+const DWORD			DEF_NET_QUEUE_CAPACITY = 4096;
 //-----------------------------------------------------------------------------------
 
 
@@ -84,11 +87,11 @@ private:
 
 
 
-class CNtlNetQueue : public CNtlQueue<CNtlPacket*>
+class CNtlNetQueue : public CNtlLockFreeQueue<CNtlPacket*>
 {
 public:
 
-	CNtlNetQueue():m_nMaxCount(0) {}
+	CNtlNetQueue():CNtlLockFreeQueue<CNtlPacket*>( DEF_NET_QUEUE_CAPACITY ), m_nMaxCount(0) {}
 
 	virtual ~CNtlNetQueue()
 	{
@@ -97,18 +100,23 @@ public:
 
 	void Destroy()
 	{
-		CNtlPacket * pPacket = PopPacket();
-		while( pPacket )
+		CNtlPacket * apPacket[DEF_PACKET_MAX_COUNT];
+
+		DWORD dwCount = PopBatch( apPacket, DEF_PACKET_MAX_COUNT );
+		while( dwCount )
 		{
-			SAFE_DELETE( pPacket );
+			for( DWORD i = 0; i < dwCount; i++ )
+			{
+				SAFE_DELETE( apPacket[i] );
+			}
 
-			pPacket = PopPacket();
+			dwCount = PopBatch( apPacket, DEF_PACKET_MAX_COUNT );
 		}
 	}
 
 	bool PushPacket(CNtlPacket* pPacket)
 	{
-		if( false == CNtlQueue<CNtlPacket*>::Push(pPacket) )
+		if( false == CNtlLockFreeQueue<CNtlPacket*>::Push(pPacket) )
 		{
 			return false;
 		}
@@ -125,12 +133,12 @@ public:
 
 	CNtlPacket* PeekPacket()
 	{
-		return CNtlQueue<CNtlPacket*>::Peek();
+		return CNtlLockFreeQueue<CNtlPacket*>::Peek();
 	}
 
 	CNtlPacket* PopPacket()
 	{
-		return CNtlQueue<CNtlPacket*>::Pop();
+		return CNtlLockFreeQueue<CNtlPacket*>::Pop();
 	}
 
 
@@ -593,6 +593,21 @@ int CNtlNetwork::Send(CNtlSession * pSession, CNtlPacket * pPacket)
 }
 
 
+//-----------------------------------------------------------------------------------
+//		Purpose	: ƽ  ȣϸ ġ  ǵ ׾Ƶ Ŷ Ǵ ѹ 
+//		Return	:
+//-----------------------------------------------------------------------------------
+void CNtlNetwork::FlushSend()
+{
+	if( NULL == m_pSessionList )
+	{
+		return;
+	}
+
+	m_pSessionList->FlushSend();
+}
+
+
 //-----------------------------------------------------------------------------------
 //		Purpose	:
 //		Return	:
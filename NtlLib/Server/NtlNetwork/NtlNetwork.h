@@ -86,6 +86,8 @@ public:
 
 	int								Send(CNtlSession * pSession, CNtlPacket * pPacket);
 
+	void							FlushSend();
+
 	int								PostNetEventMessage(WPARAM wParam, LPARAM lParam);
 
 
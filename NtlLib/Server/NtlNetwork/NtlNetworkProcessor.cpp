@@ -102,16 +102,25 @@ void CNtlNetworkProcessor::Run()
 	DWORD dwBytesTransferred = 0;
 	ULONG_PTR netEvent = INVALID_NETEVENT;
 	CNtlSession * pSession = NULL;
+	bool bFlushSend = false;
 
 	while( IsRunnable() )
 	{	
+		// ̺Ʈ ó ť   CONTROL_FLAG_USE_SEND_BATCH ǵ ׾Ƶ Ŷ ÷Ѵ
 		bResult = GetQueuedCompletionStatus(	m_hEventIOCP,
 												&dwBytesTransferred,
 												(ULONG_PTR*) &netEvent,
 												(LPOVERLAPPED*) &pSession,
-												INFINITE );
+												bFlushSend ? 0 : INFINITE );
 
 
+		if( FALSE == bResult && NULL == pSession && WAIT_TIMEOUT == GetLastError() )
+		{
+			pNetwork->FlushSend();
+			bFlushSend = false;
+			continue;
+		}
+
 		if( THREAD_CLOSE == (ULONG_PTR) netEvent )
 		{
 			NTL_PRINT( PRINT_SYSTEM,"Thread Close" );
@@ -191,6 +200,8 @@ void CNtlNetworkProcessor::Run()
 
 		}
 
+		bFlushSend = true;
+
 	} // end of while( m_bRunning )
 
 }
@@ -0,0 +1,474 @@
+//***********************************************************************************
+//
+//	File		:	NtlPacketCipher.cpp
+//
+//	Begin		:	2026-10-17
+//
+//	Copyright	:	 NTL-Inc Co., Ltd
+//
+//	Desc		:	Packet body XOR kernels ( scalar / SSE2 / AVX2, chosen at run time )
+//
+//***********************************************************************************
+
+#include "stdafx.h"
+#include "NtlPacketCipher.h"
+
+#include "NtlDebug.h"
+
+#include <stdarg.h>
+#include <emmintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+//-----------------------------------------------------------------------------------
+// AVX2 intrinsics need VS2012 or later ( or gcc, which builds the kernel for avx2 only )
+//-----------------------------------------------------------------------------------
+#if ( defined(_MSC_VER) && _MSC_VER >= 1700 ) || defined(__GNUC__)
+#define __NTL_CIPHER_AVX2__
+#include <immintrin.h>
+#endif
+
+#if defined(__GNUC__)
+#define NTL_CIPHER_TARGET_AVX2	__attribute__((target("avx2")))
+#else
+#define NTL_CIPHER_TARGET_AVX2
+#endif
+//-----------------------------------------------------------------------------------
+
+
+typedef void (*NTL_CIPHER_XOR_KEY32)(BYTE * pBuffer, int nLength, DWORD dwKey);
+typedef void (*NTL_CIPHER_XOR_BYTE)(BYTE * pDest, const BYTE * pSrc, int nLength, BYTE byKey);
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	: the loops CNtlPacketEncoder_RandKey / _XOR used to run
+//		Return	:
+//-----------------------------------------------------------------------------------
+static void XorKey32_Scalar(BYTE * pBuffer, int nLength, DWORD dwKey)
+{
+	int nRound = nLength / sizeof(DWORD);
+	DWORD * pdwRound = (DWORD*) pBuffer;
+	for( int i = 0; i < nRound; i++ )
+	{
+		pdwRound[ i ] ^= dwKey;
+	}
+
+	int nRest = nLength % sizeof(DWORD);
+	BYTE * pbyRest = (BYTE*) ( pdwRound + nRound );
+	for( int i = 0; i < nRest; i++ )
+	{
+		pbyRest[ i ] ^= (BYTE) dwKey;
+	}
+}
+
+static void XorByte_Scalar(BYTE * pDest, const BYTE * pSrc, int nLength, BYTE byKey)
+{
+	for( int i = 0; i < nLength; i++ )
+	{
+		pDest[ i ] = pSrc[ i ] ^ byKey;
+	}
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	: the key pattern repeats every 4 bytes, so 16 byte blocks from the
+//				  head of the buffer keep it in phase
+//		Return	:
+//-----------------------------------------------------------------------------------
+static void XorKey32_SSE2(BYTE * pBuffer, int nLength, DWORD dwKey)
+{
+	__m128i xmmKey = _mm_set1_epi32( (int) dwKey );
+
+	int nBlockBytes = nLength & ~15;
+	for( int i = 0; i < nBlockBytes; i += 16 )
+	{
+		__m128i xmmData = _mm_loadu_si128( (const __m128i*) ( pBuffer + i ) );
+		_mm_storeu_si128( (__m128i*) ( pBuffer + i ), _mm_xor_si128( xmmData, xmmKey ) );
+	}
+
+	XorKey32_Scalar( pBuffer + nBlockBytes, nLength - nBlockBytes, dwKey );
+}
+
+static void XorByte_SSE2(BYTE * pDest, const BYTE * pSrc, int nLength, BYTE byKey)
+{
+	__m128i xmmKey = _mm_set1_epi8( (char) byKey );
+
+	int nBlockBytes = nLength & ~15;
+	for( int i = 0; i < nBlockBytes; i += 16 )
+	{
+		__m128i xmmData = _mm_loadu_si128( (const __m128i*) ( pSrc + i ) );
+		_mm_storeu_si128( (__m128i*) ( pDest + i ), _mm_xor_si128( xmmData, xmmKey ) );
+	}
+
+	XorByte_Scalar( pDest + nBlockBytes, pSrc + nBlockBytes, nLength - nBlockBytes, byKey );
+}
+
+
+#if defined(__NTL_CIPHER_AVX2__)
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+NTL_CIPHER_TARGET_AVX2 static void XorKey32_AVX2(BYTE * pBuffer, int nLength, DWORD dwKey)
+{
+	__m256i ymmKey = _mm256_set1_epi32( (int) dwKey );
+
+	int nBlockBytes = nLength & ~31;
+	for( int i = 0; i < nBlockBytes; i += 32 )
+	{
+		__m256i ymmData = _mm256_loadu_si256( (const __m256i*) ( pBuffer + i ) );
+		_mm256_storeu_si256( (__m256i*) ( pBuffer + i ), _mm256_xor_si256( ymmData, ymmKey ) );
+	}
+
+	// avoid the AVX -> SSE transition penalty before the tail
+	_mm256_zeroupper();
+
+	XorKey32_SSE2( pBuffer + nBlockBytes, nLength - nBlockBytes, dwKey );
+}
+
+NTL_CIPHER_TARGET_AVX2 static void XorByte_AVX2(BYTE * pDest, const BYTE * pSrc, int nLength, BYTE byKey)
+{
+	__m256i ymmKey = _mm256_set1_epi8( (char) byKey );
+
+	int nBlockBytes = nLength & ~31;
+	for( int i = 0; i < nBlockBytes; i += 32 )
+	{
+		__m256i ymmData = _mm256_loadu_si256( (const __m256i*) ( pSrc + i ) );
+		_mm256_storeu_si256( (__m256i*) ( pDest + i ), _mm256_xor_si256( ymmData, ymmKey ) );
+	}
+
+	_mm256_zeroupper();
+
+	XorByte_SSE2( pDest + nBlockBytes, pSrc + nBlockBytes, nLength - nBlockBytes, byKey );
+}
+#endif
+
+
+//-----------------------------------------------------------------------------------
+//
+//-----------------------------------------------------------------------------------
+struct sNTL_CIPHER_KERNEL
+{
+	const char *				pszName;
+	NTL_CIPHER_XOR_KEY32		pfnXorKey32;
+	NTL_CIPHER_XOR_BYTE			pfnXorByte;
+};
+
+static const sNTL_CIPHER_KERNEL s_cipherKernel[MAX_NTL_CIPHER_KERNEL] =
+{
+	{ "Scalar", XorKey32_Scalar, XorByte_Scalar },
+	{ "SSE2", XorKey32_SSE2, XorByte_SSE2 },
+#if defined(__NTL_CIPHER_AVX2__)
+	{ "AVX2", XorKey32_AVX2, XorByte_AVX2 },
+#else
+	{ "AVX2", NULL, NULL },
+#endif
+};
+
+// selected on the first call, every thread ends up with the same choice
+static volatile LONG		s_nCipherKernel = -1;
+//-----------------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+bool NtlCipherIsSupported(eNTL_CIPHER_KERNEL eKernel)
+{
+	switch( eKernel )
+	{
+	case NTL_CIPHER_KERNEL_SCALAR:
+		return true;
+
+	case NTL_CIPHER_KERNEL_SSE2:
+		{
+#if defined(_MSC_VER)
+			int anInfo[4];
+			__cpuid( anInfo, 1 );
+			return 0 != ( anInfo[3] & ( 1 << 26 ) );
+#else
+			return 0 != __builtin_cpu_supports( "sse2" );
+#endif
+		}
+
+	case NTL_CIPHER_KERNEL_AVX2:
+		{
+#if !defined(__NTL_CIPHER_AVX2__)
+			return false;
+#elif defined(_MSC_VER)
+			int anInfo[4];
+			__cpuid( anInfo, 0 );
+			if( anInfo[0] < 7 )
+			{
+				return false;
+			}
+
+			// the OS has to save the ymm registers ( OSXSAVE, AVX, XCR0 xmm|ymm )
+			__cpuid( anInfo, 1 );
+			if( ( anInfo[2] & ( 1 << 27 ) ) == 0 || ( anInfo[2] & ( 1 << 28 ) ) == 0 )
+			{
+				return false;
+			}
+
+			if( ( _xgetbv( 0 ) & 0x6 ) != 0x6 )
+			{
+				return false;
+			}
+
+			__cpuidex( anInfo, 7, 0 );
+			return 0 != ( anInfo[1] & ( 1 << 5 ) );
+#else
+			return 0 != __builtin_cpu_supports( "avx2" );
+#endif
+		}
+
+	default:
+		break;
+	}
+
+	return false;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+eNTL_CIPHER_KERNEL NtlCipherGetKernel()
+{
+	if( s_nCipherKernel < 0 )
+	{
+		eNTL_CIPHER_KERNEL eKernel = NTL_CIPHER_KERNEL_SCALAR;
+
+		if( NtlCipherIsSupported( NTL_CIPHER_KERNEL_AVX2 ) )
+		{
+			eKernel = NTL_CIPHER_KERNEL_AVX2;
+		}
+		else if( NtlCipherIsSupported( NTL_CIPHER_KERNEL_SSE2 ) )
+		{
+			eKernel = NTL_CIPHER_KERNEL_SSE2;
+		}
+
+		s_nCipherKernel = eKernel;
+	}
+
+	return (eNTL_CIPHER_KERNEL) s_nCipherKernel;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+bool NtlCipherSetKernel(eNTL_CIPHER_KERNEL eKernel)
+{
+	if( eKernel < NTL_CIPHER_KERNEL_SCALAR || eKernel >= MAX_NTL_CIPHER_KERNEL )
+	{
+		return false;
+	}
+
+	if( false == NtlCipherIsSupported( eKernel ) )
+	{
+		return false;
+	}
+
+	s_nCipherKernel = eKernel;
+
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+const char * NtlCipherGetKernelName(eNTL_CIPHER_KERNEL eKernel)
+{
+	if( eKernel < NTL_CIPHER_KERNEL_SCALAR || eKernel >= MAX_NTL_CIPHER_KERNEL )
+	{
+		return "Unknown";
+	}
+
+	return s_cipherKernel[eKernel].pszName;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+void NtlCipherXorKey32(BYTE * pBuffer, int nLength, DWORD dwKey)
+{
+	s_cipherKernel[ NtlCipherGetKernel() ].pfnXorKey32( pBuffer, nLength, dwKey );
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+void NtlCipherXorByte(BYTE * pDest, const BYTE * pSrc, int nLength, BYTE byKey)
+{
+	s_cipherKernel[ NtlCipherGetKernel() ].pfnXorByte( pDest, pSrc, nLength, byKey );
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	: to the callback when there is one, to the debug print otherwise
+//		Return	:
+//-----------------------------------------------------------------------------------
+static void Report(NtlCipherReportCallback pfnReport, const char * lpszFormat, ...)
+{
+	char szLine[256];
+
+	va_list args;
+	va_start( args, lpszFormat );
+	_vsnprintf_s( szLine, sizeof(szLine), _TRUNCATE, lpszFormat, args );
+	va_end( args );
+
+	if( pfnReport )
+	{
+		pfnReport( szLine );
+	}
+	else
+	{
+		NTL_PRINT( PRINT_SYSTEM, "%s", szLine );
+	}
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	: every length up to 100 bytes at every misalignment of a DWORD
+//		Return	:
+//-----------------------------------------------------------------------------------
+static bool VerifyKernel(const sNTL_CIPHER_KERNEL & rKernel, NtlCipherReportCallback pfnReport)
+{
+	BYTE abySource[128];
+	BYTE abyExpect[128];
+	BYTE abyResult[128];
+
+	for( int i = 0; i < (int) sizeof(abySource); i++ )
+	{
+		abySource[i] = (BYTE) rand();
+	}
+
+	const DWORD dwKey = 0x9E3779B9;
+
+	for( int nOffset = 0; nOffset < 4; nOffset++ )
+	{
+		for( int nLength = 0; nLength <= 100; nLength++ )
+		{
+			memcpy( abyExpect, abySource, sizeof(abySource) );
+			memcpy( abyResult, abySource, sizeof(abySource) );
+
+			XorKey32_Scalar( abyExpect + nOffset, nLength, dwKey );
+			rKernel.pfnXorKey32( abyResult + nOffset, nLength, dwKey );
+
+			if( 0 != memcmp( abyExpect, abyResult, sizeof(abySource) ) )
+			{
+				Report( pfnReport, "Cipher[%s] XorKey32 mismatch Offset[%d] Length[%d]", rKernel.pszName, nOffset, nLength );
+				return false;
+			}
+
+			memcpy( abyExpect, abySource, sizeof(abySource) );
+			memcpy( abyResult, abySource, sizeof(abySource) );
+
+			XorByte_Scalar( abyExpect + nOffset, abySource + nOffset, nLength, (BYTE) dwKey );
+			rKernel.pfnXorByte( abyResult + nOffset, abySource + nOffset, nLength, (BYTE) dwKey );
+
+			if( 0 != memcmp( abyExpect, abyResult, sizeof(abySource) ) )
+			{
+				Report( pfnReport, "Cipher[%s] XorByte mismatch Offset[%d] Length[%d]", rKernel.pszName, nOffset, nLength );
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:	false if a kernel doesn't match the scalar one
+//-----------------------------------------------------------------------------------
+bool NtlCipherBenchmark(int nPacketSize, int nIteration, NtlCipherReportCallback pfnReport)
+{
+	if( nPacketSize <= 0 || nIteration <= 0 )
+	{
+		return false;
+	}
+
+
+	BYTE * pBuffer = new BYTE[ nPacketSize ];
+	if( NULL == pBuffer )
+	{
+		return false;
+	}
+
+	for( int i = 0; i < nPacketSize; i++ )
+	{
+		pBuffer[i] = (BYTE) rand();
+	}
+
+
+	LARGE_INTEGER liFreq;
+	QueryPerformanceFrequency( &liFreq );
+
+	bool bResult = true;
+
+	for( int nKernel = NTL_CIPHER_KERNEL_SCALAR; nKernel < MAX_NTL_CIPHER_KERNEL; nKernel++ )
+	{
+		const sNTL_CIPHER_KERNEL & rKernel = s_cipherKernel[nKernel];
+
+		if( false == NtlCipherIsSupported( (eNTL_CIPHER_KERNEL) nKernel ) )
+		{
+			Report( pfnReport, "Cipher[%s] not supported", rKernel.pszName );
+			continue;
+		}
+
+		if( false == VerifyKernel( rKernel, pfnReport ) )
+		{
+			bResult = false;
+			continue;
+		}
+
+
+		LARGE_INTEGER liBegin, liEnd;
+
+		QueryPerformanceCounter( &liBegin );
+		for( int i = 0; i < nIteration; i++ )
+		{
+			rKernel.pfnXorKey32( pBuffer, nPacketSize, (DWORD) i );
+		}
+		QueryPerformanceCounter( &liEnd );
+
+		double dXorKey32 = (double) ( liEnd.QuadPart - liBegin.QuadPart ) / (double) liFreq.QuadPart;
+
+		QueryPerformanceCounter( &liBegin );
+		for( int i = 0; i < nIteration; i++ )
+		{
+			rKernel.pfnXorByte( pBuffer, pBuffer, nPacketSize, (BYTE) i );
+		}
+		QueryPerformanceCounter( &liEnd );
+
+		double dXorByte = (double) ( liEnd.QuadPart - liBegin.QuadPart ) / (double) liFreq.QuadPart;
+
+		double dMegaBytes = (double) nPacketSize * nIteration / ( 1024.0 * 1024.0 );
+
+		Report( pfnReport, "Cipher[%s] PacketSize[%d] XorKey32[%.1f MB/s] XorByte[%.1f MB/s]",
+					rKernel.pszName,
+					nPacketSize,
+					( dXorKey32 > 0 ) ? dMegaBytes / dXorKey32 : 0.0,
+					( dXorByte > 0 ) ? dMegaBytes / dXorByte : 0.0 );
+	}
+
+	delete[] pBuffer;
+
+
+	return bResult;
+}
@@ -0,0 +1,53 @@
+//***********************************************************************************
+//
+//	File		:	NtlPacketCipher.h
+//
+//	Begin		:	2026-10-17
+//
+//	Copyright	:	 NTL-Inc Co., Ltd
+//
+//	Desc		:	Packet body XOR kernels ( scalar / SSE2 / AVX2, chosen at run time )
+//
+//***********************************************************************************
+
+#pragma once
+
+
+//---------------------------------------------------------------------------------------
+// Both packet encoders spend their time XOR'ing the packet body with a constant key.
+// These kernels do it 16 / 32 bytes at a time, the widest one the CPU supports being
+// picked on first use. Every kernel writes exactly the bytes of the scalar loop.
+//---------------------------------------------------------------------------------------
+enum eNTL_CIPHER_KERNEL
+{
+	NTL_CIPHER_KERNEL_SCALAR = 0,
+	NTL_CIPHER_KERNEL_SSE2,
+	NTL_CIPHER_KERNEL_AVX2,
+
+	MAX_NTL_CIPHER_KERNEL
+};
+
+
+// every whole DWORD of pBuffer ^= dwKey, the bytes left over ^= (BYTE) dwKey
+void					NtlCipherXorKey32(BYTE * pBuffer, int nLength, DWORD dwKey);
+
+// pDest[i] = pSrc[i] ^ byKey, pDest may be pSrc
+void					NtlCipherXorByte(BYTE * pDest, const BYTE * pSrc, int nLength, BYTE byKey);
+
+
+eNTL_CIPHER_KERNEL		NtlCipherGetKernel();
+
+// a kernel the CPU can't run is refused
+bool					NtlCipherSetKernel(eNTL_CIPHER_KERNEL eKernel);
+
+bool					NtlCipherIsSupported(eNTL_CIPHER_KERNEL eKernel);
+
+const char *			NtlCipherGetKernelName(eNTL_CIPHER_KERNEL eKernel);
+
+
+// one line of the benchmark report
+typedef void (*NtlCipherReportCallback)(const char * lpszLine);
+
+// checks every supported kernel against the scalar one and prints the throughput of each.
+// the lines go to pfnReport when it is given, NTL_PRINT otherwise
+bool					NtlCipherBenchmark(int nPacketSize = 256, int nIteration = 100000, NtlCipherReportCallback pfnReport = NULL);
@@ -16,6 +16,7 @@
 #include "NtlPacketEncoder_RandKey.h"
 
 #include "NtlPacket.h"
+#include "NtlPacketCipher.h"
 
 #include "NtlError.h"
 #include "NtlDebug.h"
@@ -79,6 +80,27 @@ const BYTE s_checksum_Table[ ] =
 
 
 
+//-----------------------------------------------------------------------------------
+//		Purpose	: low byte of each whole DWORD, then every byte left over
+//		Return	:
+//-----------------------------------------------------------------------------------
+inline void UpdateCheckSum(const BYTE * pPlain, int nLength, BYTE * pbyCheckSum)
+{
+	int nRound = nLength / sizeof(DWORD);
+	for( int i = 0; i < nRound; i++ )
+	{
+		*pbyCheckSum = s_checksum_Table[ *pbyCheckSum ^ pPlain[ i * sizeof(DWORD) ] ];
+	}
+
+	int nRest = nLength % sizeof(DWORD);
+	const BYTE * pbyRestPlain = pPlain + nRound * sizeof(DWORD);
+	for( int i = 0; i < nRest; i++ )
+	{
+		*pbyCheckSum = s_checksum_Table[ *pbyCheckSum ^ pbyRestPlain[ i ] ];
+	}
+}
+
+
 //-----------------------------------------------------------------------------------
 //		Purpose	:
 //		Return	: 8bit crc value
@@ -99,30 +121,13 @@ int Encrypt(BYTE * pPlain, int nLength, DWORD dwCipherKey, BYTE * pbyCheckSum =
 
 #ifdef __PACKET_ENCODE_OPTIMIZE__
 
-	int nRound = nLength / sizeof(DWORD);
-	DWORD * pdwRoundPlain = (DWORD*) pPlain;
-	for( int i = 0; i < nRound; i++ )
+	// the checksum is over the plain text, so it goes first
+	if( pbyCheckSum )
 	{
-		if( pbyCheckSum )
-		{
-			*pbyCheckSum = s_checksum_Table[ *pbyCheckSum ^ (BYTE) pdwRoundPlain[ i ] ];
-		}
-
-		pdwRoundPlain[ i ] ^= (DWORD) dwCipherKey;
+		UpdateCheckSum( pPlain, nLength, pbyCheckSum );
 	}
 
-
-	int nRest = nLength % sizeof(DWORD);
-	BYTE * pbyRestPlain = (BYTE*) ( pdwRoundPlain + nRound );
-	for( int i = 0; i < nRest; i++ )
-	{
-		if( pbyCheckSum )
-		{
-			*pbyCheckSum = s_checksum_Table[ *pbyCheckSum ^ pbyRestPlain[ i ] ] ;
-		}
-
-		pbyRestPlain[ i ] ^= (BYTE) dwCipherKey;
-	}
+	NtlCipherXorKey32( pPlain, nLength, dwCipherKey );
 #else
 	for( int i = 0; i < nLength; i++ )
 	{
@@ -160,29 +165,11 @@ int Decrypt(BYTE * pPlain, int nLength, DWORD dwCipherKey, BYTE * pbyCheckSum =
 
 
 #ifdef __PACKET_ENCODE_OPTIMIZE__
-	int nRound = nLength / sizeof(DWORD);
-	DWORD * pdwRoundPlain = (DWORD*) pPlain;
-	for( int i = 0; i < nRound; i++ )
-	{
-		pdwRoundPlain[ i ] ^= (DWORD) dwCipherKey;
-
-		if( pbyCheckSum )
-		{
-			*pbyCheckSum = s_checksum_Table[ *pbyCheckSum ^ (BYTE) pdwRoundPlain[ i ] ];
-		}
-	}
-
+	NtlCipherXorKey32( pPlain, nLength, dwCipherKey );
 
-	int nRest = nLength % sizeof(DWORD);
-	BYTE * pbyRestPlain = (BYTE*) ( pdwRoundPlain + nRound );
-	for( int i = 0; i < nRest; i++ )
+	if( pbyCheckSum )
 	{
-		pbyRestPlain[ i ] ^= (BYTE) dwCipherKey;
-
-		if( pbyCheckSum )
-		{
-			*pbyCheckSum = s_checksum_Table[ *pbyCheckSum ^ pbyRestPlain[ i ] ] ;
-		}
+		UpdateCheckSum( pPlain, nLength, pbyCheckSum );
 	}
 #else
 	for( int i = 0; i < nLength; i++ )
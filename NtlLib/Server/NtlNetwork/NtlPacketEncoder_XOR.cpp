@@ -17,6 +17,7 @@
 #include "NtlPacketEncoder_XOR.h"
 
 #include "NtlPacket.h"
+#include "NtlPacketCipher.h"
 
 #include "NtlError.h"
 
@@ -52,6 +53,27 @@ DWORD Encrypt(void* pvOriginalString, DWORD dwOriginalLength, void* pvBuffer, DW
 	if (dwBufferSize < dwOriginalLength)
 		return 0;
 
+	BYTE* pbyOriginal = (BYTE*)pvOriginalString;
+	BYTE* pbyBuffer = (BYTE*)pvBuffer;
+
+	// The overlapping WORD writes below leave, in place, the first byte ^ LOWER and every other byte
+	// ^ UPPER ^ LOWER, and into another buffer every byte ^ LOWER. Same bytes, XOR'ed in wide blocks.
+	if (0 < dwOriginalLength)
+	{
+		if (pbyBuffer == pbyOriginal)
+		{
+			pbyBuffer[0] ^= NTL_ENCRYPTION_MAGIC_PATTERN_LOWER;
+			NtlCipherXorByte(pbyBuffer + 1, pbyBuffer + 1, (int)dwOriginalLength - 1, NTL_ENCRYPTION_MAGIC_PATTERN_UPPER ^ NTL_ENCRYPTION_MAGIC_PATTERN_LOWER);
+			return dwOriginalLength;
+		}
+
+		if (pbyBuffer + dwOriginalLength <= pbyOriginal || pbyOriginal + dwOriginalLength <= pbyBuffer)
+		{
+			NtlCipherXorByte(pbyBuffer, pbyOriginal, (int)dwOriginalLength, NTL_ENCRYPTION_MAGIC_PATTERN_LOWER);
+			return dwOriginalLength;
+		}
+	}
+
 	DWORD dwCurrentOffset = 0;
 
 	while (dwCurrentOffset < dwOriginalLength)
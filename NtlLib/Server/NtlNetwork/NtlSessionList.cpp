@@ -249,4 +249,32 @@ void CNtlSessionList::ValidCheck(DWORD dwTickTime)
 		it = m_sessionList.Next( it );
 	}
 
-}
\ No newline at end of file
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	: CONTROL_FLAG_USE_SEND_BATCH ǵ ÷ 
+//		Return	:
+//-----------------------------------------------------------------------------------
+void CNtlSessionList::FlushSend()
+{
+	CNtlAutoMutex mutex( &m_mutex );
+	mutex.Lock();
+
+	CNtlSession * pSession = NULL;
+	for( LISTIT it = m_sessionList.Begin(); it != m_sessionList.End(); it = m_sessionList.Next( it ) )
+	{
+		pSession = *( m_sessionList.GetPtr( it ) );
+
+		if( pSession && pSession->IsSetControlFlag( CNtlConnection::CONTROL_FLAG_USE_SEND_BATCH ) )
+		{
+			int rc = pSession->FlushSend();
+			if( NTL_SUCCESS != rc && NTL_ERR_NET_CONNECTION_STATUS_WRONG != rc )
+			{
+				pSession->Disconnect( false );
+
+				NTL_LOGDL( LOG_NETWORK, "Session[%X] FlushSend Error : Err:%d(%s)", pSession, rc, NtlGetErrorMessage(rc) );
+			}
+		}
+	}
+}
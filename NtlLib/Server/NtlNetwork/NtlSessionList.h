@@ -47,6 +47,8 @@ public:
 
 	void								ValidCheck(DWORD dwTickTime);
 
+	void								FlushSend();
+
 
 public:
 
@@ -0,0 +1,374 @@
+//***********************************************************************************
+//
+//	File		:	NtlLockFreeQueue.h
+//
+//	Begin		:	2026-10-17
+//
+//	Copyright	:	 NTL-Inc Co., Ltd
+//
+//	Desc		:	ũⰡ  lock-free ť ( MPMC )
+//
+//***********************************************************************************
+
+#ifndef __NTLLOCKFREEQUEUE_H__
+#define __NTLLOCKFREEQUEUE_H__
+
+
+const DWORD NTL_LOCKFREE_QUEUE_DEFAULT_CAPACITY = 65536;
+
+
+//---------------------------------------------------------------------------------------
+// CNtlQueue   ̽. Ҹ sequence  ξ Push / Pop   ġ
+// CAS  ϹǷ  thread  mutex  ÿ ְ   ִ.
+//
+// - 뷮 2  ¼ øǸ,   Push  false  ش
+// - տ  ֱ( bFront )   ʴ´
+// - Peek  Pop   Ҹ Ű  consumer  ϳ ̴
+// -  迭 ó Push   ҴѴ
+//---------------------------------------------------------------------------------------
+template <class TYPE>
+class CNtlLockFreeQueue
+{
+public:
+
+	CNtlLockFreeQueue(DWORD dwCapacity = NTL_LOCKFREE_QUEUE_DEFAULT_CAPACITY);
+
+	virtual ~CNtlLockFreeQueue();
+
+
+public:
+
+	TYPE					Pop();
+
+	bool					Push(TYPE typeObject, bool bFront = false);
+
+	TYPE					Peek();
+
+	DWORD					PopBatch(TYPE * pObjects, DWORD dwMaxCount);
+
+	void					Clear();
+
+	DWORD					GetMaxUsedSize() { 	return m_dwMaxUseSize; }
+
+	DWORD					GetSize();
+
+	bool					IsEmpty() { return 0 == GetSize(); }
+
+	DWORD					GetCapacity() { return m_dwMask + 1; }
+
+
+private:
+
+	struct sCELL
+	{
+		volatile LONG		lSequence;
+		TYPE				typeObject;
+	};
+
+	sCELL *					GetCells();
+
+	bool					TryPop(TYPE & rObject);
+
+
+private:
+
+	sCELL * volatile		m_pCells;
+
+	DWORD					m_dwMask;
+
+	DWORD					m_dwMaxUseSize;
+
+	// producer  consumer  ġ  cache line   ʵ Ѵ
+	BYTE					m_abyPad0[64];
+
+	volatile LONG			m_lPushPos;
+
+	BYTE					m_abyPad1[64];
+
+	volatile LONG			m_lPopPos;
+
+	BYTE					m_abyPad2[64];
+
+};
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+template <class TYPE>
+inline CNtlLockFreeQueue<TYPE>::CNtlLockFreeQueue(DWORD dwCapacity)
+{
+	DWORD dwSize = 2;
+	while( dwSize < dwCapacity )
+	{
+		dwSize <<= 1;
+	}
+
+	m_pCells = NULL;
+	m_dwMask = dwSize - 1;
+	m_dwMaxUseSize = 0;
+
+	m_lPushPos = 0;
+	m_lPopPos = 0;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+template <class TYPE>
+inline CNtlLockFreeQueue<TYPE>::~CNtlLockFreeQueue()
+{
+	Clear();
+
+	delete [] m_pCells;
+	m_pCells = NULL;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+template <class TYPE>
+inline typename CNtlLockFreeQueue<TYPE>::sCELL * CNtlLockFreeQueue<TYPE>::GetCells()
+{
+	sCELL * pCells = m_pCells;
+	if( pCells )
+	{
+		return pCells;
+	}
+
+	pCells = new sCELL[m_dwMask + 1];
+	if( NULL == pCells )
+	{
+		return NULL;
+	}
+
+	for( DWORD i = 0; i <= m_dwMask; i++ )
+	{
+		pCells[i].lSequence = (LONG) i;
+	}
+
+	// ٸ thread   Ҵ װ 
+	sCELL * pPrevCells = (sCELL *) InterlockedCompareExchangePointer( (PVOID volatile *) &m_pCells, pCells, NULL );
+	if( pPrevCells )
+	{
+		delete [] pCells;
+		return pPrevCells;
+	}
+
+	return pCells;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+template <class TYPE>
+inline bool CNtlLockFreeQueue<TYPE>::Push(TYPE typeObject, bool bFront)
+{
+	if( bFront )
+	{
+		return false;
+	}
+
+	sCELL * pCells = GetCells();
+	if( NULL == pCells )
+	{
+		return false;
+	}
+
+	sCELL * pCell;
+	DWORD dwPos = (DWORD) m_lPushPos;
+	for( ;; )
+	{
+		pCell = &pCells[dwPos & m_dwMask];
+
+		LONG lDiff = (LONG) ( (DWORD) pCell->lSequence - dwPos );
+		if( 0 == lDiff )
+		{
+			DWORD dwPrevPos = (DWORD) InterlockedCompareExchange( &m_lPushPos, (LONG) (dwPos + 1), (LONG) dwPos );
+			if( dwPrevPos == dwPos )
+			{
+				break;
+			}
+
+			dwPos = dwPrevPos;
+		}
+		else if( lDiff < 0 )
+		{
+			//  á
+			return false;
+		}
+		else
+		{
+			dwPos = (DWORD) m_lPushPos;
+		}
+	}
+
+	pCell->typeObject = typeObject;
+	InterlockedExchange( &pCell->lSequence, (LONG) (dwPos + 1) );
+
+
+	// ̹Ƿ thread   Ѵ
+	DWORD dwSize = GetSize();
+	if( dwSize > m_dwMaxUseSize )
+	{
+		m_dwMaxUseSize = dwSize;
+	}
+
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+template <class TYPE>
+inline bool CNtlLockFreeQueue<TYPE>::TryPop(TYPE & rObject)
+{
+	sCELL * pCells = m_pCells;
+	if( NULL == pCells )
+	{
+		return false;
+	}
+
+	sCELL * pCell;
+	DWORD dwPos = (DWORD) m_lPopPos;
+	for( ;; )
+	{
+		pCell = &pCells[dwPos & m_dwMask];
+
+		LONG lDiff = (LONG) ( (DWORD) pCell->lSequence - (dwPos + 1) );
+		if( 0 == lDiff )
+		{
+			DWORD dwPrevPos = (DWORD) InterlockedCompareExchange( &m_lPopPos, (LONG) (dwPos + 1), (LONG) dwPos );
+			if( dwPrevPos == dwPos )
+			{
+				break;
+			}
+
+			dwPos = dwPrevPos;
+		}
+		else if( lDiff < 0 )
+		{
+			// 
+			return false;
+		}
+		else
+		{
+			dwPos = (DWORD) m_lPopPos;
+		}
+	}
+
+	rObject = pCell->typeObject;
+	InterlockedExchange( &pCell->lSequence, (LONG) (dwPos + m_dwMask + 1) );
+
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+template <class TYPE>
+inline TYPE CNtlLockFreeQueue<TYPE>::Pop()
+{
+	TYPE typeObject;
+
+	if( false == TryPop( typeObject ) )
+	{
+		ZeroMemory( &typeObject, sizeof(typeObject) );
+	}
+
+	return typeObject;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:	 ŭ pObjects  ä
+//		Return	:	 
+//-----------------------------------------------------------------------------------
+template <class TYPE>
+inline DWORD CNtlLockFreeQueue<TYPE>::PopBatch(TYPE * pObjects, DWORD dwMaxCount)
+{
+	DWORD dwCount = 0;
+	while( dwCount < dwMaxCount && TryPop( pObjects[dwCount] ) )
+	{
+		dwCount++;
+	}
+
+	return dwCount;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+template <class TYPE>
+inline TYPE CNtlLockFreeQueue<TYPE>::Peek()
+{
+	TYPE typeObject;
+
+	sCELL * pCells = m_pCells;
+	if( pCells )
+	{
+		DWORD dwPos = (DWORD) m_lPopPos;
+		sCELL * pCell = &pCells[dwPos & m_dwMask];
+
+		if( (DWORD) pCell->lSequence == dwPos + 1 )
+		{
+			typeObject = pCell->typeObject;
+			return typeObject;
+		}
+	}
+
+	ZeroMemory( &typeObject, sizeof(typeObject) );
+
+	return typeObject;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+template <class TYPE>
+inline void CNtlLockFreeQueue<TYPE>::Clear()
+{
+	TYPE typeObject;
+	while( TryPop( typeObject ) )
+	{
+	}
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:	뷫   ( ٸ thread  ְ  ̸    ̴ )
+//-----------------------------------------------------------------------------------
+template <class TYPE>
+inline DWORD CNtlLockFreeQueue<TYPE>::GetSize()
+{
+	// Pop ġ  о Push ġ Ŀ ʴ´
+	DWORD dwPopPos = (DWORD) m_lPopPos;
+	DWORD dwPushPos = (DWORD) m_lPushPos;
+
+	DWORD dwSize = dwPushPos - dwPopPos;
+	if( dwSize > m_dwMask + 1 )
+	{
+		return m_dwMask + 1;
+	}
+
+	return dwSize;
+}
+
+
+#endif // __NTLLOCKFREEQUEUE_H__
@@ -24,6 +24,9 @@
 #include "NtlMutex.h"
 #include "NtlMonitor.h"
 
+#include <deque>
+#include <vector>
+
 
 
 
@@ -39,9 +42,36 @@ public:
 	virtual void			Shutdown() {}
 
 	virtual void			QueueWorkItem(CNtlWorkItem * pWorkItem) = 0;
+
+	virtual void			Wait(CNtlTaskGroup * pTaskGroup) { pTaskGroup->Wait(); }
+
+	virtual int				GetWorkerCount() { return 0; }
+
+	virtual bool			GetWorkerStat(int nWorkerIndex, sNTL_WORKER_STAT & rStat) { UNREFERENCED_PARAMETER( nWorkerIndex ); UNREFERENCED_PARAMETER( rStat ); return false; }
 };
 
 
+//---------------------------------------------------------------------------------------
+// WorkItem    TaskGroup   ˸ (  ϰ   θ  )
+//---------------------------------------------------------------------------------------
+static void ReleaseWorkItem(CNtlWorkItem * pWorkItem)
+{
+	if( NULL == pWorkItem )
+	{
+		return;
+	}
+
+	CNtlTaskGroup * pTaskGroup = pWorkItem->GetTaskGroup();
+
+	SAFE_DELETE( pWorkItem );
+
+	if( pTaskGroup )
+	{
+		pTaskGroup->Done();
+	}
+}
+
+
 //---------------------------------------------------------------------------------------
 // CThreadPoolImp_KernelMode ( ThreadPool Ŭ ο )
 //---------------------------------------------------------------------------------------
@@ -147,6 +177,82 @@ private:
 
 
 
+//---------------------------------------------------------------------------------------
+// CThreadPoolImp_WorkStealing ( ThreadPool Ŭ ο )
+// Worker  ڱ ť . ڱ ť ڿ( ֱ ͺ ) ,
+//  ٸ Worker  ť տ(  ͺ ) Ŀ´
+//---------------------------------------------------------------------------------------
+class CWorkStealingWorker;
+class CThreadPoolImp_WorkStealing : public CThreadPoolImp
+{
+friend class CWorkStealingWorker;
+
+public:
+
+	CThreadPoolImp_WorkStealing(int nWorkerCount, bool bAffinity);
+
+	virtual ~CThreadPoolImp_WorkStealing();
+
+
+private:
+
+	CThreadPoolImp_WorkStealing( const CThreadPoolImp_WorkStealing &);
+	CThreadPoolImp_WorkStealing & operator=( const CThreadPoolImp_WorkStealing &);
+
+
+public:
+
+// override
+
+	bool					Start();
+
+	void					QueueWorkItem(CNtlWorkItem * pWorkItem);
+
+	void					Shutdown();
+
+	void					Wait(CNtlTaskGroup * pTaskGroup);
+
+	int						GetWorkerCount() { return (int) m_workerList.size(); }
+
+	bool					GetWorkerStat(int nWorkerIndex, sNTL_WORKER_STAT & rStat);
+
+
+private:
+
+	CNtlWorkItem *			Steal(CWorkStealingWorker * pThief);
+
+	void					WakeUpWorker();
+
+	void					WaitForWork(CWorkStealingWorker * pWorker);
+
+
+private:
+
+	typedef std::vector<CWorkStealingWorker*> WORKERLIST;
+
+	WORKERLIST				m_workerList;
+
+	int						m_nWorkerCount;
+
+	bool					m_bAffinity;
+
+	DWORD					m_dwTlsIndex;		//   CWorkStealingWorker
+
+	HANDLE					m_hWakeUpSemaphore;
+
+	volatile LONG			m_lSleepingCount;
+
+	volatile LONG			m_lNextWorker;		// ܺο  Worker ( round robin )
+
+	volatile bool			m_bShutdown;
+
+	CNtlMutex				m_queueMutex;		// ܺο ִ WorkItem  Shutdown ̸ ´
+
+	LARGE_INTEGER			m_liFrequency;
+};
+
+
+
 //---------------------------------------------------------------------------------------
 // NtlThread Pool 
 //---------------------------------------------------------------------------------------
@@ -181,6 +287,10 @@ int CNtlThreadPool::Create(int createFlag, int nMaxThreads, int nMinSpareThreads
 	{
 		m_pThreadPoolImp = new CThreadPoolImp_UserMode(nMaxThreads, nMinSpareThreads, nMaxSpareThread, nMonitorTimeout, nQueueHandlerTimeout);
 	}
+	else if( BIT_FLAG_TEST( createFlag, POOL_WORK_STEALING ) )
+	{
+		m_pThreadPoolImp = new CThreadPoolImp_WorkStealing( nMaxThreads, BIT_FLAG_TEST( createFlag, POOL_CPU_AFFINITY ) );
+	}
 	else
 	{
 		return NTL_ERR_THREAD_POOL_CREATE_FAIL;
@@ -214,12 +324,64 @@ void CNtlThreadPool::Start()
 //		Purpose	:
 //		Return	:
 //-----------------------------------------------------------------------------------
-void CNtlThreadPool::QueueWorkItem(CNtlWorkItem * pWorkItem)
+void CNtlThreadPool::QueueWorkItem(CNtlWorkItem * pWorkItem, CNtlTaskGroup * pTaskGroup)
 {
+	if( pTaskGroup )
+	{
+		pWorkItem->SetTaskGroup( pTaskGroup );
+		pTaskGroup->Add();
+	}
+
 	m_pThreadPoolImp->QueueWorkItem( pWorkItem );
 }
 
 
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+void CNtlThreadPool::Wait(CNtlTaskGroup * pTaskGroup)
+{
+	if( NULL == m_pThreadPoolImp )
+	{
+		pTaskGroup->Wait();
+		return;
+	}
+
+	m_pThreadPoolImp->Wait( pTaskGroup );
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+int CNtlThreadPool::GetWorkerCount()
+{
+	if( NULL == m_pThreadPoolImp )
+	{
+		return 0;
+	}
+
+	return m_pThreadPoolImp->GetWorkerCount();
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+bool CNtlThreadPool::GetWorkerStat(int nWorkerIndex, sNTL_WORKER_STAT & rStat)
+{
+	if( NULL == m_pThreadPoolImp )
+	{
+		return false;
+	}
+
+	return m_pThreadPoolImp->GetWorkerStat( nWorkerIndex, rStat );
+}
+
+
 //-----------------------------------------------------------------------------------
 //		Purpose	:
 //		Return	:
@@ -389,7 +551,8 @@ private:
 
 	void Reset()
 	{
-		SAFE_DELETE( m_pWorkItem );
+		ReleaseWorkItem( m_pWorkItem );
+		m_pWorkItem = NULL;
 		m_bShutdown = false;
 		m_bRun = false;
 	}
@@ -513,7 +676,7 @@ DWORD WINAPI ThreadProc(LPVOID lpParam)
 
 	pWorkItem->Run();
 
-	SAFE_DELETE( pWorkItem );
+	ReleaseWorkItem( pWorkItem );
 
 	return 0;
 }
@@ -606,7 +769,7 @@ inline void CThreadPoolImp_UserMode::QueueWorkItem(CNtlWorkItem * pWorkItem)
 
 	if( 0 == m_nTotalThreadCount || m_bShutdown )
 	{
-		SAFE_DELETE( pWorkItem );
+		ReleaseWorkItem( pWorkItem );
 		m_monitor.Unlock();
 		return;
 	}
@@ -636,7 +799,7 @@ inline void CThreadPoolImp_UserMode::RunWorkItem(CNtlWorkItem * pWorkItem)
 	if( !m_nTotalThreadCount || m_bShutdown )
 	{
 		m_monitor.Unlock();
-		SAFE_DELETE( pWorkItem );
+		ReleaseWorkItem( pWorkItem );
 		return;
 	}
 
@@ -658,6 +821,7 @@ inline void CThreadPoolImp_UserMode::RunWorkItem(CNtlWorkItem * pWorkItem)
 			if( 0 == m_nTotalThreadCount || m_bShutdown )
 			{
 				m_monitor.Unlock();
+				ReleaseWorkItem( pWorkItem );
 				return;
 			}
 		}
@@ -710,7 +874,7 @@ inline void CThreadPoolImp_UserMode::Shutdown()
 	CNtlWorkItem * pWorkItem = (CNtlWorkItem*) m_workItemList.Pop();
 	while( pWorkItem )
 	{
-		SAFE_DELETE( pWorkItem );
+		ReleaseWorkItem( pWorkItem );
 		pWorkItem = (CNtlWorkItem*) m_workItemList.Pop();
 	}
 }
@@ -863,6 +1027,587 @@ inline CNtlWorkItem * CThreadPoolImp_UserMode::GetWorkItem()
 
 
 
+//---------------------------------------------------------------------------------------
+// Task Group
+//---------------------------------------------------------------------------------------
+CNtlTaskGroup::CNtlTaskGroup()
+:
+m_lPendingCount( 0 )
+{
+	m_hDoneEvent = ::CreateEvent( NULL, TRUE, TRUE, NULL );
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+CNtlTaskGroup::~CNtlTaskGroup()
+{
+	if( NULL != m_hDoneEvent )
+	{
+		::CloseHandle( m_hDoneEvent );
+		m_hDoneEvent = NULL;
+	}
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+void CNtlTaskGroup::Add()
+{
+	m_mutex.Lock();
+
+	if( 0 == m_lPendingCount++ )
+	{
+		::ResetEvent( m_hDoneEvent );
+	}
+
+	m_mutex.Unlock();
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+void CNtlTaskGroup::Done()
+{
+	m_mutex.Lock();
+
+	if( 0 == --m_lPendingCount )
+	{
+		::SetEvent( m_hDoneEvent );
+	}
+
+	m_mutex.Unlock();
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+void CNtlTaskGroup::Wait()
+{
+	::WaitForSingleObject( m_hDoneEvent, INFINITE );
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+bool CNtlTaskGroup::Wait(DWORD dwMillisecs)
+{
+	return WAIT_OBJECT_0 == ::WaitForSingleObject( m_hDoneEvent, dwMillisecs );
+}
+
+
+//---------------------------------------------------------------------------------------
+// Work Stealing  Worker 
+//---------------------------------------------------------------------------------------
+const DWORD WORK_STEALING_IDLE_WAIT = 1000;	//  ȣ ĵ  ð ȿ ť ٽ  ( ms )
+
+class CWorkStealingWorker : public CNtlRunObject
+{
+friend class CThreadPoolImp_WorkStealing;
+
+private:
+
+	CWorkStealingWorker(CThreadPoolImp_WorkStealing * pPool, int nIndex)
+		:m_pPool( pPool ), m_nIndex( nIndex ), m_nDepth( 0 ), m_dwRunCount( 0 ), m_dwStealCount( 0 ), m_dw64BusyTicks( 0 )
+	{
+		m_liStart.QuadPart = 0;
+	}
+
+	void StartThread()
+	{
+		QueryPerformanceCounter( &m_liStart );
+
+		CNtlString strTemp;
+		strTemp.Format("StealWorker[%03d]", m_nIndex);
+		CNtlThread * pThread = CNtlThreadFactory::CreateThread( this, strTemp.c_str() );
+		pThread->Start();
+	}
+
+	void Run()
+	{
+		if( m_pPool->m_bAffinity )
+		{
+			SYSTEM_INFO sysInfo;
+			::GetSystemInfo( &sysInfo );
+
+			DWORD dwProcessor = m_nIndex % sysInfo.dwNumberOfProcessors;
+			::SetThreadAffinityMask( ::GetCurrentThread(), (DWORD_PTR) 1 << dwProcessor );
+		}
+
+		::TlsSetValue( m_pPool->m_dwTlsIndex, this );
+
+		while( IsRunnable() )
+		{
+			CNtlWorkItem * pWorkItem = Pop();
+			if( NULL == pWorkItem )
+			{
+				pWorkItem = m_pPool->Steal( this );
+			}
+
+			if( pWorkItem )
+			{
+				Execute( pWorkItem );
+				continue;
+			}
+
+			m_pPool->WaitForWork( this );
+		}
+	}
+
+	void Execute(CNtlWorkItem * pWorkItem)
+	{
+		// TaskGroup  ٸ ٸ WorkItem  óϴ  ð ι  ʴ´
+		bool bOuter = ( 0 == m_nDepth++ );
+
+		LARGE_INTEGER liBegin, liEnd;
+		QueryPerformanceCounter( &liBegin );
+
+		try
+		{
+			pWorkItem->Run();
+		}
+		catch( CNtlException e )
+		{
+			e.Dump();
+		}
+		catch( ... )
+		{
+		}
+
+		QueryPerformanceCounter( &liEnd );
+
+		ReleaseWorkItem( pWorkItem );
+
+		--m_nDepth;
+		++m_dwRunCount;
+
+		if( bOuter )
+		{
+			m_dw64BusyTicks += liEnd.QuadPart - liBegin.QuadPart;
+		}
+	}
+
+	// bFront :  ʿ ִ´ ( ܺο  WorkItem )
+	// Shutdown  ۵ ڿ  ʰ false  ش
+	bool Push(CNtlWorkItem * pWorkItem, bool bFront)
+	{
+		m_mutex.Lock();
+
+		if( m_pPool->m_bShutdown )
+		{
+			m_mutex.Unlock();
+			return false;
+		}
+
+		(bFront)?(m_queue.push_front(pWorkItem)):(m_queue.push_back(pWorkItem));
+
+		m_mutex.Unlock();
+
+		return true;
+	}
+
+	// ڱ ť  ֱ 
+	CNtlWorkItem * Pop()
+	{
+		CNtlWorkItem * pWorkItem = NULL;
+
+		m_mutex.Lock();
+		if( false == m_queue.empty() )
+		{
+			pWorkItem = m_queue.back();
+			m_queue.pop_back();
+		}
+		m_mutex.Unlock();
+
+		return pWorkItem;
+	}
+
+	// ٸ Worker     
+	CNtlWorkItem * StealFrom()
+	{
+		CNtlWorkItem * pWorkItem = NULL;
+
+		m_mutex.Lock();
+		if( false == m_queue.empty() )
+		{
+			pWorkItem = m_queue.front();
+			m_queue.pop_front();
+		}
+		m_mutex.Unlock();
+
+		return pWorkItem;
+	}
+
+
+private:
+
+	CThreadPoolImp_WorkStealing *	m_pPool;
+
+	int								m_nIndex;
+
+	int								m_nDepth;
+
+	std::deque<CNtlWorkItem*>		m_queue;
+
+	CNtlMutex						m_mutex;
+
+
+	//  ( Worker 常  )
+	DWORD							m_dwRunCount;
+
+	DWORD							m_dwStealCount;
+
+	LONGLONG						m_dw64BusyTicks;
+
+	LARGE_INTEGER					m_liStart;
+};
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+inline CThreadPoolImp_WorkStealing::CThreadPoolImp_WorkStealing(int nWorkerCount, bool bAffinity)
+{
+	if( nWorkerCount <= 0 )
+	{
+		SYSTEM_INFO sysInfo;
+		::GetSystemInfo( &sysInfo );
+
+		nWorkerCount = (int) sysInfo.dwNumberOfProcessors;
+	}
+
+	m_nWorkerCount		= nWorkerCount;
+	m_bAffinity			= bAffinity;
+	m_dwTlsIndex		= TLS_OUT_OF_INDEXES;
+	m_hWakeUpSemaphore	= NULL;
+	m_lSleepingCount	= 0;
+	m_lNextWorker		= 0;
+	m_bShutdown			= false;
+
+	QueryPerformanceFrequency( &m_liFrequency );
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+inline CThreadPoolImp_WorkStealing::~CThreadPoolImp_WorkStealing()
+{
+	Shutdown();
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+inline bool CThreadPoolImp_WorkStealing::Start()
+{
+	m_dwTlsIndex = ::TlsAlloc();
+	if( TLS_OUT_OF_INDEXES == m_dwTlsIndex )
+	{
+		return false;
+	}
+
+	m_hWakeUpSemaphore = ::CreateSemaphore( NULL, 0, 0x7FFFFFFF, NULL );
+	if( NULL == m_hWakeUpSemaphore )
+	{
+		return false;
+	}
+
+	m_bShutdown = false;
+
+
+	// Steal   ״ Ƿ   ڿ 带 
+	for( int i = 0; i < m_nWorkerCount; i++ )
+	{
+		CWorkStealingWorker * pWorker = new CWorkStealingWorker( this, i );
+		if( NULL == pWorker )
+		{
+			return false;
+		}
+
+		m_workerList.push_back( pWorker );
+	}
+
+	for( WORKERLIST::iterator it = m_workerList.begin(); it != m_workerList.end(); it++ )
+	{
+		(*it)->StartThread();
+	}
+
+	return true;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+inline void CThreadPoolImp_WorkStealing::QueueWorkItem(CNtlWorkItem * pWorkItem)
+{
+	CWorkStealingWorker * pWorker = NULL;
+	if( TLS_OUT_OF_INDEXES != m_dwTlsIndex )
+	{
+		pWorker = (CWorkStealingWorker *) ::TlsGetValue( m_dwTlsIndex );
+	}
+
+	bool bQueued = false;
+
+	if( pWorker )
+	{
+		// Worker    ڱ ť ٷ  óѴ
+		// Worker  Shutdown  Join  ڿ Ƿ ť lock ȿ Shutdown θ  ȴ
+		bQueued = pWorker->Push( pWorkItem, false );
+	}
+	else
+	{
+		// ܺ  Shutdown  Worker     Ƿ m_queueMutex ȿ ִ´
+		m_queueMutex.Lock();
+
+		if( false == m_bShutdown && false == m_workerList.empty() )
+		{
+			DWORD dwIndex = (DWORD) InterlockedIncrement( &m_lNextWorker ) % (DWORD) m_workerList.size();
+			bQueued = m_workerList[dwIndex]->Push( pWorkItem, true );
+		}
+
+		m_queueMutex.Unlock();
+	}
+
+	if( false == bQueued )
+	{
+		ReleaseWorkItem( pWorkItem );
+		return;
+	}
+
+	WakeUpWorker();
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+inline void CThreadPoolImp_WorkStealing::WakeUpWorker()
+{
+	if( m_lSleepingCount > 0 )
+	{
+		::ReleaseSemaphore( m_hWakeUpSemaphore, 1, NULL );
+	}
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+inline void CThreadPoolImp_WorkStealing::WaitForWork(CWorkStealingWorker * pWorker)
+{
+	InterlockedIncrement( &m_lSleepingCount );
+
+	//    WorkItem  ġ ʵ ѹ  ȮѴ
+	CNtlWorkItem * pWorkItem = pWorker->Pop();
+	if( NULL == pWorkItem )
+	{
+		pWorkItem = Steal( pWorker );
+	}
+
+	if( pWorkItem )
+	{
+		InterlockedDecrement( &m_lSleepingCount );
+
+		pWorker->Execute( pWorkItem );
+		return;
+	}
+
+	::WaitForSingleObject( m_hWakeUpSemaphore, WORK_STEALING_IDLE_WAIT );
+
+	InterlockedDecrement( &m_lSleepingCount );
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+inline CNtlWorkItem * CThreadPoolImp_WorkStealing::Steal(CWorkStealingWorker * pThief)
+{
+	if( m_bShutdown )
+	{
+		return NULL;
+	}
+
+	int nCount = (int) m_workerList.size();
+	int nStart = pThief ? pThief->m_nIndex + 1 : 0;
+
+	for( int i = 0; i < nCount; i++ )
+	{
+		CWorkStealingWorker * pVictim = m_workerList[(nStart + i) % nCount];
+		if( pVictim == pThief )
+		{
+			continue;
+		}
+
+		CNtlWorkItem * pWorkItem = pVictim->StealFrom();
+		if( pWorkItem )
+		{
+			if( pThief )
+			{
+				++pThief->m_dwStealCount;
+			}
+
+			return pWorkItem;
+		}
+	}
+
+	return NULL;
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+inline void CThreadPoolImp_WorkStealing::Wait(CNtlTaskGroup * pTaskGroup)
+{
+	CWorkStealingWorker * pWorker = NULL;
+	if( TLS_OUT_OF_INDEXES != m_dwTlsIndex )
+	{
+		pWorker = (CWorkStealingWorker *) ::TlsGetValue( m_dwTlsIndex );
+	}
+
+	if( NULL == pWorker )
+	{
+		pTaskGroup->Wait();
+		return;
+	}
+
+
+	// Worker  ׳   Worker  θ ٸ  Ƿ    óѴ
+	// Shutdown  ۵Ǹ Worker  Join   ֵ ٸ ʰ 
+	while( false == pTaskGroup->IsDone() && false == m_bShutdown )
+	{
+		CNtlWorkItem * pWorkItem = pWorker->Pop();
+		if( NULL == pWorkItem )
+		{
+			pWorkItem = Steal( pWorker );
+		}
+
+		if( pWorkItem )
+		{
+			pWorker->Execute( pWorkItem );
+		}
+		else
+		{
+			pTaskGroup->Wait( 1 );
+		}
+	}
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+inline void CThreadPoolImp_WorkStealing::Shutdown()
+{
+	m_queueMutex.Lock();
+
+	if( m_bShutdown )
+	{
+		m_queueMutex.Unlock();
+		return;
+	}
+
+	m_bShutdown = true;
+
+	m_queueMutex.Unlock();
+
+
+	for( WORKERLIST::iterator it = m_workerList.begin(); it != m_workerList.end(); it++ )
+	{
+		(*it)->Close();
+	}
+
+	if( NULL != m_hWakeUpSemaphore )
+	{
+		::ReleaseSemaphore( m_hWakeUpSemaphore, (LONG) m_workerList.size(), NULL );
+	}
+
+	// Steal  ٸ Worker  Ƿ  Worker   ڿ 
+	for( WORKERLIST::iterator it = m_workerList.begin(); it != m_workerList.end(); it++ )
+	{
+		(*it)->Terminate();
+	}
+
+	for( WORKERLIST::iterator it = m_workerList.begin(); it != m_workerList.end(); it++ )
+	{
+		CWorkStealingWorker * pWorker = *it;
+
+		// ó  WorkItem 
+		CNtlWorkItem * pWorkItem = pWorker->Pop();
+		while( pWorkItem )
+		{
+			ReleaseWorkItem( pWorkItem );
+			pWorkItem = pWorker->Pop();
+		}
+
+		SAFE_DELETE( pWorker );
+	}
+
+	m_workerList.clear();
+
+
+	if( NULL != m_hWakeUpSemaphore )
+	{
+		::CloseHandle( m_hWakeUpSemaphore );
+		m_hWakeUpSemaphore = NULL;
+	}
+
+	if( TLS_OUT_OF_INDEXES != m_dwTlsIndex )
+	{
+		::TlsFree( m_dwTlsIndex );
+		m_dwTlsIndex = TLS_OUT_OF_INDEXES;
+	}
+}
+
+
+//-----------------------------------------------------------------------------------
+//		Purpose	:
+//		Return	:
+//-----------------------------------------------------------------------------------
+inline bool CThreadPoolImp_WorkStealing::GetWorkerStat(int nWorkerIndex, sNTL_WORKER_STAT & rStat)
+{
+	if( nWorkerIndex < 0 || nWorkerIndex >= (int) m_workerList.size() )
+	{
+		return false;
+	}
+
+	CWorkStealingWorker * pWorker = m_workerList[nWorkerIndex];
+
+	LARGE_INTEGER liNow;
+	QueryPerformanceCounter( &liNow );
+
+	rStat.dwRunCount	= pWorker->m_dwRunCount;
+	rStat.dwStealCount	= pWorker->m_dwStealCount;
+	rStat.dw64BusyTime	= (DWORD64) ( pWorker->m_dw64BusyTicks * 1000000 / m_liFrequency.QuadPart );
+	rStat.dw64TotalTime	= (DWORD64) ( ( liNow.QuadPart - pWorker->m_liStart.QuadPart ) * 1000000 / m_liFrequency.QuadPart );
+
+	return true;
+}
+
+
 
 
 /*#include <iostream>
@@ -16,13 +16,93 @@
 #define __NTLTHREADPOOL_H__
 
 #include "NtlLinkList.h"
+#include "NtlMutex.h"
 
+
+class CNtlTaskGroup;
 class CNtlWorkItem : public CNtlLinkObject
 {
 public:
+	CNtlWorkItem() : m_pTaskGroup( NULL ) {}
+
 	virtual ~CNtlWorkItem() {}
 
 	virtual void Run() = 0;
+
+public:
+
+	CNtlTaskGroup *			GetTaskGroup() { return m_pTaskGroup; }
+
+	void					SetTaskGroup(CNtlTaskGroup * pTaskGroup) { m_pTaskGroup = pTaskGroup; }
+
+private:
+
+	CNtlTaskGroup *			m_pTaskGroup;
+};
+
+
+//---------------------------------------------------------------------------------------
+// CNtlTaskGroup : Բ  WorkItem   ⸦ ٸ
+//---------------------------------------------------------------------------------------
+class CNtlTaskGroup
+{
+friend class CNtlThreadPool;
+
+public:
+
+	CNtlTaskGroup();
+
+	virtual ~CNtlTaskGroup();
+
+
+private:
+
+	CNtlTaskGroup(const CNtlTaskGroup&);
+	CNtlTaskGroup& operator=(const CNtlTaskGroup&);
+
+
+public:
+
+	//  WorkItem  
+	bool					IsDone() { return 0 == m_lPendingCount; }
+
+	LONG					GetPendingCount() { return m_lPendingCount; }
+
+	//    block. Worker 忡 CNtlThreadPool::Wait   
+	void					Wait();
+
+	// ð ȿ  true
+	bool					Wait(DWORD dwMillisecs);
+
+
+public:
+
+	void					Add();
+
+	void					Done();
+
+
+private:
+
+	volatile LONG			m_lPendingCount;
+
+	HANDLE					m_hDoneEvent;
+
+	CNtlMutex				m_mutex;
+};
+
+
+//---------------------------------------------------------------------------------------
+// Work Stealing  Worker  
+//---------------------------------------------------------------------------------------
+struct sNTL_WORKER_STAT
+{
+	DWORD					dwRunCount;		// ó WorkItem 
+	DWORD					dwStealCount;	// ٸ Worker Լ  WorkItem 
+	DWORD64					dw64BusyTime;	// WorkItem  ó ð ( micro sec )
+	DWORD64					dw64TotalTime;	// Worker  ۵ ڷ  ð ( micro sec )
+
+	float					GetUtilization() const { return dw64TotalTime ? (float) ( (double) dw64BusyTime / (double) dw64TotalTime ) : 0.0f; }
 };
 
 class CThreadPoolImp; // ThreadPool ο
@@ -34,6 +114,8 @@ public:
 	{
 		POOL_KERNEL_MODE		= 0x01,
 		POOL_USER_MODE			= 0x02,
+		POOL_WORK_STEALING		= 0x04,		// nMaxThreads  Worker ( 0 ̸ CPU  )   ť   Ŀ´
+		POOL_CPU_AFFINITY		= 0x08,		// POOL_WORK_STEALING  Բ : Worker  CPU ϳ 
 
 		MAX_THREADS				= 25,
 		MIN_SPARE_THREADS		= 1,
@@ -70,11 +152,20 @@ public:
 
 	void					Start();
 
-	void					QueueWorkItem(CNtlWorkItem * pWorkItem);
+	void					QueueWorkItem(CNtlWorkItem * pWorkItem, CNtlTaskGroup * pTaskGroup = NULL);
+
+	// pTaskGroup  WorkItem     ٸ. Worker 忡 θ ٸ  ٸ WorkItem  óѴ
+	void					Wait(CNtlTaskGroup * pTaskGroup);
 
 	void					Shutdown();
 
 
+	// Work Stealing 忡 ǹ̰ ִ
+	int						GetWorkerCount();
+
+	bool					GetWorkerStat(int nWorkerIndex, sNTL_WORKER_STAT & rStat);
+
+
 	static void				UnitTest();
 
 
@@ -73,6 +73,9 @@ public:
 	{
 		SetControlFlag( CONTROL_FLAG_USE_SEND_QUEUE );
 
+		// OnDispatch    ä Ʈũ μ ť   ѹ 
+		SetControlFlag( CONTROL_FLAG_USE_SEND_BATCH );
+
 		if( bAliveCheck )
 		{
 			SetControlFlag( CONTROL_FLAG_CHECK_ALIVE );
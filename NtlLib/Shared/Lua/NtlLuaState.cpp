@@ -1,6 +1,7 @@
 #include <Winsock2.h>
 #include <Windows.h>
 #include <oleauto.h>
+#include <sys/stat.h>
 #include "NtlLuaState.h"
 
 extern "C" {
@@ -12,6 +13,33 @@ extern "C" {
 
 #define NTL_MAX_LUA_ERR		2048
 
+// CompileLua    ( <dir><name>.out )  ְ   ʾ  ̸ ش.
+static bool GetCompiledScriptName(const char *pFileName, char *pCompiled, int iSize)
+{
+	char szDrive[_MAX_DRIVE]	= {0,};
+	char szDir[_MAX_DIR]		= {0,};
+	char szName[_MAX_FNAME]		= {0,};
+	char szExt[_MAX_EXT]		= {0,};
+	if(_splitpath_s(pFileName, szDrive, szDir, szName, szExt) != 0)
+		return false;
+
+	// ̹ compile    
+	if(_stricmp(szExt, ".out") == 0)
+		return false;
+
+	sprintf_s(pCompiled, iSize, "%s%s%s.out", szDrive, szDir, szName);
+
+	struct _stat sCompiled;
+	if(_stat(pCompiled, &sCompiled) != 0)
+		return false;
+
+	struct _stat sSource;
+	if(_stat(pFileName, &sSource) == 0 && sSource.st_mtime > sCompiled.st_mtime)
+		return false;
+
+	return true;
+}
+
 CNtlLuaState::CNtlLuaState()
 {
 	m_pScriptContext = lua_open();
@@ -52,7 +80,17 @@ void CNtlLuaState::CallSuccessHandler(const char *pSuccess)
 
 bool CNtlLuaState::RunScript(const char *pFileName)
 {
-	if(luaL_loadfile(m_pScriptContext, pFileName) != 0)
+	// luac bytecode   lexing/parsing  ٷ д´.    ư.
+	char chCompiled[_MAX_PATH];
+	int iLoad = -1;
+	if(GetCompiledScriptName(pFileName, chCompiled, _MAX_PATH))
+	{
+		iLoad = luaL_loadfile(m_pScriptContext, chCompiled);
+		if(iLoad != 0)
+			lua_pop(m_pScriptContext, 1);
+	}
+
+	if(iLoad != 0 && luaL_loadfile(m_pScriptContext, pFileName) != 0)
 	{
 		CallErrorHandler(luaL_checkstring(m_pScriptContext, -1));
 
@@ -101,6 +139,84 @@ bool CNtlLuaState::RunString(const char *pCmd)
 	return true;
 }
 
+int CNtlLuaState::GetFunctionRef(const char *pFuncName)
+{
+	if(pFuncName == NULL || pFuncName[0] == '\0')
+		return NTL_LUA_NOREF;
+
+	// "a.b.c"   table   .
+	char chName[NTL_MAX_LUA_ERR];
+	strcpy_s(chName, NTL_MAX_LUA_ERR, pFuncName);
+
+	char *pContext = NULL;
+	char *pToken = strtok_s(chName, ".", &pContext);
+
+	lua_pushvalue(m_pScriptContext, LUA_GLOBALSINDEX);
+	while(pToken)
+	{
+		if(!lua_istable(m_pScriptContext, -1))
+		{
+			lua_pop(m_pScriptContext, 1);
+			lua_pushnil(m_pScriptContext);
+			break;
+		}
+
+		lua_getfield(m_pScriptContext, -1, pToken);
+		lua_remove(m_pScriptContext, -2);
+
+		pToken = strtok_s(NULL, ".", &pContext);
+	}
+
+	if(!lua_isfunction(m_pScriptContext, -1))
+	{
+		lua_pop(m_pScriptContext, 1);
+
+		char chError[ NTL_MAX_LUA_ERR ] = { '\0', };
+		sprintf_s(chError, NTL_MAX_LUA_ERR, "GetFunctionRef Error - Not a function:%s", pFuncName);
+
+		CallErrorHandler(chError);
+		return NTL_LUA_NOREF;
+	}
+
+	return luaL_ref(m_pScriptContext, LUA_REGISTRYINDEX);
+}
+
+void CNtlLuaState::ReleaseFunctionRef(int iRef)
+{
+	if(iRef == NTL_LUA_NOREF)
+		return;
+
+	luaL_unref(m_pScriptContext, LUA_REGISTRYINDEX, iRef);
+}
+
+bool CNtlLuaState::CallFunction(int iRef, const unsigned int *pArgs, int iArgCount)
+{
+	if(iRef == NTL_LUA_NOREF)
+		return false;
+
+	if(!lua_checkstack(m_pScriptContext, iArgCount + 1))
+		return false;
+
+	lua_rawgeti(m_pScriptContext, LUA_REGISTRYINDEX, iRef);
+
+	for(int i = 0; i < iArgCount; ++i)
+		lua_pushnumber(m_pScriptContext, pArgs[i]);
+
+	//  Ҹ ̹Ƿ success handler  θ ʴ´.
+	if(lua_pcall(m_pScriptContext, iArgCount, 0, 0) != 0)
+	{
+		char chError[ NTL_MAX_LUA_ERR ] = { '\0', };
+		const char *pMsg = lua_tostring(m_pScriptContext, -1);
+		sprintf_s(chError, NTL_MAX_LUA_ERR, "CallFunction(lua_pcall) Error - Error Message:%s", pMsg ? pMsg : "(error object is not a string)");
+		lua_pop(m_pScriptContext, 1);
+
+		CallErrorHandler(chError);
+		return false;
+	}
+
+	return true;
+}
+
 bool CNtlLuaState::AddFunction(const char *pFuncName, LuaFunctionType pFunc)
 {
 	lua_register(m_pScriptContext, pFuncName, pFunc);
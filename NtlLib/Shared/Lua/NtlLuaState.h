@@ -22,6 +22,8 @@ extern "C" {
 typedef int (*LuaFunctionType)(struct lua_State *pLuaState);
 };
 
+#define NTL_LUA_NOREF		(-2)		// LUA_NOREF
+
 typedef void(*fpFuncErrorHandler)(const char *pError);
 typedef void(*fpFuncSuccessHandler)(const char *pError);
 
@@ -49,6 +51,13 @@ public:
 	bool RunScript(const char *pFileName);
 	bool RunString(const char *pCmd);
 
+	//  Լ registry   д. "table.func" ĵ ȴ. ϸ NTL_LUA_NOREF.
+	int  GetFunctionRef(const char *pFuncName);
+	void ReleaseFunctionRef(int iRef);
+
+	// GetFunctionRef    Լ  ڷ ȣѴ. RunString  ޸ chunk  compile  ʴ´.
+	bool CallFunction(int iRef, const unsigned int *pArgs = NULL, int iArgCount = 0);
+
 	bool AddFunction(const char *pFuncName, LuaFunctionType pFunc);
 	const char* GetStringArgument(int num, const char *pDefault = NULL);
 	double GetNumberArgument(int num, double dDefault=0.0);
@@ -11,6 +11,12 @@
 //////////////////////////////////////////////////////////////////////////
 
 
+#define NAVI_TRACE_THREAD_NAME		(0x0001)
+#define NAVI_TRACE_BEGIN			(0x0002)
+#define NAVI_TRACE_END				(0x0003)
+#define NAVI_TRACE_THREAD_EXIT		(0x0004)
+
+
 class INtlNaviLog
 {
 public:
@@ -19,6 +25,9 @@ public:
 
 public:
 	virtual void Log( const char* pLog, ... )														= 0;
+
+	// loading thread   ð profiler  ѱ. ( NAVI_TRACE_XXX, pName  ڿ  )
+	virtual void Trace( int nTraceEvent, const char* pName ) { return; }
 };
 
 
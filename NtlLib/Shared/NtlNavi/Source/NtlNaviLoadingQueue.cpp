@@ -1,5 +1,6 @@
 #include "precomp_navi.h"
 #include "NtlNaviLoadingQueue.h"
+#include "NtlNaviLog.h"
 #include <process.h>
 
 
@@ -264,6 +265,8 @@ bool CNtlLoadingQueue::DetachEntityLoaded( CNtlNaviLoadingEntity* pEntity )
 
 unsigned int CNtlLoadingQueue::ThreadCallBackFunc( void )
 {
+	CNtlNaviLog::GetInstance()->Trace( NAVI_TRACE_THREAD_NAME, "NaviLoading" );
+
 	while ( !IsExit() )
 	{
 		WaitForSingleObjectEx( m_hEvent, INFINITE, FALSE );
@@ -280,11 +283,16 @@ unsigned int CNtlLoadingQueue::ThreadCallBackFunc( void )
 		{
 			SetEvent( m_hEvent );
 
+			CNtlNaviLog::GetInstance()->Trace( NAVI_TRACE_BEGIN, "NaviLoading::RunMultiThread" );
 			pEntity->RunMultiThread();
+			CNtlNaviLog::GetInstance()->Trace( NAVI_TRACE_END, NULL );
+
 			AttachEntityLoaded( pEntity );
 		}
 	}
 
+	CNtlNaviLog::GetInstance()->Trace( NAVI_TRACE_THREAD_EXIT, NULL );
+
 	return 0;
 }
 
@@ -44,3 +44,14 @@ void CNtlNaviLog::Log( const char* pFormat, ... )
 		m_pLog->Log( s_szStrBuf );
 	}
 }
+
+void CNtlNaviLog::Trace( int nTraceEvent, const char* pName )
+{
+	// Loading   ҸǷ lock   ʴ´. SetLog  ʱȭ  Ѵ
+	INtlNaviLog* pLog = m_pLog;
+
+	if ( pLog )
+	{
+		pLog->Trace( nTraceEvent, pName );
+	}
+}
@@ -48,6 +48,8 @@ public:
 	void							SetLog( INtlNaviLog* pLog );
 
 	void							Log( const char* pFormat, ... );
+
+	void							Trace( int nTraceEvent, const char* pName );
 };
 
 
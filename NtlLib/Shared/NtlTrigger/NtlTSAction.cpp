@@ -19,9 +19,9 @@ void CNtlTSAction::ApplyScriptDataForScript( const CNtlTSScrProperty& clProperty
 {
 	CNtlTSEntity::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "taid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "taid" ) ) )
 	{
-		SetActionId( (NTL_TS_TA_ID)clProperty.GetValueAsInt( "taid" ) );
+		SetActionId( (NTL_TS_TA_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "taid" ) ) );
 	}
 }
 
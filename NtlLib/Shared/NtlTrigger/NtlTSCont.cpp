@@ -208,14 +208,14 @@ void CNtlTSCont::ApplyScriptDataForScript( const CNtlTSScrProperty& clProperty )
 {
 	CNtlTSEntity::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "cid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "cid" ) ) )
 	{
-		m_tcID = (NTL_TS_TC_ID)clProperty.GetValueAsInt( "cid" );
+		m_tcID = (NTL_TS_TC_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "cid" ) );
 	}
 
-	if ( clProperty.IsExist( "prelnk" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "prelnk" ) ) )
 	{
-		std::string strPreLnk = clProperty.GetValue( "prelnk" );
+		std::string strPreLnk = clProperty.GetValue( NTL_TS_SCR_KEY( "prelnk" ) );
 		ParsingLinkInfo( strPreLnk );
 	}
 }
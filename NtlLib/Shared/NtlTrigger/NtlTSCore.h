@@ -30,6 +30,8 @@
 #include "NtlTSScrFactory.h"
 #include "NtlTSScrStream.h"
 #include "NtlTSScrSaver.h"
+#include "NtlTSScrBinary.h"
+#include "NtlTSScrCompiler.h"
 
 
 /** 
@@ -1,5 +1,9 @@
 #include "precomp_trigger.h"
 #include "NtlTSCoreStatic.h"
+#include "NtlTSScrProperty.h"
 
 
-char g_NtlTSString[1024] = { 0, };
+__declspec(thread) char g_NtlTSString[1024] = { 0, };
+
+
+const std::string CNtlTSScrProperty::s_strBlank;
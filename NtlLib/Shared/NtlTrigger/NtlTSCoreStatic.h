@@ -3,7 +3,8 @@
 
 
 // Ʈ Ǵ ӽ  ó 
-extern char g_NtlTSString[1024];
+// script   thread  εϹǷ thread   
+extern __declspec(thread) char g_NtlTSString[1024];
 
 
 #endif
\ No newline at end of file
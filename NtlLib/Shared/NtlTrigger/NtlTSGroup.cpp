@@ -189,9 +189,9 @@ void CNtlTSGroup::ApplyScriptDataForScript( const CNtlTSScrProperty& clProperty
 {
 	CNtlTSEntity::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "gid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "gid" ) ) )
 	{
-		SetID( (NTL_TS_TG_ID)clProperty.GetValueAsInt( "gid" ) );
+		SetID( (NTL_TS_TG_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "gid" ) ) );
 	}
 }
 
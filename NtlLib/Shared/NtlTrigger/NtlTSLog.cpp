@@ -8,7 +8,8 @@
 
 
 CNtlTSLog* CNtlTSLog::s_pLog = 0;
-char CNtlTSLog::s_szStrBuf[LOG_MAX_BUFFER];
+__declspec(thread) char CNtlTSLog::s_szStrBuf[LOG_MAX_BUFFER];
+__declspec(thread) std::vector<std::string>* CNtlTSLog::s_pCapture = 0;
 
 
 void CNtlTSLog::Register( CNtlTSLog* pLog )
@@ -29,9 +30,20 @@ void CNtlTSLog::Log( const char* pFormat, ... )
 	wvsprintf( s_szStrBuf, pFormat, vaList );
 	va_end( vaList );
 
+	if ( s_pCapture )
+	{
+		s_pCapture->push_back( s_szStrBuf );
+		return;
+	}
+
 	if ( s_pLog ) s_pLog->OnLogEvent( s_szStrBuf );
 }
 
+void CNtlTSLog::SetThreadCapture( std::vector<std::string>* pCapture )
+{
+	s_pCapture = pCapture;
+}
+
 void CNtlTSLog::OnLogEvent( const char* pLog )
 {
 
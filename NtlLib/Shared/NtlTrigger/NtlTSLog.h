@@ -22,7 +22,8 @@ public:
 // Static variables
 protected:
 	static CNtlTSLog*					s_pLog;
-	static char							s_szStrBuf[LOG_MAX_BUFFER];
+	static __declspec(thread) char		s_szStrBuf[LOG_MAX_BUFFER];
+	static __declspec(thread) std::vector<std::string>*	s_pCapture;
 
 // Static methods
 public:
@@ -30,6 +31,10 @@ public:
 	static void							Unregister( void );
 	static void							Log( const char* pFormat, ... );
 
+	//  thread  log  OnLogEvent   ʰ pCapture   д. 0 ̸  
+	// OnLogEvent  θ   ۾ thread  ,  log  main thread  Log  ٽ 
+	static void							SetThreadCapture( std::vector<std::string>* pCapture );
+
 // Constructions and Destructions
 public:
 	virtual ~CNtlTSLog( void ) { return; }
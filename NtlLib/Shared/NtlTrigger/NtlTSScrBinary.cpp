@@ -0,0 +1,287 @@
+#include "precomp_trigger.h"
+#include "NtlTSScrBinary.h"
+#include "NtlTSScrObject.h"
+#include "NtlTSScrFactory.h"
+#include "NtlTSScrFactoryType.h"
+#include "NtlTSLog.h"
+
+
+/**
+	Script binary
+*/
+
+
+CNtlTSScrBinary::CNtlTSScrBinary( CNtlTSScrFactory* pFactory )
+: m_pFactory( pFactory ),
+  m_pHeader( 0 ),
+  m_pScript( 0 ),
+  m_pType( 0 ),
+  m_pObj( 0 ),
+  m_pProp( 0 ),
+  m_pString( 0 )
+{
+}
+
+CNtlTSScrBinary::~CNtlTSScrBinary( void )
+{
+	Close();
+}
+
+bool CNtlTSScrBinary::Open( const std::string& strFileName, const char* pData, int nSize, unsigned int uiSourceSize, unsigned int uiSourceCRC )
+{
+	Close();
+
+	m_strFileName = strFileName;
+
+	if ( 0 == pData || nSize < (int)sizeof( sNTL_TS_BIN_HEADER ) )
+	{
+		CNtlTSLog::Log( "The compiled script is too small. Info[%s]. [%s]", strFileName.c_str(), TS_CODE_TRACE() );
+		return false;
+	}
+
+	m_vecData.assign( pData, pData + nSize );
+
+	const sNTL_TS_BIN_HEADER* pHeader = (const sNTL_TS_BIN_HEADER*)&m_vecData[0];
+	if ( NTL_TS_BIN_MAGIC != pHeader->uiMagic ||
+		 NTL_TS_BIN_VERSION != pHeader->wVersion ||
+		 sizeof( sNTL_TS_BIN_HEADER ) != pHeader->wHeaderSize )
+	{
+		CNtlTSLog::Log( "The compiled script version is not matched. Info[%s]. [%s]", strFileName.c_str(), TS_CODE_TRACE() );
+		Close();
+		return false;
+	}
+
+	//  ٲ ٽ compile    Ƿ log   ʴ´
+	if ( uiSourceSize != pHeader->uiSourceSize ||
+		 uiSourceCRC != pHeader->uiSourceCRC )
+	{
+		Close();
+		return false;
+	}
+
+	//   ũⰡ  ũ ¾ƾ Ѵ
+	unsigned __int64 ui64Size = sizeof( sNTL_TS_BIN_HEADER );
+	ui64Size += (unsigned __int64)pHeader->uiScriptCount * sizeof( sNTL_TS_BIN_SCRIPT );
+	ui64Size += (unsigned __int64)pHeader->uiTypeCount * sizeof( unsigned int );
+	ui64Size += (unsigned __int64)pHeader->uiObjCount * sizeof( sNTL_TS_BIN_OBJ );
+	ui64Size += (unsigned __int64)pHeader->uiPropCount * sizeof( sNTL_TS_BIN_PROP );
+	ui64Size += pHeader->uiStringSize;
+
+	if ( ui64Size != (unsigned __int64)nSize ||
+		 0 == pHeader->uiStringSize ||
+		 '\0' != m_vecData[nSize - 1] )
+	{
+		CNtlTSLog::Log( "The compiled script is broken. Info[%s]. [%s]", strFileName.c_str(), TS_CODE_TRACE() );
+		Close();
+		return false;
+	}
+
+	const char* pPos = &m_vecData[0] + sizeof( sNTL_TS_BIN_HEADER );
+
+	m_pScript = (const sNTL_TS_BIN_SCRIPT*)pPos;
+	pPos += pHeader->uiScriptCount * sizeof( sNTL_TS_BIN_SCRIPT );
+
+	m_pType = (const unsigned int*)pPos;
+	pPos += pHeader->uiTypeCount * sizeof( unsigned int );
+
+	m_pObj = (const sNTL_TS_BIN_OBJ*)pPos;
+	pPos += pHeader->uiObjCount * sizeof( sNTL_TS_BIN_OBJ );
+
+	m_pProp = (const sNTL_TS_BIN_PROP*)pPos;
+	pPos += pHeader->uiPropCount * sizeof( sNTL_TS_BIN_PROP );
+
+	m_pString = pPos;
+
+	m_pHeader = pHeader;
+
+	// type ̸ ⼭ ѹ ã´
+	m_defFactoryType.resize( pHeader->uiTypeCount );
+
+	for ( unsigned int i = 0; i < pHeader->uiTypeCount; ++i )
+	{
+		const char* pTypeName = GetString( m_pType[i] );
+		CNtlTSScrFactoryType* pFactoryType = pTypeName ? m_pFactory->GetFactoryType( pTypeName ) : 0;
+
+		if ( 0 == pFactoryType )
+		{
+			CNtlTSLog::Log( "Can not find the object type. Info[%s, %s]. [%s]", strFileName.c_str(), pTypeName ? pTypeName : "", TS_CODE_TRACE() );
+			Close();
+			return false;
+		}
+
+		m_defFactoryType[i] = pFactoryType;
+	}
+
+	// property ̸ ڿ offset    ̸̴
+	stdext::hash_map<unsigned int, CNtlTSScrSymbolTable::sSYMBOL> defNameSymbol;
+
+	m_defPropSymbol.resize( pHeader->uiPropCount );
+
+	for ( unsigned int i = 0; i < pHeader->uiPropCount; ++i )
+	{
+		CNtlTSScrSymbolTable::sSYMBOL& sSymbol = m_defPropSymbol[i];
+
+		stdext::hash_map<unsigned int, CNtlTSScrSymbolTable::sSYMBOL>::iterator it = defNameSymbol.find( m_pProp[i].uiName );
+		if ( it != defNameSymbol.end() )
+		{
+			sSymbol = it->second;
+			continue;
+		}
+
+		const char* pName = GetString( m_pProp[i].uiName );
+		if ( pName )
+		{
+			sSymbol = CNtlTSScrSymbolTable::Intern( pName );
+		}
+		else
+		{
+			sSymbol.uiSymbol = NTL_TS_SCR_INVALID_SYMBOL;
+			sSymbol.pName = 0;
+		}
+
+		defNameSymbol[m_pProp[i].uiName] = sSymbol;
+	}
+
+	for ( unsigned int i = 0; i < pHeader->uiScriptCount; ++i )
+	{
+		const sNTL_TS_BIN_SCRIPT& sScript = m_pScript[i];
+
+		if ( 0 == GetString( sScript.uiName ) ||
+			 sScript.uiFirstObj > pHeader->uiObjCount ||
+			 sScript.uiObjCount > pHeader->uiObjCount - sScript.uiFirstObj )
+		{
+			CNtlTSLog::Log( "The compiled script is broken. Info[%s]. [%s]", strFileName.c_str(), TS_CODE_TRACE() );
+			Close();
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void CNtlTSScrBinary::Close( void )
+{
+	std::vector<char>().swap( m_vecData );
+	m_defFactoryType.clear();
+	m_defPropSymbol.clear();
+
+	m_pHeader = 0;
+	m_pScript = 0;
+	m_pType = 0;
+	m_pObj = 0;
+	m_pProp = 0;
+	m_pString = 0;
+}
+
+const char* CNtlTSScrBinary::GetScriptName( int nScript ) const
+{
+	if ( nScript < 0 || nScript >= GetScriptCount() ) return 0;
+
+	return GetString( m_pScript[nScript].uiName );
+}
+
+int CNtlTSScrBinary::FindScript( const char* pScriptName ) const
+{
+	// compile   ̸   ξ
+	int nLeft = 0;
+	int nRight = GetScriptCount() - 1;
+
+	while ( nLeft <= nRight )
+	{
+		int nMid = ( nLeft + nRight ) / 2;
+
+		int nCmp = strcmp( GetString( m_pScript[nMid].uiName ), pScriptName );
+		if ( 0 == nCmp ) return nMid;
+
+		if ( nCmp < 0 ) nLeft = nMid + 1;
+		else nRight = nMid - 1;
+	}
+
+	return -1;
+}
+
+bool CNtlTSScrBinary::Load( int nScript, std::vector<CNtlTSScrObject*>& vecCreatedRootObjList )
+{
+	if ( nScript < 0 || nScript >= GetScriptCount() )
+	{
+		CNtlTSLog::Log( "Wrong script index. Info[%s, %d]. [%s]", m_strFileName.c_str(), nScript, TS_CODE_TRACE() );
+		return false;
+	}
+
+	const sNTL_TS_BIN_SCRIPT& sScript = m_pScript[nScript];
+
+	std::vector<CNtlTSScrObject*> vecObj;
+	vecObj.reserve( sScript.uiObjCount );
+
+	std::vector<CNtlTSScrObject*> vecRoot;
+
+	// ü property table  ٽ  ʵ ϳ  . ڿ ۵ ٽ 
+	CNtlTSScrProperty clProperty;
+
+	for ( unsigned int i = 0; i < sScript.uiObjCount; ++i )
+	{
+		const sNTL_TS_BIN_OBJ& sObj = m_pObj[sScript.uiFirstObj + i];
+
+		// θ  ڽĺ  
+		if ( sObj.uiType >= m_pHeader->uiTypeCount ||
+			 ( NTL_TS_BIN_INVALID_INDEX != sObj.uiParent && sObj.uiParent >= i ) ||
+			 sObj.uiFirstProp > m_pHeader->uiPropCount ||
+			 sObj.uiPropCount > m_pHeader->uiPropCount - sObj.uiFirstProp )
+		{
+			CNtlTSLog::Log( "The compiled script is broken. Info[%s, %s]. [%s]", m_strFileName.c_str(), GetScriptName( nScript ), TS_CODE_TRACE() );
+			break;
+		}
+
+		CNtlTSScrObject* pObj = m_defFactoryType[sObj.uiType]->CreateObj();
+		if ( 0 == pObj )
+		{
+			CNtlTSLog::Log( "Creating the object is failed. Info[%s]. [%s]", GetString( m_pType[sObj.uiType] ), TS_CODE_TRACE() );
+			break;
+		}
+
+		clProperty.Clear();
+
+		for ( unsigned int j = 0; j < sObj.uiPropCount; ++j )
+		{
+			const sNTL_TS_BIN_PROP& sProp = m_pProp[sObj.uiFirstProp + j];
+			const CNtlTSScrSymbolTable::sSYMBOL& sSymbol = m_defPropSymbol[sObj.uiFirstProp + j];
+
+			const char* pValue = GetString( sProp.uiValue );
+			if ( NTL_TS_SCR_INVALID_SYMBOL == sSymbol.uiSymbol || 0 == pValue ) continue;
+
+			clProperty.AddProperty( sSymbol, pValue );
+		}
+
+		pObj->ApplyScriptDataForScript( clProperty );
+
+		vecObj.push_back( pObj );
+
+		if ( NTL_TS_BIN_INVALID_INDEX == sObj.uiParent )
+		{
+			vecRoot.push_back( pObj );
+		}
+		else
+		{
+			CNtlTSScrObject* pParent = vecObj[sObj.uiParent];
+
+			pParent->AttachChildForScript( pObj );
+			pObj->SetParentForScript( pParent );
+		}
+	}
+
+	if ( vecObj.size() != sScript.uiObjCount )
+	{
+		// ڽ θ پ Ƿ root   ȴ
+		std::vector<CNtlTSScrObject*>::iterator it = vecRoot.begin();
+		for ( ; it != vecRoot.end(); ++it )
+		{
+			m_pFactory->DeleteObj( *it );
+		}
+
+		return false;
+	}
+
+	vecCreatedRootObjList.insert( vecCreatedRootObjList.end(), vecRoot.begin(), vecRoot.end() );
+
+	return true;
+}
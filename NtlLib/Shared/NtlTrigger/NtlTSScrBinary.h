@@ -0,0 +1,146 @@
+#ifndef _NTL_TSSCRBINARY_H_
+#define _NTL_TSSCRBINARY_H_
+
+
+#include "NtlTSScrProperty.h"
+
+
+class CNtlTSScrObject;
+class CNtlTSScrFactory;
+class CNtlTSScrFactoryType;
+
+
+/**
+	Script binary
+	CNtlTSScrCompiler   compiled script  о ü Ѵ
+
+	 
+	sNTL_TS_BIN_HEADER
+	sNTL_TS_BIN_SCRIPT	[uiScriptCount]		: script ̸  
+	unsigned int		[uiTypeCount]		: ü type ̸ ( string offset )
+	sNTL_TS_BIN_OBJ		[uiObjCount]		: ü   ( CNtlTSScrParser::Building   )
+	sNTL_TS_BIN_PROP	[uiPropCount]
+	char				[uiStringSize]		: '\0'   ڿ
+
+	tokenizing, ü ̸ map,   compile    Ƿ
+	  type ̸ factory type  ѹ ٲٰ record  ü 
+
+	header  compile    ũ CRC   ΰ,  ٲ  ʴ´
+	Ϸ а   ( ȣȭ  )  ϴ ʿ Ѵ
+*/
+
+
+#define NTL_TS_BIN_MAGIC				(0x4253544E)	// "NTSB"
+#define NTL_TS_BIN_VERSION				(2)
+#define NTL_TS_BIN_INVALID_INDEX		(0xffffffff)
+
+
+#pragma pack( push, 1 )
+
+struct sNTL_TS_BIN_HEADER
+{
+	unsigned int						uiMagic;
+	unsigned short						wVersion;
+	unsigned short						wHeaderSize;
+
+	unsigned int						uiSourceSize;	// compile   
+	unsigned int						uiSourceCRC;
+
+	unsigned int						uiScriptCount;
+	unsigned int						uiTypeCount;
+	unsigned int						uiObjCount;
+	unsigned int						uiPropCount;
+	unsigned int						uiStringSize;
+};
+
+struct sNTL_TS_BIN_SCRIPT
+{
+	unsigned int						uiName;			// string offset
+	unsigned int						uiFirstObj;
+	unsigned int						uiObjCount;
+};
+
+struct sNTL_TS_BIN_OBJ
+{
+	unsigned int						uiType;			// type table index
+	unsigned int						uiParent;		// script  ü index, root ̸ NTL_TS_BIN_INVALID_INDEX
+	unsigned int						uiFirstProp;
+	unsigned int						uiPropCount;
+};
+
+struct sNTL_TS_BIN_PROP
+{
+	unsigned int						uiName;			// string offset
+	unsigned int						uiValue;		// string offset
+};
+
+#pragma pack( pop )
+
+
+class CNtlTSScrBinary
+{
+// Member variables
+protected:
+	CNtlTSScrFactory*					m_pFactory;
+	std::string							m_strFileName;
+
+	std::vector<char>					m_vecData;
+
+	const sNTL_TS_BIN_HEADER*			m_pHeader;
+	const sNTL_TS_BIN_SCRIPT*			m_pScript;
+	const unsigned int*					m_pType;
+	const sNTL_TS_BIN_OBJ*				m_pObj;
+	const sNTL_TS_BIN_PROP*				m_pProp;
+	const char*							m_pString;
+
+	std::vector<CNtlTSScrFactoryType*>	m_defFactoryType;
+
+	// property ̸ Open   symbol  ѹ ٲ д. property index 
+	std::vector<CNtlTSScrSymbolTable::sSYMBOL>	m_defPropSymbol;
+
+// Constructions and Destructions
+public:
+	CNtlTSScrBinary( CNtlTSScrFactory* pFactory );
+	~CNtlTSScrBinary( void );
+
+// Methods
+public:
+	// ͸  ΰ type ̸ factory type , property ̸ symbol  ٲ۴
+	// header   ũ CRC  uiSourceSize, uiSourceCRC  ٸ Ѵ
+	bool								Open( const std::string& strFileName, const char* pData, int nSize, unsigned int uiSourceSize, unsigned int uiSourceCRC );
+	void								Close( void );
+
+	bool								IsOpened( void ) const;
+
+	int									GetScriptCount( void ) const;
+	const char*							GetScriptName( int nScript ) const;
+
+	//  -1
+	int									FindScript( const char* pScriptName ) const;
+
+	// script ϳ ü . root ü鸸 vecCreatedRootObjList  
+	bool								Load( int nScript, std::vector<CNtlTSScrObject*>& vecCreatedRootObjList );
+
+// Implementations
+protected:
+	const char*							GetString( unsigned int uiOffset ) const;
+};
+
+
+inline bool CNtlTSScrBinary::IsOpened( void ) const
+{
+	return 0 != m_pHeader;
+}
+
+inline int CNtlTSScrBinary::GetScriptCount( void ) const
+{
+	return m_pHeader ? (int)m_pHeader->uiScriptCount : 0;
+}
+
+inline const char* CNtlTSScrBinary::GetString( unsigned int uiOffset ) const
+{
+	return uiOffset < m_pHeader->uiStringSize ? m_pString + uiOffset : 0;
+}
+
+
+#endif
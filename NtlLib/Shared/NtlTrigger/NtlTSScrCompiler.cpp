@@ -0,0 +1,192 @@
+#include "precomp_trigger.h"
+#include "NtlTSScrCompiler.h"
+#include "NtlTSScrParser.h"
+#include "NtlTSScrFactory.h"
+#include "NtlTSLog.h"
+
+
+/**
+	Script compiler
+*/
+
+
+namespace
+{
+	struct sSCRIPT_NAME_LESS
+	{
+		template <class T>
+		bool operator()( const T& lhs, const T& rhs ) const
+		{
+			return strcmp( lhs.strName.c_str(), rhs.strName.c_str() ) < 0;
+		}
+	};
+}
+
+
+CNtlTSScrCompiler::CNtlTSScrCompiler( CNtlTSScrFactory* pFactory )
+: m_pFactory( pFactory )
+{
+}
+
+CNtlTSScrCompiler::~CNtlTSScrCompiler( void )
+{
+}
+
+bool CNtlTSScrCompiler::AddScript( const std::string& strScriptName, const char* pBuff, int nSize )
+{
+	std::vector<sSCRIPT>::iterator itScript = m_defScript.begin();
+	for ( ; itScript != m_defScript.end(); ++itScript )
+	{
+		if ( itScript->strName == strScriptName )
+		{
+			CNtlTSLog::Log( "The script name is duplicated. Info[%s]. [%s]", strScriptName.c_str(), TS_CODE_TRACE() );
+			return false;
+		}
+	}
+
+	CNtlTSScrParser clParser( m_pFactory );
+	if ( !clParser.Parsing( strScriptName, pBuff, nSize ) )
+	{
+		return false;
+	}
+
+	sSCRIPT sScript;
+	sScript.strName = strScriptName;
+	sScript.uiFirstObj = (unsigned int)m_defObj.size();
+	sScript.uiObjCount = 0;
+
+	// CNtlTSScrParser::Building    ü Ѵ
+	std::map<CNtlTSScrParser::sOBJ_INFO*, unsigned int> mapIndex;
+
+	CNtlTSScrParser::mmapdef_ObjSortMap& defSorted = clParser.GetSortedObjs();
+	CNtlTSScrParser::mmapdef_ObjSortMap::iterator it = defSorted.begin();
+	for ( ; it != defSorted.end(); ++it )
+	{
+		std::vector<CNtlTSScrParser::sOBJ_INFO*> vecInfo;
+
+		CNtlTSScrParser::sOBJ_INFO* pInfo = it->second;
+		if ( mapIndex.find( pInfo ) == mapIndex.end() )
+		{
+			vecInfo.push_back( pInfo );
+		}
+
+		std::list<CNtlTSScrParser::sOBJ_INFO*>::iterator itChild = pInfo->listChildren.begin();
+		for ( ; itChild != pInfo->listChildren.end(); ++itChild )
+		{
+			if ( mapIndex.find( *itChild ) == mapIndex.end() )
+			{
+				vecInfo.push_back( *itChild );
+			}
+		}
+
+		std::vector<CNtlTSScrParser::sOBJ_INFO*>::iterator itInfo = vecInfo.begin();
+		for ( ; itInfo != vecInfo.end(); ++itInfo )
+		{
+			CNtlTSScrParser::sOBJ_INFO* pObjInfo = *itInfo;
+
+			sNTL_TS_BIN_OBJ sObj;
+			sObj.uiType = AddType( pObjInfo->strType );
+			sObj.uiParent = ( pObjInfo == pInfo ) ? NTL_TS_BIN_INVALID_INDEX : mapIndex[pInfo];
+			sObj.uiFirstProp = (unsigned int)m_defProp.size();
+			sObj.uiPropCount = 0;
+
+			for ( int nProp = 0; nProp < pObjInfo->Property.GetPropertyCount(); ++nProp )
+			{
+				const sNTL_TS_SCR_VALUE& sValue = pObjInfo->Property.GetProperty( nProp );
+
+				sNTL_TS_BIN_PROP sProp;
+				sProp.uiName = AddString( sValue.GetName() );
+				sProp.uiValue = AddString( sValue.strValue );
+
+				m_defProp.push_back( sProp );
+				++sObj.uiPropCount;
+			}
+
+			mapIndex[pObjInfo] = sScript.uiObjCount++;
+			m_defObj.push_back( sObj );
+		}
+	}
+
+	m_defScript.push_back( sScript );
+
+	return true;
+}
+
+bool CNtlTSScrCompiler::Save( std::vector<char>& vecData, unsigned int uiSourceSize, unsigned int uiSourceCRC )
+{
+	// CNtlTSScrBinary::FindScript   Ž Ѵ
+	std::vector<sSCRIPT> defScript = m_defScript;
+	std::sort( defScript.begin(), defScript.end(), sSCRIPT_NAME_LESS() );
+
+	std::vector<sNTL_TS_BIN_SCRIPT> defBinScript;
+	defBinScript.reserve( defScript.size() );
+
+	std::vector<sSCRIPT>::iterator it = defScript.begin();
+	for ( ; it != defScript.end(); ++it )
+	{
+		sNTL_TS_BIN_SCRIPT sScript;
+		sScript.uiName = AddString( it->strName );
+		sScript.uiFirstObj = it->uiFirstObj;
+		sScript.uiObjCount = it->uiObjCount;
+
+		defBinScript.push_back( sScript );
+	}
+
+	if ( m_defString.empty() ) AddString( "" );
+
+	sNTL_TS_BIN_HEADER sHeader;
+	sHeader.uiMagic = NTL_TS_BIN_MAGIC;
+	sHeader.wVersion = NTL_TS_BIN_VERSION;
+	sHeader.wHeaderSize = sizeof( sNTL_TS_BIN_HEADER );
+	sHeader.uiSourceSize = uiSourceSize;
+	sHeader.uiSourceCRC = uiSourceCRC;
+	sHeader.uiScriptCount = (unsigned int)defBinScript.size();
+	sHeader.uiTypeCount = (unsigned int)m_defType.size();
+	sHeader.uiObjCount = (unsigned int)m_defObj.size();
+	sHeader.uiPropCount = (unsigned int)m_defProp.size();
+	sHeader.uiStringSize = (unsigned int)m_defString.size();
+
+	vecData.clear();
+	vecData.reserve( sizeof( sHeader ) +
+					 defBinScript.size() * sizeof( sNTL_TS_BIN_SCRIPT ) +
+					 m_defType.size() * sizeof( unsigned int ) +
+					 m_defObj.size() * sizeof( sNTL_TS_BIN_OBJ ) +
+					 m_defProp.size() * sizeof( sNTL_TS_BIN_PROP ) +
+					 m_defString.size() );
+
+	vecData.insert( vecData.end(), (const char*)&sHeader, (const char*)&sHeader + sizeof( sHeader ) );
+
+	if ( !defBinScript.empty() )	vecData.insert( vecData.end(), (const char*)&defBinScript[0], (const char*)&defBinScript[0] + defBinScript.size() * sizeof( sNTL_TS_BIN_SCRIPT ) );
+	if ( !m_defType.empty() )		vecData.insert( vecData.end(), (const char*)&m_defType[0], (const char*)&m_defType[0] + m_defType.size() * sizeof( unsigned int ) );
+	if ( !m_defObj.empty() )		vecData.insert( vecData.end(), (const char*)&m_defObj[0], (const char*)&m_defObj[0] + m_defObj.size() * sizeof( sNTL_TS_BIN_OBJ ) );
+	if ( !m_defProp.empty() )		vecData.insert( vecData.end(), (const char*)&m_defProp[0], (const char*)&m_defProp[0] + m_defProp.size() * sizeof( sNTL_TS_BIN_PROP ) );
+	vecData.insert( vecData.end(), &m_defString[0], &m_defString[0] + m_defString.size() );
+
+	return true;
+}
+
+unsigned int CNtlTSScrCompiler::AddString( const std::string& strString )
+{
+	hashdef_OFFSET::iterator it = m_defStringOffset.find( strString );
+	if ( it != m_defStringOffset.end() ) return it->second;
+
+	unsigned int uiOffset = (unsigned int)m_defString.size();
+	m_defString.insert( m_defString.end(), strString.c_str(), strString.c_str() + strString.size() + 1 );
+
+	m_defStringOffset[strString] = uiOffset;
+
+	return uiOffset;
+}
+
+unsigned int CNtlTSScrCompiler::AddType( const std::string& strType )
+{
+	hashdef_OFFSET::iterator it = m_defTypeIndex.find( strType );
+	if ( it != m_defTypeIndex.end() ) return it->second;
+
+	unsigned int uiIndex = (unsigned int)m_defType.size();
+	m_defType.push_back( AddString( strType ) );
+
+	m_defTypeIndex[strType] = uiIndex;
+
+	return uiIndex;
+}
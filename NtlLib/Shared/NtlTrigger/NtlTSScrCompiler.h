@@ -0,0 +1,72 @@
+#ifndef _NTL_TSSCRCOMPILER_H_
+#define _NTL_TSSCRCOMPILER_H_
+
+
+#include "NtlTSScrBinary.h"
+
+
+class CNtlTSScrFactory;
+
+
+/**
+	Script compiler
+	text script ( .t )  parsing ؼ CNtlTSScrBinary  д compiled script ϳ 
+	ü type  property ̸ factory  ˻ϰ, ڿ ѹ Ѵ
+*/
+
+
+class CNtlTSScrCompiler
+{
+// Declarations
+protected:
+	struct sSCRIPT
+	{
+		std::string						strName;
+		unsigned int					uiFirstObj;
+		unsigned int					uiObjCount;
+	};
+
+	typedef stdext::hash_map<std::string, unsigned int> hashdef_OFFSET;
+
+// Member variables
+protected:
+	CNtlTSScrFactory*					m_pFactory;
+
+	std::vector<sSCRIPT>				m_defScript;
+	std::vector<unsigned int>			m_defType;
+	std::vector<sNTL_TS_BIN_OBJ>		m_defObj;
+	std::vector<sNTL_TS_BIN_PROP>		m_defProp;
+	std::vector<char>					m_defString;
+
+	hashdef_OFFSET						m_defTypeIndex;
+	hashdef_OFFSET						m_defStringOffset;
+
+// Constructions and Destructions
+public:
+	CNtlTSScrCompiler( CNtlTSScrFactory* pFactory );
+	~CNtlTSScrCompiler( void );
+
+// Methods
+public:
+	// strScriptName  CNtlTSScrBinary::FindScript  ã ̸. pBuff  0 ̸ strScriptName  д´
+	bool								AddScript( const std::string& strScriptName, const char* pBuff, int nSize );
+
+	int									GetScriptCount( void ) const;
+
+	// uiSourceSize, uiSourceCRC  compile   . CNtlTSScrBinary::Open  Ѵ
+	bool								Save( std::vector<char>& vecData, unsigned int uiSourceSize, unsigned int uiSourceCRC );
+
+// Implementations
+protected:
+	unsigned int						AddString( const std::string& strString );
+	unsigned int						AddType( const std::string& strType );
+};
+
+
+inline int CNtlTSScrCompiler::GetScriptCount( void ) const
+{
+	return (int)m_defScript.size();
+}
+
+
+#endif
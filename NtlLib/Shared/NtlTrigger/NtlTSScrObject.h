@@ -44,6 +44,7 @@ public:
 
 	friend class CNtlTSScrParser;
 	friend class CNtlTSScrSaver;
+	friend class CNtlTSScrBinary;
 };
 
 
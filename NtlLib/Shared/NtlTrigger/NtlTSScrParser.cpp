@@ -51,6 +51,19 @@ bool CNtlTSScrParser::Parsing( const std::string& strScriptName, const char* pBu
 	return true;
 }
 
+bool CNtlTSScrParser::Parsing( const std::string& strScriptName, const char* pBuff, int nSize )
+{
+	CNtlTSScrTokenizer clLexer( strScriptName, pBuff, nSize );
+
+	if ( !Parsing( &clLexer ) )
+	{
+		CNtlTSLog::Log( "Parsing error. Info[%s]. [%s]", strScriptName.c_str(), TS_CODE_TRACE() );
+		return false;
+	}
+
+	return true;
+}
+
 bool CNtlTSScrParser::Parsing( CNtlTSScrTokenizer* pLexer )
 {
 	enum ePARSESTATE
@@ -239,7 +252,7 @@ bool CNtlTSScrParser::Parsing( CNtlTSScrTokenizer* pLexer )
 						return false;
 					}
 
-					stackdefObjInfoStack.top().second.Property.m_defProperty.insert(std::make_pair<std::string, std::string>((std::string &&)strVariableName, (std::string &&)""));
+					stackdefObjInfoStack.top().second.Property.AddProperty( strVariableName, std::string() );
 					strVariableName = "";
 					strVariableValue.erase();
 
@@ -272,7 +285,7 @@ bool CNtlTSScrParser::Parsing( CNtlTSScrTokenizer* pLexer )
 					}
 					else
 					{
-						stackdefObjInfoStack.top().second.Property.m_defProperty.insert( std::make_pair( strVariableName, strVariableValue ) );
+						stackdefObjInfoStack.top().second.Property.AddProperty( strVariableName, strVariableValue );
 					}
 
 					strVariableName = "";
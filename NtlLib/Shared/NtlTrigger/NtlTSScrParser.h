@@ -63,6 +63,9 @@ public:
 	bool								Parsing( const std::string& strScriptName, std::vector<CNtlTSScrObject*>& vecCreatedRootObjList );
 	bool								Parsing( const std::string& strScriptName, const char* pBuff, int nSize, std::vector<CNtlTSScrObject*>& vecCreatedRootObjList );
 
+	// ü  ʰ parsing  Ѵ.  GetObjs, GetSortedObjs  ´ ( CNtlTSScrCompiler )
+	bool								Parsing( const std::string& strScriptName, const char* pBuff, int nSize );
+
 // Implementations
 private:
 	bool								Parsing( CNtlTSScrTokenizer* pLexer );
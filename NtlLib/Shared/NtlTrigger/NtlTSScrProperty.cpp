@@ -0,0 +1,190 @@
+#include "precomp_trigger.h"
+#include "NtlTSScrProperty.h"
+
+
+/**
+	Script symbol table
+*/
+
+
+namespace
+{
+	struct sSYMBOL_TABLE
+	{
+		typedef stdext::hash_map<std::string, unsigned int> hashdef_SYMBOL;
+
+		CRITICAL_SECTION				csLock;
+		hashdef_SYMBOL					defSymbol;
+
+		sSYMBOL_TABLE( void )			{ InitializeCriticalSection( &csLock ); }
+		~sSYMBOL_TABLE( void )			{ DeleteCriticalSection( &csLock ); }
+	};
+
+	// factory type   ߿ Ƿ  ü ϴ
+	sSYMBOL_TABLE g_clSymbolTable;
+}
+
+
+CNtlTSScrSymbolTable::sSYMBOL CNtlTSScrSymbolTable::Intern( const char* pName )
+{
+	sSYMBOL sSymbol;
+
+	EnterCriticalSection( &g_clSymbolTable.csLock );
+
+	sSYMBOL_TABLE::hashdef_SYMBOL::iterator it = g_clSymbolTable.defSymbol.find( pName );
+	if ( it == g_clSymbolTable.defSymbol.end() )
+	{
+		unsigned int uiSymbol = (unsigned int)g_clSymbolTable.defSymbol.size();
+		it = g_clSymbolTable.defSymbol.insert( sSYMBOL_TABLE::hashdef_SYMBOL::value_type( pName, uiSymbol ) ).first;
+	}
+
+	// hash_map  node  Ű Ƿ key  ּҸ ̸ ״ 
+	sSymbol.uiSymbol = it->second;
+	sSymbol.pName = &it->first;
+
+	LeaveCriticalSection( &g_clSymbolTable.csLock );
+
+	return sSymbol;
+}
+
+CNtlTSScrSymbolTable::sSYMBOL CNtlTSScrSymbolTable::Find( const char* pName )
+{
+	sSYMBOL sSymbol;
+	sSymbol.uiSymbol = NTL_TS_SCR_INVALID_SYMBOL;
+	sSymbol.pName = 0;
+
+	EnterCriticalSection( &g_clSymbolTable.csLock );
+
+	sSYMBOL_TABLE::hashdef_SYMBOL::iterator it = g_clSymbolTable.defSymbol.find( pName );
+	if ( it != g_clSymbolTable.defSymbol.end() )
+	{
+		sSymbol.uiSymbol = it->second;
+		sSymbol.pName = &it->first;
+	}
+
+	LeaveCriticalSection( &g_clSymbolTable.csLock );
+
+	return sSymbol;
+}
+
+sNTL_TS_SCR_KEY CNtlTSScrSymbolTable::GetKey( const char* pName )
+{
+	sNTL_TS_SCR_KEY sKey = { Find( pName ).uiSymbol, pName };
+	return sKey;
+}
+
+int CNtlTSScrSymbolTable::GetCount( void )
+{
+	EnterCriticalSection( &g_clSymbolTable.csLock );
+	int nCount = (int)g_clSymbolTable.defSymbol.size();
+	LeaveCriticalSection( &g_clSymbolTable.csLock );
+
+	return nCount;
+}
+
+
+/**
+	Script property value
+*/
+
+
+void sNTL_TS_SCR_VALUE::Assign( const char* pValue, size_t nLength )
+{
+	strValue.assign( pValue, nLength );
+
+	const char* pStr = strValue.c_str();
+
+	nValue = atoi( pStr );
+
+	// atof  ιǷ ڷ  ʴ ڿ ǳʶڴ.  atof  
+	while ( isspace( (unsigned char)*pStr ) ) ++pStr;
+
+	char chFirst = pStr[0];
+
+	if ( ( chFirst >= '0' && chFirst <= '9' ) || '-' == chFirst || '+' == chFirst || '.' == chFirst )
+	{
+		fValue = (float)atof( pStr );
+	}
+	else
+	{
+		fValue = 0.f;
+	}
+
+	bValue = ( strValue == "yes" || strValue == "true" || strValue == "on" || strValue == "1" );
+}
+
+sNTL_TS_SCR_VALUE& sNTL_TS_SCR_VALUE::operator=( const std::string& strNewValue )
+{
+	Assign( strNewValue.c_str(), strNewValue.size() );
+	return *this;
+}
+
+sNTL_TS_SCR_VALUE& sNTL_TS_SCR_VALUE::operator=( const char* pNewValue )
+{
+	Assign( pNewValue, strlen( pNewValue ) );
+	return *this;
+}
+
+
+/**
+	Script property table
+*/
+
+
+bool CNtlTSScrPropertyTable::Insert( const CNtlTSScrSymbolTable::sSYMBOL& sSymbol, const char* pValue, size_t nLength )
+{
+	if ( -1 != Find( sSymbol.uiSymbol ) ) return false;
+
+	Append( sSymbol ).Assign( pValue, nLength );
+
+	return true;
+}
+
+void CNtlTSScrPropertyTable::Erase( int nIndex )
+{
+	if ( nIndex < 0 || nIndex >= m_nCount ) return;
+
+	//     slot   ܼ ٽ 
+	for ( int i = nIndex; i < m_nCount - 1; ++i )
+	{
+		std::swap( m_defValue[i], m_defValue[i + 1] );
+	}
+
+	--m_nCount;
+}
+
+sNTL_TS_SCR_VALUE& CNtlTSScrPropertyTable::operator[]( const std::string& strName )
+{
+	int nIndex = Find( strName.c_str() );
+	if ( -1 != nIndex ) return m_defValue[nIndex];
+
+	sNTL_TS_SCR_VALUE& sValue = Append( CNtlTSScrSymbolTable::Intern( strName.c_str() ) );
+	sValue.Assign( "", 0 );
+
+	return sValue;
+}
+
+sNTL_TS_SCR_VALUE& CNtlTSScrPropertyTable::operator[]( const char* pName )
+{
+	int nIndex = Find( pName );
+	if ( -1 != nIndex ) return m_defValue[nIndex];
+
+	sNTL_TS_SCR_VALUE& sValue = Append( CNtlTSScrSymbolTable::Intern( pName ) );
+	sValue.Assign( "", 0 );
+
+	return sValue;
+}
+
+sNTL_TS_SCR_VALUE& CNtlTSScrPropertyTable::Append( const CNtlTSScrSymbolTable::sSYMBOL& sSymbol )
+{
+	if ( m_nCount == (int)m_defValue.size() )
+	{
+		m_defValue.push_back( sNTL_TS_SCR_VALUE() );
+	}
+
+	sNTL_TS_SCR_VALUE& sValue = m_defValue[m_nCount++];
+	sValue.uiSymbol = sSymbol.uiSymbol;
+	sValue.pName = sSymbol.pName;
+
+	return sValue;
+}
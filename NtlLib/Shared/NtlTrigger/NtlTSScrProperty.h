@@ -6,22 +6,148 @@
 #include "NtlTSLog.h"
 
 
-/** 
-	Script property
+#define NTL_TS_SCR_INVALID_SYMBOL		(0xffffffff)
+
+
+struct sNTL_TS_SCR_KEY;
+
+
+/**
+	Script symbol table
+	property ̸ ó   ѹ ϵǾ ȣ ( symbol )  ޴´
+	ϵ ̸  Ƿ sSYMBOL::pName  α׷   ȿϴ
+	script   thread  Ƿ ϰ ˻ lock ȿ Ѵ
 */
 
 
-class CNtlTSScrProperty
+class CNtlTSScrSymbolTable
 {
 // Declarations
 public:
-	typedef stdext::hash_map<std::string,std::string> hashdef_PROPERTY;
-	typedef hashdef_PROPERTY::iterator PROP_IT;
-	typedef hashdef_PROPERTY::const_iterator PROP_CIT;
+	struct sSYMBOL
+	{
+		unsigned int					uiSymbol;
+		const std::string*				pName;
+	};
+
+// Methods
+public:
+	//  Ѵ
+	static sSYMBOL						Intern( const char* pName );
+
+	//  uiSymbol  NTL_TS_SCR_INVALID_SYMBOL
+	static sSYMBOL						Find( const char* pName );
+
+	// ϵ  ̸̸ uiSymbol  NTL_TS_SCR_INVALID_SYMBOL  key  ش
+	static sNTL_TS_SCR_KEY				GetKey( const char* pName );
+
+	static int							GetCount( void );
+};
+
+
+/**
+	Script key
+	ڵ忡  property ̸  NTL_TS_SCR_KEY( "name" )  ѱ
+	symbol  ȣ  symbol table  lock ȿ ã´ ( ȣ ġ ĳ ʴ´ )
+	ü     ̹Ƿ lock  ۴
+	script   ̸  Ƿ symbol table  Ŀ ʴ´
+*/
+
+
+struct sNTL_TS_SCR_KEY
+{
+	unsigned int						uiSymbol;
+	const char*							pName;
+};
+
+
+#define NTL_TS_SCR_KEY( name )			CNtlTSScrSymbolTable::GetKey( name )
+
+
+/**
+	Script property value
+	ڿ  ״ ΰ,    int / float / bool  ѹ ٲ д
+*/
+
+
+struct sNTL_TS_SCR_VALUE
+{
+	unsigned int						uiSymbol;
+	const std::string*					pName;
+
+	std::string							strValue;
+	int									nValue;
+	float								fValue;
+	bool								bValue;
+
+	const std::string&					GetName( void ) const { return *pName; }
+
+	void								Assign( const char* pValue, size_t nLength );
+
+	// TakeScriptDataForScript  m_defProperty["name"] = value 
+	sNTL_TS_SCR_VALUE&					operator=( const std::string& strNewValue );
+	sNTL_TS_SCR_VALUE&					operator=( const char* pNewValue );
+};
+
 
+/**
+	Script property table
+	hash table  symbol    flat 迭. ü ϳ property   Ƿ symbol   Ѵ
+	Clear ص slot   ξ,  table   ü   ڿ ۸ ٽ 
+*/
+
+
+class CNtlTSScrPropertyTable
+{
 // Member variables
+protected:
+	std::vector<sNTL_TS_SCR_VALUE>		m_defValue;
+	int									m_nCount;
+
+// Constructions and Destructions
+public:
+	CNtlTSScrPropertyTable( void ) : m_nCount( 0 ) { return; }
+
+// Methods
 public:
-	hashdef_PROPERTY					m_defProperty;
+	int									GetCount( void ) const;
+	const sNTL_TS_SCR_VALUE&			GetAt( int nIndex ) const;
+
+	//  -1
+	int									Find( unsigned int uiSymbol ) const;
+	int									Find( const char* pName ) const;
+
+	// ̹ ִ ̸̸  ʴ´ ( hash_map::insert   )
+	bool								Insert( const CNtlTSScrSymbolTable::sSYMBOL& sSymbol, const char* pValue, size_t nLength );
+
+	void								Erase( int nIndex );
+	void								Clear( void );
+
+// Operator
+public:
+	//    ߰Ѵ
+	sNTL_TS_SCR_VALUE&					operator[]( const std::string& strName );
+	sNTL_TS_SCR_VALUE&					operator[]( const char* pName );
+
+// Implementations
+protected:
+	sNTL_TS_SCR_VALUE&					Append( const CNtlTSScrSymbolTable::sSYMBOL& sSymbol );
+};
+
+
+/**
+	Script property
+*/
+
+
+class CNtlTSScrProperty
+{
+protected:
+	static const std::string			s_strBlank;
+
+// Member variables
+public:
+	CNtlTSScrPropertyTable				m_defProperty;
 
 // Constructions and Destructions
 public:
@@ -30,29 +156,45 @@ public:
 
 // Methods
 public:
-	PROP_IT								Begin( void );
-	PROP_IT								End( void );
-
-	PROP_CIT							Begin( void ) const;
-	PROP_CIT							End( void ) const;
+	//   Property   ´
+	// GetProperty  ִ reference  GetValue   property  ߰Ǹ ȿ ȴ
+	int									GetPropertyCount( void ) const;
+	const sNTL_TS_SCR_VALUE&			GetProperty( int nIndex ) const;
 
 	// ش Property  ϴ  ˻Ѵ.
 	bool								IsExist( const std::string& strPropertyName ) const;
+	bool								IsExist( const char* pPropertyName ) const;
+	bool								IsExist( const sNTL_TS_SCR_KEY& sKey ) const;
 
 	//  Property   Ѵ
 	int									GetCount( const std::string& strPropertyName ) const;
+	int									GetCount( const char* pPropertyName ) const;
 
 	// ش Property Name  ؼ Property Value ´
+	// ִ reference  m_defProperty  std::vector  ŰǷ property  ߰ǰų ( AddProperty, operator[] )  ȿ ȴ
+	//   ־ ϸ  д
 	const std::string&					GetValue( const std::string& strPropertyName, int nOffset = 0 ) const;
+	const std::string&					GetValue( const char* pPropertyName, int nOffset = 0 ) const;
+	const std::string&					GetValue( const sNTL_TS_SCR_KEY& sKey, int nOffset = 0 ) const;
 
 	// int  ش Property  ´
 	int									GetValueAsInt( const std::string& strPropertyName, int nOffset = 0 ) const;
+	int									GetValueAsInt( const char* pPropertyName, int nOffset = 0 ) const;
+	int									GetValueAsInt( const sNTL_TS_SCR_KEY& sKey, int nOffset = 0 ) const;
+
+	// float  ش Property  ´
+	float								GetValueAsFloat( const std::string& strPropertyName, int nOffset = 0 ) const;
+	float								GetValueAsFloat( const char* pPropertyName, int nOffset = 0 ) const;
+	float								GetValueAsFloat( const sNTL_TS_SCR_KEY& sKey, int nOffset = 0 ) const;
 
 	// bool ش Property  ´
 	bool								GetValueAsBool( const std::string& strPropertyName, int nOffset = 0 ) const;
+	bool								GetValueAsBool( const char* pPropertyName, int nOffset = 0 ) const;
+	bool								GetValueAsBool( const sNTL_TS_SCR_KEY& sKey, int nOffset = 0 ) const;
 
 	// Property ߰ Ѵ
 	void								AddProperty( const std::string& strPropertyName, const std::string& strPropertyValue );
+	void								AddProperty( const CNtlTSScrSymbolTable::sSYMBOL& sSymbol, const char* pPropertyValue );
 
 	// ش Property  Ѵ
 	void								RemoveProperty( const std::string& strPropertyName );
@@ -60,6 +202,11 @@ public:
 	//  Property Ѵ
 	void								Clear( void );
 
+// Implementations
+protected:
+	const sNTL_TS_SCR_VALUE*			FindValue( const char* pPropertyName, int nOffset ) const;
+	const sNTL_TS_SCR_VALUE*			FindValue( const sNTL_TS_SCR_KEY& sKey, int nOffset ) const;
+
 // Operator
 public:
 	const std::string& operator[] ( const std::string& strPropertyName ) const;
@@ -70,4 +217,3 @@ public:
 
 
 #endif
-
@@ -1,110 +1,205 @@
 
 
-/** 
-	Script property
+/**
+	Script property table
 */
 
 
-inline CNtlTSScrProperty::PROP_IT CNtlTSScrProperty::Begin( void )
+inline int CNtlTSScrPropertyTable::GetCount( void ) const
 {
-	return m_defProperty.begin();
+	return m_nCount;
+}
+
+inline const sNTL_TS_SCR_VALUE& CNtlTSScrPropertyTable::GetAt( int nIndex ) const
+{
+	return m_defValue[nIndex];
+}
+
+inline int CNtlTSScrPropertyTable::Find( unsigned int uiSymbol ) const
+{
+	for ( int i = 0; i < m_nCount; ++i )
+	{
+		if ( m_defValue[i].uiSymbol == uiSymbol ) return i;
+	}
+
+	return -1;
 }
 
-inline CNtlTSScrProperty::PROP_IT	CNtlTSScrProperty::End( void )
+inline int CNtlTSScrPropertyTable::Find( const char* pName ) const
 {
-	return m_defProperty.end();
+	//  ߿  ̸ symbol table  symbol  ã  symbol  Ѵ
+	unsigned int uiSymbol = CNtlTSScrSymbolTable::Find( pName ).uiSymbol;
+	if ( NTL_TS_SCR_INVALID_SYMBOL == uiSymbol ) return -1;
+
+	return Find( uiSymbol );
 }
 
-inline CNtlTSScrProperty::PROP_CIT CNtlTSScrProperty::Begin( void ) const
+inline void CNtlTSScrPropertyTable::Clear( void )
 {
-	return m_defProperty.begin();
+	m_nCount = 0;
 }
 
-inline CNtlTSScrProperty::PROP_CIT CNtlTSScrProperty::End( void ) const
+
+/**
+	Script property
+*/
+
+
+inline int CNtlTSScrProperty::GetPropertyCount( void ) const
 {
-	return m_defProperty.end();
+	return m_defProperty.GetCount();
+}
+
+inline const sNTL_TS_SCR_VALUE& CNtlTSScrProperty::GetProperty( int nIndex ) const
+{
+	return m_defProperty.GetAt( nIndex );
 }
 
 inline bool CNtlTSScrProperty::IsExist( const std::string& strPropertyName ) const
 {
-	return ( m_defProperty.find( strPropertyName ) != m_defProperty.end() );
+	return ( m_defProperty.Find( strPropertyName.c_str() ) != -1 );
+}
+
+inline bool CNtlTSScrProperty::IsExist( const char* pPropertyName ) const
+{
+	return ( m_defProperty.Find( pPropertyName ) != -1 );
+}
+
+inline bool CNtlTSScrProperty::IsExist( const sNTL_TS_SCR_KEY& sKey ) const
+{
+	return ( m_defProperty.Find( sKey.uiSymbol ) != -1 );
 }
 
 inline int CNtlTSScrProperty::GetCount( const std::string& strPropertyName ) const
 {
-	return (int)m_defProperty.count( strPropertyName );
+	return IsExist( strPropertyName ) ? 1 : 0;
 }
 
-inline const std::string& CNtlTSScrProperty::GetValue( const std::string& strPropertyName, int nOffset ) const
-{ 
-	static const std::string strBlank;
+inline int CNtlTSScrProperty::GetCount( const char* pPropertyName ) const
+{
+	return IsExist( pPropertyName ) ? 1 : 0;
+}
+
+inline const sNTL_TS_SCR_VALUE* CNtlTSScrProperty::FindValue( const char* pPropertyName, int nOffset ) const
+{
+	return FindValue( CNtlTSScrSymbolTable::GetKey( pPropertyName ), nOffset );
+}
 
-	PROP_CIT cIt = m_defProperty.find( strPropertyName );
+inline const sNTL_TS_SCR_VALUE* CNtlTSScrProperty::FindValue( const sNTL_TS_SCR_KEY& sKey, int nOffset ) const
+{
+	int nIndex = m_defProperty.Find( sKey.uiSymbol );
 
-	if ( cIt == m_defProperty.end() )
+	if ( -1 == nIndex )
 	{
-		CNtlTSLog::Log( "Can not seek this property name. Info[%s]. [%s]", strPropertyName.c_str(), TS_CODE_TRACE() );
-		return strBlank;
+		CNtlTSLog::Log( "Can not seek this property name. Info[%s]. [%s]", sKey.pName, TS_CODE_TRACE() );
+		return 0;
 	}
 
-	for ( ; nOffset > 0; --nOffset )
+	nIndex += nOffset;
+
+	if ( nIndex >= m_defProperty.GetCount() )
 	{
-		++cIt;
-		if ( cIt == m_defProperty.end() )
-		{
-			CNtlTSLog::Log( "Can not seek this entity property. Info[%s]. [%s]", strPropertyName.c_str(), TS_CODE_TRACE() );
-			return strBlank;
-		}
+		CNtlTSLog::Log( "Can not seek this entity property. Info[%s]. [%s]", sKey.pName, TS_CODE_TRACE() );
+		return 0;
 	}
 
-	return (*cIt).second; 
+	return &m_defProperty.GetAt( nIndex );
+}
+
+inline const std::string& CNtlTSScrProperty::GetValue( const std::string& strPropertyName, int nOffset ) const
+{
+	const sNTL_TS_SCR_VALUE* pValue = FindValue( strPropertyName.c_str(), nOffset );
+	return pValue ? pValue->strValue : s_strBlank;
+}
+
+inline const std::string& CNtlTSScrProperty::GetValue( const char* pPropertyName, int nOffset ) const
+{
+	const sNTL_TS_SCR_VALUE* pValue = FindValue( pPropertyName, nOffset );
+	return pValue ? pValue->strValue : s_strBlank;
+}
+
+inline const std::string& CNtlTSScrProperty::GetValue( const sNTL_TS_SCR_KEY& sKey, int nOffset ) const
+{
+	const sNTL_TS_SCR_VALUE* pValue = FindValue( sKey, nOffset );
+	return pValue ? pValue->strValue : s_strBlank;
 }
 
 inline int CNtlTSScrProperty::GetValueAsInt( const std::string& strPropertyName, int nOffset ) const
 {
-	const std::string& val = GetValue( strPropertyName, nOffset );
-	return atoi( val.c_str() );
+	const sNTL_TS_SCR_VALUE* pValue = FindValue( strPropertyName.c_str(), nOffset );
+	return pValue ? pValue->nValue : 0;
+}
+
+inline int CNtlTSScrProperty::GetValueAsInt( const char* pPropertyName, int nOffset ) const
+{
+	const sNTL_TS_SCR_VALUE* pValue = FindValue( pPropertyName, nOffset );
+	return pValue ? pValue->nValue : 0;
 }
 
+inline int CNtlTSScrProperty::GetValueAsInt( const sNTL_TS_SCR_KEY& sKey, int nOffset ) const
+{
+	const sNTL_TS_SCR_VALUE* pValue = FindValue( sKey, nOffset );
+	return pValue ? pValue->nValue : 0;
+}
+
+inline float CNtlTSScrProperty::GetValueAsFloat( const std::string& strPropertyName, int nOffset ) const
+{
+	const sNTL_TS_SCR_VALUE* pValue = FindValue( strPropertyName.c_str(), nOffset );
+	return pValue ? pValue->fValue : 0.f;
+}
+
+inline float CNtlTSScrProperty::GetValueAsFloat( const char* pPropertyName, int nOffset ) const
+{
+	const sNTL_TS_SCR_VALUE* pValue = FindValue( pPropertyName, nOffset );
+	return pValue ? pValue->fValue : 0.f;
+}
+
+inline float CNtlTSScrProperty::GetValueAsFloat( const sNTL_TS_SCR_KEY& sKey, int nOffset ) const
+{
+	const sNTL_TS_SCR_VALUE* pValue = FindValue( sKey, nOffset );
+	return pValue ? pValue->fValue : 0.f;
+}
 
 inline bool CNtlTSScrProperty::GetValueAsBool( const std::string& strPropertyName, int nOffset ) const
 {
-	const std::string &val = GetValue( strPropertyName, nOffset );
+	const sNTL_TS_SCR_VALUE* pValue = FindValue( strPropertyName.c_str(), nOffset );
+	return pValue ? pValue->bValue : false;
+}
 
-	if ( val == "yes" || val == "true" || val == "on" || val == "1" )
-	{
-		return true;
-	}
-	else if ( val == "no" || val == "false" || val == "off" || val == "0" )
-	{
-		return false;
-	}
+inline bool CNtlTSScrProperty::GetValueAsBool( const char* pPropertyName, int nOffset ) const
+{
+	const sNTL_TS_SCR_VALUE* pValue = FindValue( pPropertyName, nOffset );
+	return pValue ? pValue->bValue : false;
+}
 
-	return false;
+inline bool CNtlTSScrProperty::GetValueAsBool( const sNTL_TS_SCR_KEY& sKey, int nOffset ) const
+{
+	const sNTL_TS_SCR_VALUE* pValue = FindValue( sKey, nOffset );
+	return pValue ? pValue->bValue : false;
 }
 
 inline void CNtlTSScrProperty::AddProperty( const std::string& strPropertyName, const std::string& strPropertyValue )
 {
-	m_defProperty.insert( hashdef_PROPERTY::value_type( strPropertyName, strPropertyValue ) );
+	m_defProperty.Insert( CNtlTSScrSymbolTable::Intern( strPropertyName.c_str() ), strPropertyValue.c_str(), strPropertyValue.size() );
+}
+
+inline void CNtlTSScrProperty::AddProperty( const CNtlTSScrSymbolTable::sSYMBOL& sSymbol, const char* pPropertyValue )
+{
+	m_defProperty.Insert( sSymbol, pPropertyValue, strlen( pPropertyValue ) );
 }
 
 inline void CNtlTSScrProperty::RemoveProperty( const std::string& strPropertyName )
 {
-	PROP_IT it = m_defProperty.find( strPropertyName );
-	while ( it != m_defProperty.end() )
+	int nIndex = m_defProperty.Find( strPropertyName.c_str() );
+	if ( -1 != nIndex )
 	{
-		if ( it->first != strPropertyName ) break;
-
-		PROP_IT it2 = it;
-		++it;
-
-		m_defProperty.erase( it2 );
+		m_defProperty.Erase( nIndex );
 	}
 }
 
 inline void CNtlTSScrProperty::Clear( void )
 {
-	m_defProperty.clear();
+	m_defProperty.Clear();
 }
 
 inline const std::string& CNtlTSScrProperty::operator[]( const std::string& strPropertyName ) const
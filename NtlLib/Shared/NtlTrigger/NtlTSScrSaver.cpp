@@ -160,30 +160,30 @@ bool CNtlTSScrSaver::WriteObj( FILE* pFile, sOBJ_INFO* pstObjInfo, int nDepth )
 	fprintf_s( pFile, "%s%s\n", strTab.c_str(), pstObjInfo->pObj->GetClassName() );
 	fprintf_s( pFile, "%s{\n", strTab.c_str() );
 
-	CNtlTSScrProperty::PROP_CIT cit = pstObjInfo->Property.Begin();
-	CNtlTSScrProperty::PROP_CIT citEnd = pstObjInfo->Property.End();
-	for ( ; cit != citEnd; ++cit )
+	for ( int nProp = 0; nProp < pstObjInfo->Property.GetPropertyCount(); ++nProp )
 	{
-		switch ( pstObjInfo->pObjType->GetPropertyType( cit->first.c_str() ) )
+		const sNTL_TS_SCR_VALUE& sValue = pstObjInfo->Property.GetProperty( nProp );
+
+		switch ( pstObjInfo->pObjType->GetPropertyType( sValue.GetName() ) )
 		{
 		case CNtlTSScrFactoryType::sPROPERTY_TYPE::eDATA_TYPE_BOOL:
 			{
-				fprintf_s( pFile, "%s\t%s = %s;\n", strTab.c_str(), cit->first.c_str(), cit->second.c_str() );
+				fprintf_s( pFile, "%s\t%s = %s;\n", strTab.c_str(), sValue.GetName().c_str(), sValue.strValue.c_str() );
 			}
 			break;
 		case CNtlTSScrFactoryType::sPROPERTY_TYPE::eDATA_TYPE_NUMBER:
 			{
-				unsigned int uiVal = atoi( cit->second.c_str() );
-				fprintf_s( pFile, "%s\t%s = %d;\n", strTab.c_str(), cit->first.c_str(), uiVal );
+				unsigned int uiVal = sValue.nValue;
+				fprintf_s( pFile, "%s\t%s = %d;\n", strTab.c_str(), sValue.GetName().c_str(), uiVal );
 			}
 			break;
 		case CNtlTSScrFactoryType::sPROPERTY_TYPE::eDATA_TYPE_STRING:
 			{
-				fprintf_s( pFile, "%s\t%s = \"%s\";\n", strTab.c_str(), cit->first.c_str(), cit->second.c_str() );
+				fprintf_s( pFile, "%s\t%s = \"%s\";\n", strTab.c_str(), sValue.GetName().c_str(), sValue.strValue.c_str() );
 			}
 			break;
 		default:
-			CNtlTSLog::Log( "Can not find the matching property type. Info[%s]. [%s]", cit->first.c_str(), TS_CODE_TRACE() );
+			CNtlTSLog::Log( "Can not find the matching property type. Info[%s]. [%s]", sValue.GetName().c_str(), TS_CODE_TRACE() );
 			return false;
 		}
 	}
@@ -157,25 +157,25 @@ void CNtlTSTrigger::ApplyScriptDataForScript( const CNtlTSScrProperty& clPropert
 {
 	CNtlTSEntity::ApplyScriptDataForScript( clProperty );
 
-	if ( clProperty.IsExist( "tid" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "tid" ) ) )
 	{
-		SetID( (NTL_TS_T_ID)clProperty.GetValueAsInt( "tid" ) );
+		SetID( (NTL_TS_T_ID)clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "tid" ) ) );
 	}
-	if ( clProperty.IsExist( "rq" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "rq" ) ) )
 	{
-		SetRepeatQuest( clProperty.GetValueAsInt( "rq" ) ? true : false );
+		SetRepeatQuest( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "rq" ) ) ? true : false );
 	}
-	if ( clProperty.IsExist( "sq" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "sq" ) ) )
 	{
-		SetShareQuest( clProperty.GetValueAsInt( "sq" ) ? true : false );
+		SetShareQuest( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "sq" ) ) ? true : false );
 	}
-	if ( clProperty.IsExist( "sm" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "sm" ) ) )
 	{
-		SetOutStateMsg( clProperty.GetValueAsInt( "sm" ) ? true : false );
+		SetOutStateMsg( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "sm" ) ) ? true : false );
 	}
-	if ( clProperty.IsExist( "title" ) )
+	if ( clProperty.IsExist( NTL_TS_SCR_KEY( "title" ) ) )
 	{
-		SetTitle( clProperty.GetValueAsInt( "title" ) );
+		SetTitle( clProperty.GetValueAsInt( NTL_TS_SCR_KEY( "title" ) ) );
 	}
 }
 
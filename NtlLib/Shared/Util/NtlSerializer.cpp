@@ -10,6 +10,7 @@ CNtlSerializer::CNtlSerializer()
 	m_iEndPointer	= 0;
 	m_iGlowSize		= NTL_SERIALIZER_GROW_SIZE;
 	m_pBuffer		= NULL;
+	m_bExternal		= false;
 
 	Allocate();
 }
@@ -22,6 +23,8 @@ CNtlSerializer::CNtlSerializer(int iBufferSize, int iGlowSize)
 	m_iGlowSize		= iGlowSize;
 	if(m_iGlowSize <= 0)
 		m_iGlowSize = iBufferSize;
+	m_pBuffer		= NULL;
+	m_bExternal		= false;
 
 	Allocate();
 }
@@ -46,6 +49,12 @@ CNtlSerializer& CNtlSerializer::operator = (const CNtlSerializer& s)
 	m_iStartPointer	= iStartPointer;
 	m_iEndPointer	= iEndPointer;
 
+	// A copy always owns its buffer, even if s was attached.
+	if(m_iGlowSize <= 0)
+		m_iGlowSize = NTL_SERIALIZER_GROW_SIZE;
+	if(m_iCurrSize <= m_iEndPointer)
+		m_iCurrSize = (m_iEndPointer / m_iGlowSize + 1) * m_iGlowSize;
+
 	Allocate();
 
 	memcpy(m_pBuffer, pData, m_iEndPointer);
@@ -63,9 +72,36 @@ void CNtlSerializer::Dellocate(void)
 {
 	if(m_pBuffer)
 	{
-		delete [] m_pBuffer;
+		if(false == m_bExternal)
+			delete [] m_pBuffer;
+
 		m_pBuffer = NULL;
 	}
+
+	m_bExternal = false;
+}
+
+//-----------------------------------------------------------------------------------
+//		Purpose	: Moves the data into a new owned buffer of iNewSize bytes.
+//				  Only the part past the data is cleared.
+//		Return	:
+//-----------------------------------------------------------------------------------
+bool CNtlSerializer::Reallocate(int iNewSize)
+{
+	if(iNewSize < m_iEndPointer)
+		return false;
+
+	char *pTemp = new char [iNewSize];
+	if(m_iEndPointer > 0)
+		memcpy(pTemp, m_pBuffer, m_iEndPointer);
+	memset(pTemp + m_iEndPointer, 0, iNewSize - m_iEndPointer);
+
+	Dellocate();
+
+	m_pBuffer	= pTemp;
+	m_iCurrSize	= iNewSize;
+
+	return true;
 }
 
 bool CNtlSerializer::CheckInBuffer(int iSize)
@@ -80,23 +116,60 @@ bool CNtlSerializer::CheckInBuffer(int iSize)
 
 	if(m_iCurrSize <= m_iEndPointer + iSize)
 	{
-		m_iCurrSize = ((m_iEndPointer + iSize - 1) / m_iGlowSize + 1) * m_iGlowSize;
-		char *pTemp = new char [m_iCurrSize];
-		memset(pTemp, 0, m_iCurrSize);
-		memcpy(pTemp, m_pBuffer, m_iEndPointer);
+		// Grow geometrically so a stream built from many small writes is copied O(log n)
+		// times instead of once every m_iGlowSize bytes.
+		int iNewSize = m_iCurrSize * 2;
+		if(iNewSize <= m_iEndPointer + iSize)
+			iNewSize = m_iEndPointer + iSize;
 
-		if(m_pBuffer)
-		{
-			delete [] m_pBuffer;
-			m_pBuffer = NULL;
-		}
+		return Reallocate((iNewSize / m_iGlowSize + 1) * m_iGlowSize);
+	}
 
-		m_pBuffer = pTemp;
+	if(m_bExternal)
+	{
+		// An attached buffer is read-only, so the first write copies it.
+		return Reallocate(m_iCurrSize);
 	}
 
 	return true;
 }
 
+//-----------------------------------------------------------------------------------
+//		Purpose	: Makes room for iSize more bytes with a single allocation.
+//		Return	:
+//-----------------------------------------------------------------------------------
+bool CNtlSerializer::Reserve(int iSize)
+{
+	if(m_pBuffer == NULL || iSize < 0)
+		return false;
+
+	if(m_iCurrSize <= m_iEndPointer + iSize)
+		return Reallocate(((m_iEndPointer + iSize) / m_iGlowSize + 1) * m_iGlowSize);
+
+	return true;
+}
+
+//-----------------------------------------------------------------------------------
+//		Purpose	: Reads pData in place. The data isn't copied until something is written.
+//		Return	:
+//-----------------------------------------------------------------------------------
+void CNtlSerializer::Attach(const void *pData, int iSize)
+{
+	if(pData == NULL || iSize <= 0)
+	{
+		Refresh();
+		return;
+	}
+
+	Dellocate();
+
+	m_pBuffer		= (char*)pData;
+	m_bExternal		= true;
+	m_iCurrSize		= iSize;
+	m_iStartPointer	= 0;
+	m_iEndPointer	= iSize;
+}
+
 bool CNtlSerializer::CheckOutBuffer(int iSize)
 {
 	if(m_pBuffer == NULL)
@@ -561,6 +634,45 @@ CNtlSerializer&	CNtlSerializer::Out(CNtlSerializer& s, int iSize)
 	return *this;
 }
 
+const char* CNtlSerializer::Peek(int iSize) const
+{
+	if(m_pBuffer == NULL || iSize < 0)
+		return NULL;
+
+	if(m_iEndPointer - m_iStartPointer < iSize)
+		return NULL;
+
+	return &m_pBuffer[m_iStartPointer];
+}
+
+const char* CNtlSerializer::OutView(int iSize)
+{
+	const char *pData = Peek(iSize);
+	if(pData == NULL)
+	{
+		m_iStartPointer = m_iEndPointer;
+		return NULL;
+	}
+
+	m_iStartPointer += iSize;
+
+	return pData;
+}
+
+CNtlSerializer& CNtlSerializer::OutView(CNtlSerializer& s, int iSize)
+{
+	if(iSize == 0)
+		return *this;
+
+	const char *pData = OutView(iSize);
+	if(pData == NULL)
+		return *this;
+
+	s.Attach(pData, iSize);
+
+	return *this;
+}
+
 void CNtlSerializer::IncrementEndPointer(int nSize)
 {
 	if(nSize <= 0)
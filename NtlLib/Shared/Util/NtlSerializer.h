@@ -24,11 +24,13 @@ protected:
 	int				m_iStartPointer;	/** data start pointer */
 	int				m_iEndPointer;		/** data end pointer */
 	int				m_iGlowSize;		/** data glow size */
+	bool			m_bExternal;		/** m_pBuffer is borrowed through Attach() and is read-only */
 
 protected:
 
 	void Allocate(void);
 	void Dellocate(void);	
+	bool Reallocate(int iNewSize);
 
 public:
 
@@ -42,11 +44,26 @@ public:
 
 	void			Refresh(void);    
 
+	// Makes room for iSize more bytes in one reallocation.
+	bool			Reserve(int iSize);
+
+	// Reads pData in place instead of copying it. The caller keeps pData alive while the
+	// serializer uses it; the first write copies the data into an owned buffer.
+	void			Attach(const void *pData, int iSize);
+	bool			IsExternal(void) const;
+
 	CNtlSerializer&	In(const void *pData, int iSize);
 	CNtlSerializer& Format(const char *pData /*= NULL*/, ...);
 	CNtlSerializer&	Out(void *pData, int uiSize);
 	CNtlSerializer&	Out(CNtlSerializer& s, int uiSize);
 
+	// Zero-copy reads. Peek() doesn't move the read pointer, OutView() does.
+	// The pointers are valid until the next write to this serializer.
+	const char*		Peek(int iSize) const;
+	const char*		OutView(int iSize);
+	// s borrows the bytes instead of copying them, so it must not outlive this serializer.
+	CNtlSerializer&	OutView(CNtlSerializer& s, int iSize);
+
 	void			IncrementEndPointer(int nSize);
 
 	CNtlSerializer& operator << (char chData);
@@ -119,4 +136,9 @@ inline const char* CNtlSerializer::GetData(void) const
 	return m_pBuffer; 
 }
 
+inline bool CNtlSerializer::IsExternal(void) const
+{
+	return m_bExternal;
+}
+
 #endif
@@ -559,3 +559,27 @@ bool CNtlUnzip::GotoFile( int nFile )
 
 	return true;
 }
+
+bool CNtlUnzip::GetFilePos( sUZ_FILEPOS& sPos )
+{
+	if ( !m_hZipFile ) return false;
+
+	unz_file_pos sFilePos;
+	if ( unzGetFilePos( m_hZipFile, &sFilePos ) != UNZ_OK ) return false;
+
+	sPos.dwPosInZipDir = sFilePos.pos_in_zip_directory;
+	sPos.dwNumFile = sFilePos.num_of_file;
+
+	return true;
+}
+
+bool CNtlUnzip::GotoFilePos( const sUZ_FILEPOS& sPos )
+{
+	if ( !m_hZipFile ) return false;
+
+	unz_file_pos sFilePos;
+	sFilePos.pos_in_zip_directory = sPos.dwPosInZipDir;
+	sFilePos.num_of_file = sPos.dwNumFile;
+
+	return unzGoToFilePos( m_hZipFile, &sFilePos ) == UNZ_OK;
+}
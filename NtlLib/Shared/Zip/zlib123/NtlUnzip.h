@@ -33,6 +33,13 @@ struct sUZ_FILEINFO
 	bool								bFolder;
 };
 
+// central directory  ġ. ̸ ٽ ã ʰ ٷ ̵  
+struct sUZ_FILEPOS
+{
+	DWORD								dwPosInZipDir;
+	DWORD								dwNumFile;
+};
+
 
 class ZEXPORT CNtlUnzip  
 {
@@ -93,6 +100,9 @@ public:
 	bool								GotoFile( const char* szFileName, bool bIgnoreFilePath = true );
 	bool								GotoFile( int nFile );
 
+	bool								GetFilePos( sUZ_FILEPOS& sPos );
+	bool								GotoFilePos( const sUZ_FILEPOS& sPos );
+
 	bool								GotoFirstFile( const char* szExt = 0 );
 	bool								GotoNextFile( const char* szExt = 0 );
 };